@@ -6,10 +6,60 @@
 #ifndef ETHER_SYNTH_BRIDGE_H
 #define ETHER_SYNTH_BRIDGE_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Batched UI state. The audio callback publishes one snapshot per callback
+// (when anything in it changed) and the UI copies the newest one with a
+// single ether_read_snapshot() call instead of one getter per value.
+#define ETHER_SNAPSHOT_VERSION 1
+#define ETHER_SNAPSHOT_SLOTS 16
+#define ETHER_SNAPSHOT_PARAMS 32     // Room for every ParameterID
+#define ETHER_SNAPSHOT_LFOS 8
+#define ETHER_SNAPSHOT_SENDS 2       // 0 = reverb, 1 = delay
+
+// Fields are ordered so the struct has no padding: snapshots compare bytewise.
+typedef struct EtherStateSnapshot {
+    uint32_t version;                // ETHER_SNAPSHOT_VERSION of the layout below
+    uint32_t size;                   // sizeof(EtherStateSnapshot)
+    uint64_t sequence;               // Bumped when anything changed; 0 = nothing published yet
+    uint64_t stateSequence;          // Bumped only when the state section changed
+
+    // Live section: moves continuously while audio runs
+    uint64_t playheadFrames;         // Frames rendered since play started, 0 while stopped
+    uint32_t blockFrames;            // Frames in the last audio callback
+    float peakLeft, peakRight;       // Linear, ~300 ms release
+    float rmsLeft, rmsRight;         // Linear, ~300 ms average
+    float cpuUsage;                  // Percent of the callback period
+    int32_t activeVoices;
+    uint32_t voiceSteals;
+    float sceneMorphPosition;
+    int32_t activeVoiceCount[ETHER_SNAPSHOT_SLOTS];
+    float slotCpuPct[ETHER_SNAPSHOT_SLOTS];
+    float lfoValues[ETHER_SNAPSHOT_SLOTS][ETHER_SNAPSHOT_LFOS];
+
+    // State section: changes on edits (parameters, engines, sends, transport)
+    float bpm;
+    float sampleRate;
+    float masterVolume;
+    int32_t playing;
+    int32_t recording;
+    int32_t activeInstrument;
+    int32_t voiceLimit;
+    int32_t engineType[ETHER_SNAPSHOT_SLOTS];       // -1 = empty slot
+    float params[ETHER_SNAPSHOT_SLOTS][ETHER_SNAPSHOT_PARAMS];   // As ether_get_instrument_parameter
+    float fxSends[ETHER_SNAPSHOT_SLOTS][ETHER_SNAPSHOT_SENDS];
+} EtherStateSnapshot;
+
+// UI thread (one reader): copy the newest snapshot into *out and return its
+// sequence. When out->sequence already holds that sequence nothing is copied,
+// so comparing the result with the previous one skips unchanged frames, and
+// an unchanged stateSequence skips rebuilding parameter views.
+uint64_t ether_read_snapshot(void* engine, EtherStateSnapshot* out);
+
 // Core engine management
 void* ether_create(void);
 int ether_initialize(void* engine);
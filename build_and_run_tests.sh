@@ -13,6 +13,22 @@ g++ $CXXFLAGS $INCLUDES -o test_parameter_routing \
     src/engines/*.o \
     src/synthesis/SynthEngine_minimal.o \
     harmonized_13_engines_bridge.o \
+    src/audio/RenderWorkerPool.o \
+    src/audio/EngineCrossfader.o \
+    src/audio/VoiceManager.o \
+    src/audio/WavetableBank.o \
+    src/audio/FFT.o \
+    src/audio/AdditiveOscillatorBank.o \
+    src/audio/PerformanceTelemetry.o \
+    src/audio/OversamplingProcessor.o \
+    src/audio/AuxBusMixer.o \
+    src/audio/ChannelStripBank.o \
+    src/audio/OfflineRenderer.o \
+    src/audio/SceneMorphEngine.o \
+    src/audio/ModalResonatorBank.o \
+    src/processing/effects/ReverbEffect.o \
+    src/processing/effects/DelayEffect.o \
+    src/modulation/GlobalLFOSystem.o \
     $LIBS
 
 if [ $? -eq 0 ]; then
@@ -78,6 +78,8 @@ const char* getDisplayName(const char* technicalName);
 #include <portaudio.h>
 #include <lo/lo.h>
 #include "src/core/Types.h"
+#include "src/audio/OfflineRenderer.h"
+#include "src/sequencer/LiveNoteInbox.h"
 
 // Forward declarations for real bridge functions
 extern "C" {
@@ -117,6 +119,10 @@ extern "C" {
     void ether_set_fx_global(void* synth, int which, int param, float value);
     float ether_get_fx_global(void* synth, int which, int param);
     float ether_get_bpm(void* synth);
+    float ether_get_sample_rate(void* synth);
+    // Offline bounce (format: 0 = 16-bit, 1 = 24-bit, 2 = float)
+    int ether_render_offline(void* synth, const char* path, const OfflineRenderer::Event* events, int eventCount,
+                             uint64_t frames, int format);
     int ether_get_parameter_lfo_info(void* synth, int instrument, int keyIndex, int* activeLFOs, float* currentValue);
     // LFO bridge
     // LFO controls (use active instrument internally)
@@ -185,6 +191,11 @@ const std::vector<int> minorScale = {
     48, 50, 51, 53, 55, 56, 58, 59, 60, 62, 63, 65, 67, 68, 70, 72
 };
 
+// Notes for the audio callback: pads from the OSC thread, drums from the play thread
+LiveNoteInbox g_padNotes;
+LiveNoteInbox g_sequencerNotes;
+std::atomic<bool> g_allNotesOffRequested{false};   // Transport stop, applied by the audio callback
+
 // Grid OSC variables
 lo_server_thread grid_server = nullptr;
 lo_address grid_addr = nullptr;
@@ -660,9 +671,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     drumMasks[padIdx] |= (1u << currentStep);
                     drumPreviewStep[padIdx] = currentStep.load();
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.9f;
-                    ether_note_on(etherEngine, DRUM_PAD_NOTES[padIdx], vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, DRUM_PAD_NOTES[padIdx], vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     return 0;
                 } else {
@@ -673,9 +683,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     enginePatterns[engine][currentStep].note = liveNote;
                     melodicPreviewStep[engine] = currentStep.load();
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.8f;
-                    ether_note_on(etherEngine, liveNote, vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, liveNote, vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     return 0;
                 }
@@ -719,13 +728,11 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                         // Jump the terminal menu to the drum pad editor row
                         selectedParamIndex = (int)uiParams.size()+1;
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
                         float vel = accentLatch ? 1.0f : 0.9f;
-                        ether_note_on(etherEngine, note, vel, 0.0f);
+                        g_padNotes.postNoteOn(slot, note, vel);
                     } else if (state == 0) {
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
-                        ether_note_off(etherEngine, note);
+                        g_padNotes.postNoteOff(slot, note);
                     }
                     return 0;
                 }
@@ -749,9 +756,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                 if (state == 1) {
                     lastLiveNote = liveNote;
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.8f;
-                    ether_note_on(etherEngine, liveNote, vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, liveNote, vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     liveHeldNoteByPad[padIdx] = liveNote;
                     return 0;
@@ -759,8 +765,7 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     int held = liveHeldNoteByPad[padIdx];
                     if (held >= 0) {
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
-                        ether_note_off(etherEngine, held);
+                        g_padNotes.postNoteOff(slot, held);
                         liveHeldNoteByPad[padIdx] = -1;
                     }
                     return 0;
@@ -789,16 +794,14 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
             if (state == 1) {
                 lastLiveNote = note;
                 int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                ether_set_active_instrument(etherEngine, slot);
-                ether_note_on(etherEngine, note, 0.8f, 0.0f);
+                g_padNotes.postNoteOn(slot, note, 0.8f);
                 ether_trigger_instrument_lfos(etherEngine, slot);
                 liveHeldNoteByPad[padIdx] = note;
             } else if (state == 0) {
                 int held = liveHeldNoteByPad[padIdx];
                 if (held >= 0) {
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
-                    ether_note_off(etherEngine, held);
+                    g_padNotes.postNoteOff(slot, held);
                     liveHeldNoteByPad[padIdx] = -1;
                 }
             }
@@ -963,6 +966,17 @@ int audioCallback(const void* /*inputBuffer*/, void* outputBuffer,
         out[i] = 0.0f;
     }
     
+    // Notes posted by the OSC and play threads since the last block
+    if (g_allNotesOffRequested.exchange(false)) ether_all_notes_off(etherEngine);
+    LiveNote live;
+    for (LiveNoteInbox* inbox : {&g_padNotes, &g_sequencerNotes}) {
+        while (inbox->pop(live)) {
+            ether_set_active_instrument(etherEngine, live.slot);
+            if (live.on) ether_note_on(etherEngine, live.note, live.velocity, 0.0f);
+            else ether_note_off(etherEngine, live.note);
+        }
+    }
+    
     for (int engine = 0; engine < MAX_ENGINES; engine++) {
         for (int step = 0; step < 16; step++) {
             if (stepTrigger[engine][step].exchange(false)) {
@@ -993,6 +1007,45 @@ int audioCallback(const void* /*inputBuffer*/, void* outputBuffer,
     return paContinue;
 }
 
+// Offline bounce: the pattern played `loops` times in play-all mode, with note
+// ons/offs on exact sample frames instead of sleep-timed steps, rendered as fast
+// as the CPU allows. The live stream keeps running but outputs silence meanwhile.
+bool bouncePatternOffline(const std::string& path, int loops) {
+    if (!etherEngine || loops <= 0) return false;
+    const double sampleRate = ether_get_sample_rate(etherEngine);
+    const double stepFrames = sampleRate * 60.0 / ether_get_bpm(etherEngine) / 4.0;
+    auto frameAt = [&](double steps) { return (uint64_t)std::llround(steps * stepFrames); };
+    std::vector<OfflineRenderer::Event> events;
+    for (int loop = 0; loop < loops; ++loop) {
+        for (int step = 0; step < 16; ++step) {
+            const double at = loop * 16.0 + step;
+            for (int slot = 0; slot < 16; ++slot) {
+                int row = slotToRow[slot];
+                if (row < 0 || rowMuted[row] || (soloEngine >= 0 && row != soloEngine)) continue;
+                if (ether_get_instrument_engine_type(etherEngine, slot) == static_cast<int>(EngineType::DRUM_KIT)) {
+                    bool chNow = ((drumMasks[8] >> step) & 1u) || ((drumMasks[9] >> step) & 1u);
+                    for (int pad = 0; pad < 16; ++pad) {
+                        if (!((drumMasks[pad] >> step) & 1u)) continue;
+                        if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
+                        events.push_back({frameAt(at), OfflineRenderer::NOTE_ON, slot, DRUM_PAD_NOTES[pad],
+                                          accentLatch ? 1.0f : 0.9f});
+                    }
+                } else if (enginePatterns[row][step].active) {
+                    const StepData& data = enginePatterns[row][step];
+                    auto release = engineParameters[row].find(static_cast<int>(ParameterID::RELEASE));
+                    float releaseParam = release != engineParameters[row].end() ? release->second : 0.0f;
+                    events.push_back({frameAt(at), OfflineRenderer::NOTE_ON, slot, data.note, data.velocity});
+                    events.push_back({frameAt(at + 0.1 + releaseParam * 0.8), OfflineRenderer::NOTE_OFF, slot, data.note, 0.0f});
+                }
+            }
+        }
+    }
+    // Two seconds of tail for releases, reverb and delay
+    const uint64_t frames = frameAt(loops * 16.0) + (uint64_t)(sampleRate * 2.0);
+    std::cout << "Bouncing " << loops << " loops to " << path << "..." << std::endl;
+    return ether_render_offline(etherEngine, path.c_str(), events.data(), (int)events.size(), frames, 1) != 0;
+}
+
 class GridSequencer {
 private:
     PaStream* stream = nullptr;
@@ -1573,6 +1626,7 @@ void GridSequencer::run() {
         if (c == 'w' || c == 'W') { writeMode = !writeMode.load(); }
         if (c == 'c' || c == 'C') { reqClear = true; }
         if (c == 'a' || c == 'A') { playAllEngines = !playAllEngines.load(); }
+        if (c == 'b' || c == 'B') { bouncePatternOffline("ether_bounce.wav", 8); }
         if (c == '[') { if (--selectedLFOIndex < 0) selectedLFOIndex = 0; }
         if (c == ']') { if (++selectedLFOIndex > 7) selectedLFOIndex = 7; }
         if (c == 'L') { showLFOAssign = !showLFOAssign; if (showLFOAssign && selectedParamIndex < (int)visibleParams.size()) { int activeMask = 0; float cur = 0.0f; int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0; ParameterID pid = visibleParams[selectedParamIndex]; ether_get_parameter_lfo_info(etherEngine, slot, static_cast<int>(pid), &activeMask, &cur); lfoAssignMask = static_cast<uint32_t>(activeMask); lfoAssignCursor = 0; } }
@@ -1721,7 +1775,6 @@ void GridSequencer::play() {
                     // Trigger any drum whose bit at currentStep is set; let engine manage decay
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
                     if (!(soloEngine>=0 && currentEngineRow!=soloEngine) && !rowMuted[currentEngineRow]) {
-                        ether_set_active_instrument(etherEngine, slot);
                         bool chNow = ((drumMasks[8] >> currentStep) & 1u) || ((drumMasks[9] >> currentStep) & 1u);
                         for (int pad = 0; pad < 16; ++pad) {
                             if ((drumMasks[pad] >> currentStep) & 1u) {
@@ -1730,7 +1783,7 @@ void GridSequencer::play() {
                                 if (prev == currentStep) { drumPreviewStep[pad] = -1; continue; }
                                 if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
                                 float vel = accentLatch ? 1.0f : 0.9f;
-                                ether_note_on(etherEngine, DRUM_PAD_NOTES[pad], vel, 0.0f);
+                                g_sequencerNotes.postNoteOn(slot, DRUM_PAD_NOTES[pad], vel);
                             }
                         }
                     }
@@ -1743,7 +1796,6 @@ void GridSequencer::play() {
                             if (rowMuted[row]) continue;
                             
                             int slot = rowToSlot[row]; if (slot < 0) slot = 0;
-                            ether_set_active_instrument(etherEngine, slot);
                             bool isDrum = isEngineDrum(row);
                             
                             if (isDrum) {
@@ -1755,7 +1807,7 @@ void GridSequencer::play() {
                                         if (prev == currentStep) { drumPreviewStep[pad] = -1; continue; }
                                         if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
                                         float vel = accentLatch ? 1.0f : 0.9f;
-                                        ether_note_on(etherEngine, DRUM_PAD_NOTES[pad], vel, 0.0f);
+                                        g_sequencerNotes.postNoteOn(slot, DRUM_PAD_NOTES[pad], vel);
                                     }
                                 }
                             } else {
@@ -1821,8 +1873,8 @@ void GridSequencer::stop() {
     if (playing) { 
         std::cout << "[DEBUG] Starting stop() - setting playing=false" << std::endl;
         playing = false; 
-        std::cout << "[DEBUG] Calling ether_all_notes_off" << std::endl;
-        ether_all_notes_off(etherEngine); 
+        std::cout << "[DEBUG] Requesting all notes off" << std::endl;
+        g_allNotesOffRequested = true;
         std::cout << "[DEBUG] Checking if sequencer thread is joinable..." << std::endl;
         if (sequencerThread.joinable()) {
             std::cout << "[DEBUG] Joining sequencer thread..." << std::endl;
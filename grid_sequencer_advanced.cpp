@@ -14,7 +14,6 @@
 #include <fstream>
 #include <cstdlib>
 #include <algorithm>
-#include <random>
 #include <termios.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -40,6 +39,12 @@ const char* getDisplayName(const char* technicalName);
 #include <portaudio.h>
 #include <lo/lo.h>
 #include "src/core/Types.h"
+#include "src/sequencer/EventScheduler.h"
+#include "src/sequencer/LiveNoteInbox.h"
+#include "src/midi/MIDIInputQueue.h"
+#ifdef __linux__
+#include "src/midi/LinuxMIDIInput.h"
+#endif
 
 // Forward declarations for real bridge functions
 extern "C" {
@@ -47,6 +52,7 @@ extern "C" {
     void ether_destroy(void* synth);
     int ether_initialize(void* synth);
     void ether_process_audio(void* synth, float* outputBuffer, size_t bufferSize);
+    void ether_set_sample_rate(void* synth, float sampleRate);
     void ether_play(void* synth);
     void ether_stop(void* synth);
     void ether_note_on(void* synth, int key_index, float velocity, float aftertouch);
@@ -72,6 +78,12 @@ extern "C" {
     float ether_get_cycles_480_per_buffer(void* synth);
     float ether_get_cycles_480_per_sample(void* synth);
     float ether_get_engine_cpu_pct(void* synth, int instrument);
+    int ether_get_render_thread_count(void* synth);
+    float ether_get_render_thread_cpu_pct(void* synth, int thread);
+    int ether_get_voice_limit(void* synth);
+    int ether_get_voice_steal_count(void* synth);
+    int ether_telemetry_get_stats(void* synth, int stage, int slot, float* p50Us, float* p99Us, float* maxUs);
+    int ether_telemetry_get_overrun_count(void* synth);
     float ether_get_engine_cycles_480_buf(void* synth, int instrument);
     float ether_get_engine_cycles_480_smp(void* synth, int instrument);
     void ether_set_engine_fx_send(void* synth, int instrument, int which, float value);
@@ -126,8 +138,16 @@ std::map<int, std::string> parameterNames = {
 void* etherEngine = nullptr;
 std::atomic<bool> audioRunning{false};
 std::atomic<bool> playing{false};
-std::atomic<bool> stepTrigger[MAX_ENGINES][16] = {};
-std::atomic<bool> noteOffTrigger[MAX_ENGINES][16] = {};
+// Sample-accurate sequencer events, drained by the audio callback
+EventScheduler g_scheduler;
+// Live pad notes from the OSC grid thread, played by the audio callback before it renders
+LiveNoteInbox g_padNotes;
+std::atomic<bool> g_allNotesOffRequested{false};   // Transport stop, applied by the audio callback
+// Live MIDI input (ETHER_MIDI_INPUT), stamped by the reader and placed by the audio callback
+MIDIInputQueue g_midiQueue;
+#ifdef __linux__
+LinuxMIDIInput g_midiInput{g_midiQueue};
+#endif
 std::atomic<int> currentStep{0};
 std::atomic<int> activeNotes[MAX_ENGINES][16] = {};
 // Suppress double-trigger when live-writing: remember previewed step
@@ -693,6 +713,18 @@ void drawFixedUI() {
     printf("CPU slots: ");
     for (int s=0;s<8;s++){ float p = ether_get_engine_cpu_pct(etherEngine, s); printf("%d:%3.0f%% ", s, p); }
     printf("\n");
+    // Render thread load (thread 0 = audio callback)
+    printf("CPU threads: ");
+    for (int t=0;t<ether_get_render_thread_count(etherEngine);t++){ printf("%d:%3.0f%% ", t, ether_get_render_thread_cpu_pct(etherEngine, t)); }
+    printf("\n");
+    printf("Voices: %d/%d steals:%d\n", ether_get_active_voice_count(etherEngine),
+           ether_get_voice_limit(etherEngine), ether_get_voice_steal_count(etherEngine));
+    // Callback timing percentiles (only once telemetry has been started, e.g. ETHER_TELEMETRY=file)
+    float p50 = 0.0f, p99 = 0.0f, pmax = 0.0f;
+    if (ether_telemetry_get_stats(etherEngine, 5, -1, &p50, &p99, &pmax) > 0) {
+        printf("Block us p50:%.0f p99:%.0f max:%.0f overruns:%d\n", p50, p99, pmax,
+               ether_telemetry_get_overrun_count(etherEngine));
+    }
 
     // Mode status indicators
     printf("Modes: ");
@@ -1554,9 +1586,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     drumMasks[padIdx] |= (1u << currentStep);
                     drumPreviewStep[padIdx] = currentStep.load();
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.9f;
-                    ether_note_on(etherEngine, DRUM_PAD_NOTES[padIdx], vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, DRUM_PAD_NOTES[padIdx], vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     return 0;
                 } else {
@@ -1567,9 +1598,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     enginePatterns[engine][currentStep].note = liveNote;
                     melodicPreviewStep[engine] = currentStep.load();
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.8f;
-                    ether_note_on(etherEngine, liveNote, vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, liveNote, vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     return 0;
                 }
@@ -1615,13 +1645,11 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                         // Jump the terminal menu to the drum pad editor row
                         selectedParamIndex = (int)uiParams.size()+1;
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
                         float vel = accentLatch ? 1.0f : 0.9f;
-                        ether_note_on(etherEngine, note, vel, 0.0f);
+                        g_padNotes.postNoteOn(slot, note, vel);
                     } else if (state == 0) {
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
-                        ether_note_off(etherEngine, note);
+                        g_padNotes.postNoteOff(slot, note);
                     }
                     return 0;
                 }
@@ -1671,9 +1699,8 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                 if (state == 1) {
                     lastLiveNote = liveNote;
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
                     float vel = accentLatch ? 1.0f : 0.8f;
-                    ether_note_on(etherEngine, liveNote, vel, 0.0f);
+                    g_padNotes.postNoteOn(slot, liveNote, vel);
                     ether_trigger_instrument_lfos(etherEngine, slot);
                     liveHeldNoteByPad[padIdx] = liveNote;
                     return 0;
@@ -1681,8 +1708,7 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
                     int held = liveHeldNoteByPad[padIdx];
                     if (held >= 0) {
                         int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                        ether_set_active_instrument(etherEngine, slot);
-                        ether_note_off(etherEngine, held);
+                        g_padNotes.postNoteOff(slot, held);
                         liveHeldNoteByPad[padIdx] = -1;
                     }
                     return 0;
@@ -1734,16 +1760,14 @@ int grid_key_handler(const char *path, const char *types, lo_arg **argv, int arg
             if (state == 1) {
                 lastLiveNote = note;
                 int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                ether_set_active_instrument(etherEngine, slot);
-                ether_note_on(etherEngine, note, 0.8f, 0.0f);
+                g_padNotes.postNoteOn(slot, note, 0.8f);
                 ether_trigger_instrument_lfos(etherEngine, slot);
                 liveHeldNoteByPad[padIdx] = note;
             } else if (state == 0) {
                 int held = liveHeldNoteByPad[padIdx];
                 if (held >= 0) {
                     int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
-                    ether_note_off(etherEngine, held);
+                    g_padNotes.postNoteOff(slot, held);
                     liveHeldNoteByPad[padIdx] = -1;
                 }
             }
@@ -2402,256 +2426,340 @@ void processAudioEffects(float* audioBuffer, size_t bufferSize) {
     }
 }
 
-// PortAudio callback (same as before)
-int audioCallback(const void* /*inputBuffer*/, void* outputBuffer,
-                 unsigned long framesPerBuffer,
-                 const PaStreamCallbackTimeInfo* /*timeInfo*/,
-                 PaStreamCallbackFlags /*statusFlags*/,
-                 void* /*userData*/) {
-    
-    float* out = static_cast<float*>(outputBuffer);
-    
-    for (unsigned long i = 0; i < framesPerBuffer * 2; i++) {
-        out[i] = 0.0f;
+// Position (0..1 of the retrigger window) of ratchet `index` out of `total` hits
+double ratchetPosition(int index, int total, RetriggerTimingMode mode, float intensity) {
+    if (total <= 1) return 0.0;
+    double p = static_cast<double>(index) / static_cast<double>(total);
+    double curve = 1.0 + 2.0 * std::clamp(static_cast<double>(intensity), 0.0, 1.0);
+    switch (mode) {
+        case RetriggerTimingMode::ACCELERATING: return 1.0 - (1.0 - p) * (1.0 - p);   // Long gaps first
+        case RetriggerTimingMode::DECELERATING: return p * p;                         // Short gaps first
+        case RetriggerTimingMode::EXPONENTIAL:  return 1.0 - std::pow(1.0 - p, curve);
+        case RetriggerTimingMode::LOGARITHMIC:  return std::pow(p, curve);
+        case RetriggerTimingMode::STATIC:
+        default:                                return p;
     }
-    
-    for (int engine = 0; engine < MAX_ENGINES; engine++) {
-        for (int step = 0; step < 16; step++) {
-            if (stepTrigger[engine][step].exchange(false)) {
-                if (enginePatterns[engine][step].active) {
-                    int slot = rowToSlot[engine]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
-
-                    int note = enginePatterns[engine][step].note;
-                    float velocity = enginePatterns[engine][step].velocity;
-
-                    // Apply 303-style accent effect
-                    if (enginePatterns[engine][step].hasAccent) {
-                        // Save current filter settings
-                        float currentCutoff = getExtendedParameterValue(static_cast<int>(ParameterID::FILTER_CUTOFF), slot);
-                        float currentResonance = getExtendedParameterValue(static_cast<int>(ParameterID::FILTER_RESONANCE), slot);
-
-                        // Apply accent boost to filter (opens cutoff significantly + adds resonance)
-                        float accentCutoff = std::min(1.0f, currentCutoff + 0.3f);  // Boost cutoff
-                        float accentResonance = std::min(1.0f, currentResonance + 0.2f);  // Add resonance
-
-                        ether_set_instrument_parameter(etherEngine, slot, static_cast<int>(ParameterID::FILTER_CUTOFF), accentCutoff);
-                        ether_set_instrument_parameter(etherEngine, slot, static_cast<int>(ParameterID::FILTER_RESONANCE), accentResonance);
-                        g_params.set(slot, static_cast<int>(ParameterID::FILTER_CUTOFF), accentCutoff);
-                        g_params.set(slot, static_cast<int>(ParameterID::FILTER_RESONANCE), accentResonance);
-
-                        // Slight volume boost too
-                        velocity = std::min(1.0f, velocity * 1.2f);
-                    }
+}
 
-                    ether_note_on(etherEngine, note, velocity, 0.0f);
-                    activeNotes[engine][step] = note;
-
-                    // Apply step effects (mutually exclusive - retrigger OR arpeggiator, not both)
-                    if (enginePatterns[engine][step].hasRetrigger && !enginePatterns[engine][step].hasArpeggiator) {
-                        // RETRIGGER EFFECT: Rapid repeated triggers with octave shifts
-                        int numTriggers = retriggerSettings.numTriggers - 1; // -1 because we already triggered once
-                        float octaveStep = retriggerSettings.octaveShift / static_cast<float>(retriggerSettings.numTriggers - 1);
-
-                        // Calculate dynamic velocity curve based on velocity mode
-                        auto calculateVelocity = [&](int triggerIndex, int totalTriggers, float baseVelocity) -> float {
-                            float progress = static_cast<float>(triggerIndex) / static_cast<float>(totalTriggers - 1);
-
-                            switch (retriggerSettings.velocityMode) {
-                                case RetriggerVelocityMode::STATIC:
-                                    return baseVelocity * (1.0f - (triggerIndex * 0.15f)); // Original fade
-                                case RetriggerVelocityMode::CRESCENDO:
-                                    return baseVelocity * (0.3f + 0.7f * progress * retriggerSettings.intensityCurve);
-                                case RetriggerVelocityMode::DIMINUENDO:
-                                    return baseVelocity * (1.0f - progress * retriggerSettings.intensityCurve);
-                                case RetriggerVelocityMode::ACCENT_FIRST:
-                                    return triggerIndex == 0 ? baseVelocity : baseVelocity * (0.4f + 0.3f * retriggerSettings.intensityCurve);
-                                case RetriggerVelocityMode::ACCENT_LAST:
-                                    return triggerIndex == totalTriggers - 1 ? baseVelocity : baseVelocity * (0.4f + 0.3f * retriggerSettings.intensityCurve);
-                                default:
-                                    return baseVelocity;
-                            }
-                        };
+// Arpeggiator sequences: chord tones (semitones above the root) and the longest
+// ordering (UP_DOWN of 8 tones), so building one never allocates
+constexpr int MAX_ARP_LENGTH = 8;
+constexpr int MAX_ARP_SEQUENCE = MAX_ARP_LENGTH * 2 - 2;
+constexpr std::array<int, MAX_ARP_LENGTH> ARP_INTERVALS = {0, 4, 7, 12, 16, 19, 24, 28};
+uint32_t arpRandomState = 0x6D2B79F5u;   // Audio thread: xorshift state for RANDOM arps
+
+// Fill `order` with tone indices (0 = root) in arpeggiator pattern order; returns the count
+int buildArpOrder(std::array<int, MAX_ARP_SEQUENCE>& order) {
+    const int length = std::clamp(arpeggiatorSettings.length, 1, MAX_ARP_LENGTH);
+    int count = 0;
+    switch (arpeggiatorSettings.pattern) {
+        case ArpPattern::DOWN:
+            for (int i = length - 1; i >= 0; i--) order[count++] = i;
+            break;
+        case ArpPattern::UP_DOWN:
+            for (int i = 0; i < length; i++) order[count++] = i;
+            for (int i = length - 2; i >= 0; i--) order[count++] = i;
+            break;
+        case ArpPattern::RANDOM:
+            for (int i = 0; i < length; i++) order[count++] = i;
+            for (int i = count - 1; i > 0; i--) {
+                arpRandomState ^= arpRandomState << 13;
+                arpRandomState ^= arpRandomState >> 17;
+                arpRandomState ^= arpRandomState << 5;
+                std::swap(order[i], order[arpRandomState % static_cast<uint32_t>(i + 1)]);
+            }
+            break;
+        default:   // UP, CHORD and the rest play the tones in order
+            for (int i = 0; i < length; i++) order[count++] = i;
+            break;
+    }
+    return count;
+}
 
-                        if (isCurrentEngineDrum()) {
-                            // DRUM RETRIGGER: Pitch-shift the same drum pad instead of changing notes
-                            int drumPad = note % 16; // Map MIDI note to drum pad (0-15)
+// Fire a melodic pattern step (accent/retrigger/arpeggiator) at the event's sample time
+void triggerStep(const SequencerEvent& ev) {
+    int engine = ev.slot;
+    int step = ev.step;
+    if (engine < 0 || engine >= MAX_ENGINES || step < 0 || step >= 16) return;
+    if (!enginePatterns[engine][step].active) return;
 
-                            for (int i = 1; i <= numTriggers; i++) {
-                                float dynamicVelocity = calculateVelocity(i, retriggerSettings.numTriggers, velocity);
-                                float tuneShift = octaveStep * i; // Convert octave shift to tune parameter (-1.0 to +1.0)
-                                tuneShift = std::max(-1.0f, std::min(1.0f, tuneShift)); // Clamp tune to valid range
+    int slot = rowToSlot[engine]; if (slot < 0) slot = 0;
+    ether_set_active_instrument(etherEngine, slot);
 
-                                // TODO: Dynamic timing - currently fires immediately, should schedule based on timingMode
-                                // For ACCELERATING: delays get shorter (1/8, 1/16, 1/32...)
-                                // For DECELERATING: delays get longer (1/32, 1/16, 1/8...)
-                                // For EXPONENTIAL/LOGARITHMIC: use intensityCurve to modify delay curves
+    int note = enginePatterns[engine][step].note;
+    float velocity = enginePatterns[engine][step].velocity;
 
-                                // Temporarily adjust drum tune for this trigger
-                                ether_drum_set_param(etherEngine, 0, drumPad, 1, tuneShift); // 1 = tune parameter
-                                ether_note_on(etherEngine, note, dynamicVelocity, 0.0f); // Same note, pitched drum
+    // Apply 303-style accent effect
+    if (enginePatterns[engine][step].hasAccent) {
+        // Save current filter settings
+        float currentCutoff = getExtendedParameterValue(static_cast<int>(ParameterID::FILTER_CUTOFF), slot);
+        float currentResonance = getExtendedParameterValue(static_cast<int>(ParameterID::FILTER_RESONANCE), slot);
 
-                                // Reset drum tune back to center
-                                ether_drum_set_param(etherEngine, 0, drumPad, 1, 0.0f);
-                            }
-                        } else {
-                            // MELODIC RETRIGGER: Change note pitch for melodic engines
-                            for (int i = 1; i <= numTriggers; i++) {
-                                float dynamicVelocity = calculateVelocity(i, retriggerSettings.numTriggers, velocity);
-                                int octaveShift = static_cast<int>(octaveStep * i);
-                                int retriggeredNote = note + (octaveShift * 12);
-
-                                // Clamp note to valid MIDI range
-                                retriggeredNote = std::max(0, std::min(127, retriggeredNote));
+        // Apply accent boost to filter (opens cutoff significantly + adds resonance)
+        float accentCutoff = std::min(1.0f, currentCutoff + 0.3f);  // Boost cutoff
+        float accentResonance = std::min(1.0f, currentResonance + 0.2f);  // Add resonance
 
-                                // TODO: Dynamic timing - same scheduling system as drums
-                                ether_note_on(etherEngine, retriggeredNote, dynamicVelocity, 0.0f);
-                            }
-                        }
-                    } else if (enginePatterns[engine][step].hasArpeggiator && !enginePatterns[engine][step].hasRetrigger) {
-                        // ARPEGGIATOR EFFECT: Generate arpeggiated sequence based on settings
-                        if (isCurrentEngineDrum()) {
-                            // DRUM ARPEGGIATOR: Pitch-shift the same drum pad to different tunings
-                            int drumPad = note % 16; // Map MIDI note to drum pad (0-15)
-                            std::vector<float> arpTunes;
-
-                            // Build pitch variations for drum (tune values from -1.0 to +1.0)
-                            float tuneStep = 2.0f / static_cast<float>(arpeggiatorSettings.length - 1); // Spread across range
-                            for (int i = 0; i < arpeggiatorSettings.length; i++) {
-                                float tuneValue = -1.0f + (i * tuneStep); // From -1.0 to +1.0
-                                arpTunes.push_back(std::max(-1.0f, std::min(1.0f, tuneValue)));
-                            }
+        ether_set_instrument_parameter(etherEngine, slot, static_cast<int>(ParameterID::FILTER_CUTOFF), accentCutoff);
+        ether_set_instrument_parameter(etherEngine, slot, static_cast<int>(ParameterID::FILTER_RESONANCE), accentResonance);
+        g_params.set(slot, static_cast<int>(ParameterID::FILTER_CUTOFF), accentCutoff);
+        g_params.set(slot, static_cast<int>(ParameterID::FILTER_RESONANCE), accentResonance);
 
-                            // Apply pattern ordering to tune values
-                            std::vector<float> finalTunes;
-                            switch (arpeggiatorSettings.pattern) {
-                                case ArpPattern::UP:
-                                    finalTunes = arpTunes;
-                                    break;
-                                case ArpPattern::DOWN:
-                                    finalTunes = arpTunes;
-                                    std::reverse(finalTunes.begin(), finalTunes.end());
-                                    break;
-                                case ArpPattern::UP_DOWN:
-                                    finalTunes = arpTunes;
-                                    for (int i = arpTunes.size() - 2; i >= 0; i--) {
-                                        finalTunes.push_back(arpTunes[i]);
-                                    }
-                                    break;
-                                case ArpPattern::RANDOM:
-                                    finalTunes = arpTunes;
-                                    {
-                                        static std::random_device rd;
-                                        static std::mt19937 g(rd());
-                                        std::shuffle(finalTunes.begin(), finalTunes.end(), g);
-                                    }
-                                    break;
-                                case ArpPattern::CHORD:
-                                    // Play all tuned versions simultaneously (already did root)
-                                    for (size_t i = 1; i < arpTunes.size(); i++) {
-                                        ether_drum_set_param(etherEngine, 0, drumPad, 1, arpTunes[i]);
-                                        ether_note_on(etherEngine, note, velocity * 0.8f, 0.0f);
-                                        ether_drum_set_param(etherEngine, 0, drumPad, 1, 0.0f); // Reset
-                                    }
-                                    finalTunes.clear(); // Don't continue with sequence
-                                    break;
-                                default:
-                                    finalTunes = arpTunes;
-                                    break;
-                            }
+        // Slight volume boost too
+        velocity = std::min(1.0f, velocity * 1.2f);
+    }
 
-                            // Trigger drum arpeggio sequence
-                            if (!finalTunes.empty() && arpeggiatorSettings.pattern != ArpPattern::CHORD) {
-                                for (size_t i = 1; i < finalTunes.size(); i++) { // Skip first (already triggered)
-                                    float arpVelocity = velocity * (0.9f - (i * 0.1f)); // Slight velocity variation
-                                    ether_drum_set_param(etherEngine, 0, drumPad, 1, finalTunes[i]); // Set tune
-                                    ether_note_on(etherEngine, note, arpVelocity, 0.0f); // Same note, tuned drum
-                                    ether_drum_set_param(etherEngine, 0, drumPad, 1, 0.0f); // Reset tune
-                                }
-                            }
-                        } else {
-                            // MELODIC ARPEGGIATOR: Generate chord-based arpeggios
-                            std::vector<int> arpNotes;
-
-                            // Build base arpeggio notes (simplified - using major triad for now)
-                            arpNotes.push_back(note);                // Root
-                            arpNotes.push_back(note + 4);           // Major 3rd
-                            arpNotes.push_back(note + 7);           // Perfect 5th
-                            if (arpeggiatorSettings.length >= 4) arpNotes.push_back(note + 12); // Octave
-                            if (arpeggiatorSettings.length >= 5) arpNotes.push_back(note + 16); // Major 3rd + octave
-                            if (arpeggiatorSettings.length >= 6) arpNotes.push_back(note + 19); // Perfect 5th + octave
-                            if (arpeggiatorSettings.length >= 7) arpNotes.push_back(note + 24); // 2nd octave
-                            if (arpeggiatorSettings.length >= 8) arpNotes.push_back(note + 28); // Major 3rd + 2nd octave
-
-                            // Trim to desired length
-                            if (arpNotes.size() > static_cast<size_t>(arpeggiatorSettings.length)) {
-                                arpNotes.resize(arpeggiatorSettings.length);
-                            }
+    ether_note_on(etherEngine, note, velocity, 0.0f);
+    activeNotes[engine][step] = note;
+
+    // Apply step effects (mutually exclusive - retrigger OR arpeggiator, not both)
+    if (enginePatterns[engine][step].hasRetrigger && !enginePatterns[engine][step].hasArpeggiator) {
+        // RETRIGGER EFFECT: Rapid repeated triggers with octave shifts
+        int numTriggers = retriggerSettings.numTriggers - 1; // -1 because we already triggered once
+        float octaveStep = retriggerSettings.octaveShift / static_cast<float>(retriggerSettings.numTriggers - 1);
+
+        // Calculate dynamic velocity curve based on velocity mode
+        auto calculateVelocity = [&](int triggerIndex, int totalTriggers, float baseVelocity) -> float {
+            float progress = static_cast<float>(triggerIndex) / static_cast<float>(totalTriggers - 1);
+
+            switch (retriggerSettings.velocityMode) {
+                case RetriggerVelocityMode::STATIC:
+                    return baseVelocity * (1.0f - (triggerIndex * 0.15f)); // Original fade
+                case RetriggerVelocityMode::CRESCENDO:
+                    return baseVelocity * (0.3f + 0.7f * progress * retriggerSettings.intensityCurve);
+                case RetriggerVelocityMode::DIMINUENDO:
+                    return baseVelocity * (1.0f - progress * retriggerSettings.intensityCurve);
+                case RetriggerVelocityMode::ACCENT_FIRST:
+                    return triggerIndex == 0 ? baseVelocity : baseVelocity * (0.4f + 0.3f * retriggerSettings.intensityCurve);
+                case RetriggerVelocityMode::ACCENT_LAST:
+                    return triggerIndex == totalTriggers - 1 ? baseVelocity : baseVelocity * (0.4f + 0.3f * retriggerSettings.intensityCurve);
+                default:
+                    return baseVelocity;
+            }
+        };
 
-                            // Apply pattern ordering
-                            std::vector<int> finalArp;
-                            switch (arpeggiatorSettings.pattern) {
-                                case ArpPattern::UP:
-                                    finalArp = arpNotes;
-                                    break;
-                                case ArpPattern::DOWN:
-                                    finalArp = arpNotes;
-                                    std::reverse(finalArp.begin(), finalArp.end());
-                                    break;
-                                case ArpPattern::UP_DOWN:
-                                    finalArp = arpNotes;
-                                    for (int i = arpNotes.size() - 2; i >= 0; i--) {
-                                        finalArp.push_back(arpNotes[i]);
-                                    }
-                                    break;
-                                case ArpPattern::RANDOM:
-                                    finalArp = arpNotes;
-                                    {
-                                        static std::random_device rd;
-                                        static std::mt19937 g(rd());
-                                        std::shuffle(finalArp.begin(), finalArp.end(), g);
-                                    }
-                                    break;
-                                case ArpPattern::CHORD:
-                                    // Play all notes simultaneously (already did root note)
-                                    for (size_t i = 1; i < arpNotes.size(); i++) {
-                                        int arpNote = std::max(0, std::min(127, arpNotes[i]));
-                                        ether_note_on(etherEngine, arpNote, velocity * 0.8f, 0.0f);
-                                    }
-                                    finalArp.clear(); // Don't continue with sequence
-                                    break;
-                                default:
-                                    finalArp = arpNotes;
-                                    break;
-                            }
+        // Ratchets are spread over the retrigger window on exact samples
+        const double windowSamples = static_cast<double>(ev.duration) * std::max(1, retriggerSettings.stepWindow);
+        auto ratchetOffset = [&](int triggerIndex) -> uint64_t {
+            double position = ratchetPosition(triggerIndex, retriggerSettings.numTriggers,
+                                              retriggerSettings.timingMode, retriggerSettings.intensityCurve);
+            return static_cast<uint64_t>(position * windowSamples);
+        };
 
-                            // Trigger arpeggio sequence (simplified timing)
-                            if (!finalArp.empty() && arpeggiatorSettings.pattern != ArpPattern::CHORD) {
-                                for (size_t i = 1; i < finalArp.size(); i++) { // Skip first note (already triggered)
-                                    int arpNote = std::max(0, std::min(127, finalArp[i]));
-                                    float arpVelocity = velocity * (0.9f - (i * 0.1f)); // Slight velocity variation
-                                    ether_note_on(etherEngine, arpNote, arpVelocity, 0.0f);
-                                }
-                            }
-                        }
-                    }
-                }
+        if (isCurrentEngineDrum()) {
+            // DRUM RETRIGGER: Pitch-shift the same drum pad instead of changing notes
+            // (DRUM_HIT dispatch maps the note back to its pad for the tune change)
+            for (int i = 1; i <= numTriggers; i++) {
+                float dynamicVelocity = calculateVelocity(i, retriggerSettings.numTriggers, velocity);
+                float tuneShift = octaveStep * i; // Convert octave shift to tune parameter (-1.0 to +1.0)
+                tuneShift = std::max(-1.0f, std::min(1.0f, tuneShift)); // Clamp tune to valid range
+
+                // Pitched drum hit placed on the ratchet grid
+                SequencerEvent hit;
+                hit.time = ev.time + ratchetOffset(i);
+                hit.type = SequencerEvent::Type::DRUM_HIT;
+                hit.slot = static_cast<int16_t>(slot);
+                hit.note = static_cast<int16_t>(note);
+                hit.velocity = dynamicVelocity;
+                hit.tune = tuneShift;
+                g_scheduler.schedule(hit);
             }
-            
-            if (noteOffTrigger[engine][step].exchange(false)) {
-                int note = activeNotes[engine][step].exchange(-1);
-                if (note >= 0) {
-                    int slot = rowToSlot[engine]; if (slot < 0) slot = 0;
-                    ether_set_active_instrument(etherEngine, slot);
-                    ether_note_off(etherEngine, note);
-                }
+        } else {
+            // MELODIC RETRIGGER: Change note pitch for melodic engines
+            for (int i = 1; i <= numTriggers; i++) {
+                float dynamicVelocity = calculateVelocity(i, retriggerSettings.numTriggers, velocity);
+                int octaveShift = static_cast<int>(octaveStep * i);
+                int retriggeredNote = note + (octaveShift * 12);
+
+                // Clamp note to valid MIDI range
+                retriggeredNote = std::max(0, std::min(127, retriggeredNote));
+
+                SequencerEvent hit;
+                hit.time = ev.time + ratchetOffset(i);
+                hit.type = SequencerEvent::Type::NOTE_ON;
+                hit.slot = static_cast<int16_t>(slot);
+                hit.note = static_cast<int16_t>(retriggeredNote);
+                hit.velocity = dynamicVelocity;
+                g_scheduler.schedule(hit);
+
+                // Released where the next ratchet lands (the last one at the window end)
+                SequencerEvent release = hit;
+                release.type = SequencerEvent::Type::NOTE_OFF;
+                release.step = -1;
+                release.time = ev.time + ratchetOffset(i + 1);
+                g_scheduler.schedule(release);
             }
         }
+    } else if (enginePatterns[engine][step].hasArpeggiator && !enginePatterns[engine][step].hasRetrigger) {
+        // ARPEGGIATOR EFFECT: arp notes land on the step grid (`speed` steps apart);
+        // the root was triggered above
+        std::array<int, MAX_ARP_SEQUENCE> order;
+        const int count = buildArpOrder(order);
+        const bool chord = arpeggiatorSettings.pattern == ArpPattern::CHORD;
+        const uint64_t spacing = static_cast<uint64_t>(ev.duration) * std::max(1, arpeggiatorSettings.speed);
+        const uint64_t gate = spacing * std::clamp(arpeggiatorSettings.gateLength, 25, 100) / 100;
+        const int length = std::clamp(arpeggiatorSettings.length, 1, MAX_ARP_LENGTH);
+
+        for (int i = 1; i < count; i++) { // Skip first (already triggered)
+            SequencerEvent hit;
+            hit.time = ev.time + (chord ? 0 : spacing * i);
+            hit.slot = static_cast<int16_t>(slot);
+            hit.velocity = chord ? velocity * 0.8f : velocity * std::max(0.2f, 0.9f - (i * 0.1f)); // Slight velocity variation
+            if (isCurrentEngineDrum()) {
+                // DRUM ARPEGGIATOR: Pitch-shift the same drum pad across the tune range (-1..+1)
+                hit.type = SequencerEvent::Type::DRUM_HIT;
+                hit.note = static_cast<int16_t>(note);
+                hit.tune = -1.0f + order[i] * (2.0f / static_cast<float>(length - 1));
+                g_scheduler.schedule(hit);
+            } else {
+                // MELODIC ARPEGGIATOR: Chord tones of a major triad stacked over octaves
+                hit.type = SequencerEvent::Type::NOTE_ON;
+                hit.note = static_cast<int16_t>(std::clamp(note + ARP_INTERVALS[order[i]], 0, 127));
+                g_scheduler.schedule(hit);
+                SequencerEvent release = hit;
+                release.type = SequencerEvent::Type::NOTE_OFF;
+                release.step = -1;
+                release.time = hit.time + gate;
+                g_scheduler.schedule(release);
+            }
+        }
+    }
+}
+
+// Live MIDI CCs that drive the current instrument directly
+ParameterID midiControllerParam(int controller) {
+    switch (controller) {
+        case 1:  return ParameterID::MORPH;             // Mod wheel
+        case 7:  return ParameterID::VOLUME;
+        case 10: return ParameterID::PAN;
+        case 71: return ParameterID::FILTER_RESONANCE;
+        case 74: return ParameterID::FILTER_CUTOFF;
+        default: return ParameterID::COUNT;
     }
+}
+
+// Apply one live MIDI message to the instrument of the current engine row (audio thread)
+void dispatchMIDIInput(const SequencerEvent& ev) {
+    static std::array<int, 128> noteSlot = [] { std::array<int, 128> a; a.fill(-1); return a; }();
+    const uint8_t type = ev.status & 0xF0;
+    const int note = ev.note & 0x7F;
+    int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
+
+    if (type == 0x90 && ev.velocity > 0.0f) {
+        ether_set_active_instrument(etherEngine, slot);
+        ether_note_on(etherEngine, note, ev.velocity, 0.0f);
+        noteSlot[note] = slot;
+    } else if (type == 0x80 || type == 0x90) {
+        // Release on the slot that started the note, even if the row changed since
+        if (noteSlot[note] < 0) return;
+        ether_set_active_instrument(etherEngine, noteSlot[note]);
+        ether_note_off(etherEngine, note);
+        noteSlot[note] = -1;
+    } else if (type == 0xB0) {
+        if (ev.note == 120 || ev.note == 123) {         // All sound off / all notes off
+            ether_all_notes_off(etherEngine);
+            noteSlot.fill(-1);
+            return;
+        }
+        ParameterID pid = midiControllerParam(ev.note);
+        if (pid != ParameterID::COUNT) ether_set_instrument_parameter(etherEngine, slot, static_cast<int>(pid), ev.velocity);
+    }
+}
+
+// Apply one scheduled event on the audio thread
+void dispatchSequencerEvent(const SequencerEvent& ev) {
+    switch (ev.type) {
+        case SequencerEvent::Type::STEP_ADVANCE:
+            currentStep = ev.step;
+            break;
+        case SequencerEvent::Type::STEP_TRIGGER:
+            triggerStep(ev);
+            break;
+        case SequencerEvent::Type::NOTE_ON:
+            ether_set_active_instrument(etherEngine, ev.slot);
+            ether_note_on(etherEngine, ev.note, ev.velocity, 0.0f);
+            break;
+        case SequencerEvent::Type::DRUM_HIT: {
+            ether_set_active_instrument(etherEngine, ev.slot);
+            int drumPad = ev.note % 16;
+            if (ev.tune != 0.0f) ether_drum_set_param(etherEngine, ev.slot, drumPad, 1, ev.tune); // 1 = tune parameter
+            ether_note_on(etherEngine, ev.note, ev.velocity, 0.0f);
+            if (ev.tune != 0.0f) ether_drum_set_param(etherEngine, ev.slot, drumPad, 1, 0.0f);
+        } break;
+        case SequencerEvent::Type::NOTE_OFF: {
+            if (ev.step < 0) {
+                // Ratchet/arp note: release `note` on instrument `slot` directly
+                ether_set_active_instrument(etherEngine, ev.slot);
+                ether_note_off(etherEngine, ev.note);
+                break;
+            }
+            // `slot` carries the engine row that owns the step's held note
+            if (ev.slot < 0 || ev.slot >= MAX_ENGINES || ev.step < 0 || ev.step >= 16) break;
+            int note = activeNotes[ev.slot][ev.step].exchange(-1);
+            if (note >= 0) {
+                int slot = rowToSlot[ev.slot]; if (slot < 0) slot = 0;
+                ether_set_active_instrument(etherEngine, slot);
+                ether_note_off(etherEngine, note);
+            }
+        } break;
+        case SequencerEvent::Type::MIDI_INPUT:
+            dispatchMIDIInput(ev);
+            break;
+    }
+}
+
+// PortAudio callback: drains the event scheduler and renders between event offsets
+int audioCallback(const void* /*inputBuffer*/, void* outputBuffer,
+                 unsigned long framesPerBuffer,
+                 const PaStreamCallbackTimeInfo* /*timeInfo*/,
+                 PaStreamCallbackFlags /*statusFlags*/,
+                 void* /*userData*/) {
     
-    if (etherEngine) {
-        ether_process_audio(etherEngine, out, framesPerBuffer);
+    const uint64_t hostNow = MIDIInputQueue::hostTimeNs();
+    float* out = static_cast<float*>(outputBuffer);
+    
+    for (unsigned long i = 0; i < framesPerBuffer * 2; i++) {
+        out[i] = 0.0f;
+    }
+    
+    g_scheduler.beginBlock(static_cast<uint32_t>(framesPerBuffer));
+    // Live MIDI arrives one block late but keeps its spacing inside the block
+    g_midiQueue.beginBlock(g_scheduler.now(), static_cast<uint32_t>(framesPerBuffer), hostNow);
+    TimedMIDIMessage midi;
+    uint64_t midiTime = 0;
+    while (g_midiQueue.pop(midi, midiTime)) {
+        SequencerEvent ev;
+        ev.time = midiTime;
+        ev.type = SequencerEvent::Type::MIDI_INPUT;
+        ev.status = midi.status;
+        ev.note = midi.data1;
+        ev.velocity = midi.data2 / 127.0f;
+        g_scheduler.schedule(ev);
+    }
+    // Live pad notes and stop requests land at the top of the block
+    if (g_allNotesOffRequested.exchange(false)) ether_all_notes_off(etherEngine);
+    LiveNote live;
+    while (g_padNotes.pop(live)) {
+        ether_set_active_instrument(etherEngine, live.slot);
+        if (live.on) ether_note_on(etherEngine, live.note, live.velocity, 0.0f);
+        else ether_note_off(etherEngine, live.note);
+    }
+    unsigned long rendered = 0;
+    SequencerEvent ev;
+    uint32_t offset = 0;
+    while (g_scheduler.popDue(ev, offset)) {
+        // Render up to the event so it lands on its exact sample
+        if (etherEngine && offset > rendered) {
+            ether_process_audio(etherEngine, out + rendered * 2, offset - rendered);
+            rendered = offset;
+        }
+        dispatchSequencerEvent(ev);
+    }
+    if (etherEngine && rendered < framesPerBuffer) {
+        ether_process_audio(etherEngine, out + rendered * 2, framesPerBuffer - rendered);
+    }
+    g_scheduler.endBlock();
 
+    if (etherEngine) {
         // Apply Performance FX audio effects if active
         if (performanceFX.hasActiveEffects()) {
             processAudioEffects(out, framesPerBuffer * 2);
@@ -2722,6 +2830,12 @@ public:
     void clearPattern();
     void shutdownSequencer();
 
+    // Sample-accurate step scheduling (look-ahead producer side)
+    static constexpr double SCHEDULER_LOOKAHEAD_MS = 20.0;
+    static constexpr int SCHEDULER_POLL_MS = 2;
+    double currentStepSamples() const;
+    void scheduleStep(int step, uint64_t stepTime, double stepSamples);
+
     // Encoder control system methods
     void setupEncoderSystem();
     void updateEngineFromEncoderChange(const std::string& param_id, float delta);
@@ -3212,8 +3326,30 @@ bool GridSequencer::initialize() {
         }
     }
     rebuildVisibleParams(); // Initialize parameter list after engines are set up
+    // ETHER_SAMPLE_RATE / ETHER_BUFFER_SIZE override the default 48 kHz, 128-frame stream
+    double sampleRate = 48000.0;
+    unsigned long framesPerBuffer = 128;
+    if (const char* env = std::getenv("ETHER_SAMPLE_RATE")) sampleRate = std::clamp(std::atof(env), 22050.0, 192000.0);
+    if (const char* env = std::getenv("ETHER_BUFFER_SIZE")) framesPerBuffer = (unsigned long)std::clamp(std::atol(env), 16L, 4096L);
+    ether_set_sample_rate(etherEngine, (float)sampleRate);
     PaError err = Pa_Initialize(); if (err != paNoError) return false;
-    err = Pa_OpenDefaultStream(&stream, 0, 2, paFloat32, 48000, 128, audioCallback, nullptr); if (err != paNoError) return false;
+    g_scheduler.setSampleRate(sampleRate);
+    // ETHER_MIDI_INPUT: "raw:/dev/snd/midiC1D0", or with ETHER_ALSA=1/ETHER_JACK=1 builds
+    // "seq", "seq:20:0", "jack" or "jack:<port>"
+    g_midiQueue.setSampleRate(sampleRate);
+    g_midiQueue.setLatencySamples(static_cast<uint32_t>(framesPerBuffer));
+#ifdef __linux__
+    if (const char* env = std::getenv("ETHER_MIDI_INPUT")) {
+        if (g_midiInput.open(env)) {
+            std::cout << "MIDI input: " << env << (g_midiInput.isRealtime() ? " (realtime reader)" : "") << std::endl;
+        } else {
+            std::cout << "MIDI input unavailable: " << g_midiInput.getLastError() << std::endl;
+        }
+    }
+#endif
+    err = Pa_OpenDefaultStream(&stream, 0, 2, paFloat32, sampleRate, framesPerBuffer, audioCallback, nullptr); if (err != paNoError) return false;
+    std::cout << "Audio: " << sampleRate << " Hz, " << framesPerBuffer << " frames ("
+              << std::fixed << std::setprecision(2) << (framesPerBuffer / sampleRate * 1000.0) << " ms)" << std::endl;
     err = Pa_StartStream(stream); if (err != paNoError) return false;
     audioRunning = true; running = true;
     initializeGrid();
@@ -3865,117 +4001,24 @@ void GridSequencer::play() {
         std::cout << "✓ Playing all engines" << std::endl;
         
         std::cout << "[DEBUG] Creating sequencer thread..." << std::endl;
+        // Look-ahead producer: steps are timed on the audio sample clock and posted
+        // ahead of time; the audio callback places them on exact sample offsets.
         sequencerThread = std::thread([this]() {
             std::cout << "[DEBUG] Sequencer thread started, entering loop" << std::endl;
+            const uint64_t lookahead = g_scheduler.msToSamples(SCHEDULER_LOOKAHEAD_MS);
+            double nextStepTime = static_cast<double>(g_scheduler.now() + lookahead);
+            int step = 0;
             while (playing) {
-                if (isCurrentEngineDrum()) {
-                    // Trigger any drum whose bit at currentStep is set; let engine manage decay
-                    int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
-                    if (!(soloEngine>=0 && currentEngineRow!=soloEngine) && !rowMuted[currentEngineRow]) {
-                        ether_set_active_instrument(etherEngine, slot);
-                        bool chNow = ((drumMasks[8] >> currentStep) & 1u) || ((drumMasks[9] >> currentStep) & 1u);
-                        for (int pad = 0; pad < 16; ++pad) {
-                            if ((drumMasks[pad] >> currentStep) & 1u) {
-                                // Skip if we just previewed this pad at this step
-                                int prev = drumPreviewStep[pad].load();
-                                if (prev == currentStep) { drumPreviewStep[pad] = -1; continue; }
-                                if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
-                                float vel = accentLatch ? 1.0f : 0.9f;
-                                ether_note_on(etherEngine, DRUM_PAD_NOTES[pad], vel, 0.0f);
-                            }
-                        }
-                    }
-                } else {
-                    if (playAllEngines) {
-                        // Trigger all rows (drums + melodic)
-                        for (int s = 0; s < 16; ++s) {
-                            int row = slotToRow[s]; if (row < 0) continue;
-                            if (soloEngine >= 0 && row != soloEngine) continue;
-                            if (rowMuted[row]) continue;
-                            
-                            int slot = rowToSlot[row]; if (slot < 0) slot = 0;
-                            ether_set_active_instrument(etherEngine, slot);
-                            bool isDrum = isEngineDrum(row);
-                            
-                            if (isDrum) {
-                                bool chNow = ((drumMasks[8] >> currentStep) & 1u) || ((drumMasks[9] >> currentStep) & 1u);
-                                for (int pad = 0; pad < 16; ++pad) {
-                                    if ((drumMasks[pad] >> currentStep) & 1u) {
-                                        // Skip if we just previewed this pad at this step
-                                        int prev = drumPreviewStep[pad].load();
-                                        if (prev == currentStep) { drumPreviewStep[pad] = -1; continue; }
-                                        if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
-                                        float vel = accentLatch ? 1.0f : 0.9f;
-                                        ether_note_on(etherEngine, DRUM_PAD_NOTES[pad], vel, 0.0f);
-                                    }
-                                }
-                            } else {
-                                if (enginePatterns[row][currentStep].active) {
-                                    // Skip if just previewed live in this step
-                                    int prev = melodicPreviewStep[row].load();
-                                    if (prev == currentStep) { melodicPreviewStep[row] = -1; }
-                                    else { stepTrigger[row][currentStep] = true; }
-                                }
-                            }
-                        }
-                        // Schedule melodic note offs only (drums manage decay)
-                        std::thread([this]() {
-                            float stepMs = (60.0f / bpm) / 4.0f * 1000.0f;
-                            for (int s = 0; s < 16; ++s) {
-                                int row = slotToRow[s]; if (row < 0) continue;
-                                if (soloEngine >= 0 && row != soloEngine) continue;
-                                if (rowMuted[row]) continue;
-                                
-                                int slot = rowToSlot[row]; if (slot < 0) slot = 0;
-                                bool isDrum = isEngineDrum(row);
-                                if (!isDrum) {
-                                    float releaseParam = engineParameters[row][static_cast<int>(ParameterID::RELEASE)];
-                                    float noteOffMs = stepMs * (0.1f + releaseParam * 0.8f);
-                                    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(noteOffMs)));
-                                    if (playing) {
-                                        noteOffTrigger[row][currentStep] = true;
-                                    }
-                                }
-                            }
-                        }).detach();
-                    } else {
-                        int engine = currentEngineRow;
-                        if (soloEngine >= 0 && engine != soloEngine) {
-                            // skip
-                        } else if (!rowMuted[engine] && enginePatterns[engine][currentStep].active) {
-                            stepTrigger[engine][currentStep] = true;
-                            std::thread([this, engine]() {
-                                float stepMs = (60.0f / bpm) / 4.0f * 1000.0f;
-                                float releaseParam = engineParameters[engine][static_cast<int>(ParameterID::RELEASE)];
-                                float noteOffMs = stepMs * (0.1f + releaseParam * 0.8f);
-                                std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(noteOffMs)));
-                                if (playing) {
-                                    noteOffTrigger[engine][currentStep] = true;
-                                }
-                            }).detach();
-                        }
-                    }
-                }
-                
-                currentStep = getNextStep(currentStep);
-
-                // Check if any double-speed effects are active to adjust timing
-                bool doubleSpeedActive = false;
-                for (const auto& effect : performanceFX.activeEffects) {
-                    if (effect == PerformanceFX::LOOP_16_DOUBLE ||
-                        effect == PerformanceFX::LOOP_12_DOUBLE ||
-                        effect == PerformanceFX::LOOP_SHORT_DOUBLE ||
-                        effect == PerformanceFX::LOOP_SHORTER_DOUBLE) {
-                        doubleSpeedActive = true;
-                        break;
-                    }
+                double horizon = static_cast<double>(g_scheduler.now() + lookahead);
+                double stepSamples = currentStepSamples();
+                // Schedule half a step early so negative micro-timing is never late
+                while (playing && nextStepTime - 0.5 * stepSamples < horizon) {
+                    scheduleStep(step, static_cast<uint64_t>(nextStepTime), stepSamples);
+                    step = getNextStep(step);
+                    nextStepTime += stepSamples;
+                    stepSamples = currentStepSamples();
                 }
-
-                float stepMs = (60.0f / bpm) / 4.0f * 1000.0f;
-                if (doubleSpeedActive) {
-                    stepMs /= 2.0f; // Double speed = half the time
-                }
-                std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(stepMs)));
+                std::this_thread::sleep_for(std::chrono::milliseconds(SCHEDULER_POLL_MS));
             }
             std::cout << "[DEBUG] Sequencer thread exiting loop" << std::endl;
         });
@@ -3983,18 +4026,113 @@ void GridSequencer::play() {
     }
 }
 
+double GridSequencer::currentStepSamples() const {
+    // Check if any double-speed effects are active to adjust timing
+    bool doubleSpeedActive = false;
+    for (const auto& effect : performanceFX.activeEffects) {
+        if (effect == PerformanceFX::LOOP_16_DOUBLE ||
+            effect == PerformanceFX::LOOP_12_DOUBLE ||
+            effect == PerformanceFX::LOOP_SHORT_DOUBLE ||
+            effect == PerformanceFX::LOOP_SHORTER_DOUBLE) {
+            doubleSpeedActive = true;
+            break;
+        }
+    }
+
+    double stepSamples = (60.0 / bpm.load()) / 4.0 * g_scheduler.getSampleRate();
+    if (doubleSpeedActive) {
+        stepSamples *= 0.5; // Double speed = half the time
+    }
+    return stepSamples;
+}
+
+void GridSequencer::scheduleStep(int step, uint64_t stepTime, double stepSamples) {
+    SequencerEvent advance;
+    advance.time = stepTime;
+    advance.type = SequencerEvent::Type::STEP_ADVANCE;
+    advance.step = static_cast<int16_t>(step);
+    g_scheduler.post(advance);
+
+    auto postDrums = [&](int slot) {
+        bool chNow = ((drumMasks[8] >> step) & 1u) || ((drumMasks[9] >> step) & 1u);
+        for (int pad = 0; pad < 16; ++pad) {
+            if ((drumMasks[pad] >> step) & 1u) {
+                // Skip if we just previewed this pad at this step
+                int prev = drumPreviewStep[pad].load();
+                if (prev == step) { drumPreviewStep[pad] = -1; continue; }
+                if (chNow && pad == 10) continue; // choke OH when CH/PH hit same step
+                SequencerEvent hit;
+                hit.time = stepTime;
+                hit.type = SequencerEvent::Type::DRUM_HIT;
+                hit.slot = static_cast<int16_t>(slot);
+                hit.note = static_cast<int16_t>(DRUM_PAD_NOTES[pad]);
+                hit.velocity = accentLatch ? 1.0f : 0.9f;
+                g_scheduler.post(hit);
+            }
+        }
+    };
+
+    auto postMelodic = [&](int row) {
+        const StepData& data = enginePatterns[row][step];
+        if (!data.active) return;
+        // Skip if just previewed live in this step
+        int prev = melodicPreviewStep[row].load();
+        if (prev == step) { melodicPreviewStep[row] = -1; return; }
+
+        // Micro-timing shifts the whole step (note-on and its release)
+        double micro = std::clamp(static_cast<double>(data.microTiming), -0.5, 0.5) * stepSamples;
+        uint64_t onTime = static_cast<uint64_t>(std::max(0.0, static_cast<double>(stepTime) + micro));
+
+        SequencerEvent trigger;
+        trigger.time = onTime;
+        trigger.type = SequencerEvent::Type::STEP_TRIGGER;
+        trigger.slot = static_cast<int16_t>(row);
+        trigger.step = static_cast<int16_t>(step);
+        trigger.duration = static_cast<uint32_t>(stepSamples);
+        g_scheduler.post(trigger);
+
+        // Melodic note-off from the preallocated timed queue (drums manage decay)
+        float releaseParam = engineParameters[row][static_cast<int>(ParameterID::RELEASE)];
+        SequencerEvent release = trigger;
+        release.type = SequencerEvent::Type::NOTE_OFF;
+        release.time = onTime + static_cast<uint64_t>(stepSamples * (0.1 + releaseParam * 0.8));
+        g_scheduler.post(release);
+    };
+
+    if (isCurrentEngineDrum()) {
+        // Trigger any drum whose bit at this step is set; let engine manage decay
+        int slot = rowToSlot[currentEngineRow]; if (slot < 0) slot = 0;
+        if (!(soloEngine>=0 && currentEngineRow!=soloEngine) && !rowMuted[currentEngineRow]) {
+            postDrums(slot);
+        }
+    } else if (playAllEngines) {
+        // Trigger all rows (drums + melodic)
+        for (int s = 0; s < 16; ++s) {
+            int row = slotToRow[s]; if (row < 0) continue;
+            if (soloEngine >= 0 && row != soloEngine) continue;
+            if (rowMuted[row]) continue;
+
+            int slot = rowToSlot[row]; if (slot < 0) slot = 0;
+            if (isEngineDrum(row)) postDrums(slot);
+            else postMelodic(row);
+        }
+    } else {
+        int engine = currentEngineRow;
+        if (!(soloEngine >= 0 && engine != soloEngine) && !rowMuted[engine]) {
+            postMelodic(engine);
+        }
+    }
+}
+
 void GridSequencer::stop() {
     if (playing) { 
-        std::cout << "[DEBUG] Starting stop() - setting playing=false" << std::endl;
         playing = false; 
-        std::cout << "[DEBUG] Calling ether_all_notes_off" << std::endl;
-        ether_all_notes_off(etherEngine); 
-        std::cout << "[DEBUG] Checking if sequencer thread is joinable..." << std::endl;
+        // Join first so the sequencer thread can't schedule notes after the flush
         if (sequencerThread.joinable()) {
-            std::cout << "[DEBUG] Joining sequencer thread..." << std::endl;
             sequencerThread.join();
-            std::cout << "[DEBUG] Sequencer thread joined successfully" << std::endl;
         }
+        g_scheduler.requestFlush();
+        g_allNotesOffRequested = true;
         std::cout << "✓ Stopped" << std::endl; 
     }
 }
@@ -4004,7 +4142,11 @@ void GridSequencer::clearPattern() {
 }
 
 void GridSequencer::shutdownSequencer() {
-    if (running) { stop(); running = false; if (sequencerThread.joinable()) sequencerThread.join(); if (ledUpdateThread.joinable()) ledUpdateThread.join(); if (grid_server) { lo_server_thread_stop(grid_server); lo_server_thread_free(grid_server); grid_server = nullptr; } if (grid_addr) { lo_address_free(grid_addr); grid_addr = nullptr; } if (stream) { Pa_CloseStream(stream); stream = nullptr; } Pa_Terminate(); if (etherEngine) { light::EngineBridge::shutdown(etherEngine); light::EngineBridge::destroy(etherEngine); etherEngine = nullptr; } audioRunning = false; }
+    if (running) { stop(); running = false; if (sequencerThread.joinable()) sequencerThread.join(); if (ledUpdateThread.joinable()) ledUpdateThread.join(); if (grid_server) { lo_server_thread_stop(grid_server); lo_server_thread_free(grid_server); grid_server = nullptr; } if (grid_addr) { lo_address_free(grid_addr); grid_addr = nullptr; } if (stream) { Pa_CloseStream(stream); stream = nullptr; } Pa_Terminate();
+#ifdef __linux__
+    g_midiInput.close();
+#endif
+    if (etherEngine) { light::EngineBridge::shutdown(etherEngine); light::EngineBridge::destroy(etherEngine); etherEngine = nullptr; } audioRunning = false; }
 }
 
 /* END_OLD_INCLASS */
@@ -18,15 +18,30 @@
 #include "src/engines/Classic4OpFMEngine.h"
 #include "src/engines/SamplerSlicerEngine.h"
 #include "src/engines/SerialHPLPEngine.h"
+#include "src/engines/ModalVoiceEngine.h"
 #include "src/engines/DrumKitEngine.h"
 #include "src/engines/GranularEngine.h"
+#include "src/audio/RenderWorkerPool.h"
+#include "src/audio/EngineCrossfader.h"
+#include "src/audio/VoiceManager.h"
+#include "src/audio/PerformanceTelemetry.h"
+#include "src/audio/AuxBusMixer.h"
+#include "src/audio/ChannelStripBank.h"
+#include "src/audio/OfflineRenderer.h"
+#include "src/audio/SceneMorphEngine.h"
+#include "src/audio/TripleBuffer.h"
+#include "src/modulation/GlobalLFOSystem.h"
 
 #include <iostream>
 #include <map>
 #include <string>
 #include <cstring>
+#include <cstddef>
+#include <cstdlib>
 #include <memory>
+#include <bitset>
 #include <chrono>
+#include <thread>
 #include <cmath>
 
 #if defined(__APPLE__)
@@ -37,10 +52,73 @@ extern "C" {
 
 // Harmonized bridge with expanded 16 instrument slots
 static constexpr int SLOT_COUNT = 16;
+static_assert(SLOT_COUNT == ETHER_SNAPSHOT_SLOTS, "Snapshot covers every slot");
+static_assert(static_cast<int>(ParameterID::COUNT) <= ETHER_SNAPSHOT_PARAMS, "Snapshot covers every parameter");
+static_assert(GlobalLFOSystem::MAX_LFOS == ETHER_SNAPSHOT_LFOS, "Snapshot covers every LFO");
+
+static const char* getEngineTypeName(EngineType type) {
+    switch (type) {
+        case EngineType::MACRO_VA: return "MacroVA";
+        case EngineType::MACRO_FM: return "MacroFM";
+        case EngineType::MACRO_WAVESHAPER: return "MacroWaveshaper";
+        case EngineType::MACRO_WAVETABLE: return "MacroWavetable";
+        case EngineType::MACRO_CHORD: return "MacroChord";
+        case EngineType::MACRO_HARMONICS: return "MacroHarmonics";
+        case EngineType::FORMANT_VOCAL: return "FormantVocal";
+        case EngineType::NOISE_PARTICLES: return "NoiseParticles";
+        case EngineType::TIDES_OSC: return "TidesOsc";
+        case EngineType::RINGS_VOICE: return "RingsVoice";
+        case EngineType::ELEMENTS_VOICE: return "ElementsVoice";
+        case EngineType::SLIDE_ACCENT_BASS: return "SlideAccentBass";
+        case EngineType::CLASSIC_4OP_FM: return "Classic4OpFM";
+        case EngineType::GRANULAR: return "Granular";
+        case EngineType::DRUM_KIT: return "DrumKit(fallback)";
+        case EngineType::SAMPLER_KIT: return "SamplerKit(fallback)";
+        case EngineType::SAMPLER_SLICER: return "SamplerSlicer(fallback)";
+        case EngineType::SERIAL_HPLP: return "SerialHPLP(fallback)";
+        case EngineType::RINGS_MODAL: return "RingsModal";
+        case EngineType::ELEMENTS_MODAL: return "ElementsModal";
+        default: return "Unknown";
+    }
+}
+
+static const char* getEngineCategory(EngineType type) {
+    switch (type) {
+        case EngineType::MACRO_VA:
+        case EngineType::MACRO_FM:
+        case EngineType::MACRO_WAVESHAPER:
+        case EngineType::MACRO_WAVETABLE:
+        case EngineType::MACRO_HARMONICS:
+            return "Synthesizers";
+        case EngineType::MACRO_CHORD:
+            return "Multi-Voice";
+        case EngineType::FORMANT_VOCAL:
+        case EngineType::NOISE_PARTICLES:
+            return "Textures";
+        case EngineType::TIDES_OSC:
+        case EngineType::RINGS_VOICE:
+        case EngineType::ELEMENTS_VOICE:
+        case EngineType::RINGS_MODAL:
+        case EngineType::ELEMENTS_MODAL:
+            return "Physical Models";
+        case EngineType::DRUM_KIT:
+            return "Drums";
+        case EngineType::SAMPLER_KIT:
+        case EngineType::SAMPLER_SLICER:
+            return "Sampler";
+        case EngineType::GRANULAR:
+            return "Granular";
+        case EngineType::SERIAL_HPLP:
+            return "Filter";
+        default:
+            return "Other";
+    }
+}
 
 struct Harmonized15EngineEtherSynthInstance {
     float bpm = 120.0f;
     float masterVolume = 0.8f;
+    float sampleRate = SAMPLE_RATE;   // Set with ether_set_sample_rate before audio starts
     int activeInstrument = 0; // 0..15
     bool playing = false;
     bool recording = false;
@@ -52,164 +130,132 @@ struct Harmonized15EngineEtherSynthInstance {
     std::array<float, SLOT_COUNT> slotCyclesBuf{ };
     std::array<float, SLOT_COUNT> slotCyclesSamp{ };
 
-    // Per-slot FX sends
-    std::array<float, SLOT_COUNT> sendReverb{ };
-    std::array<float, SLOT_COUNT> sendDelay{ };
-    // Global FX params
+    // ===== FX send/return buses =====
+    // Each slot sends to the reverb and delay buses through its own level and
+    // tap point. Every bus runs its own return effect, so the two returns stay
+    // independent; bus inputs and effect state are allocated with the sample rate.
+    static constexpr int BUS_REVERB = 0;
+    static constexpr int BUS_DELAY = 1;
+    AuxBusMixer auxBuses;
+    std::array<EtherAudioBuffer, SLOT_COUNT> preSendBuffers{ };   // Engine output for PRE-tap sends
+    // Global FX params (control thread); pushed to the return effects at block start
     struct DelayFX { float timeMs = 350.0f; float feedback = 0.35f; float mix = 0.2f; } delayFX;
     struct ReverbFX { float time = 0.9f; float damp = 0.3f; float mix = 0.2f; } reverbFX;
+    DelayFX appliedDelayFX{ -1.0f, -1.0f, -1.0f };    // Audio thread: last values given to the effects
+    ReverbFX appliedReverbFX{ -1.0f, -1.0f, -1.0f };
     
-    // Simple delay state
-    struct SimpleDelay {
-        std::vector<float> bufL, bufR; size_t idx = 0; float sr = 48000.0f;
-        void setSR(float s){ sr = s; if (bufL.empty()) { bufL.resize((size_t)(sr*2),0.0f); bufR=bufL; }}
-        void process(float* l, float* r, size_t n, float timeMs, float fb, float mix){
-            size_t dl = std::min((size_t)bufL.size()-1, (size_t)std::max(1.0f, timeMs*sr*0.001f));
-            for (size_t i=0;i<n;i++){
-                float di = (float)bufL[(idx+bufL.size()-dl)%bufL.size()];
-                float dj = (float)bufR[(idx+bufR.size()-dl)%bufR.size()];
-                float inL = l[i], inR = r[i];
-                float outL = inL + di * mix; float outR = inR + dj * mix;
-                bufL[idx] = inL + di * fb; bufR[idx] = inR + dj * fb;
-                l[i] = outL; r[i] = outR; idx++; if (idx>=bufL.size()) idx=0;
-            }
-        }
-    } delayState;
+    // Shared voice allocation, stealing and CPU budget across slots
+    static constexpr float VOICE_CPU_BUDGET_PER_THREAD = 0.75f;   // Engine load per render thread
+    VoiceManager voiceManager;
     
-    // Simple reverb stub (multi-tap diffuser)
-    struct SimpleReverb {
-        std::array<size_t,4> taps{ 149, 263, 457, 631 };
-        std::vector<float> bufL, bufR; size_t idx=0; float sr=48000.0f;
-        void setSR(float s){ sr=s; size_t N=(size_t)sr*2; bufL.assign(N,0.0f); bufR.assign(N,0.0f); }
-        void process(float* l, float* r, size_t n, float time, float damp, float mix){
-            size_t N=bufL.size(); if (N<8) return; float fb = std::clamp(time,0.1f,0.98f);
-            for (size_t i=0;i<n;i++){
-                float accL=0.0f, accR=0.0f;
-                for (auto t: taps){ size_t p=(idx+N-t)%N; accL+=bufL[p]; accR+=bufR[p]; }
-                accL /= taps.size(); accR /= taps.size();
-                // damp
-                accL = accL*(1.0f-damp); accR = accR*(1.0f-damp);
-                float inL=l[i], inR=r[i];
-                float fbL=inL + accL*fb; float fbR=inR + accR*fb;
-                bufL[idx]=fbL; bufR[idx]=fbR;
-                l[i]=inL + accL*mix; r[i]=inR + accR*mix; idx++; if (idx>=N) idx=0;
-            }
-        }
-    } reverbState;
-    int activeVoices = 0;
+    // Per-stage block timings (lock-free rings, drained by a reader thread once started)
+    PerformanceTelemetry telemetry;
     
-    // Real synthesis engines per slot
-    std::array<std::unique_ptr<SynthEngine>, SLOT_COUNT> engines;
+    // Newest engine per slot, for control-thread calls. Not owning: once published,
+    // engines belong to the swap pipeline below and are only freed after retirement.
+    std::array<SynthEngine*, SLOT_COUNT> engines{ };
     
     // Engine type per slot
     std::array<EngineType, SLOT_COUNT> engineTypes;
+    // Frames each engine was last told to render (segments may be < BUFFER_SIZE)
+    std::array<size_t, SLOT_COUNT> engineRenderFrames{ };
 
-    // Simple per-slot post processing (global controls apply to all engines)
-    struct PostFilter {
-        // One-pole HPF
-        float hpfCut = 20.0f; // Hz
-        float hpf_a = 0.0f, hpf_y1L = 0.0f, hpf_x1L = 0.0f, hpf_y1R = 0.0f, hpf_x1R = 0.0f;
-        // Biquad LPF (RBJ)
-        float lpfCut = 20000.0f; // Hz
-        float lpfQ = 0.707f;
-        float b0L=1, b1L=0, b2L=0, a1L=0, a2L=0, z1L=0, z2L=0;
-        float b0R=1, b1R=0, b2R=0, a1R=0, a2R=0, z1R=0, z2R=0;
-        float sampleRate = 48000.0f;
-        // Pre/post controls
-        float preGain = 1.0f;   // amplitude gain
-        float drive = 0.0f;     // soft clip amount 0..1
-        float pan = 0.0f;       // -1..1 equal-power
-        
-        void setHPF(float hz) {
-            hpfCut = std::max(10.0f, std::min(hz, sampleRate * 0.45f));
-            float rc = 1.0f / (2.0f * M_PI * hpfCut);
-            float dt = 1.0f / sampleRate;
-            hpf_a = rc / (rc + dt);
-        }
-        void setLPF(float hz, float q) {
-            lpfCut = std::max(20.0f, std::min(hz, sampleRate * 0.45f));
-            lpfQ = std::max(0.1f, q);
-            float w0 = 2.0f * M_PI * (lpfCut / sampleRate);
-            float alpha = std::sin(w0) / (2.0f * lpfQ);
-            float cosw0 = std::cos(w0);
-            float b0 = (1 - cosw0) * 0.5f;
-            float b1 = 1 - cosw0;
-            float b2 = (1 - cosw0) * 0.5f;
-            float a0 = 1 + alpha;
-            float a1 = -2 * cosw0;
-            float a2 = 1 - alpha;
-            // Normalize
-            b0 /= a0; b1 /= a0; b2 /= a0; a1 /= a0; a2 /= a0;
-            b0L=b0; b1L=b1; b2L=b2; a1L=a1; a2L=a2;
-            b0R=b0; b1R=b1; b2R=b2; a1R=a1; a2R=a2;
-        }
-        void setSampleRate(float sr) {
-            sampleRate = sr;
-            setHPF(hpfCut);
-            setLPF(lpfCut, lpfQ);
-        }
-        void setPreGain(float g) { preGain = std::max(0.0f, g); }
-        void setDrive(float d) { drive = std::max(0.0f, std::min(d, 1.0f)); }
-        void setPan(float p) { pan = std::max(-1.0f, std::min(p, 1.0f)); }
-        inline void applyPan(float& l, float& r) {
-            // Equal-power pan
-            float t = (pan + 1.0f) * 0.25f * M_PI; // [-1,1] -> [0, pi/2]
-            float gL = std::cos(t);
-            float gR = std::sin(t);
-            l *= gL; r *= gR;
-        }
-        inline float softClip(float x) const {
-            if (drive <= 0.001f) return x;
-            float k = 1.0f + drive * 5.0f; // up to ~tanh(6x)
-            return std::tanh(k * x);
-        }
-        inline float procHPF(float x, float& y1, float& x1) {
-            float y = hpf_a * (y1 + x - x1);
-            y1 = y; x1 = x; return y;
-        }
-        inline float procLPFL(float x) {
-            float y = b0L*x + z1L; z1L = b1L*x - a1L*y + z2L; z2L = b2L*x - a2L*y; return y;
-        }
-        inline float procLPFR(float x) {
-            float y = b0R*x + z1R; z1R = b1R*x - a1R*y + z2R; z2R = b2R*x - a2R*y; return y;
-        }
-        inline void processFrame(float& l, float& r) {
-            // Pre gain
-            l *= preGain; r *= preGain;
-            // Drive (soft clip)
-            l = softClip(l); r = softClip(r);
-            // Pan
-            applyPan(l, r);
-            l = procHPF(l, hpf_y1L, hpf_x1L);
-            r = procHPF(r, hpf_y1R, hpf_x1R);
-            l = procLPFL(l);
-            r = procLPFR(r);
-        }
-    };
-    std::array<PostFilter, SLOT_COUNT> postFX;
-
-    // ===== Global LFO System (8 per slot, shared) =====
-    static constexpr int MAX_LFOS = 8;
-    struct LFO {
-        int waveform = 0;     // 0=SINE, 1=TRI, 2=SAW_UP, 3=SAW_DOWN, 4=SQUARE, 5=PULSE, etc.
-        float rateHz = 1.0f;  // 0.01..50 Hz
-        float depth = 0.0f;   // 0..1 global depth
-        int syncMode = 0;     // 0=FREE,1=TEMPO,2=KEY,3=ONESHOT,4=ENV
-        float phase = 0.0f;   // 0..2π
-        float lastValue = 0.0f; // -1..+1
-        bool active = false;
-    };
-    // LFOs per slot
-    std::array<std::array<LFO, MAX_LFOS>, SLOT_COUNT> slotLFOs{};
+    // Per-slot post chain (pre-gain/drive/pan/HPF/LPF), all slots processed together in SIMD lanes
+    ChannelStripBank postFX;
 
-    // Per-parameter assignment: 8-bit mask + per-assignment depths
+    // ===== Global LFO System (8 per slot) =====
+    // The audio thread renders each slot's LFOs at the control interval and expands
+    // the assigned parameters into per-frame ramps for the engine and post chain.
+    static constexpr int MAX_LFOS = GlobalLFOSystem::MAX_LFOS;
     static constexpr int PARAM_COUNT = static_cast<int>(ParameterID::COUNT);
-    struct ParamLFOAssign {
-        uint8_t mask = 0;                                  // bit i set => LFO i assigned
-        std::array<float, MAX_LFOS> depths{};              // per-assignment depth 0..1
+    GlobalLFOSystem lfoSystem;
+    // Ramp storage per slot (slots render concurrently)
+    struct SlotModulation {
+        std::array<std::array<float, BUFFER_SIZE>, ChannelStripBank::MOD_COUNT> post{ };
+        std::array<std::array<float, BUFFER_SIZE>, PARAM_COUNT> param{ };   // One ramp per parameter
+        std::bitset<PARAM_COUNT> engineModulated;   // Live engine was handed a ramp for these
+    };
+    std::array<SlotModulation, SLOT_COUNT> slotModulation;
+    std::array<ChannelStripBank::ModBuffers, SLOT_COUNT> postMods{ };   // Post-chain ramps per slot, nullptr = none
+
+    // ===== Engine hot-swap =====
+    // New engines are built and prepared on the calling (non-RT) thread, then published
+    // to the audio thread through a per-slot ring. The audio thread keeps the newest as
+    // `next`, adopts it at block start, crossfades from the previous engine, and returns
+    // every engine it is done with (faded out, or superseded before it ever rendered)
+    // through the retire ring; control-thread calls delete retired engines later
+    // (deferred reclamation). The control thread never frees a published engine.
+    // Calls made on the audio thread (sequencer dispatch) resolve slots through
+    // audioEngine(), never through engines[].
+    static constexpr float ENGINE_SWAP_FADE_MS = 20.0f;
+    static constexpr size_t PUBLISH_CAPACITY = 8;     // Power of two; swaps queued while audio is stopped
+    struct EngineSwap {
+        std::array<SynthEngine*, PUBLISH_CAPACITY> published{ };
+        std::atomic<size_t> publishHead{0};           // Written by control thread
+        std::atomic<size_t> publishTail{0};           // Written by audio thread
+        SynthEngine* next = nullptr;                  // Audio thread: newest published, not yet adopted
+        SynthEngine* live = nullptr;                  // Audio thread: engine being rendered
+        SynthEngine* outgoing = nullptr;              // Audio thread: engine fading out
+        EngineCrossfader crossfader;
+        EtherAudioBuffer fadeBuffer{ };               // Outgoing engine render
     };
-    // For each slot: per-ParameterID mapping
-    std::array<std::array<ParamLFOAssign, PARAM_COUNT>, SLOT_COUNT> lfoAssign{};
+    std::array<EngineSwap, SLOT_COUNT> engineSwaps;
+    static constexpr size_t RETIRE_CAPACITY = 64;     // Power of two
+    std::array<SynthEngine*, RETIRE_CAPACITY> retiredEngines{ };
+    std::atomic<size_t> retireHead{0};                // Written by audio thread
+    std::atomic<size_t> retireTail{0};                // Written by control thread
+    // Thread running ether_process_audio (or an offline render); calls from it are
+    // audio-side. Default id = audio not started: control and audio paths agree then.
+    std::atomic<std::thread::id> audioThread{};
+
+    // ===== Parallel slot rendering =====
+    // Each slot renders (engine + LFO) into its own buffer, possibly on a helper
+    // thread; the post chain then runs for all slots at once in SIMD lanes, and the
+    // master/send mix is reduced in slot order on the audio thread so the output
+    // does not depend on thread timing.
+    std::array<EtherAudioBuffer, SLOT_COUNT> slotBuffers{ };
+    std::array<int, SLOT_COUNT> renderSlots{ };       // Active slots for this block
+    std::array<int, SLOT_COUNT> slotRenderThread{ };  // Thread that last rendered each slot
+    size_t renderFrames = 0;
+    double renderFrameMs = 0.0;
+
+    // ===== Offline render =====
+    // ether_render_offline drives processBlock from the caller's thread, and
+    // setSampleRate rebuilds the graph from it. While either holds the graph, the
+    // live callback outputs silence instead of touching it.
+    std::atomic<bool> graphClaimed{false};
+    std::atomic<bool> callbackActive{false};
+    OfflineRenderer offlineRenderer;
+
+    // Control thread: take the graph from the live callback; false if already taken
+    bool claimGraph() {
+        if (graphClaimed.exchange(true)) return false;
+        while (callbackActive.load()) std::this_thread::yield();
+        return true;
+    }
+    void releaseGraph() { graphClaimed.store(false); }
+
+    // ===== Scenes =====
+    // Scenes are flat vectors (slot x ParameterID, sends, global FX, master).
+    // Control calls compile morph plans; the audio thread lerps and applies them
+    // at block start, before any slot renders.
+    SceneMorphEngine sceneMorph;
+    // Last normalized value set per slot parameter (by control calls or a morph)
+    std::array<std::array<float, PARAM_COUNT>, SLOT_COUNT> slotParams{ };
+    std::array<std::bitset<PARAM_COUNT>, SLOT_COUNT> slotParamsSet{ };
+
+    // ===== UI state snapshot =====
+    // After every callback the audio thread fills the back snapshot and publishes
+    // it if anything changed; ether_read_snapshot hands the newest one to the UI.
+    static constexpr float METER_TIME_S = 0.3f;
+    static constexpr float METER_FLOOR = 1e-5f;       // -100 dBFS
+    TripleBuffer<EtherStateSnapshot> stateSnapshots;
+    EtherStateSnapshot lastSnapshot{ };               // Audio thread: last published contents
+    uint64_t playheadFrames = 0;                      // Audio thread
+    std::array<float, 2> meterPeak{ };
+    std::array<float, 2> meterMeanSquare{ };
+
+    RenderWorkerPool renderPool;                      // Declared last: stops before engines go away
     
     Harmonized15EngineEtherSynthInstance() {
         // Initialize all slots with no engines (nullptr)
@@ -217,13 +263,528 @@ struct Harmonized15EngineEtherSynthInstance {
             engines[i] = nullptr;
             engineTypes[i] = EngineType::MACRO_VA; // Default type
         }
-        for (auto& pf : postFX) { pf.setSampleRate(48000.0f); pf.setHPF(20.0f); pf.setLPF(20000.0f, 0.707f); }
+        postFX.setSampleRate(sampleRate);
+        for (auto& sw : engineSwaps) { sw.crossfader.initialize(sampleRate, ENGINE_SWAP_FADE_MS); }
+        lfoSystem.init(sampleRate, bpm);
+        auxBuses.setSampleRate(sampleRate);
+        auxBuses.setBusReturn(BUS_REVERB, AuxBusMixer::ReturnType::REVERB);
+        auxBuses.setBusReturn(BUS_DELAY, AuxBusMixer::ReturnType::DELAY);
         std::cout << "Harmonized 15-Engine Bridge: Created EtherSynth instance with 15 unified engines" << std::endl;
     }
     
     ~Harmonized15EngineEtherSynthInstance() {
+        renderPool.shutdown();
+        releaseAllEngines();
         std::cout << "Harmonized 15-Engine Bridge: Destroyed EtherSynth instance" << std::endl;
     }
+
+    bool onAudioThread() const {
+        return std::this_thread::get_id() == audioThread.load(std::memory_order_relaxed);
+    }
+
+    // Control thread: queue a prepared engine for the audio thread
+    bool publishEngine(EngineSwap& sw, SynthEngine* engine) {
+        size_t head = sw.publishHead.load(std::memory_order_relaxed);
+        if (head - sw.publishTail.load(std::memory_order_acquire) >= PUBLISH_CAPACITY) return false;
+        sw.published[head & (PUBLISH_CAPACITY - 1)] = engine;
+        sw.publishHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool publishFull(const EngineSwap& sw) const {
+        return sw.publishHead.load(std::memory_order_relaxed) -
+               sw.publishTail.load(std::memory_order_acquire) >= PUBLISH_CAPACITY;
+    }
+
+    // Audio thread: hand an engine back for deletion; false while the ring is full
+    bool retireEngine(SynthEngine* engine) {
+        size_t head = retireHead.load(std::memory_order_relaxed);
+        if (head - retireTail.load(std::memory_order_acquire) >= RETIRE_CAPACITY) return false;
+        retiredEngines[head & (RETIRE_CAPACITY - 1)] = engine;
+        retireHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Audio thread: take newly published engines, keeping only the newest as `next`
+    void drainPublishedEngines(EngineSwap& sw) {
+        size_t tail = sw.publishTail.load(std::memory_order_relaxed);
+        const size_t head = sw.publishHead.load(std::memory_order_acquire);
+        while (tail != head) {
+            if (sw.next && !retireEngine(sw.next)) break;   // Retire ring full: retry next block
+            sw.next = sw.published[tail & (PUBLISH_CAPACITY - 1)];
+            ++tail;
+        }
+        sw.publishTail.store(tail, std::memory_order_release);
+    }
+
+    // Audio thread: the engine notes and parameters for `slot` go to. A newer engine
+    // waiting for a fade to finish owns no voice records yet, so the live one plays.
+    SynthEngine* audioEngine(size_t slot) {
+        adoptPendingEngine(slot);
+        const auto& sw = engineSwaps[slot];
+        return sw.live ? sw.live : sw.next;
+    }
+
+    // Engine for a slot as seen by the calling thread
+    SynthEngine* engineFor(size_t slot) {
+        if (slot >= engines.size()) return nullptr;
+        return onAudioThread() ? audioEngine(slot) : engines[slot];
+    }
+
+    // Audio thread, block start: adopt a published engine unless a fade is still running
+    void adoptPendingEngine(size_t slot) {
+        auto& sw = engineSwaps[slot];
+        drainPublishedEngines(sw);
+        if (!sw.next || sw.outgoing) return;
+        SynthEngine* next = sw.next;
+        sw.next = nullptr;
+        // Hand the slot's voice records over here, between renders (engines that
+        // allocate their own voices only report load). The outgoing engine keeps
+        // its voices for the fade but must not touch the records any more.
+        if (sw.live) sw.live->detachVoiceManager();
+        if (!next->attachVoiceManager(&voiceManager, static_cast<int>(slot))) {
+            voiceManager.resetSlot(static_cast<int>(slot));
+        }
+        if (sw.live) {
+            sw.outgoing = sw.live;
+            sw.crossfader.snapToEngine(false);
+            sw.crossfader.startCrossfadeToB();
+        }
+        sw.live = next;
+        slotModulation[slot].engineModulated.reset();
+        engineRenderFrames[slot] = BUFFER_SIZE;   // Prepared with BUFFER_SIZE by setEngineType
+    }
+
+    // Audio thread, block end: hand finished outgoing engines back for deletion
+    void retireFinishedFades() {
+        for (auto& sw : engineSwaps) {
+            if (!sw.outgoing || sw.crossfader.isCrossfading()) continue;
+            if (!retireEngine(sw.outgoing)) return;   // Retry next block
+            sw.outgoing = nullptr;
+        }
+    }
+
+    // Control thread: delete engines the audio thread has finished with
+    void collectRetiredEngines() {
+        size_t tail = retireTail.load(std::memory_order_relaxed);
+        size_t head = retireHead.load(std::memory_order_acquire);
+        while (tail != head) {
+            delete retiredEngines[tail & (RETIRE_CAPACITY - 1)];
+            retiredEngines[tail & (RETIRE_CAPACITY - 1)] = nullptr;
+            ++tail;
+        }
+        retireTail.store(tail, std::memory_order_release);
+    }
+
+    // Control thread with audio stopped: free every engine, whoever holds it
+    void releaseAllEngines() {
+        collectRetiredEngines();
+        for (size_t slot = 0; slot < engineSwaps.size(); ++slot) {
+            auto& sw = engineSwaps[slot];
+            size_t tail = sw.publishTail.load(std::memory_order_relaxed);
+            const size_t head = sw.publishHead.load(std::memory_order_acquire);
+            for (; tail != head; ++tail) delete sw.published[tail & (PUBLISH_CAPACITY - 1)];
+            sw.publishTail.store(tail, std::memory_order_release);
+            delete sw.next;
+            delete sw.live;
+            delete sw.outgoing;
+            sw.next = nullptr;
+            sw.live = nullptr;
+            sw.outgoing = nullptr;
+            sw.crossfader.snapToEngine(false);
+            engines[slot] = nullptr;
+        }
+    }
+    
+    // Post-chain ramp a modulated parameter feeds, or -1. Mirrors the post-filter
+    // mapping of ether_set_instrument_parameter (HARMONICS tilts the HPF, TIMBRE
+    // moves the LPF cutoff, MORPH its Q).
+    static int postModTarget(ParameterID pid) {
+        switch (pid) {
+            case ParameterID::HPF:
+            case ParameterID::HARMONICS: return ChannelStripBank::MOD_HPF;
+            case ParameterID::FILTER_CUTOFF:
+            case ParameterID::TIMBRE: return ChannelStripBank::MOD_LPF_CUTOFF;
+            case ParameterID::FILTER_RESONANCE:
+            case ParameterID::MORPH: return ChannelStripBank::MOD_LPF_Q;
+            case ParameterID::AMPLITUDE:
+            case ParameterID::VOLUME: return ChannelStripBank::MOD_PRE_GAIN;
+            case ParameterID::CLIP: return ChannelStripBank::MOD_DRIVE;
+            case ParameterID::PAN: return ChannelStripBank::MOD_PAN;
+            default: return -1;
+        }
+    }
+
+    // Render one slot into slotBuffers[slot]: LFOs, post-chain modulation ramps, engine.
+    // Touches only per-slot state, so different slots may render concurrently.
+    void renderSlot(size_t slot, size_t bufferSize, double frameMs) {
+        EtherAudioBuffer& temp = slotBuffers[slot];
+        const int writer = slotRenderThread[slot];
+        const uint64_t lfoStart = PerformanceTelemetry::now();
+        // --- LFOs: control points for this block, expanded into per-frame ramps.
+        // Assigned parameters go to the live engine when it takes modulation, and the
+        // post-chain ones are summed into the post filter's ramps.
+        auto &sw = engineSwaps[slot];
+        auto &mod = slotModulation[slot];
+        ChannelStripBank::ModBuffers& postMod = postMods[slot];
+        postMod.fill(nullptr);
+        lfoSystem.renderBlock((int)slot, (int)bufferSize);
+        for (int p = 0; p < PARAM_COUNT; ++p) {
+            const ParameterID pid = static_cast<ParameterID>(p);
+            float* param = mod.param[p].data();
+            const bool assigned = lfoSystem.renderParamBuffer((int)slot, p, param, (int)bufferSize);
+            if (!assigned && !mod.engineModulated.test(p)) continue;
+            if (sw.live && sw.live->supportsModulation(pid)) {
+                if (assigned) sw.live->setModulationBuffer(pid, param, bufferSize);
+                else sw.live->setModulation(pid, 0.0f);
+                mod.engineModulated.set(p, assigned);
+            }
+            const int target = postModTarget(pid);
+            if (!assigned || target < 0) continue;
+            float* ramp = mod.post[target].data();
+            if (postMod[target]) {
+                for (size_t i = 0; i < bufferSize; ++i) ramp[i] += param[i];
+            } else {
+                std::copy(param, param + bufferSize, ramp);
+                postMod[target] = ramp;
+            }
+        }
+        const uint64_t engineStart = PerformanceTelemetry::now();
+        telemetry.record(writer, PerformanceTelemetry::Stage::LFO, (int)slot, lfoStart, engineStart);
+        auto ts = std::chrono::high_resolution_clock::now();
+        // Process into this slot's buffer. The sequencer may split a callback
+        // at event offsets, so engines render only the requested segment.
+        for (auto &f : temp) { f.left = 0.0f; f.right = 0.0f; }
+        if (sw.live) {
+            if (engineRenderFrames[slot] != bufferSize) {
+                sw.live->setBufferSize(bufferSize);
+                engineRenderFrames[slot] = bufferSize;
+            }
+            auto liveStart = std::chrono::high_resolution_clock::now();
+            sw.live->processAudio(temp);
+            double engineMs = std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - liveStart).count();
+            voiceManager.reportLoad((int)slot, (float)(engineMs / frameMs), (int)sw.live->getActiveVoiceCount());
+        }
+        // Engine swap in progress: fade the previous engine out into the new one
+        if (sw.outgoing) {
+            sw.outgoing->setBufferSize(bufferSize);
+            for (auto &f : sw.fadeBuffer) { f.left = 0.0f; f.right = 0.0f; }
+            sw.outgoing->processAudio(sw.fadeBuffer);
+            float* mix = reinterpret_cast<float*>(temp.data());
+            sw.crossfader.processInterleavedBlock(reinterpret_cast<const float*>(sw.fadeBuffer.data()),
+                                                  mix, mix, (int)bufferSize, 2);
+        }
+        telemetry.record(writer, PerformanceTelemetry::Stage::ENGINE, (int)slot, engineStart, PerformanceTelemetry::now());
+        // PRE-tap sends hear the engine before the post chain
+        if (auxBuses.needsPreTap((int)slot)) {
+            std::copy(temp.begin(), temp.begin() + bufferSize, preSendBuffers[slot].begin());
+        }
+        auto te = std::chrono::high_resolution_clock::now();
+        double msSlot = std::chrono::duration<double, std::milli>(te - ts).count();
+        float pct = (float)std::clamp(msSlot / frameMs * 100.0, 0.0, 400.0);
+        slotCpuPct[slot] = 0.85f * slotCpuPct[slot] + 0.15f * pct;
+        double cyclesAvail = 480000000.0 * ((double)bufferSize / sampleRate);
+        double cyc = (pct / 100.0) * cyclesAvail;
+        slotCyclesBuf[slot] = 0.85f * slotCyclesBuf[slot] + 0.15f * (float)cyc;
+        slotCyclesSamp[slot] = (bufferSize>0) ? (slotCyclesBuf[slot] / (float)bufferSize) : 0.0f;
+    }
+
+    static void renderSlotTask(void* context, int task, int thread) {
+        auto* self = static_cast<Harmonized15EngineEtherSynthInstance*>(context);
+        int slot = self->renderSlots[task];
+        self->slotRenderThread[slot] = thread;
+        self->renderSlot((size_t)slot, self->renderFrames, self->renderFrameMs);
+    }
+    
+    // Render one block of at most BUFFER_SIZE frames into interleaved stereo output
+    void processBlock(float* outputBuffer, size_t bufferSize) {
+        // Clear output buffer
+        for (size_t i = 0; i < bufferSize * 2; i++) {
+            outputBuffer[i] = 0.0f;
+        }
+        
+        // Render active slots (in parallel when helper threads are available)
+        double frameMs = (double)bufferSize / sampleRate * 1000.0;
+        int activeSlots = 0;
+        for (size_t slot = 0; slot < engineSwaps.size(); ++slot) {
+            adoptPendingEngine(slot);
+            const auto& sw = engineSwaps[slot];
+            if (sw.live || sw.outgoing) renderSlots[activeSlots++] = (int)slot;
+        }
+        // Scene morph onto the adopted engines, before this block renders
+        applySceneMorph(bufferSize);
+        renderFrames = bufferSize;
+        renderFrameMs = frameMs;
+        renderPool.run(&Harmonized15EngineEtherSynthInstance::renderSlotTask, this, activeSlots, frameMs);
+        retireFinishedFades();
+
+        // Post chain for all rendered slots at once
+        const uint64_t postStart = PerformanceTelemetry::now();
+        std::array<EtherAudioBuffer*, SLOT_COUNT> stripBuffers{ };
+        for (int n = 0; n < activeSlots; ++n) stripBuffers[renderSlots[n]] = &slotBuffers[renderSlots[n]];
+        postFX.processBlock(stripBuffers.data(), postMods.data(), bufferSize, lfoSystem.getControlInterval());
+        telemetry.record(0, PerformanceTelemetry::Stage::POST_FX, PerformanceTelemetry::ALL_SLOTS,
+                         postStart, PerformanceTelemetry::now());
+
+        // Deterministic reduction: master and sends summed in slot order
+        const uint64_t sendsStart = PerformanceTelemetry::now();
+        applyGlobalFX();
+        auxBuses.beginBlock(bufferSize);
+        for (int n = 0; n < activeSlots; ++n) {
+            int slot = renderSlots[n];
+            const EtherAudioBuffer& temp = slotBuffers[slot];
+            for (size_t i = 0; i < bufferSize; ++i) {
+                outputBuffer[i*2]   += temp[i].left  * masterVolume;
+                outputBuffer[i*2+1] += temp[i].right * masterVolume;
+            }
+            if (auxBuses.hasSends(slot)) {
+                const EtherAudioBuffer* pre = auxBuses.needsPreTap(slot) ? &preSendBuffers[slot] : nullptr;
+                auxBuses.addSlot(slot, pre, temp, bufferSize);
+            }
+        }
+        // Process FX returns (each bus through its own effect)
+        auxBuses.processReturns(outputBuffer, bufferSize);
+        const uint64_t masterStart = PerformanceTelemetry::now();
+        telemetry.record(0, PerformanceTelemetry::Stage::SENDS, PerformanceTelemetry::ALL_SLOTS, sendsStart, masterStart);
+        // Gentle soft clip on mixed output
+        auto softclip = [](float x) {
+            const float drive = 1.5f;
+            return std::tanh(x * drive);
+        };
+        for (size_t i = 0; i < bufferSize; ++i) {
+            outputBuffer[i*2]   = softclip(outputBuffer[i*2]);
+            outputBuffer[i*2+1] = softclip(outputBuffer[i*2+1]);
+        }
+        telemetry.record(0, PerformanceTelemetry::Stage::MASTER, PerformanceTelemetry::ALL_SLOTS,
+                         masterStart, PerformanceTelemetry::now());
+    }
+
+    // Per-slot post filter side of a slot parameter (universal LPF/HPF, level, pan, drive)
+    void setPostParameter(int slot, ParameterID pid, float value) {
+        switch (pid) {
+            case ParameterID::HPF: {
+                // Map 0..1 to 20..200 Hz
+                float hz = 20.0f + std::clamp(value, 0.0f, 1.0f) * 180.0f;
+                postFX.setHPF(slot, hz);
+            } break;
+            case ParameterID::FILTER_CUTOFF: {
+                // Map 0..1 exponentially 100Hz..18kHz for global LPF
+                float norm = std::clamp(value, 0.0f, 1.0f);
+                float hz = 100.0f * std::pow(2.0f, norm * 7.5f); // ~100..18100 Hz
+                postFX.setLPF(slot, hz, postFX.getLPFQ(slot));
+            } break;
+            case ParameterID::FILTER_RESONANCE: {
+                float q = 0.5f + std::clamp(value, 0.0f, 1.0f) * 9.5f;
+                postFX.setLPF(slot, postFX.getLPFCutoff(slot), q);
+            } break;
+            case ParameterID::VOLUME: {
+                // Also scale post pre-gain so engines lacking VOLUME respond
+                float amp = std::clamp(value, 0.0f, 1.0f);
+                postFX.setPreGain(slot, amp * 2.0f);
+            } break;
+            case ParameterID::PAN: {
+                postFX.setPan(slot, std::clamp(value, -1.0f, 1.0f));
+            } break;
+            case ParameterID::AMPLITUDE: {
+                float amp = std::clamp(value, 0.0f, 1.0f);
+                postFX.setPreGain(slot, amp * 2.0f); // up to +6 dB
+            } break;
+            case ParameterID::CLIP: {
+                postFX.setDrive(slot, std::clamp(value, 0.0f, 1.0f));
+            } break;
+            case ParameterID::HARMONICS: {
+                // Map to HPF tilt: 10..600 Hz
+                float hz = 10.0f + std::clamp(value, 0.0f, 1.0f) * 590.0f;
+                postFX.setHPF(slot, hz);
+            } break;
+            case ParameterID::TIMBRE: {
+                // Map to LPF cutoff 300..18kHz
+                float hz = 300.0f * std::pow(2.0f, std::clamp(value, 0.0f, 1.0f) * 6.5f);
+                postFX.setLPF(slot, hz, postFX.getLPFQ(slot));
+            } break;
+            case ParameterID::MORPH: {
+                // Map to LPF Q 0.5..10 for tone emphasis
+                float q = 0.5f + std::clamp(value, 0.0f, 1.0f) * 9.5f;
+                postFX.setLPF(slot, postFX.getLPFCutoff(slot), q);
+            } break;
+            default: break;
+        }
+    }
+
+    // Control thread: the current state as a flat scene. Slot parameters are the
+    // normalized values last set (engines report some in their own units), so
+    // parameters still at the engine default are left out.
+    void captureScene(SceneMorphEngine::Scene& scene) {
+        using Morph = SceneMorphEngine;
+        for (int slot = 0; slot < SLOT_COUNT; ++slot) {
+            for (int bus = 0; bus < Morph::SENDS_PER_SLOT; ++bus) {
+                scene.set(Morph::sendIndex(slot, bus), auxBuses.getSend(slot, bus));
+            }
+            if (!engines[slot]) continue;
+            scene.slotTags[slot] = static_cast<int>(engineTypes[slot]);
+            for (int p = 0; p < PARAM_COUNT; ++p) {
+                if (slotParamsSet[slot].test(p)) scene.set(slot * PARAM_COUNT + p, slotParams[slot][p]);
+            }
+        }
+        scene.set(Morph::globalIndex(Morph::REVERB_TIME), reverbFX.time);
+        scene.set(Morph::globalIndex(Morph::REVERB_DAMP), reverbFX.damp);
+        scene.set(Morph::globalIndex(Morph::REVERB_MIX), reverbFX.mix);
+        scene.set(Morph::globalIndex(Morph::DELAY_TIME), delayFX.timeMs);
+        scene.set(Morph::globalIndex(Morph::DELAY_FEEDBACK), delayFX.feedback);
+        scene.set(Morph::globalIndex(Morph::DELAY_MIX), delayFX.mix);
+        scene.set(Morph::globalIndex(Morph::MASTER_VOLUME), masterVolume);
+    }
+
+    // Audio thread, block start: write the morphed values that moved
+    void applySceneMorph(size_t bufferSize) {
+        using Morph = SceneMorphEngine;
+        const int count = sceneMorph.process(bufferSize, sampleRate);
+        if (count == 0) return;
+        const float* values = sceneMorph.getValues();
+        const uint16_t* indices = sceneMorph.getChangedIndices();
+        for (int n = 0; n < count; ++n) {
+            const int index = indices[n];
+            const float value = values[index];
+            if (index < Morph::SEND_BASE) {
+                const int slot = index / PARAM_COUNT;
+                const ParameterID pid = static_cast<ParameterID>(index % PARAM_COUNT);
+                if (SynthEngine* engine = engineSwaps[slot].live) engine->setParameter(pid, value);
+                setPostParameter(slot, pid, value);
+                slotParams[slot][index % PARAM_COUNT] = value;
+            } else if (index < Morph::GLOBAL_BASE) {
+                const int send = index - Morph::SEND_BASE;
+                auxBuses.setSend(send / Morph::SENDS_PER_SLOT, send % Morph::SENDS_PER_SLOT, value);
+            } else {
+                switch (index - Morph::GLOBAL_BASE) {
+                    case Morph::REVERB_TIME: reverbFX.time = value; break;
+                    case Morph::REVERB_DAMP: reverbFX.damp = value; break;
+                    case Morph::REVERB_MIX: reverbFX.mix = value; break;
+                    case Morph::DELAY_TIME: delayFX.timeMs = value; break;
+                    case Morph::DELAY_FEEDBACK: delayFX.feedback = value; break;
+                    case Morph::DELAY_MIX: delayFX.mix = value; break;
+                    case Morph::MASTER_VOLUME: masterVolume = value; break;
+                    default: break;
+                }
+            }
+        }
+    }
+
+    // Audio thread: hand changed global FX params to the return effects
+    void applyGlobalFX() {
+        if (reverbFX.time != appliedReverbFX.time || reverbFX.damp != appliedReverbFX.damp) {
+            if (ReverbEffect* reverb = auxBuses.getReverb(BUS_REVERB)) {
+                reverb->setRoomSize(std::clamp((reverbFX.time - 0.2f) / 0.8f, 0.0f, 1.0f));
+                reverb->setDamping(reverbFX.damp);
+            }
+        }
+        if (delayFX.timeMs != appliedDelayFX.timeMs || delayFX.feedback != appliedDelayFX.feedback) {
+            if (DelayEffect* delay = auxBuses.getDelay(BUS_DELAY)) {
+                delay->setDelayTime(delayFX.timeMs * 0.001f);
+                delay->setFeedback(delayFX.feedback);
+            }
+        }
+        appliedReverbFX = reverbFX;
+        appliedDelayFX = delayFX;
+        auxBuses.setReturnLevel(BUS_REVERB, reverbFX.mix);
+        auxBuses.setReturnLevel(BUS_DELAY, delayFX.mix);
+    }
+
+    // Audio thread, end of callback: meters, then the snapshot if it changed
+    void publishStateSnapshot(const float* output, size_t frames) {
+        const float release = std::exp(-(float)frames / (METER_TIME_S * sampleRate));
+        for (int ch = 0; ch < 2; ++ch) {
+            float peak = 0.0f, sum = 0.0f;
+            for (size_t i = 0; i < frames; ++i) {
+                const float x = output[i * 2 + ch];
+                peak = std::max(peak, std::fabs(x));
+                sum += x * x;
+            }
+            meterPeak[ch] = std::max(peak, meterPeak[ch] * release);
+            const float meanSquare = frames ? sum / (float)frames : 0.0f;
+            meterMeanSquare[ch] = meanSquare + (meterMeanSquare[ch] - meanSquare) * release;
+            // Settle to exact zero in silence, so idle snapshots stop changing
+            if (meterPeak[ch] < METER_FLOOR) meterPeak[ch] = 0.0f;
+            if (meterMeanSquare[ch] < METER_FLOOR * METER_FLOOR) meterMeanSquare[ch] = 0.0f;
+        }
+        playheadFrames = playing ? playheadFrames + frames : 0;
+
+        EtherStateSnapshot& snap = stateSnapshots.back();
+        snap.version = ETHER_SNAPSHOT_VERSION;
+        snap.size = sizeof(EtherStateSnapshot);
+        snap.playheadFrames = playheadFrames;
+        snap.blockFrames = (uint32_t)frames;
+        snap.peakLeft = meterPeak[0];
+        snap.peakRight = meterPeak[1];
+        snap.rmsLeft = std::sqrt(meterMeanSquare[0]);
+        snap.rmsRight = std::sqrt(meterMeanSquare[1]);
+        snap.cpuUsage = cpuUsage;
+        snap.activeVoices = voiceManager.getActiveVoiceCount();
+        snap.voiceSteals = (uint32_t)voiceManager.getStealCount();
+        snap.sceneMorphPosition = sceneMorph.getPosition();
+        snap.bpm = bpm;
+        snap.sampleRate = sampleRate;
+        snap.masterVolume = masterVolume;
+        snap.playing = playing ? 1 : 0;
+        snap.recording = recording ? 1 : 0;
+        snap.activeInstrument = activeInstrument;
+        snap.voiceLimit = voiceManager.getVoiceLimit();
+        for (int slot = 0; slot < SLOT_COUNT; ++slot) {
+            SynthEngine* engine = engineSwaps[slot].live;
+            snap.activeVoiceCount[slot] = engine ? (int32_t)engine->getActiveVoiceCount() : 0;
+            snap.slotCpuPct[slot] = slotCpuPct[slot];
+            for (int lfo = 0; lfo < ETHER_SNAPSHOT_LFOS; ++lfo) snap.lfoValues[slot][lfo] = lfoSystem.getLFOValue(slot, lfo);
+            snap.engineType[slot] = engine ? static_cast<int32_t>(engineTypes[slot]) : -1;
+            for (int p = 0; p < ETHER_SNAPSHOT_PARAMS; ++p) {
+                snap.params[slot][p] = engine && p < PARAM_COUNT ? engine->getParameter(static_cast<ParameterID>(p)) : 0.0f;
+            }
+            for (int bus = 0; bus < ETHER_SNAPSHOT_SENDS; ++bus) snap.fxSends[slot][bus] = auxBuses.getSend(slot, bus);
+        }
+        // Compare the live and state sections separately; publish only on a change
+        constexpr size_t liveStart = offsetof(EtherStateSnapshot, playheadFrames);
+        constexpr size_t stateStart = offsetof(EtherStateSnapshot, bpm);
+        const auto* next = reinterpret_cast<const uint8_t*>(&snap);
+        const auto* last = reinterpret_cast<const uint8_t*>(&lastSnapshot);
+        const bool stateChanged = lastSnapshot.sequence == 0 ||
+            std::memcmp(next + stateStart, last + stateStart, sizeof(snap) - stateStart) != 0;
+        if (!stateChanged && std::memcmp(next + liveStart, last + liveStart, stateStart - liveStart) == 0) return;
+        snap.sequence = lastSnapshot.sequence + 1;
+        snap.stateSequence = lastSnapshot.stateSequence + (stateChanged ? 1 : 0);
+        lastSnapshot = snap;
+        stateSnapshots.publish();
+    }
+
+    // Change the sample rate of everything that depends on it. Not real-time safe
+    // (delay lines are reallocated), so the live callback is silenced while it runs;
+    // refused during an offline render.
+    void setSampleRate(float sr) {
+        if (!(sr >= 8000.0f && sr <= 192000.0f)) return;
+        if (!claimGraph()) {
+            std::cout << "Harmonized 13-Engine Bridge: Sample rate change refused during offline render" << std::endl;
+            return;
+        }
+        sampleRate = sr;
+        collectRetiredEngines();
+        // Every engine a slot holds: published but not yet drained, waiting, live, fading out
+        for (auto& sw : engineSwaps) {
+            const size_t head = sw.publishHead.load(std::memory_order_acquire);
+            for (size_t tail = sw.publishTail.load(std::memory_order_relaxed); tail != head; ++tail) {
+                sw.published[tail & (PUBLISH_CAPACITY - 1)]->setSampleRate(sr);
+            }
+            for (SynthEngine* engine : {sw.next, sw.live, sw.outgoing}) {
+                if (engine) engine->setSampleRate(sr);
+            }
+            sw.crossfader.setSampleRate(sr);
+        }
+        lfoSystem.setSampleRate(sr);
+        postFX.setSampleRate(sr);
+        auxBuses.setSampleRate(sr);
+        appliedReverbFX = ReverbFX{ -1.0f, -1.0f, -1.0f };
+        appliedDelayFX = DelayFX{ -1.0f, -1.0f, -1.0f };
+        telemetry.setSampleRate(sr);
+        releaseGraph();
+        std::cout << "Harmonized 13-Engine Bridge: Sample rate " << sr << " Hz" << std::endl;
+    }
     
     // Create a real synthesis engine of the specified type (all using SynthEngine interface)
     std::unique_ptr<SynthEngine> createEngine(EngineType type) {
@@ -260,6 +821,10 @@ struct Harmonized15EngineEtherSynthInstance {
                 return std::make_unique<SamplerSlicerEngine>();
             case EngineType::SERIAL_HPLP:
                 return std::make_unique<SerialHPLPEngine>();
+            case EngineType::RINGS_MODAL:
+                return std::make_unique<ModalVoiceEngine>(ModalVoiceEngine::Model::RINGS);
+            case EngineType::ELEMENTS_MODAL:
+                return std::make_unique<ModalVoiceEngine>(ModalVoiceEngine::Model::ELEMENTS);
                 
             // For engines that still have issues, fall back to working ones
             case EngineType::DRUM_KIT:
@@ -276,73 +841,29 @@ struct Harmonized15EngineEtherSynthInstance {
         size_t index = static_cast<size_t>(slot);
         if (index >= engines.size()) return;
         
-        // Destroy old engine
-        engines[index] = nullptr;
+        // Free engines from earlier swaps the audio thread has finished with
+        collectRetiredEngines();
+        auto& sw = engineSwaps[index];
+        if (publishFull(sw)) {
+            // Only happens when several swaps pile up with audio stopped
+            std::cout << "Harmonized 13-Engine Bridge: Engine swap queue full for slot " << index << std::endl;
+            return;
+        }
         
-        // Create new engine
-        engines[index] = createEngine(type);
+        // Build and prepare the new engine here, off the audio thread
+        std::unique_ptr<SynthEngine> engine = createEngine(type);
+        if (!engine) return;
+        engine->setSampleRate(sampleRate);
+        engine->setBufferSize(BUFFER_SIZE);
+        
+        // From here the audio side owns it: the previous engine keeps rendering until
+        // the crossfade ends, and whichever engine is done goes through the retire ring
+        engines[index] = engine.release();
         engineTypes[index] = type;
+        slotParamsSet[index].reset();
+        publishEngine(sw, engines[index]);
         
-        if (engines[index]) {
-            engines[index]->setSampleRate(48000.0f);
-            engines[index]->setBufferSize(128);
-            postFX[index].setSampleRate(48000.0f);
-            std::cout << "Harmonized 13-Engine Bridge: Created REAL " << getEngineTypeName(type) << " engine for slot " << index << std::endl;
-        }
-    }
-    
-    const char* getEngineTypeName(EngineType type) {
-        switch (type) {
-            case EngineType::MACRO_VA: return "MacroVA";
-            case EngineType::MACRO_FM: return "MacroFM";
-            case EngineType::MACRO_WAVESHAPER: return "MacroWaveshaper";
-            case EngineType::MACRO_WAVETABLE: return "MacroWavetable";
-            case EngineType::MACRO_CHORD: return "MacroChord";
-            case EngineType::MACRO_HARMONICS: return "MacroHarmonics";
-            case EngineType::FORMANT_VOCAL: return "FormantVocal";
-            case EngineType::NOISE_PARTICLES: return "NoiseParticles";
-            case EngineType::TIDES_OSC: return "TidesOsc";
-            case EngineType::RINGS_VOICE: return "RingsVoice";
-            case EngineType::ELEMENTS_VOICE: return "ElementsVoice";
-            case EngineType::SLIDE_ACCENT_BASS: return "SlideAccentBass";
-            case EngineType::CLASSIC_4OP_FM: return "Classic4OpFM";
-            case EngineType::GRANULAR: return "Granular";
-            case EngineType::DRUM_KIT: return "DrumKit(fallback)";
-            case EngineType::SAMPLER_KIT: return "SamplerKit(fallback)";
-            case EngineType::SAMPLER_SLICER: return "SamplerSlicer(fallback)";
-            case EngineType::SERIAL_HPLP: return "SerialHPLP(fallback)";
-            default: return "Unknown";
-        }
-    }
-    const char* getEngineCategory(EngineType type) {
-        switch (type) {
-            case EngineType::MACRO_VA:
-            case EngineType::MACRO_FM:
-            case EngineType::MACRO_WAVESHAPER:
-            case EngineType::MACRO_WAVETABLE:
-            case EngineType::MACRO_HARMONICS:
-                return "Synthesizers";
-            case EngineType::MACRO_CHORD:
-                return "Multi-Voice";
-            case EngineType::FORMANT_VOCAL:
-            case EngineType::NOISE_PARTICLES:
-                return "Textures";
-            case EngineType::TIDES_OSC:
-            case EngineType::RINGS_VOICE:
-            case EngineType::ELEMENTS_VOICE:
-                return "Physical Models";
-            case EngineType::DRUM_KIT:
-                return "Drums";
-            case EngineType::SAMPLER_KIT:
-            case EngineType::SAMPLER_SLICER:
-                return "Sampler";
-            case EngineType::GRANULAR:
-                return "Granular";
-            case EngineType::SERIAL_HPLP:
-                return "Filter";
-            default:
-                return "Other";
-        }
+        std::cout << "Harmonized 13-Engine Bridge: Created REAL " << getEngineTypeName(type) << " engine for slot " << index << std::endl;
     }
 };
 
@@ -354,6 +875,7 @@ void ether_set_bpm(void* synth, float bpm) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     if (!instance) return;
     instance->bpm = std::max(20.0f, std::min(bpm, 300.0f));
+    instance->lfoSystem.setBPM(instance->bpm);
 }
 
 float ether_get_bpm(void* synth) {
@@ -372,149 +894,80 @@ int ether_initialize(void* synth) {
     // Initialize with MacroVA engine on instrument 0
     instance->setEngineType(0, EngineType::MACRO_VA);
     
-    instance->delayState.setSR(48000.0f);
-    instance->reverbState.setSR(48000.0f);
+    instance->auxBuses.setSampleRate(instance->sampleRate);
+    
+    // Helper threads for parallel slot rendering (none on single-core systems)
+    instance->renderPool.initialize();
+    std::cout << "Harmonized 13-Engine Bridge: Render threads: " << instance->renderPool.getThreadCount()
+              << (instance->renderPool.isParallel() ? " (parallel)" : " (serial)") << std::endl;
+    
+    // Cap polyphony by measured voice cost once engines have rendered a few blocks
+    instance->voiceManager.setCpuBudget(Harmonized15EngineEtherSynthInstance::VOICE_CPU_BUDGET_PER_THREAD *
+                                        (float)instance->renderPool.getThreadCount());
+    
+    // ETHER_TELEMETRY=<file> records stage timings from the start and dumps them there
+    instance->telemetry.setSampleRate(instance->sampleRate);
+    if (const char* telemetryPath = std::getenv(PerformanceTelemetry::PATH_ENV)) {
+        instance->telemetry.start(telemetryPath);
+        std::cout << "Harmonized 13-Engine Bridge: Telemetry to " << telemetryPath << std::endl;
+    }
     std::cout << "Harmonized 13-Engine Bridge: Initialized with unified synthesis engines" << std::endl;
     return 1;
 }
 
 void ether_process_audio(void* synth, float* outputBuffer, size_t bufferSize) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
-    auto t0 = std::chrono::high_resolution_clock::now();
-    
-    // Clear output buffer
-    for (size_t i = 0; i < bufferSize * 2; i++) {
-        outputBuffer[i] = 0.0f;
+    // An offline render or sample rate change owns the graph: stay silent until it finishes
+    instance->callbackActive.store(true);
+    if (instance->graphClaimed.load()) {
+        std::fill(outputBuffer, outputBuffer + bufferSize * 2, 0.0f);
+        instance->callbackActive.store(false);
+        return;
     }
+    // Later calls from this thread (sequencer dispatch) resolve slots audio-side
+    instance->audioThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    auto t0 = std::chrono::high_resolution_clock::now();
+    instance->telemetry.beginCallback();
+    const uint64_t callbackStart = PerformanceTelemetry::now();
     
-    // Mix all engine slots
-    EtherAudioBuffer temp;
-    std::vector<float> sendL(bufferSize,0.0f), sendR(bufferSize,0.0f);
-    double frameMs = (double)bufferSize / 48000.0 * 1000.0;
-    for (size_t slot = 0; slot < instance->engines.size(); ++slot) {
-        if (!instance->engines[slot]) continue;
-        // --- LFO update & apply per-slot modulations (once per block)
-        // Step LFOs and compute per-parameter combined value (snapshot)
-        // Basic stepping: phase += 2π f / sr * bufferSize
-        for (int i=0;i<instance->MAX_LFOS;i++) {
-            auto &l = instance->slotLFOs[slot][i];
-            float inc = 2.0f * (float)M_PI * std::max(0.01f, l.rateHz) / 48000.0f;
-            l.phase += inc * (float)bufferSize; // block step
-            // wrap
-            if (l.phase > 2.0f * (float)M_PI) l.phase -= 2.0f * (float)M_PI;
-            // simple waveforms
-            float v = 0.0f;
-            switch (l.waveform) {
-                case 0: v = std::sinf(l.phase); break;                      // sine
-                case 1: {                                                   // tri
-                    float p = fmodf(l.phase/(2.0f*(float)M_PI),1.0f);
-                    v = 4.0f * fabsf(p - 0.5f) - 1.0f;
-                } break;
-                case 4: v = (std::sinf(l.phase) >= 0.0f) ? 1.0f : -1.0f; break; // square
-                default: v = std::sinf(l.phase); break;
-            }
-            l.lastValue = v * std::clamp(l.depth, 0.0f, 1.0f);
-        }
-        // For this slot, derive modulation deltas for post-chain fields
-        float modHPF = 0.0f, modLPFCut = 0.0f, modLPFQ = 0.0f, modPreGain = 0.0f, modDrive = 0.0f, modPan = 0.0f;
-        auto accumulate = [&](ParameterID pid, float &target){
-            int pidIdx = static_cast<int>(pid);
-            const auto &assign = instance->lfoAssign[slot][pidIdx];
-            if (assign.mask==0) return;
-            float sum = 0.0f;
-            for (int i=0;i<instance->MAX_LFOS;i++) {
-                if (assign.mask & (1u<<i)) {
-                    sum += instance->slotLFOs[slot][i].lastValue * std::clamp(assign.depths[i], 0.0f, 1.0f);
-                }
-            }
-            target += sum; // accumulate
-        };
-        accumulate(ParameterID::HPF, modHPF);
-        accumulate(ParameterID::FILTER_CUTOFF, modLPFCut);
-        accumulate(ParameterID::FILTER_RESONANCE, modLPFQ);
-        accumulate(ParameterID::HARMONICS, modHPF);     // tilt contributes to HPF
-        accumulate(ParameterID::TIMBRE, modLPFCut);     // brightness contributes to LPF cutoff
-        accumulate(ParameterID::MORPH, modLPFQ);        // focus contributes to Q
-        accumulate(ParameterID::AMPLITUDE, modPreGain);
-        accumulate(ParameterID::VOLUME, modPreGain);    // mirror volume
-        accumulate(ParameterID::CLIP, modDrive);
-        accumulate(ParameterID::PAN, modPan);
-        // Apply deltas with safe scales
-        auto &pf = instance->postFX[slot];
-        // hpf tilt: 10..600 Hz scaled by ~±20%
-        float hpfBase = pf.hpfCut;
-        float hpf = std::max(10.0f, hpfBase * (1.0f + 0.2f * modHPF));
-        pf.setHPF(hpf);
-        // lpf cutoff: scale exponentially by ± one octave per |mod|≈1
-        float lpfBase = pf.lpfCut;
-        float lpf = std::max(100.0f, lpfBase * std::pow(2.0f, 0.8f * modLPFCut));
-        pf.setLPF(lpf, pf.lpfQ);
-        // q: ±2.0 around base
-        float qBase = pf.lpfQ;
-        float q = std::clamp(qBase + 2.0f * modLPFQ, 0.5f, 10.0f);
-        pf.setLPF(pf.lpfCut, q);
-        // pre-gain: ±50%
-        pf.setPreGain(std::max(0.1f, pf.preGain * (1.0f + 0.5f * modPreGain)));
-        // drive: ±0.5
-        pf.setDrive(std::clamp(pf.drive + 0.5f * modDrive, 0.0f, 1.0f));
-        // pan: ±0.5
-        pf.setPan(std::clamp(pf.pan + 0.5f * modPan, -1.0f, 1.0f));
-        auto ts = std::chrono::high_resolution_clock::now();
-        // Process into temp and accumulate
-        for (auto &f : temp) { f.left = 0.0f; f.right = 0.0f; }
-        instance->engines[slot]->processAudio(temp);
-        // Apply per-slot post filters (pre-gain/drive/pan/HPF/LPF)
-        for (size_t i = 0; i < bufferSize; ++i) {
-            float l = temp[i].left;
-            float r = temp[i].right;
-            instance->postFX[slot].processFrame(l, r);
-            temp[i].left = l; temp[i].right = r;
-        }
-        for (size_t i = 0; i < bufferSize; ++i) {
-            outputBuffer[i*2]   += temp[i].left  * instance->masterVolume;
-            outputBuffer[i*2+1] += temp[i].right * instance->masterVolume;
-            // accumulate sends
-            float sR = instance->sendReverb[slot]; float sD = instance->sendDelay[slot];
-            if (sR>0.0001f || sD>0.0001f){
-                sendL[i] += temp[i].left * (sR + sD);
-                sendR[i] += temp[i].right* (sR + sD);
-            }
-        }
-        auto te = std::chrono::high_resolution_clock::now();
-        double msSlot = std::chrono::duration<double, std::milli>(te - ts).count();
-        float pct = (float)std::clamp(msSlot / frameMs * 100.0, 0.0, 400.0);
-        instance->slotCpuPct[slot] = 0.85f * instance->slotCpuPct[slot] + 0.15f * pct;
-        double cyclesAvail = 480000000.0 * ((double)bufferSize / 48000.0);
-        double cyc = (pct / 100.0) * cyclesAvail;
-        instance->slotCyclesBuf[slot] = 0.85f * instance->slotCyclesBuf[slot] + 0.15f * (float)cyc;
-        instance->slotCyclesSamp[slot] = (bufferSize>0) ? (instance->slotCyclesBuf[slot] / (float)bufferSize) : 0.0f;
-    }
-    // Process FX returns
-    instance->delayState.process(sendL.data(), sendR.data(), bufferSize, instance->delayFX.timeMs, instance->delayFX.feedback, instance->delayFX.mix);
-    instance->reverbState.process(sendL.data(), sendR.data(), bufferSize, instance->reverbFX.time, instance->reverbFX.damp, instance->reverbFX.mix);
-    for (size_t i=0;i<bufferSize;i++){ outputBuffer[i*2]+=sendL[i]; outputBuffer[i*2+1]+=sendR[i]; }
-    // Gentle soft clip on mixed output
-    auto softclip = [](float x) {
-        const float drive = 1.5f;
-        return std::tanh(x * drive);
-    };
-    for (size_t i = 0; i < bufferSize; ++i) {
-        outputBuffer[i*2]   = softclip(outputBuffer[i*2]);
-        outputBuffer[i*2+1] = softclip(outputBuffer[i*2+1]);
+    // Hosts may use any buffer size: render in blocks of at most BUFFER_SIZE frames
+    for (size_t done = 0; done < bufferSize; ) {
+        size_t frames = std::min(bufferSize - done, BUFFER_SIZE);
+        instance->processBlock(outputBuffer + done * 2, frames);
+        done += frames;
     }
     
     // CPU usage estimation: processing time vs buffer duration
     auto t1 = std::chrono::high_resolution_clock::now();
     double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
-    double frameMs2 = (double)bufferSize / 48000.0 * 1000.0; // sampleRate hardcoded 48k
-    float inst = (float)std::clamp(ms / frameMs2 * 100.0, 0.0, 400.0);
+    double frameMs = (double)bufferSize / instance->sampleRate * 1000.0;
+    float inst = (bufferSize > 0) ? (float)std::clamp(ms / frameMs * 100.0, 0.0, 400.0) : 0.0f;
     // Exponential moving average for stability
     instance->cpuUsage = 0.85f * instance->cpuUsage + 0.15f * inst;
     // Estimate cycles/buffer @480 MHz
-    double cyclesAvail = 480000000.0 * ((double)bufferSize / 48000.0);
+    double cyclesAvail = 480000000.0 * ((double)bufferSize / instance->sampleRate);
     double cyc = (inst / 100.0) * cyclesAvail;
     instance->cycles480_buf = 0.85f * instance->cycles480_buf + 0.15f * (float)cyc;
     instance->cycles480_samp = (bufferSize > 0) ? (instance->cycles480_buf / (float)bufferSize) : 0.0f;
+    instance->publishStateSnapshot(outputBuffer, bufferSize);
+    instance->telemetry.endCallback(callbackStart, PerformanceTelemetry::now(), bufferSize);
+    instance->callbackActive.store(false);
+}
+
+void ether_set_sample_rate(void* synth, float sampleRate) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return;
+    instance->setSampleRate(sampleRate);
+}
+
+float ether_get_sample_rate(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return SAMPLE_RATE;
+    return instance->sampleRate;
+}
+
+int ether_get_max_block_size(void) {
+    return (int)BUFFER_SIZE;
 }
 
 void ether_play(void* synth) {
@@ -533,9 +986,8 @@ void ether_note_on(void* synth, int key_index, float velocity, float aftertouch)
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     size_t activeIndex = static_cast<size_t>(instance->activeInstrument);
     
-    if (activeIndex < instance->engines.size() && instance->engines[activeIndex]) {
-        instance->engines[activeIndex]->noteOn(key_index, velocity, aftertouch);
-        instance->activeVoices++;
+    if (SynthEngine* engine = instance->engineFor(activeIndex)) {
+        engine->noteOn(key_index, velocity, aftertouch);
     }
 }
 
@@ -543,11 +995,8 @@ void ether_note_off(void* synth, int key_index) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     size_t activeIndex = static_cast<size_t>(instance->activeInstrument);
     
-    if (activeIndex < instance->engines.size() && instance->engines[activeIndex]) {
-        instance->engines[activeIndex]->noteOff(key_index);
-        if (instance->activeVoices > 0) {
-            instance->activeVoices--;
-        }
+    if (SynthEngine* engine = instance->engineFor(activeIndex)) {
+        engine->noteOff(key_index);
     }
 }
 
@@ -555,10 +1004,9 @@ void ether_all_notes_off(void* synth) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     size_t activeIndex = static_cast<size_t>(instance->activeInstrument);
     
-    if (activeIndex < instance->engines.size() && instance->engines[activeIndex]) {
-        instance->engines[activeIndex]->allNotesOff();
+    if (SynthEngine* engine = instance->engineFor(activeIndex)) {
+        engine->allNotesOff();
     }
-    instance->activeVoices = 0;
 }
 
 void ether_set_instrument_engine_type(void* synth, int instrument, int engine_type) {
@@ -583,8 +1031,7 @@ int ether_get_instrument_engine_type(void* synth, int instrument) {
 
 const char* ether_get_engine_type_name(int engine_type) {
     if (engine_type >= 0 && engine_type < static_cast<int>(EngineType::COUNT)) {
-        Harmonized15EngineEtherSynthInstance dummy;
-        return dummy.getEngineTypeName(static_cast<EngineType>(engine_type));
+        return getEngineTypeName(static_cast<EngineType>(engine_type));
     }
     return "Unknown";
 }
@@ -607,7 +1054,7 @@ int ether_get_active_instrument(void* synth) {
 
 int ether_get_active_voice_count(void* synth) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
-    return instance->activeVoices;
+    return instance->voiceManager.getActiveVoiceCount();
 }
 
 float ether_get_cpu_usage(void* synth) {
@@ -657,60 +1104,15 @@ void ether_set_instrument_parameter(void* synth, int instrument, int param_id, f
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     size_t idx = static_cast<size_t>(instrument);
     
-    if (idx < instance->engines.size() && instance->engines[idx]) {
+    if (SynthEngine* engine = instance->engineFor(idx)) {
         // Convert int parameter ID to ParameterID enum
         if (param_id >= 0 && param_id < static_cast<int>(ParameterID::COUNT)) {
             ParameterID paramEnum = static_cast<ParameterID>(param_id);
-            instance->engines[idx]->setParameter(paramEnum, value);
+            engine->setParameter(paramEnum, value);
+            instance->slotParams[idx][param_id] = value;
+            instance->slotParamsSet[idx].set(param_id);
             // Also drive per-slot post filters for universal LPF/HPF
-            switch (paramEnum) {
-                case ParameterID::HPF: {
-                    // Map 0..1 to 20..200 Hz
-                    float hz = 20.0f + std::clamp(value, 0.0f, 1.0f) * 180.0f;
-                    instance->postFX[idx].setHPF(hz);
-                } break;
-                case ParameterID::FILTER_CUTOFF: {
-                    // Map 0..1 exponentially 100Hz..18kHz for global LPF
-                    float norm = std::clamp(value, 0.0f, 1.0f);
-                    float hz = 100.0f * std::pow(2.0f, norm * 7.5f); // ~100..18100 Hz
-                    instance->postFX[idx].setLPF(hz, instance->postFX[idx].lpfQ);
-                } break;
-                case ParameterID::FILTER_RESONANCE: {
-                    float q = 0.5f + std::clamp(value, 0.0f, 1.0f) * 9.5f;
-                    instance->postFX[idx].setLPF(instance->postFX[idx].lpfCut, q);
-                } break;
-                case ParameterID::VOLUME: {
-                    // Also scale post pre-gain so engines lacking VOLUME respond
-                    float amp = std::clamp(value, 0.0f, 1.0f);
-                    instance->postFX[idx].setPreGain(amp * 2.0f);
-                } break;
-                case ParameterID::PAN: {
-                    instance->postFX[idx].setPan(std::clamp(value, -1.0f, 1.0f));
-                } break;
-                case ParameterID::AMPLITUDE: {
-                    float amp = std::clamp(value, 0.0f, 1.0f);
-                    instance->postFX[idx].setPreGain(amp * 2.0f); // up to +6 dB
-                } break;
-                case ParameterID::CLIP: {
-                    instance->postFX[idx].setDrive(std::clamp(value, 0.0f, 1.0f));
-                } break;
-                case ParameterID::HARMONICS: {
-                    // Map to HPF tilt: 10..600 Hz
-                    float hz = 10.0f + std::clamp(value, 0.0f, 1.0f) * 590.0f;
-                    instance->postFX[idx].setHPF(hz);
-                } break;
-                case ParameterID::TIMBRE: {
-                    // Map to LPF cutoff 300..18kHz
-                    float hz = 300.0f * std::pow(2.0f, std::clamp(value, 0.0f, 1.0f) * 6.5f);
-                    instance->postFX[idx].setLPF(hz, instance->postFX[idx].lpfQ);
-                } break;
-                case ParameterID::MORPH: {
-                    // Map to LPF Q 0.5..10 for tone emphasis
-                    float q = 0.5f + std::clamp(value, 0.0f, 1.0f) * 9.5f;
-                    instance->postFX[idx].setLPF(instance->postFX[idx].lpfCut, q);
-                } break;
-                default: break;
-            }
+            instance->setPostParameter(instrument, paramEnum, value);
         }
     }
 }
@@ -732,10 +1134,13 @@ float ether_get_instrument_parameter(void* synth, int instrument, int param_id)
 void ether_shutdown(void* synth) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     
-    // All engines now use SynthEngine interface, no shutdown() method needed
-    for (auto& engine : instance->engines) {
-        engine = nullptr; // Destructor handles cleanup
-    }
+    // Stop render helpers before engines go away
+    instance->renderPool.shutdown();
+    instance->telemetry.stop();
+    
+    // All engines now use SynthEngine interface, no shutdown() method needed;
+    // this also frees engines still pending, fading out or awaiting reclamation
+    instance->releaseAllEngines();
     
     std::cout << "Harmonized 15-Engine Bridge: Shutdown" << std::endl;
 }
@@ -745,8 +1150,8 @@ extern "C" {
 void ether_drum_set_param(void* synth, int instrument, int pad, int which, float value) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     size_t index = static_cast<size_t>(instrument);
-    if (index < instance->engines.size() && instance->engines[index]) {
-        auto* dk = dynamic_cast<DrumKitEngine*>(instance->engines[index].get());
+    if (SynthEngine* engine = instance->engineFor(index)) {
+        auto* dk = dynamic_cast<DrumKitEngine*>(engine);
         if (!dk) return;
         // Treat value as delta for convenience
         switch (which) {
@@ -796,16 +1201,37 @@ bool ether_engine_has_parameter(void* synth, int instrument, int param_id) {
 // FX sends
 void ether_set_engine_fx_send(void* synth, int instrument, int which, float value) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
-    size_t idx = static_cast<size_t>(instrument);
-    value = std::clamp(value, 0.0f, 1.0f);
-    if (idx < instance->sendReverb.size()) {
-        if (which == 0) instance->sendReverb[idx] = value;
-        else if (which == 1) instance->sendDelay[idx] = value;
-    }
+    if (instrument < 0 || instrument >= SLOT_COUNT) return;
+    // which: 0 = reverb bus, 1 = delay bus
+    instance->auxBuses.setSend(instrument, which, value);
+}
+
+// Send tap point per slot and bus: post = 1 taps after the slot's post chain
+// (the default), post = 0 taps the engine output before it
+void ether_set_engine_fx_send_tap(void* synth, int instrument, int which, int post) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (instrument < 0 || instrument >= SLOT_COUNT) return;
+    instance->auxBuses.setSendTap(instrument, which, post ? AuxBusMixer::Tap::POST : AuxBusMixer::Tap::PRE);
+}
+
+int ether_get_engine_fx_send_tap(void* synth, int instrument, int which) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (instrument < 0 || instrument >= SLOT_COUNT) return 1;
+    return instance->auxBuses.getSendTap(instrument, which) == AuxBusMixer::Tap::POST ? 1 : 0;
 }
 
 // ===== Global LFO C API (8 global LFOs per instrument slot) =====
 
+// Settings edits keep the LFO running (restart = false) so turning a knob does not
+// reset its phase
+static void editLFO(Harmonized15EngineEtherSynthInstance* in, int instrument, int lfoIndex,
+                    void (*edit)(GlobalLFOSystem::LFOSettings&, float), float value) {
+    GlobalLFOSystem::LFOSettings settings;
+    in->lfoSystem.getLFO(instrument, lfoIndex, settings);
+    edit(settings, value);
+    in->lfoSystem.setLFO(instrument, lfoIndex, settings, false);
+}
+
 // Bridge compatibility: match minimal C header (no instrument param)
 void ether_set_lfo_waveform(void* synth, unsigned char lfo_id, unsigned char waveform) {
     auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
@@ -814,8 +1240,10 @@ void ether_set_lfo_waveform(void* synth, unsigned char lfo_id, unsigned char wav
     int lfoIndex = static_cast<int>(lfo_id);
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
-    in->slotLFOs[instrument][lfoIndex].waveform = (int)waveform;
-    in->slotLFOs[instrument][lfoIndex].active = true;
+    if (waveform >= static_cast<int>(GlobalLFOSystem::Waveform::COUNT)) return;
+    editLFO(in, instrument, lfoIndex, [](GlobalLFOSystem::LFOSettings& s, float v) {
+        s.wave = static_cast<GlobalLFOSystem::Waveform>((int)v);
+    }, (float)waveform);
 }
 
 void ether_set_lfo_rate(void* synth, unsigned char lfo_id, float rate) {
@@ -825,8 +1253,9 @@ void ether_set_lfo_rate(void* synth, unsigned char lfo_id, float rate) {
     int lfoIndex = static_cast<int>(lfo_id);
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
-    in->slotLFOs[instrument][lfoIndex].rateHz = std::clamp(rate, 0.01f, 50.0f);
-    in->slotLFOs[instrument][lfoIndex].active = true;
+    editLFO(in, instrument, lfoIndex, [](GlobalLFOSystem::LFOSettings& s, float v) {
+        s.rateHz = std::clamp(v, 0.01f, 50.0f);
+    }, rate);
 }
 
 void ether_set_lfo_depth(void* synth, unsigned char lfo_id, float depth) {
@@ -836,8 +1265,9 @@ void ether_set_lfo_depth(void* synth, unsigned char lfo_id, float depth) {
     int lfoIndex = static_cast<int>(lfo_id);
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
-    in->slotLFOs[instrument][lfoIndex].depth = std::clamp(depth, 0.0f, 1.0f);
-    in->slotLFOs[instrument][lfoIndex].active = true;
+    editLFO(in, instrument, lfoIndex, [](GlobalLFOSystem::LFOSettings& s, float v) {
+        s.depth = std::clamp(v, 0.0f, 1.0f);
+    }, depth);
 }
 
 void ether_set_lfo_sync(void* synth, int instrument, int lfoIndex, int syncMode) {
@@ -845,7 +1275,16 @@ void ether_set_lfo_sync(void* synth, int instrument, int lfoIndex, int syncMode)
     if (!in) return;
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
-    in->slotLFOs[instrument][lfoIndex].syncMode = std::clamp(syncMode, 0, 4);
+    editLFO(in, instrument, lfoIndex, [](GlobalLFOSystem::LFOSettings& s, float v) {
+        s.sync = static_cast<GlobalLFOSystem::SyncMode>((int)v);   // 0=FREE,1=TEMPO,2=KEY,3=ONESHOT,4=ENV
+    }, (float)std::clamp(syncMode, 0, 4));
+}
+
+// LFO evaluation interval in samples: 1 = audio rate, BUFFER_SIZE = once per block
+void ether_set_lfo_control_interval(void* synth, int samples) {
+    auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!in) return;
+    in->lfoSystem.setControlInterval(samples);
 }
 
 void ether_assign_lfo_to_param_id(void* synth, int instrument, int lfoIndex, int paramId, float depth) {
@@ -854,10 +1293,7 @@ void ether_assign_lfo_to_param_id(void* synth, int instrument, int lfoIndex, int
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
     if (paramId < 0 || paramId >= (int)Harmonized15EngineEtherSynthInstance::PARAM_COUNT) return;
-    auto &assign = in->lfoAssign[instrument][paramId];
-    assign.mask |= (1u << lfoIndex);
-    assign.depths[lfoIndex] = std::clamp(depth, 0.0f, 1.0f);
-    in->slotLFOs[instrument][lfoIndex].active = true;
+    in->lfoSystem.assign(instrument, paramId, lfoIndex, std::clamp(depth, 0.0f, 1.0f));
 }
 
 void ether_remove_lfo_assignment_by_param(void* synth, int instrument, int lfoIndex, int paramId) {
@@ -866,9 +1302,7 @@ void ether_remove_lfo_assignment_by_param(void* synth, int instrument, int lfoIn
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
     if (lfoIndex < 0 || lfoIndex >= Harmonized15EngineEtherSynthInstance::MAX_LFOS) return;
     if (paramId < 0 || paramId >= (int)Harmonized15EngineEtherSynthInstance::PARAM_COUNT) return;
-    auto &assign = in->lfoAssign[instrument][paramId];
-    assign.mask &= ~(1u << lfoIndex);
-    assign.depths[lfoIndex] = 0.0f;
+    in->lfoSystem.unassign(instrument, paramId, lfoIndex);
 }
 
 int ether_get_parameter_lfo_info(void* synth, int instrument, int keyIndex, int* activeLFOs, float* currentValue) {
@@ -876,37 +1310,22 @@ int ether_get_parameter_lfo_info(void* synth, int instrument, int keyIndex, int*
     if (!in || !activeLFOs || !currentValue) return 0;
     if (instrument < 0 || instrument >= (int)in->engines.size()) return 0;
     if (keyIndex < 0 || keyIndex >= (int)Harmonized15EngineEtherSynthInstance::PARAM_COUNT) return 0;
-    const auto &assign = in->lfoAssign[instrument][keyIndex];
-    *activeLFOs = (int)assign.mask;
-    float sum = 0.0f;
-    for (int i=0;i<Harmonized15EngineEtherSynthInstance::MAX_LFOS;i++) {
-        if (assign.mask & (1u<<i)) {
-            sum += in->slotLFOs[instrument][i].lastValue * std::clamp(assign.depths[i], 0.0f, 1.0f);
-        }
-    }
-    *currentValue = sum; // -? .. +?
-    return assign.mask ? 1 : 0;
+    uint8_t mask = in->lfoSystem.mask(instrument, keyIndex);
+    *activeLFOs = (int)mask;
+    *currentValue = in->lfoSystem.combinedValue(instrument, keyIndex);
+    return mask ? 1 : 0;
 }
 
 void ether_trigger_instrument_lfos(void* synth, int instrument) {
     auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
     if (!in) return;
     if (instrument < 0 || instrument >= (int)in->engines.size()) return;
-    for (int i=0;i<Harmonized15EngineEtherSynthInstance::MAX_LFOS;i++) {
-        auto &l = in->slotLFOs[instrument][i];
-        if (l.syncMode==2 /*KEY*/ || l.syncMode==3 /*ONESHOT*/ || l.syncMode==4 /*ENV*/) {
-            l.phase = 0.0f;
-        }
-    }
+    in->lfoSystem.retrigger(instrument);   // KEY/ONESHOT/ENV LFOs only
 }
 float ether_get_engine_fx_send(void* synth, int instrument, int which) {
     auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
-    size_t idx = static_cast<size_t>(instrument);
-    if (idx < instance->sendReverb.size()) {
-        if (which == 0) return instance->sendReverb[idx];
-        if (which == 1) return instance->sendDelay[idx];
-    }
-    return 0.0f;
+    if (instrument < 0 || instrument >= SLOT_COUNT) return 0.0f;
+    return instance->auxBuses.getSend(instrument, which);
 }
 void ether_set_fx_global(void* synth, int which, int param, float value) {
     auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
@@ -940,6 +1359,26 @@ float ether_get_engine_cpu_pct(void* synth, int instrument){
     if (idx<in->slotCpuPct.size()) return in->slotCpuPct[idx];
     return 0.0f;
 }
+// Render thread stats: thread 0 is the audio thread, 1.. are helpers
+int ether_get_render_thread_count(void* synth){
+    auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return in->renderPool.getThreadCount();
+}
+float ether_get_render_thread_cpu_pct(void* synth, int thread){
+    auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return in->renderPool.getThreadLoad(thread);
+}
+int ether_get_engine_render_thread(void* synth, int instrument){
+    auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    size_t idx = static_cast<size_t>(instrument);
+    if (idx<in->slotRenderThread.size()) return in->slotRenderThread[idx];
+    return 0;
+}
+// threads: total render threads (1 = serial), <0 = one per core. Call while audio is stopped.
+void ether_set_render_threads(void* synth, int threads){
+    auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    in->renderPool.initialize(threads < 0 ? -1 : std::max(0, threads - 1));
+}
 float ether_get_engine_cycles_480_buf(void* synth, int instrument){ auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth); size_t idx=(size_t)instrument; if (idx<in->slotCyclesBuf.size()) return in->slotCyclesBuf[idx]; return 0.0f; }
 float ether_get_engine_cycles_480_smp(void* synth, int instrument){ auto* in = static_cast<Harmonized15EngineEtherSynthInstance*>(synth); size_t idx=(size_t)instrument; if (idx<in->slotCyclesSamp.size()) return in->slotCyclesSamp[idx]; return 0.0f; }
 void ether_set_engine_voice_count(void* synth, int instrument, int voices) {
@@ -959,9 +1398,213 @@ int ether_get_engine_voice_count(void* synth, int instrument) {
     return (int)MAX_VOICES;
 }
 
+// Voice allocation across slots: 0 = oldest, 1 = quietest, 2 = lowest priority
+void ether_set_voice_steal_policy(void* synth, int policy) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (policy < 0 || policy > static_cast<int>(VoiceManager::StealPolicy::LOWEST_PRIORITY)) return;
+    instance->voiceManager.setStealPolicy(static_cast<VoiceManager::StealPolicy>(policy));
+}
+
+void ether_set_voice_budget(void* synth, int voices) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    instance->voiceManager.setVoiceBudget(voices);
+}
+
+// Engine load in cores (1.0 = one full block); <= 0 removes the CPU cap
+void ether_set_voice_cpu_budget(void* synth, float load) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    instance->voiceManager.setCpuBudget(load);
+}
+
+void ether_set_instrument_priority(void* synth, int instrument, int priority) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    instance->voiceManager.setSlotPriority(instrument, (uint8_t)std::clamp(priority, 0, 127));
+}
+
+int ether_get_voice_limit(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return instance->voiceManager.getVoiceLimit();
+}
+
+int ether_get_voice_steal_count(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return (int)instance->voiceManager.getStealCount();
+}
+
+// ===== Performance telemetry =====
+int ether_telemetry_start(void* synth, const char* dumpPath) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return 0;
+    return instance->telemetry.start(dumpPath ? dumpPath : "") ? 1 : 0;
+}
+
+void ether_telemetry_stop(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return;
+    instance->telemetry.stop();
+}
+
+// stage: 0 LFO, 1 engine, 2 post FX, 3 sends, 4 master, 5 whole callback; slot -1 = all slots.
+// Returns the number of blocks measured.
+int ether_telemetry_get_stats(void* synth, int stage, int slot, float* p50Us, float* p99Us, float* maxUs) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance || stage < 0 || stage >= PerformanceTelemetry::STAGE_COUNT) return 0;
+    auto stats = instance->telemetry.getStats(static_cast<PerformanceTelemetry::Stage>(stage), slot);
+    if (p50Us) *p50Us = stats.p50Us;
+    if (p99Us) *p99Us = stats.p99Us;
+    if (maxUs) *maxUs = stats.maxUs;
+    return (int)std::min<uint64_t>(stats.count, INT32_MAX);
+}
+
+int ether_telemetry_get_overrun_count(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return 0;
+    return (int)instance->telemetry.getOverrunCount();
+}
+
+// Audio thread: the host saw an xrun (missed callback or device underrun)
+void ether_telemetry_report_xrun(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return;
+    instance->telemetry.reportXrun();
+}
+
+int ether_telemetry_dump(void* synth, const char* path) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance || !path) return 0;
+    instance->telemetry.poll();
+    return instance->telemetry.dump(path) ? 1 : 0;
+}
+
+// ===== Offline render =====
+static void offlineRenderBlock(void* context, float* out, size_t frames) {
+    static_cast<Harmonized15EngineEtherSynthInstance*>(context)->processBlock(out, frames);
+}
+
+static void offlineEvent(void* context, const OfflineRenderer::Event& event) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(context);
+    if (event.slot < 0 || event.slot >= SLOT_COUNT) return;
+    SynthEngine* engine = instance->audioEngine((size_t)event.slot);
+    switch (event.type) {
+        case OfflineRenderer::NOTE_ON:
+            if (engine) engine->noteOn((uint8_t)std::clamp(event.data, 0, 127), event.value, 0.0f);
+            break;
+        case OfflineRenderer::NOTE_OFF:
+            if (engine) engine->noteOff((uint8_t)std::clamp(event.data, 0, 127));
+            break;
+        case OfflineRenderer::ALL_NOTES_OFF:
+            if (engine) engine->allNotesOff();
+            break;
+        case OfflineRenderer::PARAMETER:
+            ether_set_instrument_parameter(instance, event.slot, event.data, event.value);
+            break;
+    }
+}
+
+// Render `frames` frames of the current project to a WAV file as fast as the CPU
+// allows, on the calling (non-RT) thread with the slot render pool. Events land at
+// their exact frame. format: 0 = 16-bit, 1 = 24-bit, 2 = 32-bit float.
+// Voice stealing ignores measured CPU cost during the render, so a freshly
+// created and configured instance renders the same events bit-identically.
+// Returns 1 when the file was written.
+int ether_render_offline(void* synth, const char* path, const OfflineRenderer::Event* events, int eventCount,
+                         uint64_t frames, int format) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance || !path || format < 0 || format > 2) return 0;
+    if (!instance->claimGraph()) return 0;   // Already rendering or changing sample rate
+
+    const float cpuBudget = instance->voiceManager.getCpuBudget();
+    instance->voiceManager.setCpuBudget(0.0f);
+    instance->collectRetiredEngines();
+    // This thread stands in for the audio thread until the render is done
+    const std::thread::id liveAudioThread = instance->audioThread.exchange(std::this_thread::get_id());
+
+    OfflineRenderer::Config config;
+    config.sampleRate = instance->sampleRate;
+    config.totalFrames = frames;
+    config.format = static_cast<OfflineRenderer::Format>(format);
+    bool ok = instance->offlineRenderer.render(path, config, events, (size_t)std::max(0, eventCount),
+                                               &offlineRenderBlock, &offlineEvent, instance);
+    // Leave no offline notes hanging in the live session
+    for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+        if (SynthEngine* engine = instance->audioEngine(slot)) engine->allNotesOff();
+    }
+    instance->audioThread.store(liveAudioThread);
+    instance->voiceManager.setCpuBudget(cpuBudget);
+    instance->releaseGraph();
+
+    const auto& stats = instance->offlineRenderer.getStats();
+    std::cout << "Harmonized 13-Engine Bridge: Offline render " << (ok ? "wrote " : "failed ") << path << " ("
+              << stats.frames << " frames in " << stats.renderSeconds << " s, "
+              << stats.realtimeFactor << "x realtime)" << std::endl;
+    return ok ? 1 : 0;
+}
+
+float ether_get_offline_render_progress(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return 0.0f;
+    return instance->offlineRenderer.getProgress();
+}
+
+void ether_cancel_offline_render(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return;
+    instance->offlineRenderer.cancel();
+}
+
+// ===== UI state snapshot =====
+uint64_t ether_read_snapshot(void* synth, EtherStateSnapshot* out) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance || !out) return 0;
+    instance->stateSnapshots.update();
+    const EtherStateSnapshot& snap = instance->stateSnapshots.front();
+    if (out->sequence != snap.sequence) *out = snap;
+    return snap.sequence;
+}
+
+// ===== Scenes =====
+// Capture the current state of every slot as a scene; returns its id (0 on failure)
+uint32_t ether_capture_scene(void* synth, const char* name) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return 0;
+    SceneMorphEngine::Scene scene;
+    scene.name = name ? name : "";
+    instance->captureScene(scene);
+    return instance->sceneMorph.storeScene(scene);
+}
+
+// Move from the current state to a scene over morphTime seconds (0 = immediately)
+bool ether_recall_scene(void* synth, uint32_t sceneId, float morphTime) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance) return false;
+    const SceneMorphEngine::Scene* target = instance->sceneMorph.getScene(sceneId);
+    if (!target) return false;
+    SceneMorphEngine::Scene current;
+    instance->captureScene(current);
+    instance->sceneMorph.recall(current, *target, morphTime);
+    return true;
+}
+
+// Knob morph: position 0 = fromSceneId, 1 = toSceneId. The plan is compiled when
+// the pair changes; moving the knob only publishes the position.
+void ether_morph_between_scenes(void* synth, uint32_t fromSceneId, uint32_t toSceneId, float morphPosition) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    if (!instance || !instance->sceneMorph.setMorph(fromSceneId, toSceneId)) return;
+    instance->sceneMorph.setPosition(morphPosition);
+}
+
+float ether_get_scene_morph_position(void* synth) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return instance ? instance->sceneMorph.getPosition() : 0.0f;
+}
+
+bool ether_delete_scene(void* synth, uint32_t sceneId) {
+    auto* instance = static_cast<Harmonized15EngineEtherSynthInstance*>(synth);
+    return instance && instance->sceneMorph.deleteScene(sceneId);
+}
+
 } // extern "C"
 const char* ether_get_engine_category_name(int engine_type) {
-    Harmonized15EngineEtherSynthInstance dummy;
     if (engine_type < 0 || engine_type >= static_cast<int>(EngineType::COUNT)) return "Other";
-    return dummy.getEngineCategory(static_cast<EngineType>(engine_type));
+    return getEngineCategory(static_cast<EngineType>(engine_type));
 }
@@ -1,6 +1,7 @@
 #include "LoudnessMonitor.h"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <chrono>
 #include <iostream>
 #include <numeric>
@@ -606,8 +607,23 @@ float LoudnessMonitor::KWeightingFilter::HighPassFilter::process(float input) {
 
 // True peak detector implementation
 void LoudnessMonitor::TruePeakDetector::initialize(int maxBufferSize) {
-    upsampleBuffer.resize(maxBufferSize * OVERSAMPLE_FACTOR);
-    filterBuffer.resize(maxBufferSize * OVERSAMPLE_FACTOR);
+    (void)maxBufferSize; // Frame-based: memory no longer scales with the block size
+    
+    frameFFT.setSize(FRAME_SIZE);
+    upsampleFFT.setSize(FRAME_SIZE * OVERSAMPLE_FACTOR);
+    upsampleBuffer.resize(FRAME_SIZE * OVERSAMPLE_FACTOR);
+    filterBuffer.resize(FRAME_SIZE);
+    spectrumRe.resize(upsampleFFT.getNumBins());
+    spectrumIm.resize(upsampleFFT.getNumBins());
+    
+    // Flat centre, raised-cosine edges so the frame wraps without a discontinuity
+    taperWindow.assign(FRAME_SIZE, 1.0f);
+    for (int i = 0; i < TAPER_SIZE; i++) {
+        float w = 0.5f * (1.0f - std::cos(float(M_PI) * float(i) / float(TAPER_SIZE)));
+        taperWindow[i] = w;
+        taperWindow[FRAME_SIZE - 1 - i] = w;
+    }
+    
     reset();
 }
 
@@ -619,13 +635,28 @@ void LoudnessMonitor::TruePeakDetector::reset() {
 }
 
 float LoudnessMonitor::TruePeakDetector::process(const float* buffer, int bufferSize) {
-    // Simplified true peak detection (should use proper 4x oversampling filter)
-    float currentMax = -120.0f;
+    if (filterBuffer.empty()) return 0.0f;
     
+    // Sample peak is a lower bound for the true peak
+    float currentMax = 0.0f;
     for (int i = 0; i < bufferSize; i++) {
-        float absValue = std::abs(buffer[i]);
-        if (absValue > currentMax) {
-            currentMax = absValue;
+        currentMax = std::max(currentMax, std::abs(buffer[i]));
+    }
+    
+    // Slide input into the frame history, interpolating every HOP_SIZE samples
+    int consumed = 0;
+    while (consumed < bufferSize) {
+        int count = std::min(HOP_SIZE - bufferIndex, bufferSize - consumed);
+        std::memmove(filterBuffer.data(), filterBuffer.data() + count,
+                    (FRAME_SIZE - count) * sizeof(float));
+        std::memcpy(filterBuffer.data() + (FRAME_SIZE - count), buffer + consumed,
+                   count * sizeof(float));
+        consumed += count;
+        bufferIndex += count;
+        
+        if (bufferIndex == HOP_SIZE) {
+            currentMax = std::max(currentMax, processFrame());
+            bufferIndex = 0;
         }
     }
     
@@ -636,6 +667,34 @@ float LoudnessMonitor::TruePeakDetector::process(const float* buffer, int buffer
     return currentMax;
 }
 
+float LoudnessMonitor::TruePeakDetector::processFrame() {
+    const int frameBins = FRAME_SIZE / 2;
+    const int upsampledSize = FRAME_SIZE * OVERSAMPLE_FACTOR;
+    
+    // Tapered frame -> spectrum
+    for (int i = 0; i < FRAME_SIZE; i++) {
+        upsampleBuffer[i] = filterBuffer[i] * taperWindow[i];
+    }
+    frameFFT.forwardReal(upsampleBuffer.data(), spectrumRe.data(), spectrumIm.data());
+    
+    // Zero-pad above the original Nyquist (split the Nyquist bin) and resynthesise
+    spectrumRe[frameBins] *= 0.5f;
+    spectrumIm[frameBins] = 0.0f;
+    std::fill(spectrumRe.begin() + frameBins + 1, spectrumRe.end(), 0.0f);
+    std::fill(spectrumIm.begin() + frameBins + 1, spectrumIm.end(), 0.0f);
+    upsampleFFT.inverseReal(spectrumRe.data(), spectrumIm.data(), upsampleBuffer.data());
+    
+    // Inverse scales by the upsampled length; restore the original amplitude
+    const float gain = float(OVERSAMPLE_FACTOR);
+    const int start = TAPER_SIZE * OVERSAMPLE_FACTOR;
+    const int end = upsampledSize - start;
+    float framePeak = 0.0f;
+    for (int i = start; i < end; i++) {
+        framePeak = std::max(framePeak, std::abs(upsampleBuffer[i]) * gain);
+    }
+    return framePeak;
+}
+
 float LoudnessMonitor::getProcessingLoad() const {
     return processingLoad_.load();
 }
@@ -5,6 +5,7 @@
 #include <mutex>
 #include <atomic>
 #include <deque>
+#include "../audio/FFT.h"
 
 /**
  * Professional LUFS Loudness Monitor for EtherSynth V1.0
@@ -199,16 +200,28 @@ private:
     };
     
     // True peak measurement with 4x oversampling
+    // Band-limited interpolation by FFT zero-padding over overlapping frames;
+    // only the centre hop of each frame is searched to avoid edge ringing.
     struct TruePeakDetector {
         static constexpr int OVERSAMPLE_FACTOR = 4;
-        std::vector<float> upsampleBuffer;
-        std::vector<float> filterBuffer;
+        static constexpr int FRAME_SIZE = 256;
+        static constexpr int HOP_SIZE = FRAME_SIZE / 2;
+        static constexpr int TAPER_SIZE = (FRAME_SIZE - HOP_SIZE) / 2;
+        
+        FFT frameFFT;                          // FRAME_SIZE real FFT
+        FFT upsampleFFT;                       // FRAME_SIZE * OVERSAMPLE_FACTOR inverse
+        std::vector<float> upsampleBuffer;     // Interpolated frame
+        std::vector<float> filterBuffer;       // Input frame history
+        std::vector<float> taperWindow;        // Tukey edge taper
+        std::vector<float> spectrumRe;
+        std::vector<float> spectrumIm;
         float maxTruePeak = -120.0f;
-        int bufferIndex = 0;
+        int bufferIndex = 0;                   // New samples since last frame
         
         void initialize(int maxBufferSize);
         void reset();
         float process(const float* buffer, int bufferSize);
+        float processFrame();
         float getCurrentPeak() const { return maxTruePeak; }
     };
     
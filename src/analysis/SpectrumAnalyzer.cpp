@@ -12,10 +12,6 @@ SpectrumAnalyzer::SpectrumAnalyzer()
     , processingLoad_(0.0f)
     , lastProcessTime_(0)
 {
-    // Initialize buffers
-    inputBuffer_.resize(FFT_SIZE, 0.0f);
-    windowBuffer_.resize(FFT_SIZE, 0.0f);
-    fftBuffer_.resize(FFT_SIZE);
     magnitudeHistory_.resize(BINS * 10, 0.0f); // 10 frames of history
     
     // Initialize analysis data
@@ -27,22 +23,11 @@ SpectrumAnalyzer::SpectrumAnalyzer()
     // Create bark band mapping
     barkBandStart_ = std::vector<int>(BARK_BANDS);
     barkBandEnd_ = std::vector<int>(BARK_BANDS);
-    barkBandWeights_ = std::vector<float>(BARK_BANDS);
+    barkBandWeights_ = std::vector<float>(BARK_BANDS, 1.0f);
     
-    // Initialize bark bands (0-24 bark scale mapped to 0-24kHz)
-    for (int i = 0; i < BARK_BANDS; i++) {
-        float bark = float(i);
-        float startHz = barkToHz(bark);
-        float endHz = barkToHz(bark + 1.0f);
-        
-        barkBandStart_[i] = getBinForFrequency(startHz);
-        barkBandEnd_[i] = getBinForFrequency(endHz);
-        barkBandWeights_[i] = 1.0f;
-    }
-    
-    // Create window function
-    windowFunction_ = createHannWindow(FFT_SIZE);
-    windowCacheValid_ = true;
+    // Allocate FFT plan, buffers, window and bark mapping
+    windowSize_ = 0;
+    setWindowSize(FFT_SIZE);
 }
 
 SpectrumAnalyzer::~SpectrumAnalyzer() {
@@ -56,28 +41,28 @@ void SpectrumAnalyzer::processAudioBuffer(const float* buffer, int bufferSize) {
     std::lock_guard<std::mutex> lock(analysisMutex_);
     
     // Copy input data to circular buffer
-    int copySize = std::min(bufferSize, FFT_SIZE);
+    int copySize = std::min(bufferSize, windowSize_);
     
     // Shift existing data
-    if (copySize < FFT_SIZE) {
+    if (copySize < windowSize_) {
         std::memmove(inputBuffer_.data(), 
                     inputBuffer_.data() + copySize, 
-                    (FFT_SIZE - copySize) * sizeof(float));
+                    (windowSize_ - copySize) * sizeof(float));
     }
     
-    // Copy new data
-    std::memcpy(inputBuffer_.data() + (FFT_SIZE - copySize), 
-               buffer, copySize * sizeof(float));
+    // Copy new data (most recent samples if the buffer exceeds the window)
+    std::memcpy(inputBuffer_.data() + (windowSize_ - copySize), 
+               buffer + (bufferSize - copySize), copySize * sizeof(float));
     
-    // Apply window function
-    windowBuffer_ = inputBuffer_;
+    // Apply window function (sizes match, so no reallocation)
+    std::copy(inputBuffer_.begin(), inputBuffer_.end(), windowBuffer_.begin());
     applyWindow(windowBuffer_);
     
     // Perform FFT
-    performFFT(windowBuffer_, fftBuffer_);
+    performFFT(windowBuffer_);
     
     // Calculate magnitudes
-    calculateMagnitudes(fftBuffer_);
+    calculateMagnitudes();
     
     // Calculate spectral features
     calculateSpectralFeatures();
@@ -109,25 +94,9 @@ const SpectrumAnalyzer::AudioFeatures& SpectrumAnalyzer::getAudioFeatures() cons
     return currentFeatures_;
 }
 
-void SpectrumAnalyzer::performFFT(const std::vector<float>& input, 
-                                 std::vector<std::complex<float>>& output) {
-    // Simple DFT implementation for demonstration
-    // In a real implementation, use FFTW or accelerated FFT
-    
-    const float two_pi = 2.0f * M_PI;
-    const int N = FFT_SIZE;
-    
-    for (int k = 0; k < N; k++) {
-        std::complex<float> sum(0.0f, 0.0f);
-        
-        for (int n = 0; n < N; n++) {
-            float angle = -two_pi * k * n / N;
-            std::complex<float> w(std::cos(angle), std::sin(angle));
-            sum += input[n] * w;
-        }
-        
-        output[k] = sum;
-    }
+void SpectrumAnalyzer::performFFT(const std::vector<float>& input) {
+    // Real-input FFT; plan and bin buffers are owned by setWindowSize()
+    fft_.forwardReal(input.data(), fftReal_.data(), fftImag_.data());
 }
 
 void SpectrumAnalyzer::applyWindow(std::vector<float>& buffer) const {
@@ -140,12 +109,13 @@ void SpectrumAnalyzer::applyWindow(std::vector<float>& buffer) const {
     }
 }
 
-void SpectrumAnalyzer::calculateMagnitudes(const std::vector<std::complex<float>>& fftData) {
-    const float scale = 2.0f / FFT_SIZE;
+void SpectrumAnalyzer::calculateMagnitudes() {
+    const float scale = 2.0f / windowSize_;
+    const int activeBins = std::min(BINS, windowSize_ / 2);
     
-    for (int i = 0; i < BINS; i++) {
-        float real = fftData[i].real();
-        float imag = fftData[i].imag();
+    for (int i = 0; i < activeBins; i++) {
+        float real = fftReal_[i];
+        float imag = fftImag_[i];
         float magnitude = std::sqrt(real * real + imag * imag) * scale;
         
         // Apply smoothing
@@ -297,11 +267,11 @@ void SpectrumAnalyzer::updateAudioFeatures() {
 }
 
 float SpectrumAnalyzer::getFrequencyForBin(int bin) const {
-    return (float(bin) * sampleRate_) / (2.0f * FFT_SIZE);
+    return (float(bin) * sampleRate_) / float(windowSize_);
 }
 
 int SpectrumAnalyzer::getBinForFrequency(float frequency) const {
-    return int((frequency * 2.0f * FFT_SIZE) / sampleRate_);
+    return int((frequency * float(windowSize_)) / sampleRate_);
 }
 
 float SpectrumAnalyzer::getBandEnergy(float lowFreq, float highFreq) const {
@@ -422,9 +392,40 @@ void SpectrumAnalyzer::renderSpectrum(uint32_t* displayBuffer, int width, int he
 }
 
 void SpectrumAnalyzer::setSampleRate(float sampleRate) {
+    std::lock_guard<std::mutex> lock(analysisMutex_);
     sampleRate_.store(sampleRate);
+    updateBarkBandMapping();
+}
+
+void SpectrumAnalyzer::setWindowSize(int windowSize) {
+    // Round down to a supported power of two
+    windowSize = std::max(MIN_WINDOW_SIZE, std::min(windowSize, int(FFT_SIZE)));
+    while (!FFT::isPowerOfTwo(windowSize)) {
+        windowSize &= windowSize - 1;
+    }
     
-    // Recalculate bark band mapping
+    std::lock_guard<std::mutex> lock(analysisMutex_);
+    if (windowSize == windowSize_) return;
+    
+    // All allocation happens here so processAudioBuffer() never allocates
+    windowSize_ = windowSize;
+    fft_.setSize(windowSize_);
+    inputBuffer_.assign(windowSize_, 0.0f);
+    windowBuffer_.assign(windowSize_, 0.0f);
+    fftReal_.assign(fft_.getNumBins(), 0.0f);
+    fftImag_.assign(fft_.getNumBins(), 0.0f);
+    windowFunction_ = createHannWindow(windowSize_);
+    windowCacheValid_ = true;
+    
+    // Bins above the new window's Nyquist no longer exist
+    currentSpectrum_.magnitudes.fill(0.0f);
+    smoothedSpectrum_.magnitudes.fill(0.0f);
+    
+    updateBarkBandMapping();
+}
+
+void SpectrumAnalyzer::updateBarkBandMapping() {
+    // Bark bands (0-24 bark scale) mapped onto the current bin resolution
     for (int i = 0; i < BARK_BANDS; i++) {
         float bark = float(i);
         float startHz = barkToHz(bark);
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <mutex>
 #include <atomic>
+#include "../audio/FFT.h"
 
 /**
  * Real-time Spectrum Analyzer for EtherSynth V1.0
@@ -21,7 +22,8 @@ namespace EtherSynth {
 
 class SpectrumAnalyzer {
 public:
-    static constexpr int FFT_SIZE = 1024;
+    static constexpr int FFT_SIZE = 1024;          // Maximum analysis window
+    static constexpr int MIN_WINDOW_SIZE = 64;
     static constexpr int BINS = FFT_SIZE / 2;
     static constexpr int BARK_BANDS = 24;      // Perceptual frequency bands
     static constexpr int DISPLAY_BARS = 32;    // For 960px display (30px per bar)
@@ -81,7 +83,8 @@ public:
     
     // Configuration
     void setSampleRate(float sampleRate);
-    void setWindowSize(int windowSize);
+    void setWindowSize(int windowSize);     // Power of two, MIN_WINDOW_SIZE..FFT_SIZE
+    int getWindowSize() const { return windowSize_; }
     void setOverlapRatio(float overlap);
     void setSmoothingFactor(float smoothing);
     
@@ -123,9 +126,10 @@ public:
     
 private:
     // FFT Implementation
-    void performFFT(const std::vector<float>& input, std::vector<std::complex<float>>& output);
+    void performFFT(const std::vector<float>& input);
     void applyWindow(std::vector<float>& buffer) const;
-    void calculateMagnitudes(const std::vector<std::complex<float>>& fftData);
+    void calculateMagnitudes();
+    void updateBarkBandMapping();
     
     // Analysis Implementation
     void calculateSpectralFeatures();
@@ -152,7 +156,9 @@ private:
     // Analysis buffers
     std::vector<float> inputBuffer_;
     std::vector<float> windowBuffer_;
-    std::vector<std::complex<float>> fftBuffer_;
+    std::vector<float> fftReal_;            // Real-FFT bins (windowSize/2 + 1)
+    std::vector<float> fftImag_;
+    FFT fft_;                               // Plan rebuilt in setWindowSize()
     std::vector<float> magnitudeHistory_;
     
     // Analysis data
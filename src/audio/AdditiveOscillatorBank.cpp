@@ -0,0 +1,147 @@
+#include "AdditiveOscillatorBank.h"
+#include "SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+
+using EtherSynthSIMD::SIMD::LaneVec;
+
+static_assert(AdditiveOscillatorBank::MAX_PARTIALS % LaneVec::WIDTH == 0,
+              "partials must fill whole lane registers");
+
+AdditiveOscillatorBank::AdditiveOscillatorBank() {
+    std::fill(sinInc_, sinInc_ + MAX_PARTIALS, 0.0f);
+    std::fill(cosInc_, cosInc_ + MAX_PARTIALS, 1.0f);
+    std::fill(target_, target_ + MAX_PARTIALS, 0.0f);
+    std::fill(weight_, weight_ + MAX_PARTIALS, 1.0f);
+    std::fill(audible_, audible_ + MAX_PARTIALS, true);
+    std::fill(gain_, gain_ + MAX_PARTIALS, 0.0f);
+    reset();
+}
+
+void AdditiveOscillatorBank::reset() {
+    std::fill(sin_, sin_ + MAX_PARTIALS, 0.0f);
+    std::fill(cos_, cos_ + MAX_PARTIALS, 1.0f);
+    std::fill(level_, level_ + MAX_PARTIALS, 0.0f);
+}
+
+void AdditiveOscillatorBank::setPartialCount(int count) {
+    partialCount_ = std::clamp(count, 0, MAX_PARTIALS);
+    for (int p = 0; p < MAX_PARTIALS; p++) {
+        updatePartialGain(p);
+    }
+    updateAudibleCount();
+}
+
+void AdditiveOscillatorBank::setFrequency(int partial, float increment) {
+    if (partial < 0 || partial >= MAX_PARTIALS) return;
+
+    // At or above Nyquist the partial would fold back down: cull it
+    audible_[partial] = increment >= 0.0f && increment < 0.5f;
+    const double radians = 2.0 * M_PI * static_cast<double>(increment);
+    sinInc_[partial] = static_cast<float>(std::sin(radians));
+    cosInc_[partial] = static_cast<float>(std::cos(radians));
+    updatePartialGain(partial);
+    updateAudibleCount();
+}
+
+void AdditiveOscillatorBank::setLevel(int partial, float level) {
+    if (partial < 0 || partial >= MAX_PARTIALS) return;
+    level_[partial] = level;
+    target_[partial] = level;
+}
+
+void AdditiveOscillatorBank::setTargetLevel(int partial, float level) {
+    if (partial < 0 || partial >= MAX_PARTIALS) return;
+    target_[partial] = level;
+}
+
+void AdditiveOscillatorBank::setWeight(int partial, float weight) {
+    if (partial < 0 || partial >= MAX_PARTIALS) return;
+    weight_[partial] = weight;
+    updatePartialGain(partial);
+}
+
+float AdditiveOscillatorBank::getLevel(int partial) const {
+    return (partial >= 0 && partial < MAX_PARTIALS) ? level_[partial] : 0.0f;
+}
+
+void AdditiveOscillatorBank::updatePartialGain(int partial) {
+    gain_[partial] = (partial < partialCount_ && audible_[partial]) ? weight_[partial] : 0.0f;
+}
+
+void AdditiveOscillatorBank::updateAudibleCount() {
+    audibleCount_ = 0;
+    for (int p = partialCount_ - 1; p >= 0; p--) {
+        if (audible_[p]) {
+            audibleCount_ = p + 1;
+            break;
+        }
+    }
+}
+
+void AdditiveOscillatorBank::smoothSkipped(int first, size_t frames) {
+    // Closed form of frames one-pole steps; the phasors of silent partials stay put
+    const float decay = std::pow(1.0f - smoothing_, static_cast<float>(frames));
+    for (int p = first; p < partialCount_; p++) {
+        level_[p] = target_[p] + (level_[p] - target_[p]) * decay;
+    }
+}
+
+void AdditiveOscillatorBank::render(float* out, size_t frames) {
+    constexpr int W = LaneVec::WIDTH;
+    const int registers = (audibleCount_ + W - 1) / W;
+    smoothSkipped(registers * W, frames);
+
+    if (registers == 0) {
+        std::fill(out, out + frames, 0.0f);
+        return;
+    }
+
+    const LaneVec smoothing = LaneVec::set1(smoothing_);
+    const LaneVec half = LaneVec::set1(0.5f);
+    const LaneVec threeHalves = LaneVec::set1(1.5f);
+    alignas(32) float lanes[RENORM_INTERVAL * W];
+
+    for (size_t start = 0; start < frames; start += RENORM_INTERVAL) {
+        const int count = static_cast<int>(std::min<size_t>(RENORM_INTERVAL, frames - start));
+
+        // One register at a time over the chunk, so its state stays in registers;
+        // per-lane partial sums collect in lanes[] and are reduced afterwards
+        for (int r = 0; r < registers; r++) {
+            const int o = r * W;
+            LaneVec s = LaneVec::load(sin_ + o);
+            LaneVec c = LaneVec::load(cos_ + o);
+            const LaneVec sr = LaneVec::load(sinInc_ + o);
+            const LaneVec cr = LaneVec::load(cosInc_ + o);
+            const LaneVec tg = LaneVec::load(target_ + o);
+            const LaneVec g = LaneVec::load(gain_ + o);
+            LaneVec lv = LaneVec::load(level_ + o);
+
+            for (int i = 0; i < count; i++) {
+                lv = lv + (tg - lv) * smoothing;
+                LaneVec y = s * lv * g;
+                if (r > 0) y = y + LaneVec::load(lanes + i * W);
+                y.store(lanes + i * W);
+                LaneVec ns = s * cr + c * sr;
+                c = c * cr - s * sr;
+                s = ns;
+            }
+
+            // First-order Newton step towards |phasor| = 1
+            LaneVec k = threeHalves - half * (s * s + c * c);
+            (s * k).store(sin_ + o);
+            (c * k).store(cos_ + o);
+            lv.store(level_ + o);
+        }
+
+        float* dst = out + start;
+        for (int i = 0; i < count; i++) {
+            const float* y = lanes + i * W;
+            float sum = 0.0f;
+            for (int l = 0; l < W; l++) {
+                sum += y[l];
+            }
+            dst[i] = sum;
+        }
+    }
+}
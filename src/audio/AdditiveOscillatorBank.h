@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * AdditiveOscillatorBank - Vectorised sine partials for additive engines
+ *
+ * Each partial is a unit phasor (sin, cos) rotated by its per-sample
+ * increment, so a sample costs four multiplies per partial instead of a
+ * std::sin call. Partials are stored SoA and stepped LaneVec::WIDTH at a
+ * time; every RENORM_INTERVAL samples the phasors are pulled back onto the
+ * unit circle so float rounding never drifts the amplitude.
+ *
+ * Features:
+ * - Up to MAX_PARTIALS partials, each with a smoothed level and a static weight
+ * - Bandlimit culling: partials at or above Nyquist are muted, and registers
+ *   above the highest audible partial are not computed at all
+ * - Phase-continuous frequency changes (retrigger and glide without clicks)
+ */
+class AdditiveOscillatorBank {
+public:
+    static constexpr int MAX_PARTIALS = 64;
+    static constexpr int RENORM_INTERVAL = 64;      // Samples between renormalisations
+
+    AdditiveOscillatorBank();
+
+    void reset();                                   // Phases and levels to zero
+
+    void setPartialCount(int count);
+    int getPartialCount() const { return partialCount_; }
+    int getAudiblePartialCount() const { return audibleCount_; }  // Highest audible partial + 1
+
+    // increment is cycles per sample (frequency / sample rate)
+    void setFrequency(int partial, float increment);
+    void setLevel(int partial, float level);        // Jumps immediately
+    void setTargetLevel(int partial, float level);  // Approached by one-pole smoothing
+    void setWeight(int partial, float weight);      // Static output gain
+    void setSmoothing(float coefficient) { smoothing_ = coefficient; }
+    float getLevel(int partial) const;
+
+    // Writes sum(weight * level * sin(phase)) over all partials to out
+    void render(float* out, size_t frames);
+
+private:
+    alignas(32) float sin_[MAX_PARTIALS];
+    alignas(32) float cos_[MAX_PARTIALS];
+    alignas(32) float sinInc_[MAX_PARTIALS];
+    alignas(32) float cosInc_[MAX_PARTIALS];
+    alignas(32) float level_[MAX_PARTIALS];
+    alignas(32) float target_[MAX_PARTIALS];
+    alignas(32) float gain_[MAX_PARTIALS];          // weight_, or 0 when culled
+    float weight_[MAX_PARTIALS];
+    bool audible_[MAX_PARTIALS];
+
+    int partialCount_ = 0;
+    int audibleCount_ = 0;
+    float smoothing_ = 0.01f;
+
+    void updatePartialGain(int partial);
+    void updateAudibleCount();
+    void smoothSkipped(int first, size_t frames);   // Levels of partials not rendered
+};
@@ -0,0 +1,186 @@
+#include "AuxBusMixer.h"
+#include <algorithm>
+
+AuxBusMixer::AuxBusMixer() = default;
+AuxBusMixer::~AuxBusMixer() = default;
+
+void AuxBusMixer::setSampleRate(float sampleRate) {
+    sampleRate_ = sampleRate;
+    for (auto& bus : buses_) {
+        if (bus.reverb) bus.reverb->initialize(sampleRate);
+        if (bus.delay) bus.delay->setSampleRate(sampleRate);
+    }
+    reset();
+}
+
+void AuxBusMixer::setBusReturn(int bus, ReturnType type) {
+    if (bus < 0 || bus >= MAX_BUSES) return;
+    Bus& b = buses_[bus];
+    b.type = type;
+    b.reverb.reset();
+    b.delay.reset();
+    if (type == ReturnType::REVERB) {
+        // Returns are fully wet: the dry signal already reaches the master
+        b.reverb = std::make_unique<ReverbEffect>();
+        b.reverb->initialize(sampleRate_);
+        b.reverb->setDryLevel(0.0f);
+        b.reverb->setWetLevel(1.0f / 3.0f);    // Unity wet gain (Freeverb scales wet by 3)
+    } else if (type == ReturnType::DELAY) {
+        b.delay = std::make_unique<DelayEffect>();
+        b.delay->setSampleRate(sampleRate_);
+        b.delay->setMix(1.0f);
+    }
+    b.fed = false;
+    b.tailFrames = 0;
+}
+
+AuxBusMixer::ReturnType AuxBusMixer::getBusReturn(int bus) const {
+    return (bus >= 0 && bus < MAX_BUSES) ? buses_[bus].type : ReturnType::NONE;
+}
+
+void AuxBusMixer::setSend(int slot, int bus, float level) {
+    if (slot < 0 || slot >= MAX_SLOTS || bus < 0 || bus >= MAX_BUSES) return;
+    sends_[slot][bus].level.store(std::clamp(level, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+float AuxBusMixer::getSend(int slot, int bus) const {
+    if (slot < 0 || slot >= MAX_SLOTS || bus < 0 || bus >= MAX_BUSES) return 0.0f;
+    return sends_[slot][bus].level.load(std::memory_order_relaxed);
+}
+
+void AuxBusMixer::setSendTap(int slot, int bus, Tap tap) {
+    if (slot < 0 || slot >= MAX_SLOTS || bus < 0 || bus >= MAX_BUSES) return;
+    sends_[slot][bus].tap.store(static_cast<uint8_t>(tap), std::memory_order_relaxed);
+}
+
+AuxBusMixer::Tap AuxBusMixer::getSendTap(int slot, int bus) const {
+    if (slot < 0 || slot >= MAX_SLOTS || bus < 0 || bus >= MAX_BUSES) return Tap::POST;
+    return static_cast<Tap>(sends_[slot][bus].tap.load(std::memory_order_relaxed));
+}
+
+void AuxBusMixer::setReturnLevel(int bus, float level) {
+    if (bus < 0 || bus >= MAX_BUSES) return;
+    buses_[bus].returnLevel.store(std::clamp(level, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+float AuxBusMixer::getReturnLevel(int bus) const {
+    if (bus < 0 || bus >= MAX_BUSES) return 0.0f;
+    return buses_[bus].returnLevel.load(std::memory_order_relaxed);
+}
+
+ReverbEffect* AuxBusMixer::getReverb(int bus) {
+    return (bus >= 0 && bus < MAX_BUSES) ? buses_[bus].reverb.get() : nullptr;
+}
+
+DelayEffect* AuxBusMixer::getDelay(int bus) {
+    return (bus >= 0 && bus < MAX_BUSES) ? buses_[bus].delay.get() : nullptr;
+}
+
+bool AuxBusMixer::needsPreTap(int slot) const {
+    if (slot < 0 || slot >= MAX_SLOTS) return false;
+    for (int bus = 0; bus < MAX_BUSES; ++bus) {
+        const Send& send = sends_[slot][bus];
+        if (buses_[bus].type == ReturnType::NONE) continue;
+        if (static_cast<Tap>(send.tap.load(std::memory_order_relaxed)) != Tap::PRE) continue;
+        if (send.level.load(std::memory_order_relaxed) > SEND_EPSILON || send.applied > SEND_EPSILON) return true;
+    }
+    return false;
+}
+
+bool AuxBusMixer::hasSends(int slot) const {
+    if (slot < 0 || slot >= MAX_SLOTS) return false;
+    for (int bus = 0; bus < MAX_BUSES; ++bus) {
+        const Send& send = sends_[slot][bus];
+        if (buses_[bus].type == ReturnType::NONE) continue;
+        if (send.level.load(std::memory_order_relaxed) > SEND_EPSILON || send.applied > SEND_EPSILON) return true;
+    }
+    return false;
+}
+
+void AuxBusMixer::beginBlock(size_t frames) {
+    blockFrames_ = std::min(frames, BUFFER_SIZE);
+    for (auto& bus : buses_) {
+        if (bus.type == ReturnType::NONE) continue;
+        std::fill(bus.input.begin(), bus.input.begin() + blockFrames_, AudioFrame());
+        bus.fed = false;
+    }
+}
+
+void AuxBusMixer::addSlot(int slot, const EtherAudioBuffer* pre, const EtherAudioBuffer& post, size_t frames) {
+    if (slot < 0 || slot >= MAX_SLOTS) return;
+    frames = std::min(frames, blockFrames_);
+    if (frames == 0) return;
+
+    for (int bus = 0; bus < MAX_BUSES; ++bus) {
+        Bus& b = buses_[bus];
+        Send& send = sends_[slot][bus];
+        if (b.type == ReturnType::NONE) continue;
+        const float target = send.level.load(std::memory_order_relaxed);
+        const float start = send.applied;
+        send.applied = target;
+        if (target <= SEND_EPSILON && start <= SEND_EPSILON) continue;
+
+        const bool preTap = static_cast<Tap>(send.tap.load(std::memory_order_relaxed)) == Tap::PRE && pre;
+        const AudioFrame* src = preTap ? pre->data() : post.data();
+        AudioFrame* dst = b.input.data();
+        if (start == target) {
+            for (size_t i = 0; i < frames; ++i) {
+                dst[i].left += src[i].left * target;
+                dst[i].right += src[i].right * target;
+            }
+        } else {
+            // Ramp to the new level across the block
+            const float step = (target - start) / static_cast<float>(frames);
+            float gain = start;
+            for (size_t i = 0; i < frames; ++i) {
+                gain += step;
+                dst[i].left += src[i].left * gain;
+                dst[i].right += src[i].right * gain;
+            }
+        }
+        b.fed = true;
+    }
+}
+
+void AuxBusMixer::processReturns(float* interleavedOutput, size_t frames) {
+    frames = std::min(frames, blockFrames_);
+    for (auto& bus : buses_) {
+        if (bus.type == ReturnType::NONE) continue;
+        // Idle buses skip the effect once its tail has run out
+        if (bus.fed) {
+            bus.tailFrames = tailLengthFrames(bus);
+        } else if (bus.tailFrames <= 0) {
+            continue;
+        } else {
+            bus.tailFrames -= static_cast<int>(frames);
+        }
+
+        if (bus.reverb) bus.reverb->process(bus.input, frames);
+        if (bus.delay) bus.delay->process(bus.input, frames);
+
+        const float target = bus.returnLevel.load(std::memory_order_relaxed);
+        const float step = (target - bus.returnApplied) / static_cast<float>(std::max<size_t>(1, frames));
+        float gain = bus.returnApplied;
+        for (size_t i = 0; i < frames; ++i) {
+            gain += step;
+            interleavedOutput[i * 2] += bus.input[i].left * gain;
+            interleavedOutput[i * 2 + 1] += bus.input[i].right * gain;
+        }
+        bus.returnApplied = target;
+    }
+}
+
+void AuxBusMixer::reset() {
+    for (auto& bus : buses_) {
+        bus.input.fill(AudioFrame());
+        bus.fed = false;
+        bus.tailFrames = 0;
+        if (bus.reverb) bus.reverb->reset();
+        if (bus.delay) bus.delay->reset();
+    }
+}
+
+int AuxBusMixer::tailLengthFrames(const Bus& bus) const {
+    const float seconds = bus.type == ReturnType::DELAY ? DELAY_TAIL_SECONDS : REVERB_TAIL_SECONDS;
+    return static_cast<int>(seconds * sampleRate_);
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "../core/Types.h"
+#include "../processing/effects/ReverbEffect.h"
+#include "../processing/effects/DelayEffect.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * AuxBusMixer - Preallocated send/return buses for the slot mixer
+ *
+ * Every slot feeds each aux bus through its own send level. The send is
+ * tapped either before the slot's post chain (PRE) or after it (POST).
+ * Each bus sums its own input and runs its own return effect, so one
+ * return never feeds another (the delay does not go into the reverb).
+ *
+ * Features:
+ * - MAX_BUSES aux buses, each returning through a ReverbEffect or DelayEffect
+ * - Per-slot, per-bus send level and PRE/POST tap
+ * - Send levels ramp across the block when they change, so sends never click
+ * - Bus inputs, effect state and return buffers are allocated up front by
+ *   setSampleRate()/setBusReturn(); beginBlock/addSlot/processReturns do not
+ *   allocate or lock
+ *
+ * Sends and return levels may be changed from any thread. Return effects are
+ * only touched on the audio thread: configure them through getReverb()/getDelay()
+ * from the audio thread, or with audio stopped.
+ */
+class AuxBusMixer {
+public:
+    static constexpr int MAX_BUSES = 4;
+    static constexpr int MAX_SLOTS = 16;
+    static constexpr float SEND_EPSILON = 0.0001f;
+
+    enum class Tap : uint8_t {
+        PRE,                // Engine output, before the slot's post chain
+        POST                // After the post chain (what the master hears)
+    };
+
+    enum class ReturnType : uint8_t { NONE, REVERB, DELAY };
+
+    AuxBusMixer();
+    ~AuxBusMixer();
+
+    // Configuration (control thread, audio stopped: these allocate)
+    void setSampleRate(float sampleRate);
+    void setBusReturn(int bus, ReturnType type);
+    ReturnType getBusReturn(int bus) const;
+
+    // Routing (any thread)
+    void setSend(int slot, int bus, float level);
+    float getSend(int slot, int bus) const;
+    void setSendTap(int slot, int bus, Tap tap);
+    Tap getSendTap(int slot, int bus) const;
+    void setReturnLevel(int bus, float level);
+    float getReturnLevel(int bus) const;
+
+    // Return effects (audio thread, or audio stopped); nullptr if the bus has another type
+    ReverbEffect* getReverb(int bus);
+    DelayEffect* getDelay(int bus);
+
+    // Audio thread, per block
+    bool needsPreTap(int slot) const;           // Any bus taps this slot before the post chain
+    bool hasSends(int slot) const;
+    void beginBlock(size_t frames);
+    void addSlot(int slot, const EtherAudioBuffer* pre, const EtherAudioBuffer& post, size_t frames);
+    void processReturns(float* interleavedOutput, size_t frames);
+    void reset();                               // Clear bus inputs and effect tails
+
+private:
+    struct Bus {
+        ReturnType type = ReturnType::NONE;
+        std::unique_ptr<ReverbEffect> reverb;
+        std::unique_ptr<DelayEffect> delay;
+        EtherAudioBuffer input{ };
+        std::atomic<float> returnLevel{1.0f};
+        float returnApplied = 1.0f;             // Audio thread: level at the end of the last block
+        bool fed = false;                       // Something was summed into input this block
+        int tailFrames = 0;                     // Frames left to run the return after the last input
+    };
+
+    struct Send {
+        std::atomic<float> level{0.0f};
+        std::atomic<uint8_t> tap{static_cast<uint8_t>(Tap::POST)};
+        float applied = 0.0f;                   // Audio thread: level at the end of the last block
+    };
+
+    std::array<Bus, MAX_BUSES> buses_;
+    std::array<std::array<Send, MAX_BUSES>, MAX_SLOTS> sends_;
+    float sampleRate_ = SAMPLE_RATE;
+    size_t blockFrames_ = 0;
+
+    int tailLengthFrames(const Bus& bus) const;
+
+    static constexpr float REVERB_TAIL_SECONDS = 12.0f;
+    static constexpr float DELAY_TAIL_SECONDS = 30.0f;
+};
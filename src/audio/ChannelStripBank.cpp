@@ -0,0 +1,251 @@
+#include "ChannelStripBank.h"
+#include "SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+
+using EtherSynthSIMD::SIMD::LaneVec;
+using EtherSynthSIMD::SIMD::tanhLanes;
+using EtherSynthSIMD::SIMD::sinHalfPiLanes;
+using EtherSynthSIMD::SIMD::exp2Lanes;
+
+static_assert(ChannelStripBank::MAX_STRIPS % LaneVec::WIDTH == 0, "Strips must fill whole SIMD groups");
+
+namespace {
+    constexpr int GROUPS = ChannelStripBank::MAX_STRIPS / LaneVec::WIDTH;
+}
+
+ChannelStripBank::ChannelStripBank() {
+    hpfCut_.fill(20.0f);
+    lpfCut_.fill(20000.0f);
+    lpfQ_.fill(0.707f);
+    preGain_.fill(1.0f);
+    drive_.fill(0.0f);
+    pan_.fill(0.0f);
+    setSampleRate(SAMPLE_RATE);
+}
+
+void ChannelStripBank::setSampleRate(float sampleRate) {
+    sampleRate_ = sampleRate;
+    for (int s = 0; s < MAX_STRIPS; ++s) {
+        hpfCut_[s] = std::clamp(hpfCut_[s], 10.0f, sampleRate_ * 0.45f);
+        lpfCut_[s] = std::clamp(lpfCut_[s], 20.0f, sampleRate_ * 0.45f);
+    }
+    computeTargets(nullptr, 0);
+    std::copy(&target_[0][0], &target_[0][0] + COEFF_COUNT * MAX_STRIPS, &coeff_[0][0]);
+    reset();
+}
+
+void ChannelStripBank::reset() {
+    std::fill(&hpfX1_[0][0], &hpfX1_[0][0] + 2 * MAX_STRIPS, 0.0f);
+    std::fill(&hpfY1_[0][0], &hpfY1_[0][0] + 2 * MAX_STRIPS, 0.0f);
+    std::fill(&lpfZ1_[0][0], &lpfZ1_[0][0] + 2 * MAX_STRIPS, 0.0f);
+    std::fill(&lpfZ2_[0][0], &lpfZ2_[0][0] + 2 * MAX_STRIPS, 0.0f);
+}
+
+void ChannelStripBank::setHPF(int strip, float hz) {
+    if (!valid(strip)) return;
+    hpfCut_[strip] = std::clamp(hz, 10.0f, sampleRate_ * 0.45f);
+}
+
+void ChannelStripBank::setLPF(int strip, float hz, float q) {
+    if (!valid(strip)) return;
+    lpfCut_[strip] = std::clamp(hz, 20.0f, sampleRate_ * 0.45f);
+    lpfQ_[strip] = std::max(0.1f, q);
+}
+
+void ChannelStripBank::setPreGain(int strip, float gain) {
+    if (valid(strip)) preGain_[strip] = std::max(0.0f, gain);
+}
+
+void ChannelStripBank::setDrive(int strip, float drive) {
+    if (valid(strip)) drive_[strip] = std::clamp(drive, 0.0f, 1.0f);
+}
+
+void ChannelStripBank::setPan(int strip, float pan) {
+    if (valid(strip)) pan_[strip] = std::clamp(pan, -1.0f, 1.0f);
+}
+
+void ChannelStripBank::computeTargets(const ModBuffers* mods, size_t at) {
+    // Gather each strip's ramp values; unmodulated strips get neutral values and bounds
+    alignas(32) float hpfMod[MAX_STRIPS], cutMod[MAX_STRIPS], cutFloor[MAX_STRIPS];
+    alignas(32) float qMod[MAX_STRIPS], qLow[MAX_STRIPS], qHigh[MAX_STRIPS], panMod[MAX_STRIPS];
+    for (int s = 0; s < MAX_STRIPS; ++s) {
+        const ModBuffers* mod = mods ? &mods[s] : nullptr;
+        auto value = [&](Mod m) { return mod && (*mod)[m] ? (*mod)[m][at] : 0.0f; };
+        // hpf tilt: ±20%; lpf cutoff: ± one octave per |mod|≈1 (floor 100 Hz); q: ±2.0 in 0.5..10; pan: ±0.5
+        hpfMod[s] = 0.2f * value(MOD_HPF);
+        cutMod[s] = 0.8f * value(MOD_LPF_CUTOFF);
+        cutFloor[s] = mod && (*mod)[MOD_LPF_CUTOFF] ? 100.0f : 20.0f;
+        const bool qModulated = mod && (*mod)[MOD_LPF_Q];
+        qMod[s] = 2.0f * value(MOD_LPF_Q);
+        qLow[s] = qModulated ? 0.5f : 0.1f;
+        qHigh[s] = qModulated ? 10.0f : 1.0e6f;
+        panMod[s] = 0.5f * value(MOD_PAN);
+    }
+
+    const LaneVec zero = LaneVec::set1(0.0f);
+    const LaneVec one = LaneVec::set1(1.0f);
+    const LaneVec two = LaneVec::set1(2.0f);
+    const LaneVec half = LaneVec::set1(0.5f);
+    const LaneVec nyquist = LaneVec::set1(sampleRate_ * 0.45f);
+    const LaneVec omegaPerHz = LaneVec::set1(2.0f * static_cast<float>(M_PI) / sampleRate_);
+    const LaneVec quarterTurnsPerHz = LaneVec::set1(4.0f / sampleRate_);   // w0 / (pi/2)
+    for (int g = 0; g < MAX_STRIPS; g += LaneVec::WIDTH) {
+        // One-pole HPF: a = RC / (RC + dt)
+        LaneVec hz = LaneVec::load(hpfCut_.data() + g) * (one + LaneVec::load(hpfMod + g));
+        hz = LaneVec::min(LaneVec::max(hz, LaneVec::set1(10.0f)), nyquist);
+        (one / (one + omegaPerHz * hz)).store(&target_[HPF_A][g]);
+
+        // RBJ lowpass
+        LaneVec cut = LaneVec::load(lpfCut_.data() + g) * exp2Lanes(LaneVec::load(cutMod + g));
+        cut = LaneVec::max(cut, LaneVec::load(cutFloor + g));
+        cut = LaneVec::min(LaneVec::max(cut, LaneVec::set1(20.0f)), nyquist);
+        LaneVec q = LaneVec::load(lpfQ_.data() + g) + LaneVec::load(qMod + g);
+        q = LaneVec::min(LaneVec::max(q, LaneVec::load(qLow + g)), LaneVec::load(qHigh + g));
+        q = LaneVec::max(q, LaneVec::set1(0.1f));
+        const LaneVec t = cut * quarterTurnsPerHz;                          // (0, 1.8]
+        const LaneVec sinW = sinHalfPiLanes(LaneVec::min(t, two - t));
+        const LaneVec cosW = sinHalfPiLanes(one - t);
+        const LaneVec alpha = sinW / (two * q);
+        const LaneVec norm = one / (one + alpha);
+        ((one - cosW) * norm).store(&target_[LPF_B1][g]);
+        (zero - two * cosW * norm).store(&target_[LPF_A1][g]);
+        ((one - alpha) * norm).store(&target_[LPF_A2][g]);
+
+        // Equal-power pan: [-1, 1] -> gains cos/sin of [0, pi/2]
+        LaneVec pan = LaneVec::load(pan_.data() + g) + LaneVec::load(panMod + g);
+        pan = LaneVec::min(LaneVec::max(pan, zero - one), one);
+        const LaneVec u = (pan + one) * half;
+        sinHalfPiLanes(one - u).store(&target_[PAN_L][g]);
+        sinHalfPiLanes(u).store(&target_[PAN_R][g]);
+    }
+}
+
+void ChannelStripBank::processBlock(EtherAudioBuffer* const* buffers, const ModBuffers* mods, size_t frames, int interval) {
+    frames = std::min(frames, BUFFER_SIZE);
+    if (frames == 0) return;
+
+    // Transpose into slot-interleaved frames; per-frame gain and drive come from the ramps
+    bool groupActive[GROUPS] = { };
+    bool groupDrive[GROUPS] = { };
+    for (int s = 0; s < MAX_STRIPS; ++s) {
+        const int group = s / LaneVec::WIDTH;
+        const EtherAudioBuffer* buffer = buffers[s];
+        const ModBuffers* mod = mods ? &mods[s] : nullptr;
+        const float* gainMod = mod ? (*mod)[MOD_PRE_GAIN] : nullptr;
+        const float* driveMod = mod ? (*mod)[MOD_DRIVE] : nullptr;
+        if (!buffer) {
+            for (size_t i = 0; i < frames; ++i) {
+                left_[i][s] = 0.0f; right_[i][s] = 0.0f;
+                gain_[i][s] = 0.0f; amount_[i][s] = 0.0f;
+            }
+            continue;
+        }
+        groupActive[group] = true;
+        for (size_t i = 0; i < frames; ++i) {
+            left_[i][s] = (*buffer)[i].left;
+            right_[i][s] = (*buffer)[i].right;
+        }
+        // pre-gain: ±50%; drive: ±0.5
+        const float gain = preGain_[s], drive = drive_[s];
+        if (gainMod) {
+            for (size_t i = 0; i < frames; ++i) gain_[i][s] = std::max(0.1f, gain * (1.0f + 0.5f * gainMod[i]));
+        } else {
+            for (size_t i = 0; i < frames; ++i) gain_[i][s] = gain;
+        }
+        if (driveMod) {
+            for (size_t i = 0; i < frames; ++i) amount_[i][s] = std::clamp(drive + 0.5f * driveMod[i], 0.0f, 1.0f);
+            groupDrive[group] = true;
+        } else {
+            for (size_t i = 0; i < frames; ++i) amount_[i][s] = drive;
+            groupDrive[group] = groupDrive[group] || drive > DRIVE_EPSILON;
+        }
+    }
+
+    const size_t step = static_cast<size_t>(std::max(1, interval));
+    const LaneVec half = LaneVec::set1(0.5f);
+    const LaneVec one = LaneVec::set1(1.0f);
+    const LaneVec five = LaneVec::set1(5.0f);
+    const LaneVec driveEpsilon = LaneVec::set1(DRIVE_EPSILON);
+    for (size_t start = 0; start < frames; start += step) {
+        const size_t end = std::min(frames, start + step);
+        computeTargets(mods, end - 1);
+        const LaneVec invLength = LaneVec::set1(1.0f / static_cast<float>(end - start));
+
+        for (int group = 0; group < GROUPS; ++group) {
+            const int g = group * LaneVec::WIDTH;
+            if (!groupActive[group]) {
+                for (int c = 0; c < COEFF_COUNT; ++c) std::copy(&target_[c][g], &target_[c][g] + LaneVec::WIDTH, &coeff_[c][g]);
+                continue;
+            }
+            // Coefficients ramp from where the last segment ended to this segment's targets
+            LaneVec a = LaneVec::load(&coeff_[HPF_A][g]);
+            LaneVec b1 = LaneVec::load(&coeff_[LPF_B1][g]);
+            LaneVec a1 = LaneVec::load(&coeff_[LPF_A1][g]);
+            LaneVec a2 = LaneVec::load(&coeff_[LPF_A2][g]);
+            LaneVec panL = LaneVec::load(&coeff_[PAN_L][g]);
+            LaneVec panR = LaneVec::load(&coeff_[PAN_R][g]);
+            const LaneVec da = (LaneVec::load(&target_[HPF_A][g]) - a) * invLength;
+            const LaneVec db1 = (LaneVec::load(&target_[LPF_B1][g]) - b1) * invLength;
+            const LaneVec da1 = (LaneVec::load(&target_[LPF_A1][g]) - a1) * invLength;
+            const LaneVec da2 = (LaneVec::load(&target_[LPF_A2][g]) - a2) * invLength;
+            const LaneVec dPanL = (LaneVec::load(&target_[PAN_L][g]) - panL) * invLength;
+            const LaneVec dPanR = (LaneVec::load(&target_[PAN_R][g]) - panR) * invLength;
+
+            LaneVec hx1L = LaneVec::load(&hpfX1_[0][g]), hx1R = LaneVec::load(&hpfX1_[1][g]);
+            LaneVec hy1L = LaneVec::load(&hpfY1_[0][g]), hy1R = LaneVec::load(&hpfY1_[1][g]);
+            LaneVec z1L = LaneVec::load(&lpfZ1_[0][g]), z1R = LaneVec::load(&lpfZ1_[1][g]);
+            LaneVec z2L = LaneVec::load(&lpfZ2_[0][g]), z2R = LaneVec::load(&lpfZ2_[1][g]);
+            const bool drive = groupDrive[group];
+
+            for (size_t i = start; i < end; ++i) {
+                a = a + da; b1 = b1 + db1; a1 = a1 + da1; a2 = a2 + da2;
+                panL = panL + dPanL; panR = panR + dPanR;
+
+                const LaneVec gain = LaneVec::load(&gain_[i][g]);
+                LaneVec l = LaneVec::load(&left_[i][g]) * gain;
+                LaneVec r = LaneVec::load(&right_[i][g]) * gain;
+                if (drive) {
+                    // Soft clip tanh((1 + 5 * amount) * x), bypassed where amount is ~0
+                    const LaneVec amount = LaneVec::load(&amount_[i][g]);
+                    const LaneVec k = one + five * amount;
+                    l = LaneVec::select(amount, driveEpsilon, l, tanhLanes(k * l));
+                    r = LaneVec::select(amount, driveEpsilon, r, tanhLanes(k * r));
+                }
+                l = l * panL;
+                r = r * panR;
+
+                const LaneVec hl = a * (hy1L + l - hx1L);
+                const LaneVec hr = a * (hy1R + r - hx1R);
+                hx1L = l; hy1L = hl;
+                hx1R = r; hy1R = hr;
+
+                const LaneVec b0 = b1 * half;
+                const LaneVec ol = b0 * hl + z1L;
+                const LaneVec orr = b0 * hr + z1R;
+                z1L = b1 * hl - a1 * ol + z2L;
+                z1R = b1 * hr - a1 * orr + z2R;
+                z2L = b0 * hl - a2 * ol;
+                z2R = b0 * hr - a2 * orr;
+                ol.store(&left_[i][g]);
+                orr.store(&right_[i][g]);
+            }
+
+            hx1L.store(&hpfX1_[0][g]); hx1R.store(&hpfX1_[1][g]);
+            hy1L.store(&hpfY1_[0][g]); hy1R.store(&hpfY1_[1][g]);
+            z1L.store(&lpfZ1_[0][g]); z1R.store(&lpfZ1_[1][g]);
+            z2L.store(&lpfZ2_[0][g]); z2R.store(&lpfZ2_[1][g]);
+            // Land exactly on the targets so ramps never accumulate rounding
+            for (int c = 0; c < COEFF_COUNT; ++c) std::copy(&target_[c][g], &target_[c][g] + LaneVec::WIDTH, &coeff_[c][g]);
+        }
+    }
+
+    for (int s = 0; s < MAX_STRIPS; ++s) {
+        EtherAudioBuffer* buffer = buffers[s];
+        if (!buffer) continue;
+        for (size_t i = 0; i < frames; ++i) {
+            (*buffer)[i].left = left_[i][s];
+            (*buffer)[i].right = right_[i][s];
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "../core/Types.h"
+#include <array>
+#include <cstddef>
+
+/**
+ * ChannelStripBank - Per-slot post chain for every slot, processed in SIMD lanes
+ *
+ * Each strip is pre gain -> drive (soft clip) -> equal-power pan -> one-pole
+ * HPF -> RBJ biquad LPF. State and coefficients are stored SoA with one lane
+ * per strip, and audio is transposed into slot-interleaved frames, so a
+ * sample of every strip is filtered with a few vector operations instead of
+ * one scalar chain per slot.
+ *
+ * Features:
+ * - MAX_STRIPS strips stepped LaneVec::WIDTH at a time; lane groups without an
+ *   active strip are skipped
+ * - Coefficients for all strips are computed together in lanes once per control
+ *   segment (no std::pow/sin/cos per slot), from the base settings plus the
+ *   LFO ramps at the end of the segment
+ * - Coefficient and pan changes ramp linearly across the segment, so setting
+ *   or modulating cutoff, Q and pan does not zipper
+ * - Setters only store the base settings; processBlock does not allocate
+ */
+class ChannelStripBank {
+public:
+    static constexpr int MAX_STRIPS = 16;
+
+    // LFO ramps processBlock() applies on top of the base settings
+    enum Mod { MOD_HPF = 0, MOD_LPF_CUTOFF, MOD_LPF_Q, MOD_PRE_GAIN, MOD_DRIVE, MOD_PAN, MOD_COUNT };
+    using ModBuffers = std::array<const float*, MOD_COUNT>;   // One value per frame, nullptr = none
+
+    ChannelStripBank();
+
+    void setSampleRate(float sampleRate);   // Snaps coefficients to the current settings
+    void reset();                           // Clear filter state
+
+    // Base settings (control thread)
+    void setHPF(int strip, float hz);
+    void setLPF(int strip, float hz, float q);
+    void setPreGain(int strip, float gain);
+    void setDrive(int strip, float drive);  // 0..1
+    void setPan(int strip, float pan);      // -1..1
+    float getHPF(int strip) const { return valid(strip) ? hpfCut_[strip] : 0.0f; }
+    float getLPFCutoff(int strip) const { return valid(strip) ? lpfCut_[strip] : 0.0f; }
+    float getLPFQ(int strip) const { return valid(strip) ? lpfQ_[strip] : 0.0f; }
+
+    // Audio thread. buffers[strip] == nullptr feeds that strip silence (its filters
+    // ring out) and writes nothing back; mods may be nullptr for no modulation.
+    // Coefficients are updated every `interval` frames.
+    void processBlock(EtherAudioBuffer* const* buffers, const ModBuffers* mods, size_t frames, int interval);
+
+private:
+    static constexpr float DRIVE_EPSILON = 0.001f;
+
+    static bool valid(int strip) { return strip >= 0 && strip < MAX_STRIPS; }
+
+    // Compute target coefficients for all strips from the base settings and the
+    // ramps at frame `at` (or none when mods is nullptr)
+    void computeTargets(const ModBuffers* mods, size_t at);
+
+    float sampleRate_ = SAMPLE_RATE;
+
+    // Base settings
+    std::array<float, MAX_STRIPS> hpfCut_;
+    std::array<float, MAX_STRIPS> lpfCut_;
+    std::array<float, MAX_STRIPS> lpfQ_;
+    std::array<float, MAX_STRIPS> preGain_;
+    std::array<float, MAX_STRIPS> drive_;
+    std::array<float, MAX_STRIPS> pan_;
+
+    // Coefficients at the end of the last frame, and the segment's targets
+    // (the lowpass has b0 = b2 = b1 / 2)
+    enum Coeff { HPF_A = 0, LPF_B1, LPF_A1, LPF_A2, PAN_L, PAN_R, COEFF_COUNT };
+    alignas(32) float coeff_[COEFF_COUNT][MAX_STRIPS];
+    alignas(32) float target_[COEFF_COUNT][MAX_STRIPS];
+
+    // Filter state per channel (HPF x1/y1, biquad z1/z2)
+    alignas(32) float hpfX1_[2][MAX_STRIPS];
+    alignas(32) float hpfY1_[2][MAX_STRIPS];
+    alignas(32) float lpfZ1_[2][MAX_STRIPS];
+    alignas(32) float lpfZ2_[2][MAX_STRIPS];
+
+    // Slot-interleaved block scratch: [frame][strip]
+    alignas(32) float left_[BUFFER_SIZE][MAX_STRIPS];
+    alignas(32) float right_[BUFFER_SIZE][MAX_STRIPS];
+    alignas(32) float gain_[BUFFER_SIZE][MAX_STRIPS];
+    alignas(32) float amount_[BUFFER_SIZE][MAX_STRIPS];
+};
@@ -135,6 +135,39 @@ void EngineCrossfader::processStereoBlock(float* engineALeft, float* engineARigh
     cpuUsage_ = cpuUsage_ * 0.99f + (processingTime / numSamples) * 0.01f;
 }
 
+void EngineCrossfader::processInterleavedBlock(const float* engineA, const float* engineB, float* output,
+                                               int numFrames, int numChannels) {
+    if (!initialized_) {
+        // Copy engine A to output if not initialized
+        std::copy(engineA, engineA + numFrames * numChannels, output);
+        return;
+    }
+    
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int i = 0; i < numFrames; i++) {
+        // Update crossfade position if not in manual control
+        if (!manualControl_ && !paused_) {
+            updateCrossfadeState();
+        }
+        
+        // Calculate gains for both engines
+        float gainA, gainB;
+        calculateGains(position_, gainA, gainB);
+        
+        // Mix all channels of this frame
+        int base = i * numChannels;
+        for (int ch = 0; ch < numChannels; ch++) {
+            output[base + ch] = engineA[base + ch] * gainA + engineB[base + ch] * gainB;
+        }
+    }
+    
+    // Update CPU usage
+    auto endTime = std::chrono::high_resolution_clock::now();
+    float processingTime = std::chrono::duration<float, std::micro>(endTime - startTime).count();
+    cpuUsage_ = cpuUsage_ * 0.99f + (processingTime / std::max(1, numFrames)) * 0.01f;
+}
+
 void EngineCrossfader::startCrossfadeToB() {
     if (!initialized_) {
         return;
@@ -47,6 +47,9 @@ public:
     void processStereoBlock(float* engineALeft, float* engineARight,
                            float* engineBLeft, float* engineBRight,
                            float* outputLeft, float* outputRight, int numSamples);
+    // Interleaved frames; output may alias engineB (in-place fade into the incoming engine)
+    void processInterleavedBlock(const float* engineA, const float* engineB, float* output,
+                                 int numFrames, int numChannels = 2);
     
     // Crossfade control
     void startCrossfadeToB(); // Start fade from A to B
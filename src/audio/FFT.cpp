@@ -0,0 +1,204 @@
+#include "FFT.h"
+#include "SIMDOptimizations.h"
+#include <cmath>
+#include <utility>
+
+namespace {
+constexpr double TWO_PI = 6.283185307179586476925286766559;
+}
+
+FFT::FFT() {
+}
+
+FFT::FFT(int size) {
+    setSize(size);
+}
+
+bool FFT::setSize(int size) {
+    if (!isPowerOfTwo(size) || size < MIN_SIZE || size > MAX_SIZE) {
+        return false;
+    }
+    if (size == size_) {
+        return true;
+    }
+
+    size_ = size;
+    const int half = size / 2;
+
+    buildPlan(size, complexBitReverse_, complexTwiddleRe_, complexTwiddleIm_);
+    buildPlan(half, halfBitReverse_, halfTwiddleRe_, halfTwiddleIm_);
+
+    // Post-processing twiddles for the packed real transform
+    realTwiddleRe_.resize(half + 1);
+    realTwiddleIm_.resize(half + 1);
+    for (int k = 0; k <= half; ++k) {
+        double angle = -TWO_PI * k / size;
+        realTwiddleRe_[k] = static_cast<float>(std::cos(angle));
+        realTwiddleIm_[k] = static_cast<float>(std::sin(angle));
+    }
+
+    workRe_.assign(half, 0.0f);
+    workIm_.assign(half, 0.0f);
+    return true;
+}
+
+void FFT::buildPlan(int n, std::vector<int>& bitReverse,
+                    std::vector<float>& twiddleRe, std::vector<float>& twiddleIm) {
+    int bits = 0;
+    while ((1 << bits) < n) ++bits;
+
+    bitReverse.resize(n);
+    for (int i = 0; i < n; ++i) {
+        int reversed = 0;
+        for (int b = 0; b < bits; ++b) {
+            if (i & (1 << b)) reversed |= 1 << (bits - 1 - b);
+        }
+        bitReverse[i] = reversed;
+    }
+
+    // Stage with half-length h uses e^{-2*pi*i*j/(2h)}, j < h, stored contiguously at h-1
+    twiddleRe.resize(n > 1 ? n - 1 : 1);
+    twiddleIm.resize(n > 1 ? n - 1 : 1);
+    for (int h = 1; h < n; h <<= 1) {
+        for (int j = 0; j < h; ++j) {
+            double angle = -TWO_PI * j / (2.0 * h);
+            twiddleRe[h - 1 + j] = static_cast<float>(std::cos(angle));
+            twiddleIm[h - 1 + j] = static_cast<float>(std::sin(angle));
+        }
+    }
+}
+
+void FFT::transform(float* re, float* im, int n, const int* bitReverse,
+                    const float* twiddleRe, const float* twiddleIm) {
+    for (int i = 0; i < n; ++i) {
+        int j = bitReverse[i];
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    // First two stages have trivial twiddles (1 and -i)
+    if (n >= 2) {
+        for (int k = 0; k < n; k += 2) {
+            float ar = re[k], ai = im[k];
+            float br = re[k + 1], bi = im[k + 1];
+            re[k] = ar + br;     im[k] = ai + bi;
+            re[k + 1] = ar - br; im[k + 1] = ai - bi;
+        }
+    }
+    if (n >= 4) {
+        for (int k = 0; k < n; k += 4) {
+            float ar = re[k], ai = im[k];
+            float br = re[k + 2], bi = im[k + 2];
+            re[k] = ar + br;     im[k] = ai + bi;
+            re[k + 2] = ar - br; im[k + 2] = ai - bi;
+
+            // b * (-i) = (bi, -br)
+            float cr = re[k + 1], ci = im[k + 1];
+            float dr = im[k + 3], di = -re[k + 3];
+            re[k + 1] = cr + dr; im[k + 1] = ci + di;
+            re[k + 3] = cr - dr; im[k + 3] = ci - di;
+        }
+    }
+
+    // Remaining stages: contiguous butterflies vectorise across j
+    for (int h = 4; h < n; h <<= 1) {
+        const float* wRe = twiddleRe + (h - 1);
+        const float* wIm = twiddleIm + (h - 1);
+        for (int k = 0; k < n; k += 2 * h) {
+            EtherSynthSIMD::SIMD::fftButterflies(re + k, im + k, re + k + h, im + k + h,
+                                                 wRe, wIm, h);
+        }
+    }
+}
+
+void FFT::forwardComplex(float* re, float* im) {
+    if (size_ == 0) return;
+    transform(re, im, size_, complexBitReverse_.data(),
+              complexTwiddleRe_.data(), complexTwiddleIm_.data());
+}
+
+void FFT::inverseComplex(float* re, float* im) {
+    if (size_ == 0) return;
+
+    // Conjugate, forward transform, conjugate and scale
+    for (int i = 0; i < size_; ++i) im[i] = -im[i];
+    transform(re, im, size_, complexBitReverse_.data(),
+              complexTwiddleRe_.data(), complexTwiddleIm_.data());
+    const float scale = 1.0f / size_;
+    for (int i = 0; i < size_; ++i) {
+        re[i] *= scale;
+        im[i] *= -scale;
+    }
+}
+
+void FFT::forwardReal(const float* input, float* re, float* im) {
+    if (size_ == 0) return;
+    const int half = size_ / 2;
+
+    // Pack even/odd samples as one half-size complex sequence
+    for (int n = 0; n < half; ++n) {
+        workRe_[n] = input[2 * n];
+        workIm_[n] = input[2 * n + 1];
+    }
+    transform(workRe_.data(), workIm_.data(), half, halfBitReverse_.data(),
+              halfTwiddleRe_.data(), halfTwiddleIm_.data());
+
+    // Split into even/odd spectra and recombine: X[k] = E[k] + W^k O[k]
+    for (int k = 0; k <= half; ++k) {
+        int a = (k == half) ? 0 : k;
+        int b = (k == 0) ? 0 : half - k;
+        float zr = workRe_[a], zi = workIm_[a];
+        float cr = workRe_[b], ci = -workIm_[b];
+
+        float er = 0.5f * (zr + cr);
+        float ei = 0.5f * (zi + ci);
+        float or_ = 0.5f * (zi - ci);
+        float oi = -0.5f * (zr - cr);
+
+        float wr = realTwiddleRe_[k], wi = realTwiddleIm_[k];
+        re[k] = er + (or_ * wr - oi * wi);
+        im[k] = ei + (or_ * wi + oi * wr);
+    }
+}
+
+void FFT::inverseReal(const float* re, const float* im, float* output) {
+    if (size_ == 0) return;
+    const int half = size_ / 2;
+
+    // Rebuild the packed half-size spectrum: Z[k] = E[k] + i O[k]
+    for (int k = 0; k < half; ++k) {
+        float xr = re[k], xi = im[k];
+        float cr = re[half - k], ci = -im[half - k];
+
+        float er = 0.5f * (xr + cr);
+        float ei = 0.5f * (xi + ci);
+        float dr = 0.5f * (xr - cr);
+        float di = 0.5f * (xi - ci);
+
+        // O[k] = D[k] * conj(W^k)
+        float wr = realTwiddleRe_[k], wi = -realTwiddleIm_[k];
+        float or_ = dr * wr - di * wi;
+        float oi = dr * wi + di * wr;
+
+        workRe_[k] = er - oi;
+        workIm_[k] = ei + or_;
+    }
+
+    for (int k = 0; k < half; ++k) workIm_[k] = -workIm_[k];
+    transform(workRe_.data(), workIm_.data(), half, halfBitReverse_.data(),
+              halfTwiddleRe_.data(), halfTwiddleIm_.data());
+
+    const float scale = 1.0f / half;
+    for (int n = 0; n < half; ++n) {
+        output[2 * n] = workRe_[n] * scale;
+        output[2 * n + 1] = -workIm_[n] * scale;
+    }
+}
+
+void FFT::magnitudes(const float* re, const float* im, float* output, int count, float scale) {
+    for (int i = 0; i < count; ++i) {
+        output[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]) * scale;
+    }
+}
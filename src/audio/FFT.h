@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+
+/**
+ * FFT - Shared radix-2 FFT engine for analysis and spectral processing
+ *
+ * Features:
+ * - Plans (bit-reversal table, per-stage twiddles) built once in setSize()
+ * - Split real/imaginary layout so butterflies vectorise (SIMDOptimizations.h)
+ * - Real-input path packs N real samples into an N/2 complex transform
+ * - Inverse transforms for resynthesis and band-limited interpolation
+ * - No allocation or trigonometry after setSize()
+ *
+ * Real spectra hold N/2 + 1 bins (DC..Nyquist). Forward transforms are
+ * unscaled; inverse transforms scale by 1/N so forward+inverse is identity.
+ */
+class FFT {
+public:
+    static constexpr int MIN_SIZE = 4;
+    static constexpr int MAX_SIZE = 65536;
+
+    FFT();
+    explicit FFT(int size);
+    ~FFT() = default;
+
+    // Plan allocation (not real-time safe); size must be a power of two
+    bool setSize(int size);
+    int getSize() const { return size_; }
+    int getNumBins() const { return size_ / 2 + 1; }
+    bool isValid() const { return size_ > 0; }
+
+    // Complex transforms, in place on split arrays of getSize() values
+    void forwardComplex(float* re, float* im);
+    void inverseComplex(float* re, float* im);
+
+    // Real transforms: getSize() samples <-> getNumBins() complex bins
+    void forwardReal(const float* input, float* re, float* im);
+    void inverseReal(const float* re, const float* im, float* output);
+
+    // Helpers
+    static bool isPowerOfTwo(int n) { return n > 0 && (n & (n - 1)) == 0; }
+    static void magnitudes(const float* re, const float* im, float* output, int count, float scale = 1.0f);
+
+private:
+    int size_ = 0;
+
+    // Plan for the N-point complex transform
+    std::vector<int> complexBitReverse_;
+    std::vector<float> complexTwiddleRe_;   // Stage h uses [h-1, 2h-1)
+    std::vector<float> complexTwiddleIm_;
+
+    // Plan for the N/2-point complex transform used by the real path
+    std::vector<int> halfBitReverse_;
+    std::vector<float> halfTwiddleRe_;
+    std::vector<float> halfTwiddleIm_;
+    std::vector<float> realTwiddleRe_;      // e^{-2*pi*i*k/N}, k = 0..N/2
+    std::vector<float> realTwiddleIm_;
+
+    // Scratch for the packed real transform
+    std::vector<float> workRe_;
+    std::vector<float> workIm_;
+
+    static void buildPlan(int n, std::vector<int>& bitReverse,
+                          std::vector<float>& twiddleRe, std::vector<float>& twiddleIm);
+    static void transform(float* re, float* im, int n, const int* bitReverse,
+                          const float* twiddleRe, const float* twiddleIm);
+};
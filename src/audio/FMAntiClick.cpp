@@ -1,4 +1,5 @@
 #include "FMAntiClick.h"
+#include "SIMDOptimizations.h"
 #include <cmath>
 #include <algorithm>
 #include <chrono>
@@ -379,7 +380,7 @@ float FMAntiClick::applyPhaseCorrection(int operatorIndex, float input, float ph
     
     // Generate corrected phase
     float correctedPhase = phase + correctionAmount;
-    float correctedSample = std::sin(correctedPhase) * std::abs(input);
+    float correctedSample = EtherSynthSIMD::SIMD::sinCycles(correctedPhase * INV_TWO_PI) * std::abs(input);
     
     // Check if correction is complete
     if (std::abs(state.phaseCorrection) < 0.01f) {
@@ -145,6 +145,7 @@ private:
     
     // Constants
     static constexpr float PHASE_JUMP_THRESHOLD = 0.5f;  // Radians
+    static constexpr float INV_TWO_PI = 0.159154943091895f; // Radians -> cycles for sinCycles()
     static constexpr float CLICK_DETECTION_TIME_MS = 1.0f;
     static constexpr float MIN_RAMP_SAMPLES = 8;
     static constexpr float MAX_RAMP_SAMPLES = 512;
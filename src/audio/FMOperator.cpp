@@ -14,6 +14,7 @@ FMOperator::FMOperator() {
     sampleRate_ = 44100.0f;
     phase_ = 0.0f;
     phaseIncrement_ = 0.0f;
+    cycleIncrement_ = 0.0f;
     initialized_ = false;
 }
 
@@ -40,6 +41,7 @@ void FMOperator::shutdown() {
     
     phase_ = 0.0f;
     phaseIncrement_ = 0.0f;
+    cycleIncrement_ = 0.0f;
     initialized_ = false;
 }
 
@@ -63,9 +65,9 @@ float FMOperator::processSample(float modulation) {
         return 0.0f;
     }
     
-    // Apply phase modulation
-    float modulatedPhase = phase_ + modulation;
-    modulatedPhase = normalizePhase(modulatedPhase);
+    // Apply phase modulation; any depth wraps with one floor instead of a loop
+    float modulatedPhase = (phase_ + modulation) * INV_TWO_PI;
+    modulatedPhase -= std::floor(modulatedPhase);
     
     // Generate waveform
     float output = generateWaveform(modulatedPhase);
@@ -99,11 +101,11 @@ float FMOperator::generateWaveform(float phase) const {
         case Waveform::SINE:
             return generateSine(phase);
         case Waveform::SAW_APPROX:
-            return generateSawApprox(phase);
+            return generateSaw(phase);
         case Waveform::SQUARE_APPROX:
-            return generateSquareApprox(phase);
+            return generateSquare(phase);
         case Waveform::TRIANGLE_APPROX:
-            return generateTriangleApprox(phase);
+            return generateTriangle(phase);
         case Waveform::HALF_SINE:
             return generateHalfSine(phase);
         case Waveform::FULL_SINE:
@@ -117,51 +119,43 @@ float FMOperator::generateWaveform(float phase) const {
     }
 }
 
-float FMOperator::generateSawApprox(float phase) const {
-    // Sine-based sawtooth approximation using Fourier series
-    float fundamental = std::sin(phase);
-    float harmonic2 = std::sin(phase * 2.0f) * 0.5f;
-    float harmonic3 = std::sin(phase * 3.0f) * 0.333f;
-    float harmonic4 = std::sin(phase * 4.0f) * 0.25f;
-    
-    return (fundamental + harmonic2 + harmonic3 + harmonic4) * 0.637f; // Normalize
+float FMOperator::generateSaw(float phase) const {
+    // Falling ramp, +1 -> -1 like the old Fourier sum, with its rising edge smoothed
+    float saw = 1.0f - 2.0f * phase;
+    return saw + EtherSynthSIMD::SIMD::polyBlep(phase, cycleIncrement_);
 }
 
-float FMOperator::generateSquareApprox(float phase) const {
-    // Sine-based square wave approximation using odd harmonics
-    float fundamental = std::sin(phase);
-    float harmonic3 = std::sin(phase * 3.0f) * 0.333f;
-    float harmonic5 = std::sin(phase * 5.0f) * 0.2f;
-    float harmonic7 = std::sin(phase * 7.0f) * 0.143f;
-    
-    return (fundamental + harmonic3 + harmonic5 + harmonic7) * 0.785f; // Normalize
+float FMOperator::generateSquare(float phase) const {
+    // Rising edge at 0, falling edge half a cycle later
+    float square = (phase < 0.5f) ? 1.0f : -1.0f;
+    float halfPhase = phase + 0.5f;
+    if (halfPhase >= 1.0f) halfPhase -= 1.0f;
+    return square + EtherSynthSIMD::SIMD::polyBlep(phase, cycleIncrement_)
+                  - EtherSynthSIMD::SIMD::polyBlep(halfPhase, cycleIncrement_);
 }
 
-float FMOperator::generateTriangleApprox(float phase) const {
-    // Sine-based triangle wave approximation
-    float fundamental = std::sin(phase);
-    float harmonic3 = -std::sin(phase * 3.0f) * 0.111f; // Negative for triangle
-    float harmonic5 = std::sin(phase * 5.0f) * 0.04f;
-    float harmonic7 = -std::sin(phase * 7.0f) * 0.0204f;
-    
-    return (fundamental + harmonic3 + harmonic5 + harmonic7) * 0.81f; // Normalize
+float FMOperator::generateTriangle(float phase) const {
+    // Starts at 0 rising, peaks at a quarter cycle, like the sine
+    float u = phase + 0.75f;
+    if (u >= 1.0f) u -= 1.0f;
+    return std::abs(u * 4.0f - 2.0f) - 1.0f;
 }
 
 float FMOperator::generateHalfSine(float phase) const {
     // Half-wave rectified sine
-    float sine = std::sin(phase);
+    float sine = generateSine(phase);
     return (sine > 0.0f) ? sine : 0.0f;
 }
 
 float FMOperator::generateFullSine(float phase) const {
     // Full-wave rectified sine
-    return std::abs(std::sin(phase));
+    return std::abs(generateSine(phase));
 }
 
 float FMOperator::generateQuarterSine(float phase) const {
     // Quarter sine wave (sine for first quarter, zero elsewhere)
-    if (phase < PI * 0.5f) {
-        return std::sin(phase);
+    if (phase < 0.25f) {
+        return generateSine(phase);
     } else {
         return 0.0f;
     }
@@ -169,8 +163,8 @@ float FMOperator::generateQuarterSine(float phase) const {
 
 float FMOperator::generateAltSine(float phase) const {
     // Alternating sine polarity
-    float sine = std::sin(phase);
-    int cycle = static_cast<int>(phase * INV_TWO_PI);
+    float sine = generateSine(phase);
+    int cycle = static_cast<int>(phase);
     return (cycle % 2 == 0) ? sine : -sine;
 }
 
@@ -180,4 +174,5 @@ void FMOperator::updatePhaseIncrement() {
     } else {
         phaseIncrement_ = 0.0f;
     }
+    cycleIncrement_ = std::min(std::abs(phaseIncrement_ * INV_TWO_PI), 0.5f);
 }
\ No newline at end of file
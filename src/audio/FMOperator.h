@@ -1,11 +1,15 @@
 #pragma once
 #include <cmath>
+#include "SIMDOptimizations.h"
 
 /**
  * FMOperator - Single FM operator with waveform selection and modulation support
  * 
+ * Every waveform comes from the shared sinCycles()/polyBlep() kernels in
+ * SIMDOptimizations.h: no libm transcendentals per sample.
+ *
  * Features:
- * - Multiple waveform types (sine, saw, square, triangle approximations)
+ * - Multiple waveform types (sine, PolyBLEP saw and square, triangle, sine variants)
  * - Phase modulation input for FM synthesis
  * - Anti-click envelope ramping for parameter changes
  * - Velocity sensitivity and key scaling
@@ -16,9 +20,9 @@ class FMOperator {
 public:
     enum class Waveform {
         SINE,               // Pure sine wave
-        SAW_APPROX,         // Sine-based saw approximation
-        SQUARE_APPROX,      // Sine-based square approximation
-        TRIANGLE_APPROX,    // Sine-based triangle approximation
+        SAW_APPROX,         // PolyBLEP band-limited saw (falling ramp)
+        SQUARE_APPROX,      // PolyBLEP band-limited square
+        TRIANGLE_APPROX,    // Triangle (no steps, harmonics fall at 12 dB/octave)
         HALF_SINE,          // Half-wave rectified sine
         FULL_SINE,          // Full-wave rectified sine
         QUARTER_SINE,       // Quarter sine wave
@@ -67,14 +71,15 @@ private:
     float sampleRate_ = 44100.0f;
     float phase_ = 0.0f;
     float phaseIncrement_ = 0.0f;
+    float cycleIncrement_ = 0.0f;   // phaseIncrement_ in cycles: the PolyBLEP width
     bool initialized_ = false;
     
-    // Waveform generation
+    // Waveform generation; phase in cycles, [0, 1)
     float generateWaveform(float phase) const;
     float generateSine(float phase) const;
-    float generateSawApprox(float phase) const;
-    float generateSquareApprox(float phase) const;
-    float generateTriangleApprox(float phase) const;
+    float generateSaw(float phase) const;
+    float generateSquare(float phase) const;
+    float generateTriangle(float phase) const;
     float generateHalfSine(float phase) const;
     float generateFullSine(float phase) const;
     float generateQuarterSine(float phase) const;
@@ -91,7 +96,7 @@ private:
 };
 
 inline float FMOperator::generateSine(float phase) const {
-    return std::sin(phase);
+    return EtherSynthSIMD::SIMD::sinCycles(phase);
 }
 
 inline float FMOperator::normalizePhase(float phase) const {
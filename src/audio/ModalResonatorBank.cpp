@@ -0,0 +1,236 @@
+#include "ModalResonatorBank.h"
+#include "SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+
+using EtherSynthSIMD::SIMD::LaneVec;
+
+static_assert(ModalResonatorBank::MAX_MODES / 2 % LaneVec::WIDTH == 0, "Each output's modes must fill whole SIMD groups");
+
+namespace {
+    constexpr int TABLE_SIZE = 256;
+
+    // Rings' lut_stiffness and lut_4_decades, built once and shared by every bank
+    struct Tables {
+        float stiffness[TABLE_SIZE + 1];
+        float fourDecades[TABLE_SIZE + 1];
+
+        Tables() {
+            for (int i = 0; i <= TABLE_SIZE; ++i) {
+                const double x = static_cast<double>(i) / TABLE_SIZE;
+                double g = x;
+                if (g < 0.25) {
+                    stiffness[i] = static_cast<float>(-(0.25 - g) * 0.25);          // Partials squeeze: bells
+                } else if (g < 0.3) {
+                    stiffness[i] = 0.0f;                                           // Harmonic
+                } else if (g < 0.9) {
+                    g = (g - 0.3) / 0.6;
+                    stiffness[i] = static_cast<float>(0.01 * std::pow(10.0, g * 2.005) - 0.01);
+                } else {
+                    g = (g - 0.9) / 0.1;
+                    stiffness[i] = static_cast<float>(1.5 - std::cos(g * g * M_PI) / 2.0);
+                }
+                fourDecades[i] = static_cast<float>(std::pow(10.0, 4.0 * x));
+            }
+            stiffness[TABLE_SIZE] = stiffness[TABLE_SIZE - 1] = 2.0f;
+        }
+    };
+
+    const Tables& tables() {
+        static const Tables shared;
+        return shared;
+    }
+
+    float interpolate(const float* table, float x) {
+        x = std::clamp(x, 0.0f, 1.0f) * TABLE_SIZE;
+        const int i = std::min(static_cast<int>(x), TABLE_SIZE - 1);
+        return table[i] + (table[i + 1] - table[i]) * (x - i);
+    }
+
+    // tan(pi * f) as stmlib's FREQUENCY_FAST polynomial, fitted for 16 Hz..16 kHz at 48 kHz
+    float tanPi(float f) {
+        constexpr float PI = 3.14159265f;
+        constexpr float A = 3.260e-01f * PI * PI * PI;
+        constexpr float B = 1.823e-01f * PI * PI * PI * PI * PI;
+        const float f2 = f * f;
+        return f * (PI + f2 * (A + B * f2));
+    }
+}
+
+ModalResonatorBank::ModalResonatorBank() {
+    tables();   // Build the shared tables here, not on the first audio block
+    reset();
+}
+
+void ModalResonatorBank::reset() {
+    state1_.fill(0.0f);
+    state2_.fill(0.0f);
+}
+
+void ModalResonatorBank::setFrequency(float hz, float sampleRate) {
+    if (sampleRate > 0.0f) frequency_ = std::max(hz, 0.0f) / sampleRate;
+}
+
+void ModalResonatorBank::setStructure(float structure) { structure_ = std::clamp(structure, 0.0f, 1.0f); }
+void ModalResonatorBank::setBrightness(float brightness) { brightness_ = std::clamp(brightness, 0.0f, 1.0f); }
+void ModalResonatorBank::setDamping(float damping) { damping_ = std::clamp(damping, 0.0f, 1.0f); }
+void ModalResonatorBank::setPosition(float position) { position_ = std::clamp(position, 0.0f, 1.0f); }
+
+void ModalResonatorBank::setResolution(int modes) {
+    modes -= modes & 1;   // Modes come in odd/even pairs
+    resolution_ = std::clamp(modes, 2, MAX_MODES);
+}
+
+int ModalResonatorBank::computeFilters() {
+    // Rings' Resonator::ComputeFilters, with coefficients written to each mode's lane
+    const Tables& t = tables();
+    float stiffness = interpolate(t.stiffness, structure_);
+    float harmonic = frequency_;
+    float stretchFactor = 1.0f;
+    float q = 500.0f * interpolate(t.fourDecades, damping_);
+    float brightnessAttenuation = 1.0f - structure_;
+    // Reduces the range of brightness when structure is very low, to prevent clipping
+    brightnessAttenuation *= brightnessAttenuation;
+    brightnessAttenuation *= brightnessAttenuation;
+    brightnessAttenuation *= brightnessAttenuation;
+    const float brightness = brightness_ * (1.0f - 0.2f * brightnessAttenuation);
+    float qLoss = brightness * (2.0f - brightness) * 0.85f + 0.15f;
+    const float qLossDampingRate = structure_ * (2.0f - structure_) * 0.1f;
+
+    int modes = 0;
+    for (int i = 0; i < resolution_; ++i) {
+        float partialFrequency = harmonic * stretchFactor;
+        if (partialFrequency >= 0.49f) {
+            partialFrequency = 0.49f;
+        } else {
+            modes = i + 1;
+        }
+        const int lane = laneOf(i);
+        const float g = tanPi(partialFrequency);
+        const float r = 1.0f / (1.0f + partialFrequency * q);
+        g_[lane] = g;
+        rg_[lane] = r + g;
+        h_[lane] = 1.0f / (1.0f + r * g + g * g);
+
+        stretchFactor += stiffness;
+        // Keep partials from folding back into negative frequencies, and add a
+        // few extra partials at the top when stretched
+        stiffness *= (stiffness < 0.0f) ? 0.93f : 0.98f;
+        // Keep the highest partials from decaying too fast
+        qLoss += qLossDampingRate * (1.0f - qLoss);
+        harmonic += frequency_;
+        q *= qLoss;
+    }
+    // Modes past the resolution hold still: g = 0 freezes an SVF at zero state
+    for (int i = resolution_; i < MAX_MODES; ++i) {
+        const int lane = laneOf(i);
+        g_[lane] = 0.0f;
+        rg_[lane] = 1.0f;
+        h_[lane] = 1.0f;
+        state1_[lane] = state2_[lane] = 0.0f;
+    }
+    return modes;
+}
+
+void ModalResonatorBank::process(const float* in, float* odd, float* even, size_t frames) {
+    while (frames > 0) {
+        const size_t chunk = std::min(frames, BUFFER_SIZE);
+        processChunk(in, odd, even, chunk);
+        in += chunk;
+        odd += chunk;
+        even += chunk;
+        frames -= chunk;
+    }
+}
+
+void ModalResonatorBank::processChunk(const float* in, float* odd, float* even, size_t frames) {
+    constexpr int W = LaneVec::WIDTH;
+    activeModes_ = computeFilters();
+
+    // Modes run in pairs like the original; lanes past the last pair are silent
+    const int pairs = (activeModes_ + 1) / 2;
+    const int groups = (pairs + W - 1) / W;
+
+    // Mode amplitudes are a raised cosine over the mode index, 0.5 + 0.5 cos(2 pi position i),
+    // as Rings' CosineOscillator produces it. Position glides across the block, so each lane
+    // rotates its cosine by a fixed angle per sample instead of evaluating it.
+    using EtherSynthSIMD::SIMD::sinCycles;
+    alignas(32) float weight[MAX_MODES];
+    alignas(32) float cosStart[MAX_MODES];
+    alignas(32) float sinStart[MAX_MODES];
+    alignas(32) float cosStep[MAX_MODES];
+    alignas(32) float sinStep[MAX_MODES];
+    const float delta = (position_ - previousPosition_) / static_cast<float>(frames);
+    for (int i = 0; i < MAX_MODES; ++i) {
+        const int lane = laneOf(i);
+        weight[lane] = (lane % HALF) < pairs ? 0.5f : 0.0f;
+        cosStart[lane] = sinCycles(previousPosition_ * i + 0.25f);
+        sinStart[lane] = sinCycles(previousPosition_ * i);
+        cosStep[lane] = sinCycles(delta * i + 0.25f);
+        sinStep[lane] = sinCycles(delta * i);
+    }
+    previousPosition_ = position_;
+    if (groups == 0) return;
+
+    alignas(32) float input[BUFFER_SIZE];
+    for (size_t n = 0; n < frames; ++n) input[n] = in[n] * 0.125f;
+
+    // Each output sums its modes lane-wise first, then across lanes once per sample
+    alignas(32) float acc[2][BUFFER_SIZE * W];
+    for (int half = 0; half < 2; ++half) {
+        float* sum = acc[half];
+        for (int group = 0; group < groups; ++group) {
+            const int base = half * HALF + group * W;
+            const LaneVec g = LaneVec::load(&g_[base]);
+            const LaneVec rg = LaneVec::load(&rg_[base]);
+            const LaneVec h = LaneVec::load(&h_[base]);
+            const LaneVec w = LaneVec::load(weight + base);
+            const LaneVec cs = LaneVec::load(cosStep + base);
+            const LaneVec ss = LaneVec::load(sinStep + base);
+            LaneVec c = LaneVec::load(cosStart + base);
+            LaneVec sn = LaneVec::load(sinStart + base);
+            LaneVec s1 = LaneVec::load(&state1_[base]);
+            LaneVec s2 = LaneVec::load(&state2_[base]);
+
+            for (size_t n = 0; n < frames; ++n) {
+                const LaneVec x = LaneVec::set1(input[n]);
+                const LaneVec hp = (x - rg * s1 - s2) * h;
+                const LaneVec gh = g * hp;
+                const LaneVec bp = gh + s1;
+                s1 = gh + bp;
+                const LaneVec gb = g * bp;
+                s2 = gb + gb + s2;
+                const LaneVec cNext = c * cs - sn * ss;
+                sn = sn * cs + c * ss;
+                c = cNext;
+                const LaneVec y = w * (bp + c * bp);
+                float* out = sum + n * W;
+                if (group == 0) {
+                    y.store(out);
+                } else {
+                    (LaneVec::load(out) + y).store(out);
+                }
+            }
+
+            s1.store(&state1_[base]);
+            s2.store(&state2_[base]);
+        }
+    }
+
+    // A long ring fades into denormals, which cost many times a normal multiply
+    // on x86; settle such states to zero once per block
+    for (int lane = 0; lane < MAX_MODES; ++lane) {
+        if (std::fabs(state1_[lane]) < 1e-20f) state1_[lane] = 0.0f;
+        if (std::fabs(state2_[lane]) < 1e-20f) state2_[lane] = 0.0f;
+    }
+
+    for (size_t n = 0; n < frames; ++n) {
+        float o = 0.0f, e = 0.0f;
+        for (int lane = 0; lane < W; ++lane) {
+            o += acc[0][n * W + lane];
+            e += acc[1][n * W + lane];
+        }
+        odd[n] += o;
+        even[n] += e;
+    }
+}
@@ -0,0 +1,233 @@
+#include "OfflineRenderer.h"
+#include "FileHandle.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// Two preallocated byte buffers: the renderer fills one while the writer
+// thread writes the other. Buffers are written in submission order.
+class AsyncFileWriter {
+public:
+    ~AsyncFileWriter() { finish(); }
+
+    void start(FILE* file, size_t capacity) {
+        file_ = file;
+        for (auto& buffer : buffers_) buffer.assign(capacity, 0);
+        full_.fill(false);
+        done_ = false;
+        failed_ = false;
+        back_ = 0;
+        thread_ = std::thread(&AsyncFileWriter::run, this);
+    }
+
+    // Renderer: the buffer to fill next; waits while the writer still owns it
+    uint8_t* acquire() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return !full_[back_]; });
+        return buffers_[back_].data();
+    }
+
+    void submit(size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sizes_[back_] = bytes;
+            full_[back_] = true;
+        }
+        condition_.notify_all();
+        back_ ^= 1;
+    }
+
+    // Drains pending buffers and stops the thread; false if any write failed
+    bool finish() {
+        if (!thread_.joinable()) return !failed_;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        condition_.notify_all();
+        thread_.join();
+        return !failed_;
+    }
+
+private:
+    void run() {
+        int front = 0;
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [&] { return full_[front] || done_; });
+            if (!full_[front]) return;   // Done and drained
+            const size_t bytes = sizes_[front];
+            lock.unlock();
+            if (!failed_ && fwrite(buffers_[front].data(), 1, bytes, file_) != bytes) failed_ = true;
+            lock.lock();
+            full_[front] = false;
+            lock.unlock();
+            condition_.notify_all();
+            front ^= 1;
+        }
+    }
+
+    FILE* file_ = nullptr;
+    std::array<std::vector<uint8_t>, 2> buffers_;
+    std::array<size_t, 2> sizes_{ };
+    std::array<bool, 2> full_{ };
+    int back_ = 0;
+    bool done_ = false;
+    std::atomic<bool> failed_{false};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread thread_;
+};
+
+// xorshift32: uniform in [0, 1)
+inline float nextUniform(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (float)(state >> 8) * (1.0f / 16777216.0f);
+}
+
+inline void putLE(uint8_t* out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+} // namespace
+
+size_t OfflineRenderer::bytesPerSample(Format format) {
+    switch (format) {
+        case Format::PCM_16: return 2;
+        case Format::PCM_24: return 3;
+        case Format::FLOAT_32: return 4;
+    }
+    return 4;
+}
+
+size_t OfflineRenderer::convert(const float* in, size_t samples, Format format, bool dither,
+                                uint32_t& ditherState, uint8_t* out) {
+    if (format == Format::FLOAT_32) {
+        for (size_t i = 0; i < samples; ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, &in[i], sizeof(bits));
+            putLE(out + i * 4, bits, 4);
+        }
+        return samples * 4;
+    }
+    // PCM: scale, add triangular dither of +-1 LSB, round and clip
+    const int bytes = format == Format::PCM_16 ? 2 : 3;
+    const float scale = format == Format::PCM_16 ? 32767.0f : 8388607.0f;
+    const float lo = -scale - 1.0f;
+    for (size_t i = 0; i < samples; ++i) {
+        float v = std::clamp(in[i], -1.0f, 1.0f) * scale;
+        if (dither) v += nextUniform(ditherState) - nextUniform(ditherState);
+        v = std::clamp(std::floor(v + 0.5f), lo, scale);
+        putLE(out + i * bytes, (uint32_t)(int32_t)v, bytes);
+    }
+    return samples * bytes;
+}
+
+void OfflineRenderer::makeWavHeader(uint8_t* header, const Config& config, uint64_t dataBytes) {
+    const uint32_t channels = 2;
+    const uint32_t sampleBytes = (uint32_t)bytesPerSample(config.format);
+    const uint32_t rate = (uint32_t)std::lround(config.sampleRate);
+    const uint32_t data = (uint32_t)std::min<uint64_t>(dataBytes, UINT32_MAX - WAV_HEADER_BYTES);
+    std::memcpy(header, "RIFF", 4);
+    putLE(header + 4, data + (uint32_t)WAV_HEADER_BYTES - 8, 4);
+    std::memcpy(header + 8, "WAVEfmt ", 8);
+    putLE(header + 16, 16, 4);
+    putLE(header + 20, config.format == Format::FLOAT_32 ? 3 : 1, 2);   // IEEE float / PCM
+    putLE(header + 22, channels, 2);
+    putLE(header + 24, rate, 4);
+    putLE(header + 28, rate * channels * sampleBytes, 4);
+    putLE(header + 32, channels * sampleBytes, 2);
+    putLE(header + 34, sampleBytes * 8, 2);
+    std::memcpy(header + 36, "data", 4);
+    putLE(header + 40, data, 4);
+}
+
+float OfflineRenderer::getProgress() const {
+    const uint64_t total = framesTotal_.load(std::memory_order_relaxed);
+    if (total == 0) return 0.0f;
+    return (float)((double)framesDone_.load(std::memory_order_relaxed) / (double)total);
+}
+
+bool OfflineRenderer::render(const std::string& path, const Config& config, const Event* events, size_t eventCount,
+                             RenderFunc renderFunc, EventFunc eventFunc, void* context) {
+    if (!renderFunc || config.maxBlockFrames == 0 || config.chunkFrames == 0) return false;
+    FileHandle file(path, "wb");
+    if (!file.is_open()) {
+        std::cerr << "OfflineRenderer: cannot open " << path << std::endl;
+        return false;
+    }
+
+    stats_ = Stats{ };
+    cancelRequested_.store(false, std::memory_order_relaxed);
+    framesDone_.store(0, std::memory_order_relaxed);
+    framesTotal_.store(config.totalFrames, std::memory_order_relaxed);
+    rendering_.store(true, std::memory_order_release);
+
+    // Everything is allocated before the loop: sorted events, render chunk, write buffers
+    events_.assign(events, events ? events + eventCount : events);
+    std::stable_sort(events_.begin(), events_.end(),
+                     [](const Event& a, const Event& b) { return a.frame < b.frame; });
+    chunk_.assign(config.chunkFrames * 2, 0.0f);
+    const size_t chunkBytes = config.chunkFrames * 2 * bytesPerSample(config.format);
+
+    uint8_t header[WAV_HEADER_BYTES];
+    makeWavHeader(header, config, 0);
+    bool ok = fwrite(header, 1, WAV_HEADER_BYTES, file.get()) == WAV_HEADER_BYTES;
+
+    const auto start = std::chrono::steady_clock::now();
+    AsyncFileWriter writer;
+    writer.start(file.get(), chunkBytes);
+    uint32_t ditherState = config.ditherSeed ? config.ditherSeed : 1u;
+    uint64_t position = 0;
+    size_t nextEvent = 0;
+    uint64_t dataBytes = 0;
+    while (ok && position < config.totalFrames) {
+        if (cancelRequested_.load(std::memory_order_relaxed)) {
+            stats_.cancelled = true;
+            break;
+        }
+        const uint64_t chunkStart = position;
+        const uint64_t chunkEnd = std::min<uint64_t>(config.totalFrames, chunkStart + config.chunkFrames);
+        while (position < chunkEnd) {
+            // Events due now, then render up to the next event or block boundary
+            while (nextEvent < events_.size() && events_[nextEvent].frame <= position) {
+                if (eventFunc) eventFunc(context, events_[nextEvent]);
+                ++nextEvent;
+                ++stats_.events;
+            }
+            uint64_t end = std::min<uint64_t>(chunkEnd, position + config.maxBlockFrames);
+            if (nextEvent < events_.size() && events_[nextEvent].frame < end) end = events_[nextEvent].frame;
+            renderFunc(context, chunk_.data() + (position - chunkStart) * 2, (size_t)(end - position));
+            position = end;
+        }
+        const size_t samples = (size_t)(chunkEnd - chunkStart) * 2;
+        for (size_t i = 0; i < samples; ++i) stats_.peak = std::max(stats_.peak, std::fabs(chunk_[i]));
+        const size_t bytes = convert(chunk_.data(), samples, config.format, config.dither, ditherState, writer.acquire());
+        writer.submit(bytes);
+        dataBytes += bytes;
+        framesDone_.store(chunkEnd, std::memory_order_relaxed);
+    }
+    ok = writer.finish() && ok;
+
+    // Patch the sizes now that the data length is known
+    makeWavHeader(header, config, dataBytes);
+    ok = ok && fseek(file.get(), 0, SEEK_SET) == 0 && fwrite(header, 1, WAV_HEADER_BYTES, file.get()) == WAV_HEADER_BYTES;
+    file.close();
+
+    stats_.frames = dataBytes / (2 * bytesPerSample(config.format));
+    stats_.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats_.realtimeFactor = stats_.renderSeconds > 0.0
+        ? (double)stats_.frames / config.sampleRate / stats_.renderSeconds : 0.0;
+    rendering_.store(false, std::memory_order_release);
+    return ok;
+}
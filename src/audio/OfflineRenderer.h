@@ -0,0 +1,98 @@
+#pragma once
+#include "../core/Types.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * OfflineRenderer - Faster-than-realtime bounce of a whole render graph to WAV
+ *
+ * Drives a render callback from the calling (non-RT) thread as fast as it
+ * returns, instead of waiting on the live audio callback. Timed events
+ * (notes, parameter changes) are handed to an event callback at their exact
+ * frame: the render is split at every event, so offline timing is sample
+ * accurate where the live sequencer is quantised to callback boundaries.
+ *
+ * Features:
+ * - Renders into fixed chunks; a writer thread writes the previous chunk while
+ *   the next one renders (double-buffered, both buffers allocated up front)
+ * - 16/24-bit PCM or 32-bit float WAV; the header is patched with the final size
+ * - Deterministic: the TPDF dither comes from a seeded generator, so the same
+ *   graph and events render bit-identical files
+ * - Progress and cancellation readable/settable from any thread
+ */
+class OfflineRenderer {
+public:
+    enum class Format { PCM_16 = 0, PCM_24, FLOAT_32 };
+
+    // Event types understood by the bridge (the renderer only orders and times them)
+    enum EventType : int32_t { NOTE_ON = 0, NOTE_OFF, ALL_NOTES_OFF, PARAMETER };
+
+    // Plain data so it can cross the C bridge API
+    struct Event {
+        uint64_t frame = 0;     // Absolute frame from the start of the render
+        int32_t type = NOTE_ON;
+        int32_t slot = 0;
+        int32_t data = 0;       // Note or parameter id
+        float value = 0.0f;     // Velocity or parameter value
+    };
+
+    struct Config {
+        float sampleRate = SAMPLE_RATE;
+        uint64_t totalFrames = 0;
+        Format format = Format::PCM_24;
+        bool dither = true;                 // TPDF dither for the PCM formats
+        uint32_t ditherSeed = 0x2545F491u;
+        size_t maxBlockFrames = BUFFER_SIZE; // Largest block handed to the render callback
+        size_t chunkFrames = 16384;          // Frames per write buffer
+    };
+
+    struct Stats {
+        uint64_t frames = 0;                // Frames written
+        size_t events = 0;                  // Events dispatched
+        double renderSeconds = 0.0;         // Wall time of the whole render
+        double realtimeFactor = 0.0;        // Audio seconds per wall second
+        float peak = 0.0f;                  // Before conversion
+        bool cancelled = false;
+    };
+
+    // out is interleaved stereo; frames <= maxBlockFrames
+    using RenderFunc = void (*)(void* context, float* out, size_t frames);
+    using EventFunc = void (*)(void* context, const Event& event);
+
+    OfflineRenderer() = default;
+    ~OfflineRenderer() = default;
+
+    // Blocks until the file is written. Events may be in any order; events at or
+    // past totalFrames are dropped. Returns false when the file cannot be written.
+    bool render(const std::string& path, const Config& config, const Event* events, size_t eventCount,
+                RenderFunc renderFunc, EventFunc eventFunc, void* context);
+
+    // Any thread
+    void cancel() { cancelRequested_.store(true, std::memory_order_relaxed); }
+    float getProgress() const;              // 0..1 of the current/last render
+    bool isRendering() const { return rendering_.load(std::memory_order_acquire); }
+
+    const Stats& getStats() const { return stats_; }
+
+    static size_t bytesPerSample(Format format);
+
+    // Convert interleaved floats to little-endian samples; returns bytes written
+    static size_t convert(const float* in, size_t samples, Format format, bool dither,
+                          uint32_t& ditherState, uint8_t* out);
+
+private:
+    static constexpr size_t WAV_HEADER_BYTES = 44;
+
+    static void makeWavHeader(uint8_t* header, const Config& config, uint64_t dataBytes);
+
+    std::atomic<bool> cancelRequested_{false};
+    std::atomic<bool> rendering_{false};
+    std::atomic<uint64_t> framesDone_{0};
+    std::atomic<uint64_t> framesTotal_{0};
+    Stats stats_;
+    std::vector<Event> events_;             // Sorted copy of the caller's events
+    std::vector<float> chunk_;              // Interleaved render target
+};
@@ -1,42 +1,122 @@
 #include "OversamplingProcessor.h"
 #include <cmath>
-#include <algorithm>
-#include <chrono>
+#include <cstring>
+
+namespace {
+
+// Stage filter settings per quality preset: the first stage is the steep one,
+// later stages only need to reject images above 3/8 of their rate
+struct StagePreset {
+    int firHalfLength;      // FIR: K (4K-1 taps)
+    float kaiserBeta;
+    int allpassSections;    // IIR
+    float transition;       // IIR: normalized transition band at the stage's high rate
+};
+
+constexpr StagePreset SHORT_FIR_PRESET[2] = {{6, 3.5f, 0, 0.0f}, {4, 5.4f, 0, 0.0f}};
+constexpr StagePreset LONG_FIR_PRESET[2] = {{16, 10.0f, 0, 0.0f}, {7, 10.0f, 0, 0.0f}};
+constexpr StagePreset IIR_PRESET[2] = {{0, 0.0f, 8, 0.04f}, {0, 0.0f, 6, 0.12f}};
+
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// Elliptic half-band as two allpass chains (Valenzuela and Constantinides)
+void computeTransitionParams(double transition, double& k, double& q) {
+    k = std::tan((1.0 - transition * 2.0) * M_PI / 4.0);
+    k *= k;
+    const double kksqrt = std::pow(1.0 - k * k, 0.25);
+    const double e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+    const double e2 = e * e;
+    const double e4 = e2 * e2;
+    q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+}
+
+double computeAllpassCoeff(int index, double k, double q, int order) {
+    const int c = index + 1;
+
+    double num = 0.0;
+    double sign = 1.0;
+    for (int i = 0; i < 64; i++) {
+        const double term = std::pow(q, i * (i + 1)) * std::sin((i * 2 + 1) * c * M_PI / order) * sign;
+        num += term;
+        sign = -sign;
+        if (std::fabs(term) < 1e-100) break;
+    }
+    num *= std::pow(q, 0.25);
+
+    double den = 0.0;
+    sign = -1.0;
+    for (int i = 1; i < 64; i++) {
+        const double term = std::pow(q, i * i) * std::cos(i * 2 * c * M_PI / order) * sign;
+        den += term;
+        sign = -sign;
+        if (std::fabs(term) < 1e-100) break;
+    }
+    den += 0.5;
+
+    const double ww = num / den;
+    const double wwsq = ww * ww;
+    const double x = std::sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+    return (1.0 - x) / (1.0 + x);
+}
+
+} // namespace
 
 OversamplingProcessor::OversamplingProcessor() {
     oversampleFactor_ = Factor::X2;
+    quality_ = Quality::SHORT_FIR;
     sampleRate_ = 44100.0f;
     enabled_ = true;
     initialized_ = false;
-    filterLength_ = MAX_FILTER_LENGTH;
-    latencySamples_ = filterLength_ / 2;
-    cpuUsage_ = 0.0f;
 }
 
 OversamplingProcessor::~OversamplingProcessor() {
     shutdown();
 }
 
-bool OversamplingProcessor::initialize(float sampleRate, Factor oversampleFactor) {
+bool OversamplingProcessor::initialize(float sampleRate, Factor oversampleFactor, Quality quality, int maxBlockSize) {
     if (initialized_) {
         shutdown();
     }
-    
+    if (sampleRate <= 0.0f || maxBlockSize <= 0) {
+        return false;
+    }
+
     sampleRate_ = sampleRate;
     oversampleFactor_ = oversampleFactor;
-    
-    // Design half-band filter
-    designHalfBandFilter();
-    
-    // Initialize delay lines
-    initializeDelayLines();
-    
-    // Initialize processing buffers
-    int maxBufferSize = 1024 * static_cast<int>(oversampleFactor_);
-    oversampledBuffer_.resize(maxBufferSize);
-    processedBuffer_.resize(maxBufferSize);
-    
+    quality_ = quality;
+    maxBlockSize_ = maxBlockSize;
+    stageCount_ = oversampleFactor_ == Factor::X2 ? 1 : (oversampleFactor_ == Factor::X4 ? 2 : 3);
+
+    // Design the cascade; latency adds up in base-rate samples
+    latencySamples_ = 0.0f;
+    for (int s = 0; s < stageCount_; s++) {
+        Stage& stage = stages_[s];
+        designStage(stage, s);
+
+        // Stage s runs between 2^s and 2^(s+1) times the base rate
+        if (!stage.iir) {
+            const size_t lineSize = static_cast<size_t>(stage.taps + (maxBlockSize_ << s));
+            stage.upLine.assign(lineSize, 0.0f);
+            stage.evenLine.assign(lineSize, 0.0f);
+            stage.oddLine.assign(lineSize, 0.0f);
+        }
+        latencySamples_ += stageLatency(stage) / static_cast<float>(1 << s);
+    }
+
+    bufferA_.assign(static_cast<size_t>(maxBlockSize_) * getFactor(), 0.0f);
+    bufferB_.assign(static_cast<size_t>(maxBlockSize_) * getFactor(), 0.0f);
+    oversampled_ = bufferA_.data();
+
     initialized_ = true;
+    reset();
     return true;
 }
 
@@ -44,26 +124,47 @@ void OversamplingProcessor::shutdown() {
     if (!initialized_) {
         return;
     }
-    
-    upsampleCoeffs_.clear();
-    downsampleCoeffs_.clear();
-    upsampleDelay_.clear();
-    downsampleDelay_.clear();
-    oversampledBuffer_.clear();
-    processedBuffer_.clear();
-    
+
+    for (auto& stage : stages_) {
+        stage.upLine.clear();
+        stage.evenLine.clear();
+        stage.oddLine.clear();
+    }
+    bufferA_.clear();
+    bufferB_.clear();
+    oversampled_ = nullptr;
+
     initialized_ = false;
 }
 
+void OversamplingProcessor::reset() {
+    for (auto& stage : stages_) {
+        std::fill(stage.upLine.begin(), stage.upLine.end(), 0.0f);
+        std::fill(stage.evenLine.begin(), stage.evenLine.end(), 0.0f);
+        std::fill(stage.oddLine.begin(), stage.oddLine.end(), 0.0f);
+        stage.upX.fill(0.0f);
+        stage.upY.fill(0.0f);
+        stage.downX.fill(0.0f);
+        stage.downY.fill(0.0f);
+    }
+}
+
 void OversamplingProcessor::setOversampleFactor(Factor factor) {
     if (factor != oversampleFactor_) {
         oversampleFactor_ = factor;
-        
+
         if (initialized_) {
-            // Reinitialize with new factor
-            float currentSampleRate = sampleRate_;
-            shutdown();
-            initialize(currentSampleRate, factor);
+            initialize(sampleRate_, oversampleFactor_, quality_, maxBlockSize_);
+        }
+    }
+}
+
+void OversamplingProcessor::setQuality(Quality quality) {
+    if (quality != quality_) {
+        quality_ = quality;
+
+        if (initialized_) {
+            initialize(sampleRate_, oversampleFactor_, quality_, maxBlockSize_);
         }
     }
 }
@@ -72,138 +173,178 @@ float OversamplingProcessor::getLatencyMs() const {
     return (latencySamples_ / sampleRate_) * 1000.0f;
 }
 
-void OversamplingProcessor::designHalfBandFilter() {
-    // Use pre-computed optimized half-band filter coefficients
-    upsampleCoeffs_.assign(HALFBAND_COEFFS.begin(), HALFBAND_COEFFS.end());
-    downsampleCoeffs_ = upsampleCoeffs_; // Same coefficients for up and down
-    
-    filterLength_ = static_cast<int>(upsampleCoeffs_.size());
-    latencySamples_ = filterLength_ / 2;
+float* OversamplingProcessor::upsample(const float* input, int numSamples) {
+    const float* source = input;
+    int length = numSamples;
+    float* target = bufferA_.data();
+
+    for (int s = 0; s < stageCount_; s++) {
+        upsampleStage(stages_[s], source, target, length);
+        source = target;
+        length *= 2;
+        target = (target == bufferA_.data()) ? bufferB_.data() : bufferA_.data();
+    }
+
+    oversampled_ = const_cast<float*>(source);
+    return oversampled_;
 }
 
-void OversamplingProcessor::initializeDelayLines() {
-    upsampleDelay_.assign(filterLength_, 0.0f);
-    downsampleDelay_.assign(filterLength_, 0.0f);
+void OversamplingProcessor::downsample(float* output, int numSamples) {
+    const float* source = oversampled_;
+    int length = numSamples << stageCount_;
+
+    for (int s = stageCount_ - 1; s >= 0; s--) {
+        float* target = (s == 0) ? output : (source == bufferA_.data() ? bufferB_.data() : bufferA_.data());
+        length /= 2;
+        downsampleStage(stages_[s], source, target, length);
+        source = target;
+    }
 }
 
-void OversamplingProcessor::upsample2x(const float* input, float* output, int numInputSamples) {
-    for (int i = 0; i < numInputSamples; i++) {
-        // Insert sample into delay line
-        for (int j = filterLength_ - 1; j > 0; j--) {
-            upsampleDelay_[j] = upsampleDelay_[j - 1];
-        }
-        upsampleDelay_[0] = input[i];
-        
-        // Generate two output samples per input sample
-        // First sample (direct path)
-        float sum1 = 0.0f;
-        for (int j = 0; j < filterLength_; j += 2) {
-            sum1 += upsampleDelay_[j] * upsampleCoeffs_[j];
-        }
-        output[i * 2] = sum1 * 2.0f; // Compensate for 2x interpolation
-        
-        // Second sample (interpolated)
-        float sum2 = 0.0f;
-        for (int j = 1; j < filterLength_; j += 2) {
-            sum2 += upsampleDelay_[j] * upsampleCoeffs_[j];
-        }
-        output[i * 2 + 1] = sum2 * 2.0f;
+void OversamplingProcessor::designStage(Stage& stage, int index) {
+    const StagePreset* presets = quality_ == Quality::SHORT_FIR ? SHORT_FIR_PRESET
+                               : (quality_ == Quality::LONG_FIR ? LONG_FIR_PRESET : IIR_PRESET);
+    const StagePreset& preset = presets[index == 0 ? 0 : 1];
+
+    if (quality_ == Quality::IIR_ALLPASS) {
+        designHalfbandIIR(stage, preset.allpassSections, preset.transition);
+    } else {
+        designHalfbandFIR(stage, preset.firHalfLength, preset.kaiserBeta);
     }
 }
 
-void OversamplingProcessor::downsample2x(const float* input, float* output, int numInputSamples) {
-    int numOutputSamples = numInputSamples / 2;
-    
-    for (int i = 0; i < numOutputSamples; i++) {
-        // Process every second sample with anti-aliasing filter
-        float sample = input[i * 2];
-        
-        // Insert into delay line
-        for (int j = filterLength_ - 1; j > 0; j--) {
-            downsampleDelay_[j] = downsampleDelay_[j - 1];
-        }
-        downsampleDelay_[0] = sample;
-        
-        // Apply filter
-        float sum = 0.0f;
-        for (int j = 0; j < filterLength_; j++) {
-            sum += downsampleDelay_[j] * downsampleCoeffs_[j];
-        }
-        
-        output[i] = sum;
-    }
-}
-
-void OversamplingProcessor::upsample4x(const float* input, float* output, int numInputSamples) {
-    // 4x oversampling implemented as two stages of 2x
-    std::vector<float> intermediate(numInputSamples * 2);
-    
-    // First stage: 1x to 2x
-    upsample2x(input, intermediate.data(), numInputSamples);
-    
-    // Second stage: 2x to 4x
-    upsample2x(intermediate.data(), output, numInputSamples * 2);
-}
-
-void OversamplingProcessor::downsample4x(const float* input, float* output, int numInputSamples) {
-    // 4x downsampling implemented as two stages of 2x
-    int intermediateSize = numInputSamples / 2;
-    std::vector<float> intermediate(intermediateSize);
-    
-    // First stage: 4x to 2x
-    downsample2x(input, intermediate.data(), numInputSamples);
-    
-    // Second stage: 2x to 1x
-    downsample2x(intermediate.data(), output, intermediateSize);
-}
-
-float OversamplingProcessor::processUpsampleFilter(float input) {
-    // Insert into delay line
-    for (int j = filterLength_ - 1; j > 0; j--) {
-        upsampleDelay_[j] = upsampleDelay_[j - 1];
-    }
-    upsampleDelay_[0] = input;
-    
-    // Apply filter
-    float sum = 0.0f;
-    for (int j = 0; j < filterLength_; j++) {
-        sum += upsampleDelay_[j] * upsampleCoeffs_[j];
-    }
-    
-    return sum;
+void OversamplingProcessor::designHalfbandFIR(Stage& stage, int halfLength, float kaiserBeta) {
+    // Kaiser-windowed half-band: h[centre] = 0.5, odd offsets from the centre
+    // carry the sinc, even offsets are zero. Only the even-phase taps are kept.
+    stage.iir = false;
+    stage.halfLength = halfLength;
+    stage.taps = 2 * halfLength;
+    stage.coeffs.fill(0.0f);
+
+    const int centre = 2 * halfLength - 1;
+    const double windowHalfWidth = centre + 1.0;
+    const double i0Beta = besselI0(kaiserBeta);
+    double sum = 0.0;
+    for (int m = 0; m < stage.taps; m++) {
+        const double t = 2 * m - centre;
+        const double sinc = std::sin(M_PI * t * 0.5) / (M_PI * t * 0.5);
+        const double ratio = t / windowHalfWidth;
+        const double window = besselI0(kaiserBeta * std::sqrt(1.0 - ratio * ratio)) / i0Beta;
+        stage.coeffs[m] = static_cast<float>(0.5 * sinc * window);
+        sum += stage.coeffs[m];
+    }
+
+    // Exact unity gain at DC: the even phase sums to 0.5, the centre tap is the other 0.5
+    for (int m = 0; m < stage.taps; m++) {
+        stage.coeffs[m] = static_cast<float>(stage.coeffs[m] * 0.5 / sum);
+    }
+}
+
+void OversamplingProcessor::designHalfbandIIR(Stage& stage, int sections, float transition) {
+    stage.iir = true;
+    stage.halfLength = 0;
+    stage.taps = std::min(sections, MAX_ALLPASS_SECTIONS);
+    stage.coeffs.fill(0.0f);
+
+    double k, q;
+    computeTransitionParams(transition, k, q);
+    const int order = stage.taps * 2 + 1;
+    for (int i = 0; i < stage.taps; i++) {
+        stage.coeffs[i] = static_cast<float>(computeAllpassCoeff(i, k, q, order));
+    }
 }
 
-float OversamplingProcessor::processDownsampleFilter(float input) {
-    // Insert into delay line
-    for (int j = filterLength_ - 1; j > 0; j--) {
-        downsampleDelay_[j] = downsampleDelay_[j - 1];
+float OversamplingProcessor::stageLatency(const Stage& stage) {
+    if (!stage.iir) {
+        // Linear phase: centre delay 2K-1 at the high rate, once each way
+        return static_cast<float>(2 * stage.halfLength - 1);
     }
-    downsampleDelay_[0] = input;
-    
-    // Apply filter
-    float sum = 0.0f;
-    for (int j = 0; j < filterLength_; j++) {
-        sum += downsampleDelay_[j] * downsampleCoeffs_[j];
+
+    // Allpass (a + z^-1) / (1 + a z^-1) delays DC by (1 - a) / (1 + a) low-rate
+    // samples; the two polyphase paths are averaged in each direction
+    float delay = 0.0f;
+    for (int i = 0; i < stage.taps; i++) {
+        delay += (1.0f - stage.coeffs[i]) / (1.0f + stage.coeffs[i]);
     }
-    
-    return sum;
+    return delay;
 }
 
-void OversamplingProcessor::clearDelayLines() {
-    std::fill(upsampleDelay_.begin(), upsampleDelay_.end(), 0.0f);
-    std::fill(downsampleDelay_.begin(), downsampleDelay_.end(), 0.0f);
+void OversamplingProcessor::upsampleStage(Stage& stage, const float* input, float* output, int numInputSamples) {
+    if (stage.iir) {
+        // Path 0 (even sections) makes the even output, path 1 the odd output
+        const int sections = stage.taps;
+        for (int i = 0; i < numInputSamples; i++) {
+            float path[2] = {input[i], input[i]};
+            for (int j = 0; j < sections; j++) {
+                float& x = path[j & 1];
+                const float y = (x - stage.upY[j]) * stage.coeffs[j] + stage.upX[j];
+                stage.upX[j] = x;
+                stage.upY[j] = y;
+                x = y;
+            }
+            output[i * 2] = path[0];
+            output[i * 2 + 1] = path[1];
+        }
+        return;
+    }
+
+    // Even outputs: FIR branch (x2 interpolation gain); odd outputs: the centre tap, a pure delay
+    const int history = stage.taps;
+    const int taps = stage.taps;
+    const int delay = stage.halfLength - 1;
+    float* line = stage.upLine.data();
+    std::memcpy(line + history, input, sizeof(float) * numInputSamples);
+
+    for (int i = 0; i < numInputSamples; i++) {
+        const float* x = line + history + i;
+        float sum = 0.0f;
+        for (int m = 0; m < taps; m++) {
+            sum += stage.coeffs[m] * x[-m];
+        }
+        output[i * 2] = sum * 2.0f;
+        output[i * 2 + 1] = x[-delay];
+    }
+
+    std::memmove(line, line + numInputSamples, sizeof(float) * history);
 }
 
-float OversamplingProcessor::calculateCPUUsage(int numSamples, float processingTimeMs) {
-    if (sampleRate_ <= 0.0f || numSamples <= 0) {
-        return 0.0f;
+void OversamplingProcessor::downsampleStage(Stage& stage, const float* input, float* output, int numOutputSamples) {
+    if (stage.iir) {
+        const int sections = stage.taps;
+        for (int i = 0; i < numOutputSamples; i++) {
+            float path[2] = {input[i * 2 + 1], input[i * 2]};
+            for (int j = 0; j < sections; j++) {
+                float& x = path[j & 1];
+                const float y = (x - stage.downY[j]) * stage.coeffs[j] + stage.downX[j];
+                stage.downX[j] = x;
+                stage.downY[j] = y;
+                x = y;
+            }
+            output[i] = 0.5f * (path[0] + path[1]);
+        }
+        return;
     }
-    
-    float blockTimeMs = (numSamples / sampleRate_) * 1000.0f;
-    float usage = (processingTimeMs / blockTimeMs) * 100.0f;
-    
-    // Smooth CPU usage measurement
-    cpuUsage_ = cpuUsage_ * CPU_USAGE_SMOOTH + usage * (1.0f - CPU_USAGE_SMOOTH);
-    
-    return cpuUsage_;
-}
\ No newline at end of file
+
+    // Even phase through the FIR branch, odd phase through the centre tap
+    const int history = stage.taps;
+    const int taps = stage.taps;
+    const int delay = stage.halfLength;
+    float* even = stage.evenLine.data();
+    float* odd = stage.oddLine.data();
+    for (int i = 0; i < numOutputSamples; i++) {
+        even[history + i] = input[i * 2];
+        odd[history + i] = input[i * 2 + 1];
+    }
+
+    for (int i = 0; i < numOutputSamples; i++) {
+        const float* x = even + history + i;
+        float sum = 0.0f;
+        for (int m = 0; m < taps; m++) {
+            sum += stage.coeffs[m] * x[-m];
+        }
+        output[i] = sum + 0.5f * odd[history + i - delay];
+    }
+
+    std::memmove(even, even + numOutputSamples, sizeof(float) * history);
+    std::memmove(odd, odd + numOutputSamples, sizeof(float) * history);
+}
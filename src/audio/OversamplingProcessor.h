@@ -1,105 +1,126 @@
 #pragma once
 #include <vector>
+#include <algorithm>
 #include <array>
 
 /**
- * OversamplingProcessor - Polyphase oversampling for aliasing reduction
- * 
+ * OversamplingProcessor - Polyphase half-band oversampling for aliasing reduction
+ *
+ * 2x, 4x and 8x run as a cascade of 2x half-band stages. Each stage is
+ * polyphase, so its filters only ever run at the lower of its two rates. The
+ * first stage does the steep filtering. The later stages only have to keep
+ * images off the base band, so they use short filters. All state and block
+ * buffers are sized in initialize(), and processing never allocates.
+ *
  * Features:
- * - 2x or 4x oversampling with polyphase filters
- * - Anti-aliasing filters for upsampling and downsampling
- * - Optimized for real-time processing
- * - Low latency design suitable for synthesis
- * - Supports both block and sample-by-sample processing
+ * - 2x, 4x or 8x oversampling
+ * - Quality presets: short FIR, long FIR (both linear phase) or IIR allpass
+ *   (polyphase allpass half-bands: steep and short delay, not linear phase)
+ * - Block API: upsample(), process the oversampled block in place, downsample()
+ * - processBlock()/processSample() wrap the block API around a callable
+ * - Reports round-trip latency in base-rate samples (group delay at DC)
+ * - Blocks longer than the preallocated size are processed in chunks
  */
 class OversamplingProcessor {
 public:
     enum class Factor {
         X2 = 2,    // 2x oversampling
-        X4 = 4     // 4x oversampling
+        X4 = 4,    // 4x oversampling
+        X8 = 8     // 8x oversampling
     };
-    
+
+    enum class Quality {
+        SHORT_FIR,      // 23-tap first stage: ~45 dB alias rejection, 11-16 samples latency
+        LONG_FIR,       // 63-tap first stage: ~95 dB, flat to 20 kHz at 48k, 31-41 samples
+        IIR_ALLPASS     // 8 allpass sections first stage: ~99 dB, 3-5 samples, not linear phase
+    };
+
+    static constexpr int MAX_STAGES = 3;
+    static constexpr int DEFAULT_MAX_BLOCK_SIZE = 256;  // Base-rate samples per chunk
+
     OversamplingProcessor();
     ~OversamplingProcessor();
-    
-    // Initialization
-    bool initialize(float sampleRate, Factor oversampleFactor = Factor::X2);
+
+    // Initialization (allocates; not for the audio thread)
+    bool initialize(float sampleRate, Factor oversampleFactor = Factor::X2,
+                    Quality quality = Quality::SHORT_FIR, int maxBlockSize = DEFAULT_MAX_BLOCK_SIZE);
     void shutdown();
-    
-    // Configuration
+    void reset();                                       // Clears filter state
+    bool isInitialized() const { return initialized_; }
+
+    // Configuration (re-initializes when already initialized)
     void setOversampleFactor(Factor factor);
     Factor getOversampleFactor() const { return oversampleFactor_; }
-    
+    void setQuality(Quality quality);
+    Quality getQuality() const { return quality_; }
+    int getFactor() const { return static_cast<int>(oversampleFactor_); }
+    int getMaxBlockSize() const { return maxBlockSize_; }
+
     void setEnabled(bool enabled) { enabled_ = enabled; }
     bool isEnabled() const { return enabled_; }
-    
+
+    // Block API: upsample() returns numSamples * getFactor() oversampled samples
+    // (numSamples <= getMaxBlockSize()); process them in place, then
+    // downsample() writes numSamples base-rate samples
+    float* upsample(const float* input, int numSamples);
+    void downsample(float* output, int numSamples);
+
     // Processing
     template<typename ProcessorFunc>
     float processSample(float input, ProcessorFunc processor);
-    
+
     template<typename ProcessorFunc>
     void processBlock(const float* input, float* output, int numSamples, ProcessorFunc processor);
-    
+
     // Analysis
+    float getLatencySamples() const { return latencySamples_; }    // Base rate, may be fractional
     float getLatencyMs() const;
-    int getLatencySamples() const { return latencySamples_; }
-    float getCPUUsage() const { return cpuUsage_; }
-    
+
 private:
+    static constexpr int MAX_FIR_TAPS = 32;             // Per polyphase branch
+    static constexpr int MAX_ALLPASS_SECTIONS = 8;
+
+    // One 2x half-band stage (up and down direction)
+    struct Stage {
+        bool iir = false;
+        int halfLength = 0;                     // FIR: K, branch taps 2K, centre delay 2K-1
+        int taps = 0;                           // FIR branch taps / IIR allpass sections
+        std::array<float, MAX_FIR_TAPS> coeffs{};  // FIR: even-phase taps h[2m]; IIR: allpass coefficients
+
+        // FIR: history followed by the current block
+        std::vector<float> upLine;
+        std::vector<float> evenLine;
+        std::vector<float> oddLine;
+
+        // IIR allpass state (x[n-1], y[n-1] per section)
+        std::array<float, MAX_ALLPASS_SECTIONS> upX{}, upY{}, downX{}, downY{};
+    };
+
     // Configuration
     Factor oversampleFactor_ = Factor::X2;
+    Quality quality_ = Quality::SHORT_FIR;
     float sampleRate_ = 44100.0f;
     bool enabled_ = true;
     bool initialized_ = false;
-    
-    // Filter coefficients (half-band filters for polyphase implementation)
-    std::vector<float> upsampleCoeffs_;
-    std::vector<float> downsampleCoeffs_;
-    
-    // Delay lines for polyphase filters
-    std::vector<float> upsampleDelay_;
-    std::vector<float> downsampleDelay_;
-    
-    // Processing buffers
-    std::vector<float> oversampledBuffer_;
-    std::vector<float> processedBuffer_;
-    
-    // State
-    int filterLength_;
-    int latencySamples_;
-    float cpuUsage_ = 0.0f;
-    
+    int maxBlockSize_ = DEFAULT_MAX_BLOCK_SIZE;
+
+    // Cascade
+    std::array<Stage, MAX_STAGES> stages_;
+    int stageCount_ = 1;
+    std::vector<float> bufferA_;                // Ping-pong oversampled buffers
+    std::vector<float> bufferB_;
+    float* oversampled_ = nullptr;              // Result of the last upsample()
+    float latencySamples_ = 0.0f;
+
     // Filter design
-    void designHalfBandFilter();
-    void initializeDelayLines();
-    
-    // Polyphase processing
-    void upsample2x(const float* input, float* output, int numInputSamples);
-    void downsample2x(const float* input, float* output, int numInputSamples);
-    void upsample4x(const float* input, float* output, int numInputSamples);
-    void downsample4x(const float* input, float* output, int numInputSamples);
-    
-    // Filter processing
-    float processUpsampleFilter(float input);
-    float processDownsampleFilter(float input);
-    
-    // Utility functions
-    void clearDelayLines();
-    float calculateCPUUsage(int numSamples, float processingTimeMs);
-    
-    // Constants
-    static constexpr int MAX_FILTER_LENGTH = 31;
-    static constexpr float CPU_USAGE_SMOOTH = 0.99f;
-    
-    // Half-band filter coefficients (31-tap, optimized for real-time use)
-    static constexpr std::array<float, MAX_FILTER_LENGTH> HALFBAND_COEFFS = {{
-        -0.000244140625f, 0.0f, 0.000732421875f, 0.0f, -0.00152587890625f,
-        0.0f, 0.00262451171875f, 0.0f, -0.004150390625f, 0.0f,
-        0.006103515625f, 0.0f, -0.008544921875f, 0.0f, 0.011962890625f,
-        0.0f, -0.017333984375f, 0.0f, 0.026611328125f, 0.0f,
-        -0.044677734375f, 0.0f, 0.099853515625f, 0.0f, 0.3505859375f,
-        0.5f, 0.3505859375f, 0.0f, 0.099853515625f, 0.0f, -0.044677734375f
-    }};
+    void designStage(Stage& stage, int index);
+    static void designHalfbandFIR(Stage& stage, int halfLength, float kaiserBeta);
+    static void designHalfbandIIR(Stage& stage, int sections, float transition);
+    static float stageLatency(const Stage& stage);     // Round trip, in samples at the stage's low rate
+
+    // Polyphase processing (numInput base samples in, twice as many out, and back)
+    static void upsampleStage(Stage& stage, const float* input, float* output, int numInputSamples);
+    static void downsampleStage(Stage& stage, const float* input, float* output, int numOutputSamples);
 };
 
 // Template method implementations
@@ -108,38 +129,15 @@ float OversamplingProcessor::processSample(float input, ProcessorFunc processor)
     if (!initialized_ || !enabled_) {
         return processor(input);
     }
-    
-    int oversampleRate = static_cast<int>(oversampleFactor_);
-    
-    // Upsample
-    std::vector<float> upsampled(oversampleRate);
-    if (oversampleFactor_ == Factor::X2) {
-        float upsampledArray[2] = {0.0f, 0.0f};
-        upsample2x(&input, upsampledArray, 1);
-        upsampled[0] = upsampledArray[0];
-        upsampled[1] = upsampledArray[1];
-    } else {
-        float upsampledArray[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-        upsample4x(&input, upsampledArray, 1);
-        for (int i = 0; i < 4; i++) {
-            upsampled[i] = upsampledArray[i];
-        }
-    }
-    
-    // Process at higher sample rate
-    std::vector<float> processed(oversampleRate);
+
+    const int oversampleRate = getFactor();
+    float* upsampled = upsample(&input, 1);
     for (int i = 0; i < oversampleRate; i++) {
-        processed[i] = processor(upsampled[i]);
+        upsampled[i] = processor(upsampled[i]);
     }
-    
-    // Downsample
+
     float output;
-    if (oversampleFactor_ == Factor::X2) {
-        downsample2x(processed.data(), &output, 2);
-    } else {
-        downsample4x(processed.data(), &output, 4);
-    }
-    
+    downsample(&output, 1);
     return output;
 }
 
@@ -151,32 +149,16 @@ void OversamplingProcessor::processBlock(const float* input, float* output, int
         }
         return;
     }
-    
-    int oversampleRate = static_cast<int>(oversampleFactor_);
-    int oversampledSize = numSamples * oversampleRate;
-    
-    // Ensure buffers are large enough
-    if (oversampledBuffer_.size() < static_cast<size_t>(oversampledSize)) {
-        oversampledBuffer_.resize(oversampledSize);
-        processedBuffer_.resize(oversampledSize);
-    }
-    
-    // Upsample
-    if (oversampleFactor_ == Factor::X2) {
-        upsample2x(input, oversampledBuffer_.data(), numSamples);
-    } else {
-        upsample4x(input, oversampledBuffer_.data(), numSamples);
-    }
-    
-    // Process at higher sample rate
-    for (int i = 0; i < oversampledSize; i++) {
-        processedBuffer_[i] = processor(oversampledBuffer_[i]);
-    }
-    
-    // Downsample
-    if (oversampleFactor_ == Factor::X2) {
-        downsample2x(processedBuffer_.data(), output, oversampledSize);
-    } else {
-        downsample4x(processedBuffer_.data(), output, oversampledSize);
+
+    const int oversampleRate = getFactor();
+    for (int start = 0; start < numSamples; start += maxBlockSize_) {
+        const int count = std::min(maxBlockSize_, numSamples - start);
+        const int oversampledSize = count * oversampleRate;
+
+        float* upsampled = upsample(input + start, count);
+        for (int i = 0; i < oversampledSize; i++) {
+            upsampled[i] = processor(upsampled[i]);
+        }
+        downsample(output + start, count);
     }
-}
\ No newline at end of file
+}
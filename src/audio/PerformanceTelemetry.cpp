@@ -0,0 +1,371 @@
+#include "PerformanceTelemetry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace {
+constexpr uint8_t NO_SLOT = 0xFF;
+constexpr float HISTOGRAM_MIN_US = 0.1f;
+constexpr float BINS_PER_DECADE = 40.0f;
+constexpr double CALIBRATION_MIN_US = 10000.0;   // Reader waits this long before converting ticks
+
+PerformanceTelemetry::Stats statsFrom(uint64_t count, double sumUs, float maxUs,
+                                      const uint64_t* bins, int binCount, float (*upper)(int)) {
+    PerformanceTelemetry::Stats stats;
+    stats.count = count;
+    if (count == 0) return stats;
+    stats.maxUs = maxUs;
+    stats.meanUs = static_cast<float>(sumUs / static_cast<double>(count));
+
+    auto percentile = [&](double q) {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+        uint64_t seen = 0;
+        for (int b = 0; b < binCount; ++b) {
+            seen += bins[b];
+            if (seen >= rank) return std::min(upper(b), maxUs);
+        }
+        return maxUs;
+    };
+    stats.p50Us = percentile(0.50);
+    stats.p99Us = percentile(0.99);
+    return stats;
+}
+}
+
+PerformanceTelemetry::PerformanceTelemetry() {
+}
+
+PerformanceTelemetry::~PerformanceTelemetry() {
+    stop();
+}
+
+// ===== Real-time side =====
+
+void PerformanceTelemetry::beginCallback() {
+    block_.store(block_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void PerformanceTelemetry::record(int writer, Stage stage, int slot, uint64_t start, uint64_t end) {
+    push(writer, stage, slot, start, end, 0);
+}
+
+void PerformanceTelemetry::endCallback(uint64_t start, uint64_t end, size_t frames) {
+    push(0, Stage::CALLBACK, ALL_SLOTS, start, end, frames);
+}
+
+void PerformanceTelemetry::push(int writer, Stage stage, int slot, uint64_t start, uint64_t end, size_t frames) {
+    if (!isEnabled() || writer < 0 || writer >= MAX_WRITERS) return;
+    Ring& ring = rings_[writer];
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Event& event = ring.events[head & (RING_CAPACITY - 1)];
+    uint64_t duration = end > start ? end - start : 0;
+    event.start = start;
+    event.duration = static_cast<uint32_t>(std::min<uint64_t>(duration, std::numeric_limits<uint32_t>::max()));
+    event.block = block_.load(std::memory_order_relaxed);
+    event.frames = static_cast<uint16_t>(std::min<size_t>(frames, std::numeric_limits<uint16_t>::max()));
+    event.stage = static_cast<uint8_t>(stage);
+    event.slot = (slot >= 0 && slot < MAX_SLOTS) ? static_cast<uint8_t>(slot) : NO_SLOT;
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+void PerformanceTelemetry::reportXrun() {
+    uint64_t t = now();
+    record(0, Stage::XRUN, ALL_SLOTS, t, t);
+}
+
+// ===== Control side =====
+
+bool PerformanceTelemetry::start(const std::string& dumpPath) {
+    if (readerRunning_) return true;
+    {
+        // Buffers are allocated on first start: idle instances stay small
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        for (auto& ring : rings_) {
+            if (ring.events.empty()) ring.events.resize(RING_CAPACITY);
+        }
+        if (histograms_.empty()) histograms_.resize(static_cast<size_t>(STAGE_COUNT) * (MAX_SLOTS + 1));
+        batch_.reserve(RING_CAPACITY * MAX_WRITERS);
+        overruns_.reserve(MAX_OVERRUNS);
+        calibrationTicks_ = now();
+        calibrationTime_ = std::chrono::steady_clock::now();
+        ticksPerUs_ = 0.0;
+    }
+    dumpPath_ = dumpPath;
+    stopRequested_ = false;
+    enabled_.store(true, std::memory_order_release);
+    reader_ = std::thread(&PerformanceTelemetry::readerLoop, this);
+    readerRunning_ = true;
+    return true;
+}
+
+void PerformanceTelemetry::stop() {
+    if (!readerRunning_) return;
+    enabled_.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(readerMutex_);
+        stopRequested_ = true;
+    }
+    readerWake_.notify_all();
+    reader_.join();
+    readerRunning_ = false;
+    poll();
+    if (!dumpPath_.empty()) dump(dumpPath_);
+}
+
+void PerformanceTelemetry::reset() {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    for (auto& ring : rings_) {
+        ring.tail.store(ring.head.load(std::memory_order_acquire), std::memory_order_release);
+        ring.dropped.store(0, std::memory_order_relaxed);
+    }
+    for (auto& h : histograms_) h = Histogram();
+    for (auto& trace : traces_) trace = BlockTrace();
+    overruns_.clear();
+    overrunCount_ = 0;
+    callbackCount_ = 0;
+}
+
+void PerformanceTelemetry::readerLoop() {
+    auto lastDump = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(readerMutex_);
+    while (!stopRequested_) {
+        readerWake_.wait_for(lock, std::chrono::milliseconds(READER_INTERVAL_MS),
+                             [this] { return stopRequested_; });
+        lock.unlock();
+        poll();
+        auto t = std::chrono::steady_clock::now();
+        if (!dumpPath_.empty() && t - lastDump >= std::chrono::milliseconds(DUMP_INTERVAL_MS)) {
+            dump(dumpPath_);
+            lastDump = t;
+        }
+        lock.lock();
+    }
+}
+
+bool PerformanceTelemetry::updateCalibration() {
+    auto t = std::chrono::steady_clock::now();
+    uint64_t ticks = now();
+    if (calibrationTicks_ == 0) {
+        calibrationTicks_ = ticks;
+        calibrationTime_ = t;
+        return false;
+    }
+    double us = std::chrono::duration<double, std::micro>(t - calibrationTime_).count();
+    if (us >= CALIBRATION_MIN_US && ticks > calibrationTicks_) {
+        ticksPerUs_ = static_cast<double>(ticks - calibrationTicks_) / us;
+    }
+    return ticksPerUs_ > 0.0;
+}
+
+void PerformanceTelemetry::poll() {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    if (histograms_.empty() || !updateCalibration()) return;   // Events wait in the rings until ticks can be converted
+
+    // Audio ring head first: every helper event of the callbacks it holds is then visible
+    batch_.clear();
+    size_t audioHead = rings_[0].head.load(std::memory_order_acquire);
+    for (int w = 1; w < MAX_WRITERS; ++w) {
+        drain(rings_[w], rings_[w].head.load(std::memory_order_acquire));
+    }
+    drain(rings_[0], audioHead);
+
+    // Stage events before callbacks, so overrun breakdowns are complete
+    for (const Event& event : batch_) {
+        if (event.stage != static_cast<uint8_t>(Stage::CALLBACK)) aggregate(event);
+    }
+    for (const Event& event : batch_) {
+        if (event.stage == static_cast<uint8_t>(Stage::CALLBACK)) aggregate(event);
+    }
+}
+
+void PerformanceTelemetry::drain(Ring& ring, size_t head) {
+    size_t tail = ring.tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+        batch_.push_back(ring.events[tail & (RING_CAPACITY - 1)]);
+    }
+    ring.tail.store(tail, std::memory_order_release);
+}
+
+void PerformanceTelemetry::aggregate(const Event& event) {
+    if (event.stage >= STAGE_COUNT) return;
+    const float us = static_cast<float>(event.duration / ticksPerUs_);
+    const int slot = event.slot == NO_SLOT ? ALL_SLOTS : event.slot;
+
+    BlockTrace& trace = traces_[event.block % TRACE_BLOCKS];
+    if (!trace.used || trace.block != event.block) {
+        trace = BlockTrace();
+        trace.block = event.block;
+        trace.used = true;
+    }
+
+    const Stage stage = static_cast<Stage>(event.stage);
+    if (stage == Stage::XRUN) {
+        overrunCount_++;
+        recordOverrun(event, 0.0f, 0.0f);
+        return;
+    }
+
+    auto add = [us](Histogram& h) {
+        h.bins[binForUs(us)]++;
+        h.count++;
+        h.sumUs += us;
+        h.maxUs = std::max(h.maxUs, us);
+    };
+    add(histogram(event.stage, ALL_SLOTS));
+    if (slot != ALL_SLOTS) add(histogram(event.stage, slot));
+
+    trace.stageTicks[event.stage] += event.duration;
+    if (slot != ALL_SLOTS && (stage == Stage::LFO || stage == Stage::ENGINE || stage == Stage::POST_FX)) {
+        trace.slotTicks[slot] += event.duration;
+    }
+
+    if (stage == Stage::CALLBACK) {
+        callbackCount_++;
+        const float deadlineUs = event.frames * 1.0e6f / sampleRate_.load(std::memory_order_relaxed);
+        if (event.frames > 0 && us > deadlineUs) {
+            overrunCount_++;
+            recordOverrun(event, us, deadlineUs);
+        }
+    }
+}
+
+void PerformanceTelemetry::recordOverrun(const Event& event, float durationUs, float deadlineUs) {
+    Overrun overrun;
+    overrun.block = event.block;
+    overrun.hostReported = event.stage == static_cast<uint8_t>(Stage::XRUN);
+    overrun.durationUs = durationUs;
+    overrun.deadlineUs = deadlineUs;
+
+    const BlockTrace& trace = traces_[event.block % TRACE_BLOCKS];
+    for (int s = 0; s < STAGE_COUNT; ++s) {
+        overrun.stageUs[s] = static_cast<float>(trace.stageTicks[s] / ticksPerUs_);
+    }
+    for (int slot = 0; slot < MAX_SLOTS; ++slot) {
+        float slotUs = static_cast<float>(trace.slotTicks[slot] / ticksPerUs_);
+        if (slotUs > overrun.worstSlotUs) {
+            overrun.worstSlotUs = slotUs;
+            overrun.worstSlot = slot;
+        }
+    }
+
+    if (overruns_.size() >= static_cast<size_t>(MAX_OVERRUNS)) {
+        overruns_.erase(overruns_.begin());
+    }
+    overruns_.push_back(overrun);
+}
+
+PerformanceTelemetry::Histogram& PerformanceTelemetry::histogram(int stage, int slot) {
+    return histograms_[static_cast<size_t>(stage) * (MAX_SLOTS + 1) + static_cast<size_t>(slot + 1)];
+}
+
+const PerformanceTelemetry::Histogram& PerformanceTelemetry::histogram(int stage, int slot) const {
+    return histograms_[static_cast<size_t>(stage) * (MAX_SLOTS + 1) + static_cast<size_t>(slot + 1)];
+}
+
+int PerformanceTelemetry::binForUs(float us) {
+    if (!(us > HISTOGRAM_MIN_US)) return 0;
+    int bin = static_cast<int>(std::log10(us / HISTOGRAM_MIN_US) * BINS_PER_DECADE);
+    return std::clamp(bin, 0, HISTOGRAM_BINS - 1);
+}
+
+float PerformanceTelemetry::binUpperUs(int bin) {
+    return HISTOGRAM_MIN_US * std::pow(10.0f, static_cast<float>(bin + 1) / BINS_PER_DECADE);
+}
+
+// ===== Reports =====
+
+PerformanceTelemetry::Stats PerformanceTelemetry::getStats(Stage stage, int slot) const {
+    if (stage >= Stage::COUNT || slot < ALL_SLOTS || slot >= MAX_SLOTS) return Stats();
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    if (histograms_.empty()) return Stats();
+    const Histogram& h = histogram(static_cast<int>(stage), slot);
+    return statsFrom(h.count, h.sumUs, h.maxUs, h.bins.data(), HISTOGRAM_BINS, &binUpperUs);
+}
+
+std::vector<PerformanceTelemetry::Overrun> PerformanceTelemetry::getOverruns() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return overruns_;
+}
+
+uint64_t PerformanceTelemetry::getCallbackCount() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return callbackCount_;
+}
+
+uint64_t PerformanceTelemetry::getOverrunCount() const {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return overrunCount_;
+}
+
+uint64_t PerformanceTelemetry::getDroppedEvents() const {
+    uint64_t dropped = 0;
+    for (const auto& ring : rings_) {
+        dropped += ring.dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+const char* PerformanceTelemetry::getStageName(Stage stage) {
+    switch (stage) {
+        case Stage::LFO: return "lfo";
+        case Stage::ENGINE: return "engine";
+        case Stage::POST_FX: return "postfx";
+        case Stage::SENDS: return "sends";
+        case Stage::MASTER: return "master";
+        case Stage::CALLBACK: return "callback";
+        case Stage::XRUN: return "xrun";
+        default: return "unknown";
+    }
+}
+
+bool PerformanceTelemetry::dump(const std::string& path) const {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    std::fprintf(file, "# EtherSynth performance telemetry\n");
+    std::fprintf(file, "callbacks %llu overruns %llu dropped %llu\n",
+                 static_cast<unsigned long long>(callbackCount_),
+                 static_cast<unsigned long long>(overrunCount_),
+                 static_cast<unsigned long long>(getDroppedEvents()));
+    std::fprintf(file, "%-9s %-5s %10s %10s %10s %10s %10s\n",
+                 "stage", "slot", "count", "p50_us", "p99_us", "max_us", "mean_us");
+    for (int s = 0; s < STAGE_COUNT && !histograms_.empty(); ++s) {
+        for (int slot = ALL_SLOTS; slot < MAX_SLOTS; ++slot) {
+            const Histogram& h = histogram(s, slot);
+            if (h.count == 0) continue;
+            Stats stats = statsFrom(h.count, h.sumUs, h.maxUs, h.bins.data(), HISTOGRAM_BINS, &binUpperUs);
+            char slotName[8];
+            if (slot == ALL_SLOTS) {
+                std::snprintf(slotName, sizeof(slotName), "all");
+            } else {
+                std::snprintf(slotName, sizeof(slotName), "%d", slot);
+            }
+            std::fprintf(file, "%-9s %-5s %10llu %10.1f %10.1f %10.1f %10.1f\n",
+                         getStageName(static_cast<Stage>(s)), slotName,
+                         static_cast<unsigned long long>(stats.count),
+                         stats.p50Us, stats.p99Us, stats.maxUs, stats.meanUs);
+        }
+    }
+    for (const Overrun& o : overruns_) {
+        std::fprintf(file, "overrun block %llu %s", static_cast<unsigned long long>(o.block),
+                     o.hostReported ? "host-xrun" : "deadline");
+        if (!o.hostReported) {
+            std::fprintf(file, " %.1f/%.1f us", o.durationUs, o.deadlineUs);
+        }
+        for (int s = 0; s < static_cast<int>(Stage::CALLBACK); ++s) {
+            std::fprintf(file, " %s %.1f", getStageName(static_cast<Stage>(s)), o.stageUs[s]);
+        }
+        if (o.worstSlot >= 0) {
+            std::fprintf(file, " worst-slot %d %.1f us", o.worstSlot, o.worstSlotUs);
+        }
+        std::fprintf(file, "\n");
+    }
+    std::fclose(file);
+    return true;
+}
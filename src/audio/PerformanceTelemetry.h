@@ -0,0 +1,189 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * PerformanceTelemetry - Lock-free per-block stage timings with percentile reports
+ *
+ * The audio thread and the render helpers write one event per stage per
+ * block (start timestamp + duration in CPU ticks) into their own
+ * single-producer rings. A low-priority reader thread drains the rings,
+ * calibrates ticks against steady_clock and keeps log-spaced histograms per
+ * stage and slot, so p50/p99/max cover every block rendered rather than a
+ * moving average. Callbacks that miss their real-time deadline are kept as
+ * overruns with a per-stage and per-slot breakdown, which points at the
+ * stage behind a 1-in-10k click.
+ *
+ * Features:
+ * - rdtsc / cntvct_el0 timestamps (steady_clock on other targets)
+ * - One SPSC ring per writer thread; a full ring drops events, never blocks
+ * - Stages: LFO, engine, post FX, sends, master, whole callback
+ * - Host-reported xruns alongside detected deadline overruns
+ * - Reports through getStats()/getOverruns() and a plain-text dump file
+ * - Disabled (one atomic load per stage, no buffers) until start()
+ */
+class PerformanceTelemetry {
+public:
+    enum class Stage : uint8_t {
+        LFO = 0,        // Per slot
+        ENGINE,         // Per slot: live engine plus any outgoing crossfade engine
+        POST_FX,        // Per slot
+        SENDS,          // Master/send reduction and FX returns
+        MASTER,         // Output soft clip
+        CALLBACK,       // Whole host callback; checked against its deadline
+        XRUN,           // Host-reported xrun (no duration)
+        COUNT
+    };
+
+    static constexpr int STAGE_COUNT = static_cast<int>(Stage::COUNT);
+    static constexpr int MAX_WRITERS = 8;               // Audio thread + render helpers
+    static constexpr int MAX_SLOTS = 16;
+    static constexpr int ALL_SLOTS = -1;
+    static constexpr size_t RING_CAPACITY = 8192;       // Events per writer, power of two
+    static constexpr int HISTOGRAM_BINS = 240;          // 40 per decade, 0.1 us .. 100 ms
+    static constexpr int MAX_OVERRUNS = 32;             // Most recent overruns kept in detail
+    static constexpr int READER_INTERVAL_MS = 50;
+    static constexpr int DUMP_INTERVAL_MS = 1000;
+    static constexpr const char* PATH_ENV = "ETHER_TELEMETRY";
+
+    struct Stats {
+        uint64_t count = 0;
+        float p50Us = 0.0f;
+        float p99Us = 0.0f;
+        float maxUs = 0.0f;
+        float meanUs = 0.0f;
+    };
+
+    struct Overrun {
+        uint64_t block = 0;
+        bool hostReported = false;                      // ether_telemetry_report_xrun
+        float durationUs = 0.0f;
+        float deadlineUs = 0.0f;
+        std::array<float, STAGE_COUNT> stageUs{};       // Summed over slots and sub-blocks
+        int worstSlot = -1;                             // Slot with the longest LFO+engine+post time
+        float worstSlotUs = 0.0f;
+    };
+
+    PerformanceTelemetry();
+    ~PerformanceTelemetry();
+    PerformanceTelemetry(const PerformanceTelemetry&) = delete;
+    PerformanceTelemetry& operator=(const PerformanceTelemetry&) = delete;
+
+    // Raw timestamp in ticks; the reader converts with its calibration
+    static inline uint64_t now() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Real-time side (no locks, no allocation)
+    bool isEnabled() const { return enabled_.load(std::memory_order_acquire); }
+    void beginCallback();                               // Audio thread: starts a new block id
+    void record(int writer, Stage stage, int slot, uint64_t start, uint64_t end);
+    void endCallback(uint64_t start, uint64_t end, size_t frames);
+    void reportXrun();                                  // Audio thread (host callback)
+
+    // Control side
+    void setSampleRate(float sampleRate) { sampleRate_.store(sampleRate, std::memory_order_relaxed); }
+    bool start(const std::string& dumpPath = "");       // Enables recording, starts the reader
+    void stop();                                        // Final drain and dump
+    bool isRunning() const { return readerRunning_; }
+    void reset();                                       // Clears aggregated statistics
+    void poll();                                        // Drain and aggregate now
+
+    Stats getStats(Stage stage, int slot = ALL_SLOTS) const;
+    std::vector<Overrun> getOverruns() const;
+    uint64_t getCallbackCount() const;
+    uint64_t getOverrunCount() const;                   // Deadline misses + host xruns
+    uint64_t getDroppedEvents() const;
+    bool dump(const std::string& path) const;
+    static const char* getStageName(Stage stage);
+
+private:
+    struct Event {
+        uint64_t start;                 // Ticks
+        uint32_t duration;              // Ticks, saturated
+        uint32_t block;                 // Callback index (wraps)
+        uint16_t frames;                // CALLBACK only
+        uint8_t stage;
+        uint8_t slot;                   // 0xFF: not slot specific
+    };
+
+    struct alignas(64) Ring {
+        std::vector<Event> events;
+        std::atomic<size_t> head{0};    // Written by the producer
+        alignas(64) std::atomic<size_t> tail{0};    // Written by the reader
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    // Stage sums for recent blocks, to break overruns down
+    struct BlockTrace {
+        uint32_t block = 0;
+        bool used = false;
+        std::array<uint64_t, STAGE_COUNT> stageTicks{};
+        std::array<uint64_t, MAX_SLOTS> slotTicks{};
+    };
+    static constexpr int TRACE_BLOCKS = 64;
+
+    struct Histogram {
+        std::array<uint64_t, HISTOGRAM_BINS> bins{};
+        uint64_t count = 0;
+        double sumUs = 0.0;
+        float maxUs = 0.0f;
+    };
+
+    std::array<Ring, MAX_WRITERS> rings_;
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint32_t> block_{0};
+    std::atomic<float> sampleRate_{48000.0f};
+
+    // Reader state (guarded by statsMutex_)
+    mutable std::mutex statsMutex_;
+    std::vector<Histogram> histograms_;         // [stage][slot + 1], slot 0 = all slots
+    std::array<BlockTrace, TRACE_BLOCKS> traces_;
+    std::vector<Overrun> overruns_;             // Ring of MAX_OVERRUNS
+    uint64_t overrunCount_ = 0;
+    uint64_t callbackCount_ = 0;
+    uint64_t calibrationTicks_ = 0;
+    std::chrono::steady_clock::time_point calibrationTime_;
+    double ticksPerUs_ = 0.0;
+    std::vector<Event> batch_;
+
+    // Reader thread
+    std::thread reader_;
+    bool readerRunning_ = false;
+    std::mutex readerMutex_;
+    std::condition_variable readerWake_;
+    bool stopRequested_ = false;
+    std::string dumpPath_;
+
+    void push(int writer, Stage stage, int slot, uint64_t start, uint64_t end, size_t frames);
+    void readerLoop();
+    void drain(Ring& ring, size_t head);
+    void aggregate(const Event& event);
+    void recordOverrun(const Event& event, float durationUs, float deadlineUs);
+    Histogram& histogram(int stage, int slot);
+    const Histogram& histogram(int stage, int slot) const;
+    bool updateCalibration();
+    static int binForUs(float us);
+    static float binUpperUs(int bin);
+};
@@ -56,6 +56,10 @@ bool PostNonlinearProcessor::initialize(float sampleRate, FilterTopology topolog
             break;
     }
     
+    if (!oversampler_.initialize(sampleRate_, oversampleFactor_, oversampleQuality_)) {
+        return false;
+    }
+    
     calculateGainCompensation();
     reset();
     
@@ -70,6 +74,7 @@ void PostNonlinearProcessor::shutdown() {
     
     dcBlocker_.shutdown();
     subsonicFilter_.shutdown();
+    oversampler_.shutdown();
     
     initialized_ = false;
 }
@@ -276,6 +281,7 @@ void PostNonlinearProcessor::setSampleRate(float sampleRate) {
         if (initialized_) {
             dcBlocker_.setSampleRate(sampleRate);
             subsonicFilter_.setSampleRate(sampleRate);
+            oversampler_.initialize(sampleRate_, oversampleFactor_, oversampleQuality_);
             calculateGainCompensation();
         }
     }
@@ -292,6 +298,15 @@ void PostNonlinearProcessor::setGainCompensation(bool enable) {
     }
 }
 
+void PostNonlinearProcessor::setOversampling(OversamplingProcessor::Factor factor,
+                                             OversamplingProcessor::Quality quality) {
+    oversampleFactor_ = factor;
+    oversampleQuality_ = quality;
+    if (initialized_) {
+        oversampler_.initialize(sampleRate_, oversampleFactor_, oversampleQuality_);
+    }
+}
+
 float PostNonlinearProcessor::getSubsonicCutoff() const {
     return subsonicFilter_.getCutoffFrequency();
 }
@@ -352,12 +367,14 @@ float PostNonlinearProcessor::getMagnitudeResponse(float frequency) const {
 void PostNonlinearProcessor::reset() {
     dcBlocker_.reset();
     subsonicFilter_.reset();
+    oversampler_.reset();
     cpuUsage_ = 0.0f;
 }
 
 void PostNonlinearProcessor::reset(float initialValue) {
     dcBlocker_.reset(initialValue);
     subsonicFilter_.reset(initialValue);
+    oversampler_.reset();
     cpuUsage_ = 0.0f;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "DCBlocker.h"
 #include "SubsonicFilter.h"
+#include "OversamplingProcessor.h"
 
 /**
  * PostNonlinearProcessor - Integrated cleanup processor for after nonlinear stages
@@ -14,6 +15,7 @@
  * - CPU-optimized processing with optional bypass
  * - Multi-channel batch processing
  * - Automatic gain compensation
+ * - Optional oversampled nonlinear stage: shaper at 2x-8x, then cleanup
  */
 class PostNonlinearProcessor {
 public:
@@ -36,6 +38,12 @@ public:
     void processBlock(float* output, const float* input, int numSamples);
     void processBlock(float* buffer, int numSamples); // In-place processing
     
+    // Nonlinear stage: shaper runs oversampled, then the cleanup filters
+    template<typename Shaper>
+    float processSample(float input, Shaper shaper);
+    template<typename Shaper>
+    void processBlock(float* buffer, int numSamples, Shaper shaper);
+    
     // Configuration
     void setFilterTopology(FilterTopology topology);
     void setSubsonicCutoff(float hz);
@@ -43,6 +51,8 @@ public:
     void setSampleRate(float sampleRate);
     void setBypass(bool bypass);
     void setGainCompensation(bool enable); // Compensate for filter gain
+    void setOversampling(OversamplingProcessor::Factor factor,
+                         OversamplingProcessor::Quality quality = OversamplingProcessor::Quality::SHORT_FIR);
     
     // Analysis
     FilterTopology getFilterTopology() const { return topology_; }
@@ -50,6 +60,7 @@ public:
     bool isBypassed() const { return bypassed_; }
     bool isInitialized() const { return initialized_; }
     float getMagnitudeResponse(float frequency) const;
+    float getLatencySamples() const { return oversampler_.getLatencySamples(); }
     
     // State management
     void reset();
@@ -72,6 +83,11 @@ private:
     DCBlocker dcBlocker_;
     SubsonicFilter subsonicFilter_;
     
+    // Oversampling around the nonlinear stage
+    OversamplingProcessor oversampler_;
+    OversamplingProcessor::Factor oversampleFactor_ = OversamplingProcessor::Factor::X2;
+    OversamplingProcessor::Quality oversampleQuality_ = OversamplingProcessor::Quality::SHORT_FIR;
+    
     // Gain compensation
     float gainCompensation_ = 1.0f;
     
@@ -85,4 +101,16 @@ private:
     
     // Constants
     static constexpr float GAIN_COMP_FREQ = 1000.0f; // Reference frequency for gain compensation
-};
\ No newline at end of file
+};
+
+// Template method implementations
+template<typename Shaper>
+float PostNonlinearProcessor::processSample(float input, Shaper shaper) {
+    return processSample(oversampler_.processSample(input, shaper));
+}
+
+template<typename Shaper>
+void PostNonlinearProcessor::processBlock(float* buffer, int numSamples, Shaper shaper) {
+    oversampler_.processBlock(buffer, buffer, numSamples, shaper);
+    processBlock(buffer, numSamples);
+}
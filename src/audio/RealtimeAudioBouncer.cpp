@@ -3,7 +3,6 @@
 #include <cmath>
 #include <cstdio>
 #include <chrono>
-#include <random>
 
 RealtimeAudioBouncer::RealtimeAudioBouncer() :
     status_(BounceStatus::IDLE),
@@ -18,6 +17,7 @@ RealtimeAudioBouncer::RealtimeAudioBouncer() :
     rmsSampleCount_(0),
     outputFile_(),
     bytesWritten_(0),
+    ditherState_(0x2545F491u),
     srcRatio_(1.0f),
     srcState_(0),
     limiterState_(0.0f),
@@ -98,6 +98,7 @@ bool RealtimeAudioBouncer::startBounce(const std::string& outputPath, uint32_t d
     startTimeMs_ = getCurrentTimeMs();
     samplesRecorded_ = 0;
     targetSampleCount_ = (static_cast<uint64_t>(targetDurationMs_) * static_cast<uint32_t>(config_.sampleRate)) / 1000;
+    ditherState_ = 0x2545F491u;
     
     // Reset buffers and meters
     resetBuffers();
@@ -318,78 +319,74 @@ void RealtimeAudioBouncer::convertToOutputFormat(const float* inputBuffer, uint3
     }
     
     // Apply sample rate conversion if needed
-    std::vector<float> srcBuffer;
     const float* processBuffer = inputBuffer;
     uint32_t processSampleCount = sampleCount;
     
     if (srcRatio_ != 1.0f) {
         uint32_t outputSamples = static_cast<uint32_t>(sampleCount * srcRatio_);
-        srcBuffer.resize(outputSamples * config_.channels);
+        if (srcBuffer_.size() < outputSamples * config_.channels) {
+            srcBuffer_.resize(outputSamples * config_.channels);
+        }
         applySampleRateConversion(inputBuffer, sampleCount * config_.channels, 
-                                 srcBuffer.data(), outputSamples);
-        processBuffer = srcBuffer.data();
+                                 srcBuffer_.data(), outputSamples);
+        processBuffer = srcBuffer_.data();
         processSampleCount = outputSamples;
     }
     
-    // Apply normalization if enabled
-    std::vector<float> normalizedBuffer;
-    if (config_.enableNormalization) {
-        normalizedBuffer.assign(processBuffer, processBuffer + processSampleCount * config_.channels);
-        applyNormalization(normalizedBuffer.data(), normalizedBuffer.size(), config_.normalizationLevel);
-        processBuffer = normalizedBuffer.data();
-    }
-    
-    // Apply dithering if enabled and reducing bit depth
-    if (config_.enableDithering && config_.format != AudioFormat::WAV_32BIT_FLOAT && 
-        config_.format != AudioFormat::RAW_PCM_32_FLOAT) {
-        std::vector<float> ditheredBuffer(processBuffer, processBuffer + processSampleCount * config_.channels);
-        applyDithering(ditheredBuffer.data(), ditheredBuffer.size());
-        processBuffer = ditheredBuffer.data();
+    // Normalization and dithering work on a copy of the block
+    const uint32_t totalSamples = processSampleCount * config_.channels;
+    const bool dither = config_.enableDithering && config_.format != AudioFormat::WAV_32BIT_FLOAT && 
+                        config_.format != AudioFormat::RAW_PCM_32_FLOAT;
+    if (config_.enableNormalization || dither) {
+        if (processBuffer_.size() < totalSamples) {
+            processBuffer_.resize(totalSamples);
+        }
+        std::copy(processBuffer, processBuffer + totalSamples, processBuffer_.begin());
+        if (config_.enableNormalization) {
+            applyNormalization(processBuffer_.data(), totalSamples, config_.normalizationLevel);
+        }
+        if (dither) {
+            applyDithering(processBuffer_.data(), totalSamples);
+        }
+        processBuffer = processBuffer_.data();
     }
     
     // Convert to target format
-    auto formatData = convertFloatToFormat(processBuffer, processSampleCount * config_.channels, config_.format);
+    if (formatBuffer_.size() < totalSamples * sizeof(float)) {
+        formatBuffer_.resize(totalSamples * sizeof(float));
+    }
+    uint32_t formatBytes = convertFloatToFormat(processBuffer, totalSamples, config_.format, formatBuffer_.data());
     
     // Write to file
-    if (!formatData.empty()) {
-        writeAudioData(formatData.data(), formatData.size());
+    if (formatBytes > 0) {
+        writeAudioData(formatBuffer_.data(), formatBytes);
         samplesRecorded_ += processSampleCount;
     }
     
     updateProgress();
 }
 
-std::vector<uint8_t> RealtimeAudioBouncer::convertFloatToFormat(const float* samples, uint32_t sampleCount, AudioFormat format) {
-    std::vector<uint8_t> output;
-    
+uint32_t RealtimeAudioBouncer::convertFloatToFormat(const float* samples, uint32_t sampleCount, AudioFormat format, uint8_t* output) {
     switch (format) {
         case AudioFormat::WAV_16BIT:
         case AudioFormat::AIFF_16BIT:
-        case AudioFormat::RAW_PCM_16: {
-            output.resize(sampleCount * sizeof(int16_t));
-            int16_t* int16Output = reinterpret_cast<int16_t*>(output.data());
-            convertToInt16(samples, int16Output, sampleCount);
-            break;
-        }
+        case AudioFormat::RAW_PCM_16:
+            convertToInt16(samples, reinterpret_cast<int16_t*>(output), sampleCount);
+            return sampleCount * sizeof(int16_t);
         
         case AudioFormat::WAV_24BIT:
         case AudioFormat::AIFF_24BIT:
-        case AudioFormat::RAW_PCM_24: {
-            output.resize(sampleCount * 3);  // 3 bytes per sample
-            convertToInt24(samples, output.data(), sampleCount);
-            break;
-        }
+        case AudioFormat::RAW_PCM_24:
+            convertToInt24(samples, output, sampleCount);  // 3 bytes per sample
+            return sampleCount * 3;
         
         case AudioFormat::WAV_32BIT_FLOAT:
-        case AudioFormat::RAW_PCM_32_FLOAT: {
-            output.resize(sampleCount * sizeof(float));
-            float* floatOutput = reinterpret_cast<float*>(output.data());
-            convertToFloat32(samples, floatOutput, sampleCount);
-            break;
-        }
+        case AudioFormat::RAW_PCM_32_FLOAT:
+            convertToFloat32(samples, reinterpret_cast<float*>(output), sampleCount);
+            return sampleCount * sizeof(float);
     }
     
-    return output;
+    return 0;
 }
 
 void RealtimeAudioBouncer::applySampleRateConversion(const float* input, uint32_t inputSamples, 
@@ -590,6 +587,8 @@ bool RealtimeAudioBouncer::initializeBuffers() {
     
     circularBuffer_.resize(bufferSize_ * config_.channels);
     std::fill(circularBuffer_.begin(), circularBuffer_.end(), 0.0f);
+    processBuffer_.resize(bufferSize_ * config_.channels);
+    formatBuffer_.resize(bufferSize_ * config_.channels * sizeof(float));
     
     writeIndex_.store(0);
     readIndex_.store(0);
@@ -739,15 +738,17 @@ void RealtimeAudioBouncer::processHighpassFilter(float* buffer, uint32_t sampleC
 }
 
 void RealtimeAudioBouncer::applyDithering(float* buffer, uint32_t sampleCount) {
-    // Simple triangular dithering
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
-    
+    // Simple triangular dithering from a seeded per-bouncer generator (repeatable bounces)
     float ditherAmount = 1.0f / 32768.0f;  // For 16-bit quantization
+    auto uniform = [this] {
+        ditherState_ ^= ditherState_ << 13;
+        ditherState_ ^= ditherState_ >> 17;
+        ditherState_ ^= ditherState_ << 5;
+        return static_cast<float>(ditherState_ >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    };
     
     for (uint32_t i = 0; i < sampleCount; ++i) {
-        float dither = (dis(gen) + dis(gen)) * 0.5f * ditherAmount;
+        float dither = (uniform() + uniform()) * 0.5f * ditherAmount;
         buffer[i] += dither;
     }
 }
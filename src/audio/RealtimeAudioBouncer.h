@@ -194,7 +194,8 @@ public:
     
     // Format Conversion
     void convertToOutputFormat(const float* inputBuffer, uint32_t sampleCount);
-    std::vector<uint8_t> convertFloatToFormat(const float* samples, uint32_t sampleCount, AudioFormat format);
+    // Writes sampleCount samples into output (sampleCount * bytes per sample); returns bytes written
+    uint32_t convertFloatToFormat(const float* samples, uint32_t sampleCount, AudioFormat format, uint8_t* output);
     void applySampleRateConversion(const float* input, uint32_t inputSamples, 
                                   float* output, uint32_t& outputSamples);
     
@@ -270,6 +271,11 @@ private:
     std::string currentOutputPath_;
     uint32_t bytesWritten_;
     
+    // Block scratch, grown on the first blocks and then reused (no allocation per block)
+    std::vector<float> processBuffer_;
+    std::vector<uint8_t> formatBuffer_;
+    uint32_t ditherState_;
+    
     // Sample rate conversion
     std::vector<float> srcBuffer_;
     float srcRatio_;
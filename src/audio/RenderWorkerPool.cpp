@@ -0,0 +1,208 @@
+#include "RenderWorkerPool.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <mach/mach_time.h>
+#include <mach/thread_policy.h>
+#endif
+
+RenderWorkerPool::RenderWorkerPool() {
+}
+
+RenderWorkerPool::~RenderWorkerPool() {
+    shutdown();
+}
+
+int RenderWorkerPool::recommendedHelpers() {
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores <= 1) return 0;   // Serial fallback
+    return std::min(static_cast<int>(cores) - 1, MAX_HELPERS);
+}
+
+bool RenderWorkerPool::initialize(int helpers) {
+    shutdown();
+
+    if (helpers < 0) helpers = recommendedHelpers();
+    helperCount_ = std::clamp(helpers, 0, MAX_HELPERS);
+
+    for (auto& s : stats_) {
+        s.busyNs.store(0);
+        s.loadPct.store(0.0f);
+    }
+
+    running_.store(true, std::memory_order_release);
+    for (int i = 0; i < helperCount_; ++i) {
+        helpers_[i] = std::thread(&RenderWorkerPool::helperLoop, this, i + 1);
+    }
+    return true;
+}
+
+void RenderWorkerPool::shutdown() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        helperCount_ = 0;
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeCondition_.notify_all();
+    }
+    for (int i = 0; i < helperCount_; ++i) {
+        if (helpers_[i].joinable()) helpers_[i].join();
+    }
+    helperCount_ = 0;
+}
+
+void RenderWorkerPool::run(TaskFunc func, void* context, int taskCount, double budgetMs) {
+    if (!func || taskCount <= 0) return;
+
+    if (helperCount_ == 0 || taskCount == 1) {
+        // Serial path: everything on the calling (audio) thread
+        auto t0 = std::chrono::steady_clock::now();
+        for (int task = 0; task < taskCount; ++task) {
+            func(context, task, 0);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        stats_[0].busyNs.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count(),
+            std::memory_order_relaxed);
+    } else {
+        // Publish the job, then tag the cursor with its generation
+        uint32_t generation = generation_.load(std::memory_order_relaxed) + 1;
+        func_.store(func, std::memory_order_relaxed);
+        context_.store(context, std::memory_order_relaxed);
+        taskCount_.store(taskCount, std::memory_order_relaxed);
+        completed_.store(0, std::memory_order_relaxed);
+        cursor_.store(static_cast<uint64_t>(generation) << 32, std::memory_order_release);
+        generation_.store(generation, std::memory_order_release);
+
+        if (sleepers_.load(std::memory_order_acquire) > 0) {
+            wakeCondition_.notify_all();
+        }
+
+        // The audio thread claims tasks too, so the job finishes even if no helper wakes
+        workOn(generation, 0);
+        while (completed_.load(std::memory_order_acquire) < taskCount) {
+            cpuRelax();
+        }
+    }
+
+    if (budgetMs > 0.0) {
+        const int threads = getThreadCount();
+        for (int t = 0; t < threads; ++t) {
+            double busyMs = stats_[t].busyNs.exchange(0, std::memory_order_relaxed) / 1.0e6;
+            float pct = static_cast<float>(std::clamp(busyMs / budgetMs * 100.0, 0.0, 400.0));
+            float prev = stats_[t].loadPct.load(std::memory_order_relaxed);
+            stats_[t].loadPct.store(0.85f * prev + 0.15f * pct, std::memory_order_relaxed);
+        }
+    }
+}
+
+float RenderWorkerPool::getThreadLoad(int thread) const {
+    if (thread < 0 || thread >= getThreadCount()) return 0.0f;
+    return stats_[thread].loadPct.load(std::memory_order_relaxed);
+}
+
+void RenderWorkerPool::workOn(uint32_t generation, int thread) {
+    for (;;) {
+        uint64_t cursor = cursor_.load(std::memory_order_acquire);
+        if (static_cast<uint32_t>(cursor >> 32) != generation) return;
+
+        int task = static_cast<int>(cursor & 0xFFFFFFFFu);
+        TaskFunc func = func_.load(std::memory_order_relaxed);
+        void* context = context_.load(std::memory_order_relaxed);
+        if (task >= taskCount_.load(std::memory_order_relaxed)) return;
+
+        // A successful claim proves the job is still live, so func/context belong to it
+        if (!cursor_.compare_exchange_weak(cursor, cursor + 1, std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        func(context, task, thread);
+        auto t1 = std::chrono::steady_clock::now();
+        stats_[thread].busyNs.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count(),
+            std::memory_order_relaxed);
+
+        completed_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void RenderWorkerPool::helperLoop(int thread) {
+    configureThread(thread);
+
+    uint32_t seen = generation_.load(std::memory_order_acquire);
+    while (running_.load(std::memory_order_acquire)) {
+        // Spin briefly: blocks arrive back to back while audio is running
+        uint32_t generation = seen;
+        for (int i = 0; i < SPIN_ITERATIONS; ++i) {
+            generation = generation_.load(std::memory_order_acquire);
+            if (generation != seen) break;
+            cpuRelax();
+        }
+
+        if (generation == seen) {
+            // Idle: sleep until woken. The timeout bounds a missed wake-up, which
+            // only costs parallelism because the audio thread also works the job.
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            sleepers_.fetch_add(1, std::memory_order_acq_rel);
+            wakeCondition_.wait_for(lock, std::chrono::milliseconds(2), [&]() {
+                return !running_.load(std::memory_order_acquire) ||
+                       generation_.load(std::memory_order_acquire) != seen;
+            });
+            sleepers_.fetch_sub(1, std::memory_order_acq_rel);
+            continue;
+        }
+
+        seen = generation;
+        workOn(generation, thread);
+    }
+}
+
+void RenderWorkerPool::configureThread(int thread) {
+#if defined(__linux__)
+    // Pin to a core (the audio thread usually lives on core 0) and request
+    // SCHED_FIFO just below typical audio-callback priority. Both are
+    // best-effort: without privileges the thread stays at normal priority.
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<unsigned>(thread) % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+
+    sched_param param{};
+    param.sched_priority = std::max(1, sched_get_priority_max(SCHED_FIFO) - 10);
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+#elif defined(__APPLE__)
+    // macOS has no hard pinning; use the time-constraint policy audio threads use
+    (void)thread;
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    const double nsToAbs = static_cast<double>(timebase.denom) / timebase.numer;
+    thread_time_constraint_policy_data_t policy;
+    policy.period = static_cast<uint32_t>(2666667 * nsToAbs);       // 128 frames @ 48 kHz
+    policy.computation = static_cast<uint32_t>(500000 * nsToAbs);
+    policy.constraint = static_cast<uint32_t>(2000000 * nsToAbs);
+    policy.preemptible = 1;
+    thread_policy_set(mach_thread_self(), THREAD_TIME_CONSTRAINT_POLICY,
+                      reinterpret_cast<thread_policy_t>(&policy),
+                      THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+#else
+    (void)thread;
+#endif
+}
+
+void RenderWorkerPool::cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/**
+ * RenderWorkerPool - Real-time worker threads for parallel slot rendering
+ *
+ * The audio thread publishes a job (plain function pointer + context +
+ * task count) and then works on it alongside the helpers, so a job always
+ * completes even if no helper wakes in time. Tasks are claimed from a
+ * generation-tagged counter, which keeps a late helper from running a task
+ * of a newer job with a stale function.
+ *
+ * Features:
+ * - Fixed threads created in initialize(), no allocation in run()
+ * - Best-effort real-time priority and core pinning
+ * - Spin-then-wait handoff (helpers spin briefly, then sleep on a condvar)
+ * - Serial fallback with zero helpers (single-core systems)
+ * - Per-thread busy time as a percentage of the block budget
+ */
+class RenderWorkerPool {
+public:
+    using TaskFunc = void (*)(void* context, int task, int thread);
+
+    static constexpr int MAX_HELPERS = 7;
+    static constexpr int MAX_THREADS = MAX_HELPERS + 1;   // Including the audio thread
+    static constexpr int SPIN_ITERATIONS = 20000;
+
+    RenderWorkerPool();
+    ~RenderWorkerPool();
+
+    // Initialization (not real-time safe); helpers < 0 picks from the core count
+    bool initialize(int helpers = -1);
+    void shutdown();
+    static int recommendedHelpers();
+
+    // Runs func(context, task, thread) for task in [0, taskCount) and returns when all are done.
+    // Thread 0 is the caller. budgetMs > 0 updates the per-thread load statistics.
+    void run(TaskFunc func, void* context, int taskCount, double budgetMs = 0.0);
+
+    // Statistics
+    int getHelperCount() const { return helperCount_; }
+    int getThreadCount() const { return helperCount_ + 1; }
+    bool isParallel() const { return helperCount_ > 0; }
+    float getThreadLoad(int thread) const;   // % of block budget (EMA)
+
+private:
+    struct alignas(64) ThreadStats {
+        std::atomic<uint64_t> busyNs{0};
+        std::atomic<float> loadPct{0.0f};
+    };
+
+    int helperCount_ = 0;
+    std::array<std::thread, MAX_HELPERS> helpers_;
+    std::array<ThreadStats, MAX_THREADS> stats_;
+
+    // Current job; fields are only rewritten after the previous job completed
+    std::atomic<TaskFunc> func_{nullptr};
+    std::atomic<void*> context_{nullptr};
+    std::atomic<int> taskCount_{0};
+
+    // High 32 bits: job generation, low 32 bits: next task index
+    alignas(64) std::atomic<uint64_t> cursor_{0};
+    alignas(64) std::atomic<int> completed_{0};
+    std::atomic<uint32_t> generation_{0};
+    std::atomic<bool> running_{false};
+
+    // Sleep/wake for helpers that stopped spinning
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<int> sleepers_{0};
+
+    void helperLoop(int thread);
+    void workOn(uint32_t generation, int thread);
+    static void configureThread(int thread);
+    static void cpuRelax();
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <cmath>
 #include <cstdint>
 
 // Platform detection for SIMD
@@ -189,5 +190,272 @@ inline void processOscillatorBlock(float* output, float* phases,
     }
 }
 
+// Radix-2 FFT butterflies on split-complex data (used by FFT)
+// For each lane: t = w * b; a' = a + t; b' = a - t
+inline void fftButterflies(float* aRe, float* aIm, float* bRe, float* bIm,
+                           const float* wRe, const float* wIm, int count) {
+    int i = 0;
+#ifdef SIMD_NEON
+    int simdCount = count & ~3;
+    for (; i < simdCount; i += 4) {
+        float32x4_t ar = vld1q_f32(&aRe[i]);
+        float32x4_t ai = vld1q_f32(&aIm[i]);
+        float32x4_t br = vld1q_f32(&bRe[i]);
+        float32x4_t bi = vld1q_f32(&bIm[i]);
+        float32x4_t wr = vld1q_f32(&wRe[i]);
+        float32x4_t wi = vld1q_f32(&wIm[i]);
+        
+        float32x4_t tr = vsubq_f32(vmulq_f32(br, wr), vmulq_f32(bi, wi));
+        float32x4_t ti = vaddq_f32(vmulq_f32(br, wi), vmulq_f32(bi, wr));
+        
+        vst1q_f32(&aRe[i], vaddq_f32(ar, tr));
+        vst1q_f32(&aIm[i], vaddq_f32(ai, ti));
+        vst1q_f32(&bRe[i], vsubq_f32(ar, tr));
+        vst1q_f32(&bIm[i], vsubq_f32(ai, ti));
+    }
+#elif defined(SIMD_AVX2)
+    int simdCount = count & ~7;
+    for (; i < simdCount; i += 8) {
+        __m256 ar = _mm256_loadu_ps(&aRe[i]);
+        __m256 ai = _mm256_loadu_ps(&aIm[i]);
+        __m256 br = _mm256_loadu_ps(&bRe[i]);
+        __m256 bi = _mm256_loadu_ps(&bIm[i]);
+        __m256 wr = _mm256_loadu_ps(&wRe[i]);
+        __m256 wi = _mm256_loadu_ps(&wIm[i]);
+        
+        __m256 tr = _mm256_sub_ps(_mm256_mul_ps(br, wr), _mm256_mul_ps(bi, wi));
+        __m256 ti = _mm256_add_ps(_mm256_mul_ps(br, wi), _mm256_mul_ps(bi, wr));
+        
+        _mm256_storeu_ps(&aRe[i], _mm256_add_ps(ar, tr));
+        _mm256_storeu_ps(&aIm[i], _mm256_add_ps(ai, ti));
+        _mm256_storeu_ps(&bRe[i], _mm256_sub_ps(ar, tr));
+        _mm256_storeu_ps(&bIm[i], _mm256_sub_ps(ai, ti));
+    }
+#elif defined(SIMD_SSE2)
+    int simdCount = count & ~3;
+    for (; i < simdCount; i += 4) {
+        __m128 ar = _mm_loadu_ps(&aRe[i]);
+        __m128 ai = _mm_loadu_ps(&aIm[i]);
+        __m128 br = _mm_loadu_ps(&bRe[i]);
+        __m128 bi = _mm_loadu_ps(&bIm[i]);
+        __m128 wr = _mm_loadu_ps(&wRe[i]);
+        __m128 wi = _mm_loadu_ps(&wIm[i]);
+        
+        __m128 tr = _mm_sub_ps(_mm_mul_ps(br, wr), _mm_mul_ps(bi, wi));
+        __m128 ti = _mm_add_ps(_mm_mul_ps(br, wi), _mm_mul_ps(bi, wr));
+        
+        _mm_storeu_ps(&aRe[i], _mm_add_ps(ar, tr));
+        _mm_storeu_ps(&aIm[i], _mm_add_ps(ai, ti));
+        _mm_storeu_ps(&bRe[i], _mm_sub_ps(ar, tr));
+        _mm_storeu_ps(&bIm[i], _mm_sub_ps(ai, ti));
+    }
+#endif
+    // Scalar remainder (and fallback)
+    for (; i < count; ++i) {
+        float tr = bRe[i] * wRe[i] - bIm[i] * wIm[i];
+        float ti = bRe[i] * wIm[i] + bIm[i] * wRe[i];
+        float ar = aRe[i];
+        float ai = aIm[i];
+        aRe[i] = ar + tr;
+        aIm[i] = ai + ti;
+        bRe[i] = ar - tr;
+        bIm[i] = ai - ti;
+    }
+}
+
+/**
+ * LaneVec - One SIMD register of independent lanes for SoA voice processing
+ *
+ * Engines keep per-voice (or per-partial) state in arrays of LANE_GROUP
+ * floats and step the whole group per sample, so recurrences that cannot
+ * vectorize over time (filters, phase accumulators) vectorize across voices.
+ * 8 lanes with AVX2, 4 with NEON/SSE2, 4 scalar lanes otherwise.
+ */
+struct LaneVec {
+#if defined(SIMD_NEON)
+    static constexpr int WIDTH = 4;
+    float32x4_t v;
+    static LaneVec load(const float* p) { return {vld1q_f32(p)}; }
+    static LaneVec set1(float x) { return {vdupq_n_f32(x)}; }
+    void store(float* p) const { vst1q_f32(p, v); }
+    friend LaneVec operator+(LaneVec a, LaneVec b) { return {vaddq_f32(a.v, b.v)}; }
+    friend LaneVec operator-(LaneVec a, LaneVec b) { return {vsubq_f32(a.v, b.v)}; }
+    friend LaneVec operator*(LaneVec a, LaneVec b) { return {vmulq_f32(a.v, b.v)}; }
+    friend LaneVec operator/(LaneVec a, LaneVec b) {
+        // Reciprocal estimate plus two Newton steps (ARMv7 has no vector divide)
+        float32x4_t r = vrecpeq_f32(b.v);
+        r = vmulq_f32(r, vrecpsq_f32(b.v, r));
+        r = vmulq_f32(r, vrecpsq_f32(b.v, r));
+        return {vmulq_f32(a.v, r)};
+    }
+    static LaneVec min(LaneVec a, LaneVec b) { return {vminq_f32(a.v, b.v)}; }
+    static LaneVec max(LaneVec a, LaneVec b) { return {vmaxq_f32(a.v, b.v)}; }
+    // x >= limit ? x - limit : x (phase wrap)
+    static LaneVec wrap(LaneVec x, LaneVec limit) {
+        uint32x4_t ge = vcgeq_f32(x.v, limit.v);
+        return {vsubq_f32(x.v, vreinterpretq_f32_u32(vandq_u32(ge, vreinterpretq_u32_f32(limit.v))))};
+    }
+    // a < b ? x : y, per lane
+    static LaneVec select(LaneVec a, LaneVec b, LaneVec x, LaneVec y) {
+        return {vbslq_f32(vcltq_f32(a.v, b.v), x.v, y.v)};
+    }
+    static LaneVec abs(LaneVec x) { return {vabsq_f32(x.v)}; }
+    // Round towards -inf, |x| < 2^31 (truncate, then step down where that rounded up)
+    static LaneVec floor(LaneVec x) {
+        float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(x.v));
+        uint32x4_t up = vcgtq_f32(t, x.v);
+        return {vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(up, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))))};
+    }
+#elif defined(SIMD_AVX2)
+    static constexpr int WIDTH = 8;
+    __m256 v;
+    static LaneVec load(const float* p) { return {_mm256_loadu_ps(p)}; }
+    static LaneVec set1(float x) { return {_mm256_set1_ps(x)}; }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+    friend LaneVec operator+(LaneVec a, LaneVec b) { return {_mm256_add_ps(a.v, b.v)}; }
+    friend LaneVec operator-(LaneVec a, LaneVec b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    friend LaneVec operator*(LaneVec a, LaneVec b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    friend LaneVec operator/(LaneVec a, LaneVec b) { return {_mm256_div_ps(a.v, b.v)}; }
+    static LaneVec min(LaneVec a, LaneVec b) { return {_mm256_min_ps(a.v, b.v)}; }
+    static LaneVec max(LaneVec a, LaneVec b) { return {_mm256_max_ps(a.v, b.v)}; }
+    static LaneVec wrap(LaneVec x, LaneVec limit) {
+        __m256 ge = _mm256_cmp_ps(x.v, limit.v, _CMP_GE_OQ);
+        return {_mm256_sub_ps(x.v, _mm256_and_ps(ge, limit.v))};
+    }
+    static LaneVec select(LaneVec a, LaneVec b, LaneVec x, LaneVec y) {
+        return {_mm256_blendv_ps(y.v, x.v, _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ))};
+    }
+    static LaneVec abs(LaneVec x) { return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.v)}; }
+    static LaneVec floor(LaneVec x) { return {_mm256_floor_ps(x.v)}; }
+#elif defined(SIMD_SSE2)
+    static constexpr int WIDTH = 4;
+    __m128 v;
+    static LaneVec load(const float* p) { return {_mm_loadu_ps(p)}; }
+    static LaneVec set1(float x) { return {_mm_set1_ps(x)}; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+    friend LaneVec operator+(LaneVec a, LaneVec b) { return {_mm_add_ps(a.v, b.v)}; }
+    friend LaneVec operator-(LaneVec a, LaneVec b) { return {_mm_sub_ps(a.v, b.v)}; }
+    friend LaneVec operator*(LaneVec a, LaneVec b) { return {_mm_mul_ps(a.v, b.v)}; }
+    friend LaneVec operator/(LaneVec a, LaneVec b) { return {_mm_div_ps(a.v, b.v)}; }
+    static LaneVec min(LaneVec a, LaneVec b) { return {_mm_min_ps(a.v, b.v)}; }
+    static LaneVec max(LaneVec a, LaneVec b) { return {_mm_max_ps(a.v, b.v)}; }
+    static LaneVec wrap(LaneVec x, LaneVec limit) {
+        __m128 ge = _mm_cmpge_ps(x.v, limit.v);
+        return {_mm_sub_ps(x.v, _mm_and_ps(ge, limit.v))};
+    }
+    static LaneVec select(LaneVec a, LaneVec b, LaneVec x, LaneVec y) {
+        __m128 lt = _mm_cmplt_ps(a.v, b.v);
+        return {_mm_or_ps(_mm_and_ps(lt, x.v), _mm_andnot_ps(lt, y.v))};
+    }
+    static LaneVec abs(LaneVec x) { return {_mm_andnot_ps(_mm_set1_ps(-0.0f), x.v)}; }
+    // SSE2 has no floor: truncate, then step down where that rounded up (|x| < 2^31)
+    static LaneVec floor(LaneVec x) {
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.v));
+        return {_mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x.v), _mm_set1_ps(1.0f)))};
+    }
+#else
+    static constexpr int WIDTH = 4;
+    float v[4];
+    static LaneVec load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    static LaneVec set1(float x) { return {{x, x, x, x}}; }
+    void store(float* p) const { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+    friend LaneVec operator+(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+    friend LaneVec operator-(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+    friend LaneVec operator*(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+    friend LaneVec operator/(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] /= b.v[i]; return a; }
+    static LaneVec min(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] = b.v[i] < a.v[i] ? b.v[i] : a.v[i]; return a; }
+    static LaneVec max(LaneVec a, LaneVec b) { for (int i = 0; i < 4; ++i) a.v[i] = b.v[i] > a.v[i] ? b.v[i] : a.v[i]; return a; }
+    static LaneVec wrap(LaneVec x, LaneVec limit) {
+        for (int i = 0; i < 4; ++i) if (x.v[i] >= limit.v[i]) x.v[i] -= limit.v[i];
+        return x;
+    }
+    static LaneVec select(LaneVec a, LaneVec b, LaneVec x, LaneVec y) {
+        for (int i = 0; i < 4; ++i) x.v[i] = a.v[i] < b.v[i] ? x.v[i] : y.v[i];
+        return x;
+    }
+    static LaneVec abs(LaneVec x) { for (int i = 0; i < 4; ++i) x.v[i] = std::fabs(x.v[i]); return x; }
+    static LaneVec floor(LaneVec x) { for (int i = 0; i < 4; ++i) x.v[i] = std::floor(x.v[i]); return x; }
+#endif
+};
+
+// Lanes per SoA group: a multiple of every LaneVec width
+constexpr int LANE_GROUP = 8;
+
+// tanh via a [7/6] Pade approximant, clamped where it reaches +-1 (|error| < 1e-4)
+inline LaneVec tanhLanes(LaneVec x) {
+    x = LaneVec::min(LaneVec::max(x, LaneVec::set1(-4.97f)), LaneVec::set1(4.97f));
+    LaneVec x2 = x * x;
+    LaneVec num = x * (LaneVec::set1(135135.0f) + x2 * (LaneVec::set1(17325.0f) +
+                  x2 * (LaneVec::set1(378.0f) + x2)));
+    LaneVec den = LaneVec::set1(135135.0f) + x2 * (LaneVec::set1(62370.0f) +
+                  x2 * (LaneVec::set1(3150.0f) + x2 * LaneVec::set1(28.0f)));
+    return num / den;
+}
+
+// sin(pi/2 * t) for t in [-1, 1]: odd minimax polynomial (|error| < 1e-6).
+// A triangle wave through this is a sine, which is how the LFO lanes use it.
+inline LaneVec sinHalfPiLanes(LaneVec t) {
+    LaneVec t2 = t * t;
+    LaneVec poly = LaneVec::set1(-0.00433294098f) * t2 + LaneVec::set1(0.0794340077f);
+    poly = poly * t2 + LaneVec::set1(-0.64589268f);
+    poly = poly * t2 + LaneVec::set1(1.57079099f);
+    return t * poly;
+}
+
+// sin(2*pi * x) for x in cycles, any sign and offset (|x| < 2^31): folds x into a
+// triangle wave and shapes it with sinHalfPiLanes (|error| < 1e-6). The shared
+// phase-to-amplitude kernel for FM operators, which accumulate phase in cycles
+// and add modulation without wrapping it first.
+inline LaneVec sinCyclesLanes(LaneVec x) {
+    LaneVec u = x - LaneVec::set1(0.25f);
+    u = u - LaneVec::floor(u);
+    return sinHalfPiLanes(LaneVec::abs(u * LaneVec::set1(4.0f) - LaneVec::set1(2.0f)) - LaneVec::set1(1.0f));
+}
+
+// Scalar twins of the kernels above, same polynomial, for per-sample code paths
+inline float sinHalfPi(float t) {
+    float t2 = t * t;
+    float poly = -0.00433294098f * t2 + 0.0794340077f;
+    poly = poly * t2 - 0.64589268f;
+    poly = poly * t2 + 1.57079099f;
+    return t * poly;
+}
+
+inline float sinCycles(float x) {
+    float u = x - 0.25f;
+    u -= std::floor(u);
+    return sinHalfPi(std::fabs(u * 4.0f - 2.0f) - 1.0f);
+}
+
+// PolyBLEP residual for a -1 -> +1 step at phase 0 of a [0, 1) ramp advancing dt per
+// sample: add it at a rising edge, subtract it at a falling one
+inline float polyBlep(float t, float dt) {
+    if (t < dt) {
+        t /= dt;
+        return t + t - t * t - 1.0f;
+    }
+    if (t > 1.0f - dt) {
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+    return 0.0f;
+}
+
+// 2^x for x in [-8, 8] (clamped): degree-6 series on x/16, squared four times (|rel error| < 5e-6)
+inline LaneVec exp2Lanes(LaneVec x) {
+    x = LaneVec::min(LaneVec::max(x, LaneVec::set1(-8.0f)), LaneVec::set1(8.0f));
+    LaneVec y = x * LaneVec::set1(0.0625f * 0.69314718f);   // ln(2^(x/16))
+    LaneVec p = LaneVec::set1(1.0f / 720.0f) * y + LaneVec::set1(1.0f / 120.0f);
+    p = p * y + LaneVec::set1(1.0f / 24.0f);
+    p = p * y + LaneVec::set1(1.0f / 6.0f);
+    p = p * y + LaneVec::set1(0.5f);
+    p = p * y + LaneVec::set1(1.0f);
+    p = p * y + LaneVec::set1(1.0f);
+    p = p * p;
+    p = p * p;
+    p = p * p;
+    return p * p;
+}
+
 } // namespace SIMD
 } // namespace EtherSynthSIMD
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "SceneMorphEngine.h"
+#include "SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+
+using EtherSynthSIMD::SIMD::LaneVec;
+using EtherSynthSIMD::SIMD::LANE_GROUP;
+
+static_assert(SceneMorphEngine::PADDED_COUNT % LANE_GROUP == 0, "Values must fill whole SIMD groups");
+static_assert(SceneMorphEngine::VALUE_COUNT <= UINT16_MAX, "Indices are stored as uint16_t");
+
+SceneMorphEngine::SceneMorphEngine() = default;
+
+uint32_t SceneMorphEngine::storeScene(const Scene& scene) {
+    while (scenes_.count(nextId_) || nextId_ == 0) ++nextId_;
+    const uint32_t id = nextId_++;
+    scenes_[id] = scene;
+    return id;
+}
+
+void SceneMorphEngine::storeScene(uint32_t id, const Scene& scene) {
+    if (id == 0) return;
+    scenes_[id] = scene;
+    if (id == compiledFrom_ || id == compiledTo_) compiledFrom_ = compiledTo_ = 0;   // Recompile on next select
+}
+
+const SceneMorphEngine::Scene* SceneMorphEngine::getScene(uint32_t id) const {
+    auto it = scenes_.find(id);
+    return it == scenes_.end() ? nullptr : &it->second;
+}
+
+bool SceneMorphEngine::deleteScene(uint32_t id) {
+    if (id == compiledFrom_ || id == compiledTo_) compiledFrom_ = compiledTo_ = 0;
+    return scenes_.erase(id) > 0;
+}
+
+bool SceneMorphEngine::setMorph(uint32_t fromId, uint32_t toId) {
+    const Scene* from = getScene(fromId);
+    const Scene* to = getScene(toId);
+    if (!from || !to) return false;
+    if (fromId == compiledFrom_ && toId == compiledTo_) return true;
+    compile(*from, *to);
+    plans_.back().recall = false;
+    plans_.publish();
+    compiledFrom_ = fromId;
+    compiledTo_ = toId;
+    return true;
+}
+
+void SceneMorphEngine::recall(const Scene& from, const Scene& to, float seconds) {
+    compile(from, to);
+    Plan& plan = plans_.back();
+    plan.recall = true;
+    plan.recallSeconds = std::max(0.0f, seconds);
+    plan.positionSerial = positionSerial_.load(std::memory_order_acquire);
+    plans_.publish();
+    compiledFrom_ = compiledTo_ = 0;
+}
+
+void SceneMorphEngine::compile(const Scene& from, const Scene& to) {
+    Plan& plan = plans_.back();
+    plan.count = 0;
+    for (int i = 0; i < VALUE_COUNT; ++i) {
+        // Slots whose engine differs between the scenes keep their parameters
+        bool morphs = from.captured[i] && to.captured[i];
+        if (morphs && i < SEND_BASE) {
+            const int slot = i / PARAM_COUNT;
+            morphs = from.slotTags[slot] >= 0 && from.slotTags[slot] == to.slotTags[slot];
+        }
+        plan.from[i] = from.values[i];
+        plan.delta[i] = morphs ? to.values[i] - from.values[i] : 0.0f;
+        if (plan.delta[i] != 0.0f) plan.indices[plan.count++] = (uint16_t)i;
+    }
+    compiledCount_ = plan.count;
+}
+
+void SceneMorphEngine::setPosition(float position, float glideSeconds) {
+    glideSeconds_.store(std::max(0.0f, glideSeconds), std::memory_order_relaxed);
+    targetPosition_.store(std::clamp(position, 0.0f, 1.0f), std::memory_order_relaxed);
+    positionSerial_.fetch_add(1, std::memory_order_release);
+}
+
+int SceneMorphEngine::process(size_t frames, float sampleRate) {
+    const bool fresh = plans_.update();
+    const Plan& plan = plans_.front();
+    if (fresh) {
+        recalling_ = plan.recall;
+        if (recalling_) position_ = 0.0f;
+    }
+
+    // A recall runs 0 -> 1 on its own clock until the position is set again
+    if (recalling_ && positionSerial_.load(std::memory_order_acquire) != plan.positionSerial) recalling_ = false;
+    const float target = recalling_ ? 1.0f : targetPosition_.load(std::memory_order_relaxed);
+    const float glide = recalling_ ? plan.recallSeconds : glideSeconds_.load(std::memory_order_relaxed);
+    float position = target;
+    if (glide > 0.0f && sampleRate > 0.0f) {
+        const float step = (float)frames / (glide * sampleRate);
+        position = position_ < target ? std::min(target, position_ + step) : std::max(target, position_ - step);
+    }
+    if (!fresh && applied_ && position == position_) return 0;
+    position_ = position;
+    applied_ = true;
+    appliedPosition_.store(position, std::memory_order_relaxed);
+    if (plan.count == 0) return 0;
+
+    // One lerp over the whole vector: cheaper than gathering the changed indices
+    const LaneVec t = LaneVec::set1(position);
+    for (int i = 0; i < PADDED_COUNT; i += LaneVec::WIDTH) {
+        (LaneVec::load(plan.from.data() + i) + LaneVec::load(plan.delta.data() + i) * t).store(values_.data() + i);
+    }
+    return plan.count;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include "../core/Types.h"
+#include "TripleBuffer.h"
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/**
+ * SceneMorphEngine - Flat scene storage and precompiled morphs across all slots
+ *
+ * A scene is one dense float vector addressed by index: every slot's
+ * ParameterID values, every slot's FX sends, then the global FX parameters
+ * and master volume. Choosing a pair of scenes compiles a morph plan once on
+ * the control thread (start values, deltas and the list of indices that
+ * actually differ). The audio thread turns a morph position into values with
+ * one SIMD lerp over the whole vector and applies only the listed indices:
+ * no name lookups, map walks or allocation while a knob sweeps the morph.
+ *
+ * Features:
+ * - Index layout: slot x ParameterID, slot x send, globals; values a scene
+ *   did not capture, and slots whose engine differs, are never written
+ * - Plans reach the audio thread through a lock-free triple buffer, so scene
+ *   pairs can change while audio runs
+ * - Morph position settable from any thread, jumping or gliding at a rate
+ * - process() reports values only when the plan or the position moved
+ */
+class SceneMorphEngine {
+public:
+    static constexpr int MAX_SLOTS = 16;
+    static constexpr int PARAM_COUNT = static_cast<int>(ParameterID::COUNT);
+    static constexpr int SENDS_PER_SLOT = 2;
+
+    // Values after the per-slot blocks
+    enum Global { REVERB_TIME = 0, REVERB_DAMP, REVERB_MIX, DELAY_TIME, DELAY_FEEDBACK, DELAY_MIX,
+                  MASTER_VOLUME, GLOBAL_COUNT };
+
+    static constexpr int SEND_BASE = MAX_SLOTS * PARAM_COUNT;
+    static constexpr int GLOBAL_BASE = SEND_BASE + MAX_SLOTS * SENDS_PER_SLOT;
+    static constexpr int VALUE_COUNT = GLOBAL_BASE + GLOBAL_COUNT;
+    static constexpr int PADDED_COUNT = (VALUE_COUNT + 7) / 8 * 8;   // Whole LANE_GROUPs
+
+    static constexpr int paramIndex(int slot, ParameterID id) { return slot * PARAM_COUNT + static_cast<int>(id); }
+    static constexpr int sendIndex(int slot, int bus) { return SEND_BASE + slot * SENDS_PER_SLOT + bus; }
+    static constexpr int globalIndex(Global global) { return GLOBAL_BASE + global; }
+
+    struct Scene {
+        std::string name;
+        std::array<float, VALUE_COUNT> values{ };
+        std::bitset<VALUE_COUNT> captured;
+        std::array<int, MAX_SLOTS> slotTags;    // Engine type per slot, -1 = empty
+
+        Scene() { slotTags.fill(-1); }
+        void set(int index, float value) { values[index] = value; captured.set(index); }
+    };
+
+    SceneMorphEngine();
+
+    // Scene store (control thread)
+    uint32_t storeScene(const Scene& scene);                // New id, never 0
+    void storeScene(uint32_t id, const Scene& scene);       // Insert or replace under a caller's id
+    const Scene* getScene(uint32_t id) const;
+    bool deleteScene(uint32_t id);
+    size_t getSceneCount() const { return scenes_.size(); }
+
+    // Compile the morph from -> to and publish it to the audio thread; the position
+    // is kept. Re-selecting the pair already compiled is free, so it can be called
+    // on every knob move.
+    bool setMorph(uint32_t fromId, uint32_t toId);
+    // Morph from -> to over `seconds` (0 = jump to `to`), starting when the audio
+    // thread adopts the plan. The scenes need not be stored, e.g. `from` may be a
+    // capture of the current state. A later setPosition() takes over.
+    void recall(const Scene& from, const Scene& to, float seconds);
+    int getCompiledCount() const { return compiledCount_; }   // Values that differ in the last plan
+
+    // Any thread. glideSeconds > 0 moves towards the target at a full 0..1 sweep per
+    // glideSeconds instead of jumping.
+    void setPosition(float position, float glideSeconds = 0.0f);
+    float getPosition() const { return appliedPosition_.load(std::memory_order_relaxed); }
+
+    // Audio thread, once per block: adopt a new plan, advance a glide over `frames`
+    // and lerp. Returns how many indices to apply from getValues(), 0 for none.
+    int process(size_t frames, float sampleRate);
+    const float* getValues() const { return values_.data(); }
+    const uint16_t* getChangedIndices() const { return plans_.front().indices.data(); }
+
+private:
+    struct Plan {
+        alignas(32) std::array<float, PADDED_COUNT> from{ };
+        alignas(32) std::array<float, PADDED_COUNT> delta{ };
+        std::array<uint16_t, VALUE_COUNT> indices{ };
+        int count = 0;
+        bool recall = false;                    // Restart at 0 and glide to 1 over recallSeconds
+        float recallSeconds = 0.0f;
+        uint32_t positionSerial = 0;            // setPosition() count when published
+    };
+
+    void compile(const Scene& from, const Scene& to);
+
+    std::map<uint32_t, Scene> scenes_;
+    uint32_t nextId_ = 1;
+    uint32_t compiledFrom_ = 0, compiledTo_ = 0;    // Stored pair behind the last plan, 0 = none
+    int compiledCount_ = 0;
+
+    TripleBuffer<Plan> plans_;                    // Control writes back(), audio reads front()
+
+    std::atomic<float> targetPosition_{0.0f};
+    std::atomic<float> glideSeconds_{0.0f};
+    std::atomic<uint32_t> positionSerial_{0};
+    std::atomic<float> appliedPosition_{0.0f};
+    // Audio thread
+    float position_ = 0.0f;
+    bool applied_ = false;                        // position_ has been lerped
+    bool recalling_ = false;                      // Following the plan's recall until setPosition()
+    alignas(32) std::array<float, PADDED_COUNT> values_{ };
+};
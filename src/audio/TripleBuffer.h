@@ -0,0 +1,43 @@
+#pragma once
+#include <array>
+#include <atomic>
+
+/**
+ * TripleBuffer - Lock-free single-writer/single-reader hand-off of whole values
+ *
+ * The writer fills back() and publishes it; the reader calls update() and
+ * reads front(). Publishing swaps the back slot with the middle one and
+ * update() swaps the middle slot with the front one, each with one atomic
+ * exchange, so neither side ever waits and the reader always sees a complete
+ * value: the newest published one, skipping any it was too slow to see.
+ *
+ * Features:
+ * - No locks, no allocation; T is stored inline three times
+ * - back() holds stale contents after publish(): the writer rewrites the
+ *   whole value (or the fields it owns) before publishing again
+ * - update() reports whether a new value arrived, so readers can skip work
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    // Writer
+    T& back() { return slots_[back_]; }
+    void publish() { back_ = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+    // Reader: adopt the newest published value; false when nothing new was published
+    bool update() {
+        if (!(middle_.load(std::memory_order_relaxed) & FRESH)) return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    const T& front() const { return slots_[front_]; }
+
+private:
+    static constexpr int FRESH = 4;         // Middle slot published, not yet taken
+    static constexpr int INDEX_MASK = 3;
+
+    std::array<T, 3> slots_{ };
+    int back_ = 0;
+    std::atomic<int> middle_{1};
+    int front_ = 2;
+};
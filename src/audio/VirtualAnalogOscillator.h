@@ -1,5 +1,6 @@
 #pragma once
 #include <cmath>
+#include <cstdint>
 
 /**
  * VirtualAnalogOscillator - Virtual analog oscillator with multiple waveforms
@@ -49,7 +50,9 @@ public:
                 output = (phase_ < 0.5f) ? (phase_ * 4.0f - 1.0f) : (3.0f - phase_ * 4.0f);
                 break;
             case NOISE:
-                output = ((rand() / (float)RAND_MAX) * 2.0f) - 1.0f;
+                // Own LCG rather than rand(): no state shared between threads, repeatable renders
+                noiseState_ = noiseState_ * 1664525u + 1013904223u;
+                output = static_cast<float>(noiseState_ >> 8) * (2.0f / 16777216.0f) - 1.0f;
                 break;
         }
         
@@ -64,4 +67,5 @@ private:
     float level_ = 1.0f;
     float pulseWidth_ = 0.5f;
     float phase_ = 0.0f;
+    uint32_t noiseState_ = 22222u;
 };
\ No newline at end of file
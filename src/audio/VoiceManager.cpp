@@ -1,38 +1,247 @@
 #include "VoiceManager.h"
-#include <iostream>
+#include <algorithm>
+#include <cmath>
 
 VoiceManager::VoiceManager() {
-    std::cout << "VoiceManager created" << std::endl;
 }
 
 VoiceManager::~VoiceManager() {
-    std::cout << "VoiceManager destroyed" << std::endl;
 }
 
-void VoiceManager::noteOn(uint8_t note, float velocity, float aftertouch) {
-    // Stub implementation
-    activeVoices_++;
-    std::cout << "VoiceManager: Note ON " << static_cast<int>(note) 
-              << " vel=" << velocity << " after=" << aftertouch 
-              << " (voices=" << activeVoices_ << ")" << std::endl;
+void VoiceManager::setVoiceBudget(int voices) {
+    voiceBudget_ = std::clamp(voices, 1, MAX_TOTAL_VOICES);
 }
 
-void VoiceManager::noteOff(uint8_t note) {
-    // Stub implementation
-    if (activeVoices_ > 0) activeVoices_--;
-    std::cout << "VoiceManager: Note OFF " << static_cast<int>(note) 
-              << " (voices=" << activeVoices_ << ")" << std::endl;
+void VoiceManager::setCpuBudget(float load) {
+    cpuBudget_ = std::max(0.0f, load);
 }
 
-void VoiceManager::allNotesOff() {
-    activeVoices_ = 0;
-    std::cout << "VoiceManager: All notes OFF" << std::endl;
+void VoiceManager::setSlotPriority(int slot, uint8_t priority) {
+    if (!validSlot(slot)) return;
+    slots_[slot].priority = priority;
+    for (auto& rec : slots_[slot].voices) {
+        rec.priority = priority;
+    }
+}
+
+uint8_t VoiceManager::getSlotPriority(int slot) const {
+    return validSlot(slot) ? slots_[slot].priority : DEFAULT_PRIORITY;
+}
+
+void VoiceManager::attachSlot(int slot, const void* owner, int voiceCount) {
+    if (!validSlot(slot)) return;
+    resetSlot(slot);
+    slots_[slot].owner = owner;
+    slots_[slot].voiceCount = std::clamp(voiceCount, 0, MAX_SLOT_VOICES);
+}
+
+void VoiceManager::resetSlot(int slot) {
+    if (!validSlot(slot)) return;
+    Slot& s = slots_[slot];
+    for (auto& rec : s.voices) {
+        rec = VoiceRecord{};
+        rec.priority = s.priority;
+    }
+    s.owner = nullptr;
+    s.voiceCount = 0;
+    s.voiceCost = 0.0f;
+    s.reportedVoices = 0;
+}
+
+int VoiceManager::noteOn(int slot, uint8_t note, float velocity) {
+    if (!validSlot(slot) || slots_[slot].voiceCount == 0) return -1;
+    Slot& s = slots_[slot];
+
+    int index = -1;
+    for (int v = 0; v < s.voiceCount; ++v) {
+        if (s.voices[v].state == VoiceState::FREE) {
+            index = v;
+            break;
+        }
+    }
+
+    if (index < 0 || overBudget(slot)) {
+        // A full slot only steals from itself; a full budget may steal anywhere
+        int victimSlot = -1, victimVoice = -1;
+        if (!findVictim(index < 0 ? slot : -1, s.priority, victimSlot, victimVoice)) {
+            return -1;
+        }
+        ++stealCount_;
+        if (victimSlot == slot) {
+            index = victimVoice;        // Engine retriggers the voice in place
+        } else {
+            slots_[victimSlot].voices[victimVoice].state = VoiceState::STOLEN;
+        }
+    }
+
+    VoiceRecord& rec = s.voices[index];
+    rec.state = VoiceState::ACTIVE;
+    rec.note = note;
+    rec.priority = s.priority;
+    rec.level = std::clamp(velocity, 0.0f, 1.0f);
+    rec.startStamp = ++clock_;
+    rec.releaseStamp = 0;
+    return index;
 }
 
-void VoiceManager::processAudio(EtherAudioBuffer& outputBuffer) {
-    // Stub implementation - just clear the buffer for now
-    for (auto& frame : outputBuffer) {
-        frame.left = 0.0f;
-        frame.right = 0.0f;
+int VoiceManager::noteOff(int slot, uint8_t note) {
+    if (!validSlot(slot)) return -1;
+    Slot& s = slots_[slot];
+
+    // Release the oldest held voice playing this note
+    int index = -1;
+    for (int v = 0; v < s.voiceCount; ++v) {
+        const VoiceRecord& rec = s.voices[v];
+        if (rec.state == VoiceState::ACTIVE && rec.note == note &&
+            (index < 0 || rec.startStamp < s.voices[index].startStamp)) {
+            index = v;
+        }
+    }
+    if (index >= 0) {
+        s.voices[index].state = VoiceState::RELEASING;
+        s.voices[index].releaseStamp = ++clock_;
+    }
+    return index;
+}
+
+void VoiceManager::allNotesOff(int slot) {
+    if (!validSlot(slot)) return;
+    for (auto& rec : slots_[slot].voices) {
+        if (rec.state == VoiceState::ACTIVE) {
+            rec.state = VoiceState::RELEASING;
+            rec.releaseStamp = ++clock_;
+        }
+    }
+}
+
+void VoiceManager::reportLoad(int slot, float load, int activeVoices) {
+    if (!validSlot(slot)) return;
+    Slot& s = slots_[slot];
+    s.reportedVoices = std::max(0, activeVoices);
+    if (activeVoices > 0 && std::isfinite(load)) {
+        float perVoice = std::max(0.0f, load) / activeVoices;
+        s.voiceCost += (perVoice - s.voiceCost) * COST_SMOOTHING;
     }
-}
\ No newline at end of file
+}
+
+VoiceManager::VoiceState VoiceManager::getVoiceState(int slot, int voice) const {
+    if (!validSlot(slot) || voice < 0 || voice >= MAX_SLOT_VOICES) return VoiceState::FREE;
+    return slots_[slot].voices[voice].state;
+}
+
+int VoiceManager::getActiveVoiceCount() const {
+    int total = 0;
+    for (int slot = 0; slot < MAX_SLOTS; ++slot) {
+        total += slotVoices(slot);
+    }
+    return total;
+}
+
+int VoiceManager::getSlotVoiceCount(int slot) const {
+    return validSlot(slot) ? slotVoices(slot) : 0;
+}
+
+int VoiceManager::getReleasingVoiceCount() const {
+    int total = 0;
+    for (const auto& s : slots_) {
+        for (int v = 0; v < s.voiceCount; ++v) {
+            if (s.voices[v].state == VoiceState::RELEASING) ++total;
+        }
+    }
+    return total;
+}
+
+int VoiceManager::getVoiceLimit() const {
+    if (cpuBudget_ <= 0.0f) return voiceBudget_;
+
+    // Mean cost of a sounding voice, falling back to the mean slot cost when idle
+    int voices = getActiveVoiceCount();
+    float cost = voices > 0 ? getEstimatedLoad() / voices : 0.0f;
+    if (cost <= 0.0f) {
+        int measured = 0;
+        for (const auto& s : slots_) {
+            if (s.voiceCost > 0.0f) {
+                cost += s.voiceCost;
+                ++measured;
+            }
+        }
+        if (measured == 0) return voiceBudget_;
+        cost /= measured;
+    }
+    return std::clamp(static_cast<int>(cpuBudget_ / cost), 1, voiceBudget_);
+}
+
+float VoiceManager::getVoiceCost(int slot) const {
+    return validSlot(slot) ? slots_[slot].voiceCost : 0.0f;
+}
+
+float VoiceManager::getEstimatedLoad() const {
+    float load = 0.0f;
+    for (int slot = 0; slot < MAX_SLOTS; ++slot) {
+        load += slots_[slot].voiceCost * slotVoices(slot);
+    }
+    return load;
+}
+
+int VoiceManager::countSounding(const Slot& slot) const {
+    int count = 0;
+    for (int v = 0; v < slot.voiceCount; ++v) {
+        if (sounding(slot.voices[v].state)) ++count;
+    }
+    return count;
+}
+
+int VoiceManager::slotVoices(int slot) const {
+    const Slot& s = slots_[slot];
+    return s.voiceCount > 0 ? countSounding(s) : s.reportedVoices;
+}
+
+bool VoiceManager::overBudget(int slot) const {
+    if (getActiveVoiceCount() >= voiceBudget_) return true;
+    if (cpuBudget_ > 0.0f) {
+        return getEstimatedLoad() + slots_[slot].voiceCost > cpuBudget_;
+    }
+    return false;
+}
+
+bool VoiceManager::betterVictim(const VoiceRecord& a, const VoiceRecord& b) const {
+    // Release tails always give way before held notes
+    bool aReleasing = a.state == VoiceState::RELEASING;
+    bool bReleasing = b.state == VoiceState::RELEASING;
+    if (aReleasing != bReleasing) return aReleasing;
+
+    switch (policy_) {
+        case StealPolicy::QUIETEST:
+            if (a.level != b.level) return a.level < b.level;
+            break;
+        case StealPolicy::LOWEST_PRIORITY:
+            if (a.priority != b.priority) return a.priority < b.priority;
+            break;
+        case StealPolicy::OLDEST:
+            break;
+    }
+    return a.startStamp < b.startStamp;
+}
+
+bool VoiceManager::findVictim(int onlySlot, uint8_t priority, int& victimSlot, int& victimVoice) const {
+    victimSlot = -1;
+    victimVoice = -1;
+    const VoiceRecord* best = nullptr;
+    int first = onlySlot >= 0 ? onlySlot : 0;
+    int last = onlySlot >= 0 ? onlySlot : MAX_SLOTS - 1;
+
+    for (int slot = first; slot <= last; ++slot) {
+        const Slot& s = slots_[slot];
+        for (int v = 0; v < s.voiceCount; ++v) {
+            const VoiceRecord& rec = s.voices[v];
+            if (!sounding(rec.state)) continue;
+            if (policy_ == StealPolicy::LOWEST_PRIORITY && rec.priority > priority) continue;
+            if (!best || betterVictim(rec, *best)) {
+                best = &rec;
+                victimSlot = slot;
+                victimVoice = v;
+            }
+        }
+    }
+    return best != nullptr;
+}
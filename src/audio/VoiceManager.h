@@ -1,34 +1,144 @@
 #pragma once
 #include "../core/Types.h"
-#include <memory>
 #include <array>
-
-class SynthEngine;
+#include <cstdint>
 
 /**
- * Basic voice manager stub for initial testing
- * This will be expanded with full polyphonic voice allocation
+ * VoiceManager - Shared polyphonic voice allocator across instrument slots
+ *
+ * Engines keep their own fixed voice arrays; the manager decides which voice
+ * index a note gets and which voice gives way when a slot or the global
+ * budget is full. A voice stolen from another slot is flagged and silenced
+ * by its engine at the start of that engine's next block (syncVoices).
+ *
+ * Features:
+ * - Oldest / quietest / lowest-priority stealing; release tails go first
+ * - Release-tail tracking: voices stay allocated until the engine reports silence
+ * - Global voice budget across all slots
+ * - Per-voice CPU cost (EMA per slot) with polyphony capped by a CPU budget
+ * - Fixed-size tables: no allocation or locks after construction
+ *
+ * Note events and render calls must not overlap: call noteOn/noteOff from the
+ * thread that drives rendering (the audio callback), and syncVoices/reportLoad
+ * only from the task rendering that slot.
  */
 class VoiceManager {
 public:
+    enum class StealPolicy : uint8_t {
+        OLDEST,             // Longest-running voice
+        QUIETEST,           // Lowest reported level
+        LOWEST_PRIORITY     // Lowest slot priority, oldest first; never steals upwards
+    };
+
+    enum class VoiceState : uint8_t {
+        FREE,
+        ACTIVE,             // Note held
+        RELEASING,          // Note released, tail still sounding
+        STOLEN              // Reassigned; owning engine must kill it
+    };
+
+    static constexpr int MAX_SLOTS = 16;
+    static constexpr int MAX_SLOT_VOICES = static_cast<int>(MAX_VOICES);
+    static constexpr int MAX_TOTAL_VOICES = MAX_SLOTS * MAX_SLOT_VOICES;
+    static constexpr uint8_t DEFAULT_PRIORITY = 64;
+
     VoiceManager();
     ~VoiceManager();
-    
-    // Voice allocation
-    void noteOn(uint8_t note, float velocity, float aftertouch = 0.0f);
-    void noteOff(uint8_t note);
-    void allNotesOff();
-    
-    // Processing
-    void processAudio(EtherAudioBuffer& outputBuffer);
-    
-    // Voice statistics
-    size_t getActiveVoiceCount() const { return activeVoices_; }
-    size_t getMaxVoiceCount() const { return MAX_VOICES; }
-    
+
+    // Configuration
+    void setStealPolicy(StealPolicy policy) { policy_ = policy; }
+    StealPolicy getStealPolicy() const { return policy_; }
+    void setVoiceBudget(int voices);            // Total voices across slots
+    int getVoiceBudget() const { return voiceBudget_; }
+    void setCpuBudget(float load);              // Load in cores (1.0 = one full block); <= 0 disables
+    float getCpuBudget() const { return cpuBudget_; }
+    void setSlotPriority(int slot, uint8_t priority);
+    uint8_t getSlotPriority(int slot) const;
+
+    // Slot ownership. owner is the engine whose voices are tracked (checked by
+    // syncVoices); voiceCount 0 means the engine allocates voices itself and only
+    // reports load.
+    void attachSlot(int slot, const void* owner, int voiceCount);
+    void resetSlot(int slot);
+
+    // Note events: voice index to (re)trigger / release, or -1
+    int noteOn(int slot, uint8_t note, float velocity);
+    int noteOff(int slot, uint8_t note);
+    void allNotesOff(int slot);
+
+    // Render side, start of the owning engine's block. VoiceArray elements need
+    // isActive(), kill() and getLevel().
+    template<typename VoiceArray>
+    void syncVoices(int slot, const void* owner, VoiceArray& voices);
+
+    // Render side, after the slot rendered: load = render time / block duration
+    void reportLoad(int slot, float load, int activeVoices);
+
+    // Statistics
+    VoiceState getVoiceState(int slot, int voice) const;
+    int getActiveVoiceCount() const;            // All slots, including release tails
+    int getSlotVoiceCount(int slot) const;
+    int getReleasingVoiceCount() const;
+    int getVoiceLimit() const;                  // Voice budget, or fewer if the CPU budget binds
+    float getVoiceCost(int slot) const;         // Load per voice (EMA)
+    float getEstimatedLoad() const;
+    uint32_t getStealCount() const { return stealCount_; }
+
 private:
-    size_t activeVoices_ = 0;
-    
-    // Simple stub implementation
-    // This will be replaced with proper voice allocation system
-};
\ No newline at end of file
+    struct VoiceRecord {
+        VoiceState state = VoiceState::FREE;
+        uint8_t note = 0;
+        uint8_t priority = DEFAULT_PRIORITY;
+        float level = 0.0f;
+        uint32_t startStamp = 0;
+        uint32_t releaseStamp = 0;
+    };
+
+    struct Slot {
+        std::array<VoiceRecord, MAX_SLOT_VOICES> voices{};
+        const void* owner = nullptr;
+        int voiceCount = 0;             // 0: voices not managed here
+        uint8_t priority = DEFAULT_PRIORITY;
+        float voiceCost = 0.0f;         // Load per voice
+        int reportedVoices = 0;         // From reportLoad
+    };
+
+    std::array<Slot, MAX_SLOTS> slots_{};
+    StealPolicy policy_ = StealPolicy::OLDEST;
+    int voiceBudget_ = MAX_TOTAL_VOICES;
+    float cpuBudget_ = 0.0f;
+    uint32_t clock_ = 0;
+    uint32_t stealCount_ = 0;
+
+    static constexpr float COST_SMOOTHING = 0.1f;
+
+    bool validSlot(int slot) const { return slot >= 0 && slot < MAX_SLOTS; }
+    static bool sounding(VoiceState state) {
+        return state == VoiceState::ACTIVE || state == VoiceState::RELEASING;
+    }
+    int countSounding(const Slot& slot) const;
+    int slotVoices(int slot) const;             // Managed count, else last reported
+    bool overBudget(int slot) const;
+    bool findVictim(int onlySlot, uint8_t priority, int& victimSlot, int& victimVoice) const;
+    bool betterVictim(const VoiceRecord& a, const VoiceRecord& b) const;
+};
+
+template<typename VoiceArray>
+void VoiceManager::syncVoices(int slot, const void* owner, VoiceArray& voices) {
+    if (!validSlot(slot) || slots_[slot].owner != owner) return;
+    Slot& s = slots_[slot];
+    for (int v = 0; v < s.voiceCount; ++v) {
+        VoiceRecord& rec = s.voices[v];
+        auto& voice = voices[v];
+        if (rec.state == VoiceState::STOLEN) {
+            voice.kill();
+            rec.state = VoiceState::FREE;
+        } else if (sounding(rec.state)) {
+            if (voice.isActive()) {
+                rec.level = voice.getLevel();
+            } else {
+                rec.state = VoiceState::FREE;   // Tail finished
+            }
+        }
+    }
+}
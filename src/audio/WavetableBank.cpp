@@ -0,0 +1,306 @@
+#include "WavetableBank.h"
+#include "FFT.h"
+#include "SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define WAVETABLE_BANK_MMAP 1
+#endif
+
+using EtherSynthSIMD::SIMD::LaneVec;
+
+WavetableBank::WavetableBank() {
+}
+
+WavetableBank::~WavetableBank() {
+    release();
+}
+
+int WavetableBank::getLevelSize(int level) {
+    // Full size while a level still holds hundreds of harmonics, then halve per octave
+    return std::max(TABLE_SIZE >> std::max(0, level - 2), MIN_LEVEL_SIZE);
+}
+
+size_t WavetableBank::levelOffset(int level) {
+    size_t offset = 0;
+    for (int l = 0; l < level; ++l) {
+        offset += static_cast<size_t>(getLevelSize(l) + GUARD);
+    }
+    return offset;
+}
+
+size_t WavetableBank::tableStride() {
+    return levelOffset(MAX_LEVELS);
+}
+
+const float* WavetableBank::getTable(int table, int level) const {
+    if (!data_) return nullptr;
+    table = std::clamp(table, 0, tableCount_ - 1);
+    level = std::clamp(level, 0, levelCount_ - 1);
+    return data_ + table * tableStride() + levelOffset(level);
+}
+
+bool WavetableBank::build(const float* cycles, int tableCount, int cycleSize) {
+    if (!cycles || tableCount <= 0 || tableCount > MAX_TABLES) return false;
+    if (!FFT::isPowerOfTwo(cycleSize) || cycleSize < FFT::MIN_SIZE || cycleSize > FFT::MAX_SIZE) return false;
+
+    release();
+    storage_.assign(tableStride() * tableCount, 0.0f);
+
+    FFT analysis(cycleSize);
+    FFT synthesis(TABLE_SIZE);
+    std::vector<float> sourceRe(analysis.getNumBins()), sourceIm(analysis.getNumBins());
+    std::vector<float> re(synthesis.getNumBins()), im(synthesis.getNumBins());
+    std::vector<float> cycle(TABLE_SIZE);
+
+    // Source bins are rescaled to the synthesis size; Nyquist bins are dropped
+    const int sourceHarmonics = std::min(cycleSize, TABLE_SIZE) / 2 - 1;
+    const float scale = static_cast<float>(TABLE_SIZE) / cycleSize;
+
+    for (int table = 0; table < tableCount; ++table) {
+        analysis.forwardReal(cycles + static_cast<size_t>(table) * cycleSize, sourceRe.data(), sourceIm.data());
+
+        for (int level = 0; level < MAX_LEVELS; ++level) {
+            const int size = getLevelSize(level);
+            const int harmonics = std::min({getLevelHarmonics(level), sourceHarmonics, size / 2 - 1});
+
+            std::fill(re.begin(), re.end(), 0.0f);
+            std::fill(im.begin(), im.end(), 0.0f);
+            for (int k = 0; k <= harmonics; ++k) {
+                re[k] = sourceRe[k] * scale;
+                im[k] = sourceIm[k] * scale;
+            }
+            synthesis.inverseReal(re.data(), im.data(), cycle.data());
+
+            // Band-limited below the level's Nyquist, so decimation is exact
+            float* dst = storage_.data() + table * tableStride() + levelOffset(level);
+            const int step = TABLE_SIZE / size;
+            for (int i = 0; i < size; ++i) {
+                dst[i] = cycle[i * step];
+            }
+            for (int i = 0; i < GUARD; ++i) {
+                dst[size + i] = dst[i];
+            }
+        }
+    }
+
+    data_ = storage_.data();
+    tableCount_ = tableCount;
+    levelCount_ = MAX_LEVELS;
+    return true;
+}
+
+bool WavetableBank::buildFactory() {
+    // Sine, then partials of rising (non-integer) ratio for a bright scan
+    std::vector<float> cycles(static_cast<size_t>(FACTORY_TABLES) * TABLE_SIZE);
+    for (int table = 0; table < FACTORY_TABLES; ++table) {
+        float* cycle = cycles.data() + static_cast<size_t>(table) * TABLE_SIZE;
+        const double harmonic = 1.0 + table * 0.1;
+        for (int i = 0; i < TABLE_SIZE; ++i) {
+            double phase = 2.0 * M_PI * i / TABLE_SIZE;
+            cycle[i] = table == 0 ? static_cast<float>(std::sin(phase))
+                                  : static_cast<float>(std::sin(phase * harmonic) / harmonic);
+        }
+    }
+    return build(cycles.data(), FACTORY_TABLES, TABLE_SIZE);
+}
+
+bool WavetableBank::save(const std::string& path) const {
+    if (!data_) return false;
+
+    FileHeader header{};
+    std::memcpy(header.magic, "EWTB", 4);
+    header.version = FILE_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.tableCount = static_cast<uint32_t>(tableCount_);
+    header.levelCount = static_cast<uint32_t>(levelCount_);
+    header.tableSize = TABLE_SIZE;
+    header.minLevelSize = MIN_LEVEL_SIZE;
+    header.guard = GUARD;
+    header.dataOffset = (sizeof(FileHeader) + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+    header.dataBytes = tableStride() * tableCount_ * sizeof(float);
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    char padding[DATA_ALIGNMENT] = {};
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              std::fwrite(padding, 1, header.dataOffset - sizeof(header), file) == header.dataOffset - sizeof(header) &&
+              std::fwrite(data_, 1, header.dataBytes, file) == header.dataBytes;
+    ok = std::fclose(file) == 0 && ok;
+    return ok;
+}
+
+bool WavetableBank::validateHeader(const FileHeader& header, size_t fileBytes) {
+    if (std::memcmp(header.magic, "EWTB", 4) != 0) return false;
+    if (header.version != FILE_VERSION || header.byteOrder != BYTE_ORDER_MARK) return false;
+    if (header.tableCount == 0 || header.tableCount > static_cast<uint32_t>(MAX_TABLES)) return false;
+
+    // Level layout is fixed by the constants, so it must match exactly
+    if (header.levelCount != static_cast<uint32_t>(MAX_LEVELS) || header.tableSize != static_cast<uint32_t>(TABLE_SIZE) ||
+        header.minLevelSize != static_cast<uint32_t>(MIN_LEVEL_SIZE) || header.guard != static_cast<uint32_t>(GUARD)) {
+        return false;
+    }
+    if (header.dataOffset < sizeof(FileHeader) || header.dataOffset % DATA_ALIGNMENT != 0) return false;
+    if (header.dataBytes != tableStride() * header.tableCount * sizeof(float)) return false;
+    return header.dataOffset + header.dataBytes <= fileBytes;
+}
+
+bool WavetableBank::load(const std::string& path) {
+    release();
+#if defined(WAVETABLE_BANK_MMAP)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        return false;
+    }
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) return false;
+
+    FileHeader header;
+    std::memcpy(&header, mapping, sizeof(header));
+    if (!validateHeader(header, bytes)) {
+        ::munmap(mapping, bytes);
+        return false;
+    }
+
+    mapping_ = mapping;
+    mappingBytes_ = bytes;
+    data_ = reinterpret_cast<const float*>(static_cast<const char*>(mapping) + header.dataOffset);
+    tableCount_ = static_cast<int>(header.tableCount);
+    levelCount_ = static_cast<int>(header.levelCount);
+    return true;
+#else
+    return readFile(path);
+#endif
+}
+
+bool WavetableBank::readFile(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    FileHeader header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+              std::fseek(file, 0, SEEK_END) == 0;
+    long bytes = ok ? std::ftell(file) : -1;
+    ok = ok && bytes > 0 && validateHeader(header, static_cast<size_t>(bytes)) &&
+         std::fseek(file, static_cast<long>(header.dataOffset), SEEK_SET) == 0;
+    if (ok) {
+        storage_.resize(header.dataBytes / sizeof(float));
+        ok = std::fread(storage_.data(), 1, header.dataBytes, file) == header.dataBytes;
+    }
+    std::fclose(file);
+
+    if (!ok) {
+        storage_.clear();
+        return false;
+    }
+    data_ = storage_.data();
+    tableCount_ = static_cast<int>(header.tableCount);
+    levelCount_ = static_cast<int>(header.levelCount);
+    return true;
+}
+
+void WavetableBank::release() {
+#if defined(WAVETABLE_BANK_MMAP)
+    if (mapping_) {
+        ::munmap(mapping_, mappingBytes_);
+    }
+#endif
+    mapping_ = nullptr;
+    mappingBytes_ = 0;
+    storage_.clear();
+    storage_.shrink_to_fit();
+    data_ = nullptr;
+    tableCount_ = 0;
+    levelCount_ = 0;
+}
+
+std::shared_ptr<const WavetableBank> WavetableBank::getShared() {
+    static const std::shared_ptr<const WavetableBank> shared = [] {
+        auto bank = std::make_shared<WavetableBank>();
+        const char* path = std::getenv(PATH_ENV);
+        if (!(path && bank->load(path)) && !bank->load(DEFAULT_PATH)) {
+            bank->buildFactory();
+        }
+        return bank;
+    }();
+    return shared;
+}
+
+int WavetableBank::selectLevel(float increment) const {
+    int level = 0;
+    while (level < levelCount_ - 1 && getLevelHarmonics(level) * increment > 0.5f) {
+        ++level;
+    }
+    return level;
+}
+
+void WavetableBank::render(int tableA, int tableB, float fraction, int level,
+                           float& phase, float increment, float gain,
+                           float* out, size_t frames) const {
+    if (!data_ || gain == 0.0f) {
+        // Silent: keep the phase running
+        phase += increment * static_cast<float>(frames);
+        phase -= std::floor(phase);
+        return;
+    }
+
+    const float* ta = getTable(tableA, level);
+    const float* tb = getTable(tableB, level);
+    const float size = static_cast<float>(getLevelSize(level));
+    const LaneVec blend = LaneVec::set1(fraction);
+    const LaneVec g = LaneVec::set1(gain);
+
+    alignas(32) float a0[RENDER_CHUNK], a1[RENDER_CHUNK];
+    alignas(32) float b0[RENDER_CHUNK], b1[RENDER_CHUNK];
+    alignas(32) float frac[RENDER_CHUNK];
+
+    for (size_t start = 0; start < frames; start += RENDER_CHUNK) {
+        const int count = static_cast<int>(std::min<size_t>(RENDER_CHUNK, frames - start));
+
+        // Phase recurrence and table gathers (guard samples cover index + 1)
+        for (int i = 0; i < count; ++i) {
+            float position = phase * size;
+            int index = static_cast<int>(position);
+            frac[i] = position - static_cast<float>(index);
+            a0[i] = ta[index];
+            a1[i] = ta[index + 1];
+            b0[i] = tb[index];
+            b1[i] = tb[index + 1];
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        // Sample interpolation, then cross-table interpolation, across lanes
+        float* dst = out + start;
+        int i = 0;
+        for (; i + LaneVec::WIDTH <= count; i += LaneVec::WIDTH) {
+            LaneVec f = LaneVec::load(frac + i);
+            LaneVec va = LaneVec::load(a0 + i);
+            LaneVec vb = LaneVec::load(b0 + i);
+            va = va + (LaneVec::load(a1 + i) - va) * f;
+            vb = vb + (LaneVec::load(b1 + i) - vb) * f;
+            LaneVec sum = LaneVec::load(dst + i) + (va + (vb - va) * blend) * g;
+            sum.store(dst + i);
+        }
+        for (; i < count; ++i) {
+            float va = a0[i] + (a1[i] - a0[i]) * frac[i];
+            float vb = b0[i] + (b1[i] - b0[i]) * frac[i];
+            dst[i] += (va + (vb - va) * fraction) * gain;
+        }
+    }
+}
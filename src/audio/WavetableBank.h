@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * WavetableBank - Band-limited, mip-mapped wavetables shared by all engines
+ *
+ * Every table is stored as one mip level per octave: level k keeps the
+ * harmonics up to (TABLE_SIZE / 2) >> k, so playback picks the level whose
+ * highest harmonic stays below Nyquist for the note and never aliases.
+ * Levels are generated offline from single cycles by FFT (zeroing bins
+ * above the level's limit) and written to a compact .ewtb file that is
+ * memory-mapped at startup; the factory set is built in memory if no file
+ * is found.
+ *
+ * Features:
+ * - Per-octave mip levels; high levels use shorter tables (cache friendly)
+ * - Guard samples after every level: interpolation needs no index masking
+ * - .ewtb files mapped read-only (pages shared between processes)
+ * - One shared bank for every engine and slot (getShared)
+ * - Block playback with cross-table interpolation, vectorised with LaneVec
+ *
+ * File layout (.ewtb, little endian): FileHeader, then float32 level data at
+ * dataOffset: for each table, levels 0..levelCount-1 of levelSize + GUARD
+ * samples each.
+ */
+class WavetableBank {
+public:
+    static constexpr int TABLE_SIZE = 2048;         // Level 0 samples per cycle
+    static constexpr int MIN_LEVEL_SIZE = 256;      // Shortest level table
+    static constexpr int MAX_LEVELS = 11;           // 1024 harmonics down to 1
+    static constexpr int GUARD = 4;                 // Wrapped samples after each level
+    static constexpr int MAX_TABLES = 256;
+    static constexpr int FACTORY_TABLES = 64;
+    static constexpr const char* DEFAULT_PATH = "data/wavetables/factory.ewtb";
+    static constexpr const char* PATH_ENV = "ETHER_WAVETABLE_BANK";
+
+    WavetableBank();
+    ~WavetableBank();
+    WavetableBank(const WavetableBank&) = delete;
+    WavetableBank& operator=(const WavetableBank&) = delete;
+
+    // Offline generation (allocates, runs FFTs). cycles holds tableCount
+    // single cycles of cycleSize samples each; cycleSize must be a power of two.
+    bool build(const float* cycles, int tableCount, int cycleSize);
+    bool buildFactory();
+
+    // Storage
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);             // Maps the file where supported
+    void release();
+
+    // Shared bank: the file named by ETHER_WAVETABLE_BANK or DEFAULT_PATH,
+    // else the factory tables built in memory. Loaded once, never released.
+    static std::shared_ptr<const WavetableBank> getShared();
+
+    // Table access
+    bool isValid() const { return data_ != nullptr; }
+    bool isMapped() const { return mapping_ != nullptr; }
+    int getTableCount() const { return tableCount_; }
+    int getLevelCount() const { return levelCount_; }
+    static int getLevelSize(int level);
+    static int getLevelHarmonics(int level) { return (TABLE_SIZE / 2) >> level; }
+    const float* getTable(int table, int level) const;  // getLevelSize(level) + GUARD samples
+
+    // Playback. increment is cycles per sample; selectLevel returns the richest
+    // level without harmonics above Nyquist.
+    int selectLevel(float increment) const;
+
+    // Adds gain * table output to out, blending tableA -> tableB by fraction
+    // (cross-table interpolation). phase (0-1) is advanced by frames * increment.
+    void render(int tableA, int tableB, float fraction, int level,
+                float& phase, float increment, float gain,
+                float* out, size_t frames) const;
+
+private:
+    struct FileHeader {
+        char magic[4];                  // "EWTB"
+        uint32_t version;
+        uint32_t byteOrder;             // BYTE_ORDER_MARK as written
+        uint32_t tableCount;
+        uint32_t levelCount;
+        uint32_t tableSize;             // Level 0 size
+        uint32_t minLevelSize;
+        uint32_t guard;
+        uint64_t dataOffset;            // Bytes from file start
+        uint64_t dataBytes;
+        uint32_t reserved[6];
+    };
+
+    static constexpr uint32_t FILE_VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr size_t DATA_ALIGNMENT = 64;
+    static constexpr int RENDER_CHUNK = 64;
+
+    const float* data_ = nullptr;       // storage_ or the mapped file
+    std::vector<float> storage_;
+    void* mapping_ = nullptr;
+    size_t mappingBytes_ = 0;
+    int tableCount_ = 0;
+    int levelCount_ = 0;
+
+    static size_t tableStride();        // Floats per table (all levels)
+    static size_t levelOffset(int level);
+    static bool validateHeader(const FileHeader& header, size_t fileBytes);
+    bool readFile(const std::string& path);   // Fallback where files cannot be mapped
+};
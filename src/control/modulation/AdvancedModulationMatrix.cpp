@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <cmath>
 #include <chrono>
+#include <cstring>
 #include <iostream>
 
 AdvancedModulationMatrix::AdvancedModulationMatrix() {
@@ -15,6 +16,7 @@ AdvancedModulationMatrix::AdvancedModulationMatrix() {
     lfos_[0].frequency = 1.0f;   // 1 Hz
     lfos_[1].frequency = 0.5f;   // 0.5 Hz
     lfos_[2].frequency = 2.0f;   // 2 Hz
+    for (size_t i = 0; i < lfos_.size(); ++i) lfos_[i].randomState += static_cast<uint32_t>(i) * 0x9E3779B9u;
     
     // Set up envelope followers
     for (auto& follower : envelopeFollowers_) {
@@ -26,6 +28,9 @@ AdvancedModulationMatrix::AdvancedModulationMatrix() {
     // Calculate update interval
     updateInterval_ = 1.0f / updateRate_;
     
+    // Publish the empty routing table
+    commitRouting();
+    
     std::cout << "AdvancedModulationMatrix: Initialized with " << static_cast<int>(ModSource::COUNT) 
               << " modulation sources" << std::endl;
 }
@@ -34,7 +39,12 @@ AdvancedModulationMatrix::~AdvancedModulationMatrix() {
     std::cout << "AdvancedModulationMatrix destroyed" << std::endl;
 }
 
-void AdvancedModulationMatrix::addModulation(ModSource source, ParameterID destination, float amount) {
+uint32_t AdvancedModulationMatrix::addModulation(ModSource source, ParameterID destination, float amount) {
+    if (modSlots_.size() >= MAX_SLOTS) {
+        std::cout << "Modulation matrix full (" << MAX_SLOTS << " slots)" << std::endl;
+        return 0;
+    }
+    
     ModulationSlot slot;
     slot.source = source;
     slot.destination = destination;
@@ -43,10 +53,12 @@ void AdvancedModulationMatrix::addModulation(ModSource source, ParameterID desti
     slot.id = generateSlotId();
     
     modSlots_.push_back(slot);
+    commitRouting();
     
     std::cout << "Added modulation: " << getSourceName(source) 
               << " -> Parameter " << static_cast<int>(destination) 
               << " (amount: " << amount << ")" << std::endl;
+    return slot.id;
 }
 
 void AdvancedModulationMatrix::removeModulation(uint32_t slotId) {
@@ -55,12 +67,14 @@ void AdvancedModulationMatrix::removeModulation(uint32_t slotId) {
     
     if (it != modSlots_.end()) {
         modSlots_.erase(it, modSlots_.end());
+        commitRouting();
         std::cout << "Removed modulation slot " << slotId << std::endl;
     }
 }
 
 void AdvancedModulationMatrix::clearAllModulations() {
     modSlots_.clear();
+    commitRouting();
     std::cout << "Cleared all modulations" << std::endl;
 }
 
@@ -71,24 +85,31 @@ void AdvancedModulationMatrix::processFrame() {
     if (deltaTime >= updateInterval_ || !smartUpdates_) {
         updateSourceValues();
         updateLFOs(deltaTime);
-        updateMacros();
         updateAudioDerivedSources();
+        evaluateRouting(deltaTime);
         
         lastUpdateTime_ = currentTime;
     }
 }
 
+void AdvancedModulationMatrix::processBlock(size_t frames) {
+    float deltaTime = static_cast<float>(frames) / sampleRate_;
+    
+    updateSourceValues();
+    updateLFOs(deltaTime);
+    updateAudioDerivedSources();
+    evaluateRouting(deltaTime);
+}
+
 void AdvancedModulationMatrix::updateSourceValues() {
     // Hardware sources are updated externally via setSourceValue()
     // Internal sources are updated here
     
     // Random source
-    static float randomTimer = 0.0f;
-    randomTimer += updateInterval_;
-    if (randomTimer >= 0.1f) { // Update random every 100ms
-        sourceValues_[static_cast<size_t>(ModSource::RANDOM)] = 
-            static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f;
-        randomTimer = 0.0f;
+    randomTimer_ += updateInterval_;
+    if (randomTimer_ >= 0.1f) { // Update random every 100ms
+        sourceValues_[static_cast<size_t>(ModSource::RANDOM)] = nextRandom(randomState_);
+        randomTimer_ = 0.0f;
     }
     
     // Note-based sources (would be set by voice manager)
@@ -99,59 +120,136 @@ void AdvancedModulationMatrix::updateSourceValues() {
 }
 
 float AdvancedModulationMatrix::getModulatedValue(ParameterID param, float baseValue) const {
-    float result = baseValue;
+    return baseValue + getModulation(param);
+}
+
+float AdvancedModulationMatrix::getModulation(ParameterID param) const {
+    size_t index = static_cast<size_t>(param);
+    return index < modulation_.size() ? modulation_[index] : 0.0f;
+}
+
+void AdvancedModulationMatrix::commitRouting() {
+    RoutingTable& table = routing_.back();
+    table.count = 0;
+    table.needsShaping = false;
+    table.globalAmount = globalModAmount_;
     
     for (const auto& slot : modSlots_) {
-        if (!slot.enabled || slot.destination != param) continue;
-        
-        float sourceValue = getSourceValue(slot.source);
+        if (!slot.enabled || table.count >= MAX_SLOTS) continue;
+        if (slot.source >= ModSource::COUNT || slot.destination >= ParameterID::COUNT) continue;
         
-        // Apply conditional modulation if specified
-        if (slot.condition != ModSource::COUNT) {
-            float conditionValue = getSourceValue(slot.condition);
-            bool conditionMet = slot.conditionInvert ? 
-                (conditionValue < slot.conditionThreshold) : 
-                (conditionValue >= slot.conditionThreshold);
-            
-            if (!conditionMet) continue;
-        }
+        const size_t i = table.count++;
+        const bool isLFO = slot.source >= ModSource::LFO_1 && slot.source <= ModSource::LFO_3;
+        table.slotId[i] = slot.id;
+        table.source[i] = static_cast<uint8_t>(slot.source);
+        table.destination[i] = static_cast<uint8_t>(slot.destination);
+        table.condition[i] = static_cast<uint8_t>(std::min(slot.condition, ModSource::COUNT));
+        table.conditionInvert[i] = slot.conditionInvert ? 1 : 0;
+        table.conditionThreshold[i] = slot.conditionThreshold;
+        table.processing[i] = static_cast<uint8_t>(slot.processing);
+        table.curveAmount[i] = slot.curveAmount;
+        table.rateMultiplier[i] = isLFO ? slot.rateMultiplier : 1.0f;
+        table.phaseOffset[i] = slot.phaseOffset;
         
-        // Apply processing to source value
-        float processedValue = applyProcessing(sourceValue, slot.processing, slot.curveAmount);
+        // Unipolar (v + 1) / 2 folded into scale and bias
+        table.scale[i] = slot.bipolar ? slot.amount : slot.amount * 0.5f;
+        table.bias[i] = slot.bipolar ? slot.offset : slot.offset + slot.amount * 0.5f;
+        table.smoothRate[i] = slot.responseTime > 0.0f ? 1.0f / slot.responseTime : 0.0f;
         
-        // Apply rate multiplier for time-based sources
-        if (slot.source >= ModSource::LFO_1 && slot.source <= ModSource::LFO_3) {
-            processedValue *= slot.rateMultiplier;
+        if (slot.processing != ModProcessing::DIRECT || slot.phaseOffset != 0.0f) {
+            table.needsShaping = true;
         }
-        
-        // Add phase offset
-        if (slot.phaseOffset != 0.0f) {
-            processedValue = std::sin((std::asin(processedValue) + slot.phaseOffset * 2.0f * M_PI));
+    }
+    
+    table.macroWeights = macroWeights_;
+    table.macroDefined = macroDefined_;
+    
+    routing_.publish();
+}
+
+const AdvancedModulationMatrix::RoutingTable& AdvancedModulationMatrix::acquireRoutingTable() {
+    if (!routing_.update()) return routing_.front();
+    
+    const RoutingTable& table = routing_.front();
+    
+    // Carry smoothing state over by slot id; new slots start from silence
+    std::array<float, MAX_SLOTS> carried{};
+    for (size_t i = 0; i < table.count; i++) {
+        for (size_t j = 0; j < smoothCount_; j++) {
+            if (smoothSlotId_[j] == table.slotId[i]) {
+                carried[i] = smoothState_[j];
+                break;
+            }
         }
-        
-        // Convert to unipolar if needed
-        if (!slot.bipolar) {
-            processedValue = (processedValue + 1.0f) * 0.5f;
+    }
+    smoothState_ = carried;
+    smoothSlotId_ = table.slotId;
+    smoothCount_ = table.count;
+    return table;
+}
+
+void AdvancedModulationMatrix::evaluateRouting(float deltaTime) {
+    const RoutingTable& table = acquireRoutingTable();
+    const size_t count = table.count;
+    
+    // Effective source values; the extra entry is the "no condition" source
+    std::array<float, SOURCE_COUNT + 1> sources;
+    for (size_t s = 0; s < SOURCE_COUNT; s++) {
+        sources[s] = sourceEnabled_[s] ? sourceValues_[s] : 0.0f;
+    }
+    sources[SOURCE_COUNT] = 0.0f;
+    
+    // Macros are dense weighted sums, in order so later macros see earlier ones
+    for (size_t m = 0; m < MACRO_COUNT; m++) {
+        if (!table.macroDefined[m]) continue;
+        const auto& weights = table.macroWeights[m];
+        float value = 0.0f;
+        for (size_t s = 0; s < SOURCE_COUNT; s++) {
+            value += weights[s] * sources[s];
         }
-        
-        // Apply amount and offset
-        float modulation = processedValue * slot.amount + slot.offset;
-        
-        // Apply global modulation amount
-        modulation *= globalModAmount_;
-        
-        // Apply smoothing if specified
-        if (slot.responseTime > 0.0f) {
-            auto& filter = smoothingFilters_[slot.id];
-            filter.target = baseValue + modulation;
-            filter.smoothTime = slot.responseTime;
-            result = filter.process(filter.target, updateInterval_);
-        } else {
-            result += modulation;
+        const size_t index = static_cast<size_t>(ModSource::MACRO_1) + m;
+        sourceValues_[index] = std::clamp(value, -1.0f, 1.0f);
+        sources[index] = sourceEnabled_[index] ? sourceValues_[index] : 0.0f;
+    }
+    
+    // Gather
+    std::array<float, MAX_SLOTS> values;
+    std::array<float, MAX_SLOTS> gates;
+    for (size_t i = 0; i < count; i++) {
+        values[i] = sources[table.source[i]];
+        const bool met = sources[table.condition[i]] >= table.conditionThreshold[i];
+        gates[i] = (table.condition[i] == SOURCE_COUNT || met != (table.conditionInvert[i] != 0)) ? 1.0f : 0.0f;
+    }
+    
+    // Curves and phase offsets, only when a slot uses them
+    if (table.needsShaping) {
+        for (size_t i = 0; i < count; i++) {
+            float value = applyProcessing(values[i], static_cast<ModProcessing>(table.processing[i]),
+                                          table.curveAmount[i]) * table.rateMultiplier[i];
+            if (table.phaseOffset[i] != 0.0f) {
+                value = std::sin(std::asin(std::clamp(value, -1.0f, 1.0f)) + table.phaseOffset[i] * 2.0f * M_PI);
+            }
+            values[i] = value;
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            values[i] *= table.rateMultiplier[i];
         }
     }
     
-    return result;
+    // Scale, gate and smooth
+    const float global = table.globalAmount;
+    for (size_t i = 0; i < count; i++) {
+        const float target = (values[i] * table.scale[i] + table.bias[i]) * global * gates[i];
+        const float coeff = table.smoothRate[i] > 0.0f ? std::min(1.0f, deltaTime * table.smoothRate[i]) : 1.0f;
+        smoothState_[i] += (target - smoothState_[i]) * coeff;
+    }
+    
+    // Scatter into the dense destination array
+    modulation_.fill(0.0f);
+    for (size_t i = 0; i < count; i++) {
+        modulation_[table.destination[i]] += smoothState_[i];
+    }
 }
 
 void AdvancedModulationMatrix::setSourceValue(ModSource source, float value) {
@@ -216,20 +314,31 @@ const AdvancedModulationMatrix::ModulationSlot* AdvancedModulationMatrix::getMod
 
 void AdvancedModulationMatrix::setGlobalModulationAmount(float amount) {
     globalModAmount_ = std::clamp(amount, 0.0f, 2.0f);
+    commitRouting();
 }
 
 void AdvancedModulationMatrix::defineMacro(ModSource macro, const std::vector<std::pair<ModSource, float>>& sources) {
     if (macro >= ModSource::MACRO_1 && macro <= ModSource::MACRO_4) {
-        macros_[macro] = sources;
+        const size_t m = static_cast<size_t>(macro) - static_cast<size_t>(ModSource::MACRO_1);
+        macroWeights_[m].fill(0.0f);
+        for (const auto& source : sources) {
+            if (source.first < ModSource::COUNT) {
+                macroWeights_[m][static_cast<size_t>(source.first)] += source.second;
+            }
+        }
+        macroDefined_[m] = true;
+        commitRouting();
         std::cout << "Defined macro " << getSourceName(macro) 
                   << " with " << sources.size() << " sources" << std::endl;
     }
 }
 
 void AdvancedModulationMatrix::clearMacro(ModSource macro) {
-    auto it = macros_.find(macro);
-    if (it != macros_.end()) {
-        macros_.erase(it);
+    if (macro >= ModSource::MACRO_1 && macro <= ModSource::MACRO_4) {
+        const size_t m = static_cast<size_t>(macro) - static_cast<size_t>(ModSource::MACRO_1);
+        macroWeights_[m].fill(0.0f);
+        macroDefined_[m] = false;
+        commitRouting();
         std::cout << "Cleared macro " << getSourceName(macro) << std::endl;
     }
 }
@@ -336,7 +445,7 @@ bool AdvancedModulationMatrix::loadMatrix(const std::vector<uint8_t>& data) {
     std::memcpy(&numSlots, data.data() + offset, sizeof(numSlots));
     offset += sizeof(numSlots);
     
-    if (data.size() < offset + numSlots * sizeof(ModulationSlot) + sizeof(float)) {
+    if (numSlots > MAX_SLOTS || data.size() < offset + numSlots * sizeof(ModulationSlot) + sizeof(float)) {
         return false;
     }
     
@@ -355,14 +464,23 @@ bool AdvancedModulationMatrix::loadMatrix(const std::vector<uint8_t>& data) {
     // Read global settings
     std::memcpy(&globalModAmount_, data.data() + offset, sizeof(globalModAmount_));
     
+    // Keep new ids clear of the loaded ones
+    for (const auto& slot : modSlots_) {
+        nextSlotId_ = std::max(nextSlotId_, slot.id + 1);
+    }
+    commitRouting();
+    
     std::cout << "Loaded modulation matrix with " << numSlots << " slots" << std::endl;
     return true;
 }
 
 void AdvancedModulationMatrix::resetToDefault() {
-    clearAllModulations();
     globalModAmount_ = 1.0f;
-    macros_.clear();
+    for (auto& weights : macroWeights_) {
+        weights.fill(0.0f);
+    }
+    macroDefined_.fill(false);
+    clearAllModulations();
     
     // Reset LFOs
     for (auto& lfo : lfos_) {
@@ -451,6 +569,13 @@ float AdvancedModulationMatrix::applyProcessing(float value, ModProcessing proce
     }
 }
 
+float AdvancedModulationMatrix::nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<float>(state) * (2.0f / 4294967295.0f) - 1.0f;
+}
+
 // LFO implementation
 float AdvancedModulationMatrix::LFO::process(float deltaTime) {
     if (!enabled) return 0.0f;
@@ -475,8 +600,9 @@ float AdvancedModulationMatrix::LFO::process(float deltaTime) {
             break;
         case Waveform::RANDOM:
             if (phase < deltaTime * frequency) {
-                output = static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f;
+                randomValue = nextRandom(randomState);
             }
+            output = randomValue;
             break;
         default:
             output = 0.0f;
@@ -507,35 +633,11 @@ float AdvancedModulationMatrix::EnvelopeFollower::process(float input, float del
     return std::clamp(level, 0.0f, 1.0f);
 }
 
-// SmoothingFilter implementation
-float AdvancedModulationMatrix::SmoothingFilter::process(float input, float deltaTime) {
-    if (smoothTime <= 0.0f) {
-        value = input;
-        return value;
-    }
-    
-    float rate = 1.0f / smoothTime;
-    value += (input - value) * rate * deltaTime;
-    return value;
-}
-
 // Private helper methods
 uint32_t AdvancedModulationMatrix::generateSlotId() {
     return nextSlotId_++;
 }
 
-void AdvancedModulationMatrix::updateMacros() {
-    for (const auto& macro : macros_) {
-        float value = 0.0f;
-        
-        for (const auto& source : macro.second) {
-            value += getSourceValue(source.first) * source.second;
-        }
-        
-        setSourceValue(macro.first, std::clamp(value, -1.0f, 1.0f));
-    }
-}
-
 void AdvancedModulationMatrix::updateLFOs(float deltaTime) {
     for (size_t i = 0; i < lfos_.size(); i++) {
         float lfoValue = lfos_[i].process(deltaTime);
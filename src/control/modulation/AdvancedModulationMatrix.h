@@ -1,18 +1,33 @@
 #pragma once
 #include "../../core/Types.h"
-#include <vector>
+#include "../../audio/TripleBuffer.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
-#include <map>
+#include <string>
+#include <vector>
 
 /**
  * Advanced Modulation Matrix
  * Route any modulation source to any parameter with sophisticated processing
+ *
+ * Slots are edited on the control thread. Every edit compiles them into a
+ * flat routing table (source index -> destination index, scale, bias and
+ * curve, as parallel arrays) and publishes it through a lock-free triple
+ * buffer. Once per block, the audio thread evaluates all slots in one pass
+ * into a dense per-parameter modulation array. getModulatedValue() is then
+ * a single lookup. Smoothing state is preallocated per slot, and the audio
+ * path never allocates or takes a lock.
  */
 class AdvancedModulationMatrix {
 public:
     AdvancedModulationMatrix();
     ~AdvancedModulationMatrix();
     
+    static constexpr size_t MAX_SLOTS = 16;
+    static constexpr size_t MACRO_COUNT = 4;
+    
     // Modulation sources
     enum class ModSource {
         // Hardware sources
@@ -50,6 +65,9 @@ public:
         COUNT
     };
     
+    static constexpr size_t SOURCE_COUNT = static_cast<size_t>(ModSource::COUNT);
+    static constexpr size_t DESTINATION_COUNT = static_cast<size_t>(ParameterID::COUNT);
+    
     // Modulation processing types
     enum class ModProcessing {
         DIRECT = 0,        // Direct mapping
@@ -91,15 +109,19 @@ public:
         uint32_t id = 0;              // Unique identifier
     };
     
-    // Core operations
-    void addModulation(ModSource source, ParameterID destination, float amount);
+    // Core operations (control thread; each edit recompiles the routing table)
+    uint32_t addModulation(ModSource source, ParameterID destination, float amount); // 0 when all slots are used
     void removeModulation(uint32_t slotId);
     void clearAllModulations();
+    void commitRouting();             // Publish edits made through getModulationSlot()
     
-    // Modulation processing
+    // Modulation processing (audio thread)
     void processFrame();              // Process one audio frame
+    void processBlock(size_t frames); // Advance sources and evaluate all slots once per block
     void updateSourceValues();       // Update all source values
     float getModulatedValue(ParameterID param, float baseValue) const;
+    float getModulation(ParameterID param) const;   // Summed modulation from the last evaluation
+    void setSampleRate(float sampleRate) { sampleRate_ = sampleRate; }
     
     // Source value management
     void setSourceValue(ModSource source, float value);
@@ -131,6 +153,8 @@ public:
         float offset = 0.0f;          // DC offset
         bool syncToNote = false;      // Sync to note on
         bool enabled = true;
+        uint32_t randomState = 0x2545F491u;   // RANDOM waveform xorshift state
+        float randomValue = 0.0f;             // RANDOM waveform: held until the next cycle
         
         float process(float deltaTime);
         void reset() { phase = 0.0f; }
@@ -183,7 +207,29 @@ public:
     std::function<void(ParameterID, float)> onParameterChange;
 
 private:
-    // Storage
+    // Flat routing table compiled from modSlots_, one entry per enabled slot
+    struct RoutingTable {
+        size_t count = 0;
+        bool needsShaping = false;                          // Any curve or phase offset
+        float globalAmount = 1.0f;
+        std::array<uint32_t, MAX_SLOTS> slotId{};
+        std::array<uint8_t, MAX_SLOTS> source{};
+        std::array<uint8_t, MAX_SLOTS> destination{};
+        std::array<uint8_t, MAX_SLOTS> condition{};         // SOURCE_COUNT: unconditional
+        std::array<uint8_t, MAX_SLOTS> conditionInvert{};
+        std::array<uint8_t, MAX_SLOTS> processing{};
+        std::array<float, MAX_SLOTS> conditionThreshold{};
+        std::array<float, MAX_SLOTS> curveAmount{};
+        std::array<float, MAX_SLOTS> rateMultiplier{};      // 1 for non-LFO sources
+        std::array<float, MAX_SLOTS> phaseOffset{};
+        std::array<float, MAX_SLOTS> scale{};               // amount, halved when unipolar
+        std::array<float, MAX_SLOTS> bias{};                // offset, plus amount / 2 when unipolar
+        std::array<float, MAX_SLOTS> smoothRate{};          // 1 / responseTime, 0 = unsmoothed
+        std::array<std::array<float, SOURCE_COUNT>, MACRO_COUNT> macroWeights{};
+        std::array<bool, MACRO_COUNT> macroDefined{};
+    };
+    
+    // Storage (control thread)
     std::vector<ModulationSlot> modSlots_;
     std::array<float, static_cast<size_t>(ModSource::COUNT)> sourceValues_;
     std::array<bool, static_cast<size_t>(ModSource::COUNT)> sourceEnabled_;
@@ -194,8 +240,20 @@ private:
     // Envelope followers
     std::array<EnvelopeFollower, 3> envelopeFollowers_;
     
-    // Macro definitions
-    std::map<ModSource, std::vector<std::pair<ModSource, float>>> macros_;
+    // Macro definitions: dense weights per macro over all sources
+    std::array<std::array<float, SOURCE_COUNT>, MACRO_COUNT> macroWeights_{};
+    std::array<bool, MACRO_COUNT> macroDefined_{};
+    
+    // Routing tables: the control thread fills back() and publishes it, the
+    // audio thread evaluates front()
+    TripleBuffer<RoutingTable> routing_;
+    
+    // Audio-thread evaluation state, preallocated per slot
+    std::array<float, MAX_SLOTS> smoothState_{};
+    std::array<uint32_t, MAX_SLOTS> smoothSlotId_{};   // Slot each smoothState_ entry belongs to
+    size_t smoothCount_ = 0;
+    std::array<float, DESTINATION_COUNT> modulation_{};
+    float sampleRate_ = SAMPLE_RATE;
     
     // Global settings
     float globalModAmount_ = 1.0f;
@@ -207,14 +265,20 @@ private:
     float lastUpdateTime_ = 0.0f;
     float updateInterval_ = 0.001f;   // 1ms default
     
+    // RANDOM source: per-instance xorshift state, resampled every 100ms
+    uint32_t randomState_ = 0x9E3779B9u;
+    float randomTimer_ = 0.0f;
+    
     // Audio analysis
     float audioLevel_ = 0.0f;
     float audioPitch_ = 440.0f;
     float audioBrightness_ = 0.5f;
     
     // Helper methods
+    static float nextRandom(uint32_t& state);   // Bipolar -1..+1, lock-free (no rand())
     uint32_t generateSlotId();
-    void updateMacros();
+    const RoutingTable& acquireRoutingTable();
+    void evaluateRouting(float deltaTime);
     void updateLFOs(float deltaTime);
     void updateAudioDerivedSources();
     void applyConditionalModulation(ModulationSlot& slot);
@@ -231,16 +295,6 @@ private:
     void analyzeAudioPitch(const EtherAudioBuffer& buffer);
     void analyzeAudioBrightness(const EtherAudioBuffer& buffer);
     
-    // Smoothing filters for responsive parameters
-    struct SmoothingFilter {
-        float value = 0.0f;
-        float target = 0.0f;
-        float smoothTime = 0.1f;
-        
-        float process(float input, float deltaTime);
-    };
-    
-    mutable std::map<uint32_t, SmoothingFilter> smoothingFilters_;
 };
 
 // Predefined modulation templates
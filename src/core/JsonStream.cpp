@@ -0,0 +1,523 @@
+#include "JsonStream.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+namespace {
+
+constexpr double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void appendUtf8(std::string& out, uint32_t codepoint) {
+    if (codepoint < 0x80) {
+        out += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codepoint >> 18));
+        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+// Writes scaled / 10^6 as a plain decimal without trailing zeros
+void appendMicros(std::string& out, int64_t scaled) {
+    char text[32];
+    char* end = text + sizeof(text);
+    char* p = end;
+    const bool negative = scaled < 0;
+    uint64_t magnitude = negative ? static_cast<uint64_t>(-scaled) : static_cast<uint64_t>(scaled);
+    uint64_t fraction = magnitude % 1000000;
+    uint64_t whole = magnitude / 1000000;
+
+    if (fraction != 0) {
+        int digits = 6;
+        while (fraction % 10 == 0) { fraction /= 10; --digits; }
+        for (int i = 0; i < digits; ++i) { *--p = static_cast<char>('0' + fraction % 10); fraction /= 10; }
+        *--p = '.';
+    }
+    do { *--p = static_cast<char>('0' + whole % 10); whole /= 10; } while (whole != 0);
+    if (negative) *--p = '-';
+    out.append(p, static_cast<size_t>(end - p));
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// JsonReader
+//-----------------------------------------------------------------------------
+
+JsonReader::JsonReader(const char* text, size_t length)
+    : begin_(text), pos_(text), end_(text + length) {}
+
+void JsonReader::skipWhitespace() {
+    while (pos_ < end_ && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t')) {
+        ++pos_;
+    }
+}
+
+bool JsonReader::fail() {
+    if (!error_) {
+        error_ = true;
+        errorOffset_ = static_cast<size_t>(pos_ - begin_);
+    }
+    return false;
+}
+
+bool JsonReader::expect(char c) {
+    skipWhitespace();
+    if (pos_ >= end_ || *pos_ != c) return fail();
+    ++pos_;
+    return true;
+}
+
+JsonReader::Type JsonReader::peek() {
+    if (error_) return Type::INVALID;
+    skipWhitespace();
+    if (pos_ >= end_) return Type::INVALID;
+    switch (*pos_) {
+        case '{': return Type::OBJECT;
+        case '[': return Type::ARRAY;
+        case '"': return Type::STRING;
+        case 't': case 'f': return Type::BOOL;
+        case 'n': return Type::NULL_VALUE;
+        default: return (*pos_ == '-' || isDigit(*pos_)) ? Type::NUMBER : Type::INVALID;
+    }
+}
+
+bool JsonReader::atEnd() {
+    skipWhitespace();
+    return !error_ && pos_ >= end_;
+}
+
+bool JsonReader::enter(char open) {
+    if (error_ || !expect(open)) return false;
+    if (depth_ + 1 >= MAX_DEPTH) return fail();
+    ++depth_;
+    first_ |= (1ull << depth_);
+    return true;
+}
+
+bool JsonReader::separator(char close) {
+    if (error_) return false;
+    skipWhitespace();
+    if (pos_ >= end_) return fail();
+    if (*pos_ == close) {
+        ++pos_;
+        first_ &= ~(1ull << depth_);
+        --depth_;
+        return false;
+    }
+    if (first_ & (1ull << depth_)) {
+        first_ &= ~(1ull << depth_);
+        return true;
+    }
+    return expect(',');
+}
+
+bool JsonReader::beginObject() { return enter('{'); }
+bool JsonReader::beginArray() { return enter('['); }
+
+bool JsonReader::nextMember(std::string_view& key) {
+    if (!separator('}')) return false;
+    skipWhitespace();
+    return parseString(key, keyScratch_) && expect(':');
+}
+
+bool JsonReader::nextElement() {
+    return separator(']');
+}
+
+bool JsonReader::parseString(std::string_view& out, std::string& scratch) {
+    if (error_) return false;
+    skipWhitespace();
+    if (pos_ >= end_ || *pos_ != '"') return fail();
+    const char* start = ++pos_;
+
+    // Fast path: no escapes, return a view into the input
+    while (pos_ < end_ && *pos_ != '"' && *pos_ != '\\') {
+        if (static_cast<unsigned char>(*pos_) < 0x20) return fail();
+        ++pos_;
+    }
+    if (pos_ >= end_) return fail();
+    if (*pos_ == '"') {
+        out = std::string_view(start, static_cast<size_t>(pos_ - start));
+        ++pos_;
+        return true;
+    }
+
+    scratch.assign(start, static_cast<size_t>(pos_ - start));
+    while (pos_ < end_ && *pos_ != '"') {
+        char c = *pos_++;
+        if (static_cast<unsigned char>(c) < 0x20) return fail();
+        if (c != '\\') {
+            scratch += c;
+            continue;
+        }
+        if (pos_ >= end_) return fail();
+        c = *pos_++;
+        switch (c) {
+            case '"': scratch += '"'; break;
+            case '\\': scratch += '\\'; break;
+            case '/': scratch += '/'; break;
+            case 'b': scratch += '\b'; break;
+            case 'f': scratch += '\f'; break;
+            case 'n': scratch += '\n'; break;
+            case 'r': scratch += '\r'; break;
+            case 't': scratch += '\t'; break;
+            case 'u': {
+                auto readHex = [&](uint32_t& value) {
+                    if (end_ - pos_ < 4) return false;
+                    value = 0;
+                    for (int i = 0; i < 4; ++i) {
+                        int digit = hexValue(*pos_++);
+                        if (digit < 0) return false;
+                        value = (value << 4) | static_cast<uint32_t>(digit);
+                    }
+                    return true;
+                };
+                uint32_t codepoint = 0;
+                if (!readHex(codepoint)) return fail();
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    uint32_t low = 0;
+                    if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') return fail();
+                    pos_ += 2;
+                    if (!readHex(low) || low < 0xDC00 || low > 0xDFFF) return fail();
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    return fail();
+                }
+                appendUtf8(scratch, codepoint);
+                break;
+            }
+            default:
+                return fail();
+        }
+    }
+    if (pos_ >= end_) return fail();
+    ++pos_;
+    out = scratch;
+    return true;
+}
+
+bool JsonReader::readString(std::string_view& value) {
+    return parseString(value, valueScratch_);
+}
+
+bool JsonReader::readString(std::string& value) {
+    std::string_view view;
+    if (!parseString(view, valueScratch_)) return false;
+    value.assign(view.data(), view.size());
+    return true;
+}
+
+bool JsonReader::readNumber(double& value) {
+    if (error_) return false;
+    skipWhitespace();
+    const char* p = pos_;
+    const bool negative = p < end_ && *p == '-';
+    if (negative) ++p;
+    if (p >= end_ || !isDigit(*p)) return fail();
+
+    // Up to 19 significant digits in an integer mantissa, the rest scale the exponent
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    if (*p == '0') {
+        ++p;
+    } else {
+        for (; p < end_ && isDigit(*p); ++p) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                ++digits;
+            } else {
+                ++exponent;
+            }
+        }
+    }
+    if (p < end_ && *p == '.') {
+        ++p;
+        if (p >= end_ || !isDigit(*p)) { pos_ = p; return fail(); }
+        for (; p < end_ && isDigit(*p); ++p) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                if (mantissa != 0) ++digits;
+                --exponent;
+            }
+        }
+    }
+    if (p < end_ && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExponent = false;
+        if (p < end_ && (*p == '+' || *p == '-')) negativeExponent = *p++ == '-';
+        if (p >= end_ || !isDigit(*p)) { pos_ = p; return fail(); }
+        int explicitExponent = 0;
+        for (; p < end_ && isDigit(*p); ++p) {
+            if (explicitExponent < 10000) explicitExponent = explicitExponent * 10 + (*p - '0');
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+    pos_ = p;
+
+    double result = static_cast<double>(mantissa);
+    if (exponent >= 0 && exponent <= 22) {
+        result *= POWERS_OF_TEN[exponent];
+    } else if (exponent < 0 && exponent >= -22) {
+        result /= POWERS_OF_TEN[-exponent];
+    } else if (mantissa != 0) {
+        result *= std::pow(10.0, exponent);
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+bool JsonReader::readFloat(float& value) {
+    double number = 0.0;
+    if (!readNumber(number)) return false;
+    value = static_cast<float>(number);
+    return true;
+}
+
+bool JsonReader::readInt(int64_t& value) {
+    double number = 0.0;
+    if (!readNumber(number)) return false;
+    if (number < static_cast<double>(std::numeric_limits<int64_t>::min()) ||
+        number > static_cast<double>(std::numeric_limits<int64_t>::max())) {
+        return fail();
+    }
+    value = static_cast<int64_t>(number);
+    return true;
+}
+
+bool JsonReader::readBool(bool& value) {
+    if (error_) return false;
+    skipWhitespace();
+    if (end_ - pos_ >= 4 && std::string_view(pos_, 4) == "true") {
+        pos_ += 4;
+        value = true;
+        return true;
+    }
+    if (end_ - pos_ >= 5 && std::string_view(pos_, 5) == "false") {
+        pos_ += 5;
+        value = false;
+        return true;
+    }
+    return fail();
+}
+
+bool JsonReader::skipValue() {
+    switch (peek()) {
+        case Type::OBJECT: {
+            if (!beginObject()) return false;
+            std::string_view key;
+            while (nextMember(key)) {
+                if (!skipValue()) return false;
+            }
+            return !error_;
+        }
+        case Type::ARRAY: {
+            if (!beginArray()) return false;
+            while (nextElement()) {
+                if (!skipValue()) return false;
+            }
+            return !error_;
+        }
+        case Type::STRING: {
+            std::string_view text;
+            return readString(text);
+        }
+        case Type::NUMBER: {
+            double number;
+            return readNumber(number);
+        }
+        case Type::BOOL: {
+            bool flag;
+            return readBool(flag);
+        }
+        case Type::NULL_VALUE:
+            if (end_ - pos_ >= 4 && std::string_view(pos_, 4) == "null") {
+                pos_ += 4;
+                return true;
+            }
+            return fail();
+        case Type::INVALID:
+            break;
+    }
+    return fail();
+}
+
+//-----------------------------------------------------------------------------
+// JsonWriter
+//-----------------------------------------------------------------------------
+
+JsonWriter::JsonWriter(std::string& out, int indent) : out_(out), indent_(indent) {}
+
+void JsonWriter::newline() {
+    out_ += '\n';
+    out_.append(static_cast<size_t>(depth_ * indent_), ' ');
+}
+
+void JsonWriter::beforeValue() {
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+    if (depth_ == 0) return;
+    const uint64_t bit = 1ull << depth_;
+    if (!(first_ & bit)) out_ += ',';
+    first_ &= ~bit;
+    if (inline_ & bit) {
+        if (out_.back() == ',') out_ += ' ';
+    } else {
+        newline();
+    }
+}
+
+void JsonWriter::beginObject() {
+    beforeValue();
+    out_ += '{';
+    ++depth_;
+    first_ |= (1ull << depth_);
+    inline_ &= ~(1ull << depth_);
+}
+
+void JsonWriter::endObject() {
+    const bool empty = first_ & (1ull << depth_);
+    --depth_;
+    if (!empty) newline();
+    out_ += '}';
+}
+
+void JsonWriter::beginArray(bool inlineItems) {
+    beforeValue();
+    out_ += '[';
+    ++depth_;
+    first_ |= (1ull << depth_);
+    if (inlineItems) {
+        inline_ |= (1ull << depth_);
+    } else {
+        inline_ &= ~(1ull << depth_);
+    }
+}
+
+void JsonWriter::endArray() {
+    const uint64_t bit = 1ull << depth_;
+    const bool empty = first_ & bit;
+    const bool isInline = inline_ & bit;
+    --depth_;
+    if (!empty && !isInline) newline();
+    out_ += ']';
+}
+
+void JsonWriter::key(std::string_view name) {
+    beforeValue();
+    appendEscaped(out_, name);
+    out_ += ": ";
+    afterKey_ = true;
+}
+
+void JsonWriter::value(std::string_view text) {
+    beforeValue();
+    appendEscaped(out_, text);
+}
+
+void JsonWriter::value(float number) {
+    beforeValue();
+    if (!std::isfinite(number)) {
+        out_ += "null";
+        return;
+    }
+    // Most parameter values are exact at six decimals; try that before printf
+    const double widened = number;
+    if (std::fabs(widened) < 1e9) {
+        const int64_t scaled = std::llround(widened * 1e6);
+        if (static_cast<float>(static_cast<double>(scaled) / 1e6) == number) {
+            appendMicros(out_, scaled);
+            return;
+        }
+    }
+    // Shortest of 6 or 9 significant digits that reads back exactly
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.6g", static_cast<double>(number));
+    if (std::strtof(text, nullptr) != number) {
+        std::snprintf(text, sizeof(text), "%.9g", static_cast<double>(number));
+    }
+    out_ += text;
+}
+
+void JsonWriter::value(double number) {
+    beforeValue();
+    if (!std::isfinite(number)) {
+        out_ += "null";
+        return;
+    }
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.15g", number);
+    if (std::strtod(text, nullptr) != number) {
+        std::snprintf(text, sizeof(text), "%.17g", number);
+    }
+    out_ += text;
+}
+
+void JsonWriter::value(int64_t number) {
+    beforeValue();
+    out_ += std::to_string(number);
+}
+
+void JsonWriter::value(uint64_t number) {
+    beforeValue();
+    out_ += std::to_string(number);
+}
+
+void JsonWriter::value(bool flag) {
+    beforeValue();
+    out_ += flag ? "true" : "false";
+}
+
+void JsonWriter::nullValue() {
+    beforeValue();
+    out_ += "null";
+}
+
+void JsonWriter::appendEscaped(std::string& out, std::string_view text) {
+    static const char hex[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += "\\u00";
+                    out += hex[(c >> 4) & 0xF];
+                    out += hex[c & 0xF];
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * JsonReader - Single-pass pull (SAX-style) JSON reader
+ *
+ * Walks the text once without building a tree. The caller steers: open an
+ * object, take members one at a time, read or skip each value. Strings
+ * without escapes are returned as views into the input. Escaped strings are
+ * decoded into a reused scratch buffer, so steady-state parsing does not
+ * allocate. The first syntax error stops the reader and records its offset.
+ *
+ * Features:
+ * - Strict JSON syntax (commas, nesting, literals) up to MAX_DEPTH levels
+ * - \uXXXX escapes, including surrogate pairs, decoded to UTF-8
+ * - Locale-independent number parsing
+ * - skipValue() for any subtree, so unknown keys cost one scan
+ */
+class JsonReader {
+public:
+    enum class Type { OBJECT, ARRAY, STRING, NUMBER, BOOL, NULL_VALUE, INVALID };
+    static constexpr int MAX_DEPTH = 64;
+
+    JsonReader(const char* text, size_t length);
+    explicit JsonReader(std::string_view text) : JsonReader(text.data(), text.size()) {}
+
+    Type peek();                                // Type of the next value
+
+    bool beginObject();
+    bool nextMember(std::string_view& key);     // false once the object closes (or on error)
+    bool beginArray();
+    bool nextElement();                         // false once the array closes (or on error)
+
+    // Values. Views stay valid until the next key (for keys) or value (for values)
+    bool readString(std::string_view& value);
+    bool readString(std::string& value);
+    bool readNumber(double& value);
+    bool readFloat(float& value);
+    bool readInt(int64_t& value);
+    bool readBool(bool& value);
+    bool skipValue();
+
+    bool hasError() const { return error_; }
+    size_t getErrorOffset() const { return errorOffset_; }
+    bool atEnd();                               // Only whitespace remains
+
+private:
+    const char* begin_;
+    const char* pos_;
+    const char* end_;
+    int depth_ = 0;
+    uint64_t first_ = 0;                        // Bit per depth: no member/element read yet
+    bool error_ = false;
+    size_t errorOffset_ = 0;
+    std::string keyScratch_;
+    std::string valueScratch_;
+
+    void skipWhitespace();
+    bool fail();
+    bool expect(char c);
+    bool parseString(std::string_view& out, std::string& scratch);
+    bool enter(char open);
+    bool separator(char close);                 // Comma between items, or the closing bracket
+};
+
+/**
+ * JsonWriter - Streaming JSON writer
+ *
+ * Appends straight to a string with commas, indentation and escaping handled
+ * as it goes. Floats are written in the shortest form that reads back to the
+ * same value.
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out, int indent = 2);
+
+    void beginObject();
+    void endObject();
+    void beginArray(bool inlineItems = false);  // inlineItems: ["a", "b"] on one line
+    void endArray();
+
+    void key(std::string_view name);
+    void value(std::string_view text);
+    void value(const char* text) { value(std::string_view(text)); }
+    void value(const std::string& text) { value(std::string_view(text)); }
+    void value(float number);
+    void value(double number);
+    void value(int number) { value(static_cast<int64_t>(number)); }
+    void value(int64_t number);
+    void value(uint64_t number);
+    void value(bool flag);
+    void nullValue();
+
+    template<typename T>
+    void member(std::string_view name, const T& v) { key(name); value(v); }
+
+    static void appendEscaped(std::string& out, std::string_view text);
+
+private:
+    std::string& out_;
+    int indent_;
+    int depth_ = 0;
+    uint64_t first_ = 0;                        // Bit per depth
+    uint64_t inline_ = 0;                       // Bit per depth
+    bool afterKey_ = false;
+
+    void beforeValue();
+    void newline();
+};
+
+/**
+ * JsonKeyMap - Compile-time perfect hash from JSON keys to integer ids
+ *
+ * The seed is searched for during constant evaluation, so every key gets its
+ * own slot. A lookup is one hash, one slot read and one string compare. Build
+ * one with makeJsonKeyMap() in a constexpr variable.
+ */
+struct JsonKey {
+    const char* name;
+    int id;
+};
+
+namespace JsonDetail {
+
+constexpr uint32_t hashKey(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : key) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+constexpr size_t tableSizeFor(size_t keys) {
+    size_t size = 8;
+    while (size < keys * 4) size <<= 1;
+    return size;
+}
+
+} // namespace JsonDetail
+
+template<size_t N>
+class JsonKeyMap {
+public:
+    static constexpr size_t TABLE_SIZE = JsonDetail::tableSizeFor(N);
+    static constexpr int NOT_FOUND = -1;
+
+    constexpr explicit JsonKeyMap(const JsonKey (&keys)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            names_[i] = keys[i].name;
+            ids_[i] = keys[i].id;
+        }
+        for (uint32_t seed = 0; seed < 100000; ++seed) {
+            if (tryFill(seed)) {
+                seed_ = seed;
+                return;
+            }
+        }
+        throw "JsonKeyMap: no perfect hash seed (duplicate key?)";
+    }
+
+    constexpr int find(std::string_view key) const {
+        const int16_t slot = slots_[JsonDetail::hashKey(key, seed_) & (TABLE_SIZE - 1)];
+        return slot >= 0 && names_[slot] == key ? ids_[slot] : NOT_FOUND;
+    }
+
+    constexpr size_t size() const { return N; }
+    constexpr std::string_view nameAt(size_t i) const { return names_[i]; }
+    constexpr int idAt(size_t i) const { return ids_[i]; }
+
+private:
+    std::array<std::string_view, N> names_{};
+    std::array<int, N> ids_{};
+    std::array<int16_t, TABLE_SIZE> slots_{};
+    uint32_t seed_ = 0;
+
+    constexpr bool tryFill(uint32_t seed) {
+        for (size_t s = 0; s < TABLE_SIZE; ++s) slots_[s] = -1;
+        for (size_t i = 0; i < N; ++i) {
+            const size_t slot = JsonDetail::hashKey(names_[i], seed) & (TABLE_SIZE - 1);
+            if (slots_[slot] >= 0) return false;
+            slots_[slot] = static_cast<int16_t>(i);
+        }
+        return true;
+    }
+};
+
+template<size_t N>
+constexpr JsonKeyMap<N> makeJsonKeyMap(const JsonKey (&keys)[N]) {
+    return JsonKeyMap<N>(keys);
+}
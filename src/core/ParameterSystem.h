@@ -9,6 +9,8 @@
 #include <functional>
 #include <vector>
 
+class JsonReader;
+
 /**
  * UnifiedParameterSystem - Central parameter management for EtherSynth
  * 
@@ -168,8 +170,8 @@ public:
     bool deserializeFromJSON(const std::string& json);
     
     // JSON parsing helpers (private methods made public for separate implementation)
-    void parseParameterSection(const std::string& sectionContent);
-    void parseVelocityConfig(const std::string& jsonStr);
+    void parseParameterSection(JsonReader& reader);
+    void parseVelocityConfig(JsonReader& reader);
     
     // Parameter automation and recording
     void enableParameterAutomation(ParameterID id, bool enabled);
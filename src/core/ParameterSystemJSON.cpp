@@ -1,6 +1,6 @@
 #include "ParameterSystem.h"
-#include <sstream>
-#include <iomanip>
+#include "JsonStream.h"
+#include <cmath>
 #include <ctime>
 
 /**
@@ -9,79 +9,53 @@
  */
 
 namespace {
-    // Helper function to escape JSON strings
-    std::string escapeJSON(const std::string& str) {
-        std::stringstream escaped;
-        for (char c : str) {
-            switch (c) {
-                case '"': escaped << "\\\""; break;
-                case '\\': escaped << "\\\\"; break;
-                case '\b': escaped << "\\b"; break;
-                case '\f': escaped << "\\f"; break;
-                case '\n': escaped << "\\n"; break;
-                case '\r': escaped << "\\r"; break;
-                case '\t': escaped << "\\t"; break;
-                default:
-                    if (c < 32) {
-                        escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
-                    } else {
-                        escaped << c;
-                    }
-                    break;
-            }
-        }
-        return escaped.str();
-    }
-    
-    // Map ParameterID to legacy JSON parameter names
-    std::unordered_map<ParameterID, std::string> parameterToJSONName = {
-        {ParameterID::HARMONICS, "harmonics"},
-        {ParameterID::TIMBRE, "timbre"},
-        {ParameterID::MORPH, "morph"},
-        {ParameterID::OSC_MIX, "osc_mix"},
-        {ParameterID::DETUNE, "detune"},
-        {ParameterID::FILTER_CUTOFF, "filter_cutoff"},
-        {ParameterID::FILTER_RESONANCE, "filter_resonance"},
-        {ParameterID::FILTER_TYPE, "filter_type"},
-        {ParameterID::ATTACK, "env_attack"},
-        {ParameterID::DECAY, "env_decay"},
-        {ParameterID::SUSTAIN, "amp_sustain"},
-        {ParameterID::RELEASE, "env_release"},
-        {ParameterID::LFO_RATE, "lfo_rate"},
-        {ParameterID::LFO_DEPTH, "lfo_depth"},
-        {ParameterID::LFO_SHAPE, "lfo_shape"},
-        {ParameterID::REVERB_SIZE, "reverb_size"},
-        {ParameterID::REVERB_DAMPING, "reverb_damping"},
-        {ParameterID::REVERB_MIX, "reverb_mix"},
-        {ParameterID::DELAY_TIME, "delay_time"},
-        {ParameterID::DELAY_FEEDBACK, "delay_feedback"},
-        {ParameterID::VOLUME, "volume"},
-        {ParameterID::PAN, "pan"}
+    // Legacy JSON parameter names, resolved through a compile-time perfect hash
+    constexpr JsonKey kParameterKeys[] = {
+        {"harmonics", static_cast<int>(ParameterID::HARMONICS)},
+        {"timbre", static_cast<int>(ParameterID::TIMBRE)},
+        {"morph", static_cast<int>(ParameterID::MORPH)},
+        {"osc_mix", static_cast<int>(ParameterID::OSC_MIX)},
+        {"detune", static_cast<int>(ParameterID::DETUNE)},
+        {"filter_cutoff", static_cast<int>(ParameterID::FILTER_CUTOFF)},
+        {"filter_resonance", static_cast<int>(ParameterID::FILTER_RESONANCE)},
+        {"filter_type", static_cast<int>(ParameterID::FILTER_TYPE)},
+        {"env_attack", static_cast<int>(ParameterID::ATTACK)},
+        {"env_decay", static_cast<int>(ParameterID::DECAY)},
+        {"amp_sustain", static_cast<int>(ParameterID::SUSTAIN)},
+        {"env_release", static_cast<int>(ParameterID::RELEASE)},
+        {"lfo_rate", static_cast<int>(ParameterID::LFO_RATE)},
+        {"lfo_depth", static_cast<int>(ParameterID::LFO_DEPTH)},
+        {"lfo_shape", static_cast<int>(ParameterID::LFO_SHAPE)},
+        {"reverb_size", static_cast<int>(ParameterID::REVERB_SIZE)},
+        {"reverb_damping", static_cast<int>(ParameterID::REVERB_DAMPING)},
+        {"reverb_mix", static_cast<int>(ParameterID::REVERB_MIX)},
+        {"delay_time", static_cast<int>(ParameterID::DELAY_TIME)},
+        {"delay_feedback", static_cast<int>(ParameterID::DELAY_FEEDBACK)},
+        {"volume", static_cast<int>(ParameterID::VOLUME)},
+        {"pan", static_cast<int>(ParameterID::PAN)}
     };
-    
-    // Reverse mapping for deserialization
-    std::unordered_map<std::string, ParameterID> jsonNameToParameter;
-    
-    void initializeJSONMapping() {
-        static bool initialized = false;
-        if (initialized) return;
-        
-        for (const auto& [paramId, jsonName] : parameterToJSONName) {
-            jsonNameToParameter[jsonName] = paramId;
+    constexpr auto kParameterMap = makeJsonKeyMap(kParameterKeys);
+
+    // Top-level sections the deserializer acts on
+    enum class Section { HOLD_PARAMS, TWIST_PARAMS, FX_PARAMS, VELOCITY_CONFIG };
+    constexpr JsonKey kSectionKeys[] = {
+        {"hold_params", static_cast<int>(Section::HOLD_PARAMS)},
+        {"twist_params", static_cast<int>(Section::TWIST_PARAMS)},
+        {"fx_params", static_cast<int>(Section::FX_PARAMS)},
+        {"velocity_config", static_cast<int>(Section::VELOCITY_CONFIG)}
+    };
+    constexpr auto kSectionMap = makeJsonKeyMap(kSectionKeys);
+
+    std::string_view parameterIDToJSON(ParameterID id) {
+        for (size_t i = 0; i < kParameterMap.size(); ++i) {
+            if (kParameterMap.idAt(i) == static_cast<int>(id)) return kParameterMap.nameAt(i);
         }
-        initialized = true;
-    }
-    
-    std::string parameterIDToJSON(ParameterID id) {
-        initializeJSONMapping();
-        auto it = parameterToJSONName.find(id);
-        return (it != parameterToJSONName.end()) ? it->second : "unknown";
+        return {};
     }
     
-    ParameterID jsonToParameterID(const std::string& jsonName) {
-        initializeJSONMapping();
-        auto it = jsonNameToParameter.find(jsonName);
-        return (it != jsonNameToParameter.end()) ? it->second : ParameterID::COUNT;
+    ParameterID jsonToParameterID(std::string_view jsonName) {
+        const int id = kParameterMap.find(jsonName);
+        return id == kParameterMap.NOT_FOUND ? ParameterID::COUNT : static_cast<ParameterID>(id);
     }
     
     // Get current timestamp
@@ -96,149 +70,137 @@ std::string UnifiedParameterSystem::serializeToJSON() const {
         return "";
     }
     
-    std::stringstream json;
+    std::string out;
+    out.reserve(4096);
+    JsonWriter json(out);
     std::lock_guard<std::mutex> lock(configMutex_);
     
-    json << std::fixed << std::setprecision(3);
-    json << "{\n";
+    json.beginObject();
     
     // Schema version for compatibility
-    json << "  \"schema_version\": \"2.0\",\n";
+    json.member("schema_version", "2.0");
     
     // Preset info section
-    json << "  \"preset_info\": {\n";
-    json << "    \"name\": \"Generated Preset\",\n";
-    json << "    \"description\": \"Generated from UnifiedParameterSystem\",\n";
-    json << "    \"author\": \"EtherSynth\",\n";
-    json << "    \"engine_type\": 0,\n";
-    json << "    \"category\": 0,\n";
-    json << "    \"creation_time\": " << getCurrentTimestamp() << ",\n";
-    json << "    \"modification_time\": " << getCurrentTimestamp() << ",\n";
-    json << "    \"tags\": [\"generated\", \"unified\"]\n";
-    json << "  },\n";
+    json.key("preset_info");
+    json.beginObject();
+    json.member("name", "Generated Preset");
+    json.member("description", "Generated from UnifiedParameterSystem");
+    json.member("author", "EtherSynth");
+    json.member("engine_type", 0);
+    json.member("category", 0);
+    json.member("creation_time", getCurrentTimestamp());
+    json.member("modification_time", getCurrentTimestamp());
+    json.key("tags");
+    json.beginArray(true);
+    json.value("generated");
+    json.value("unified");
+    json.endArray();
+    json.endObject();
+    
+    auto writeValue = [&](ParameterID paramId) {
+        std::string_view jsonName = parameterIDToJSON(paramId);
+        if (jsonName.empty()) return;
+        json.member(jsonName, globalParameters_[static_cast<size_t>(paramId)].load(std::memory_order_relaxed));
+    };
     
     // Hold params (main synthesis parameters)
-    json << "  \"hold_params\": {\n";
-    bool first = true;
+    json.key("hold_params");
+    json.beginObject();
     for (const auto& [paramId, config] : parameterConfigs_) {
         if (config.isGlobalParameter) continue; // Skip global params for hold_params
-        
-        std::string jsonName = parameterIDToJSON(paramId);
-        if (jsonName == "unknown") continue;
-        
-        float value = globalParameters_[static_cast<size_t>(paramId)].load(std::memory_order_relaxed);
-        
-        if (!first) json << ",\n";
-        json << "    \"" << jsonName << "\": " << value;
-        first = false;
+        writeValue(paramId);
     }
-    json << "\n  },\n";
+    json.endObject();
     
     // Twist params (modulation and envelope parameters)
-    json << "  \"twist_params\": {\n";
-    first = true;
-    std::vector<ParameterID> twistParams = {
+    json.key("twist_params");
+    json.beginObject();
+    static constexpr ParameterID twistParams[] = {
         ParameterID::ATTACK, ParameterID::DECAY, ParameterID::RELEASE,
         ParameterID::LFO_RATE, ParameterID::LFO_DEPTH, ParameterID::DETUNE
     };
-    
     for (ParameterID paramId : twistParams) {
-        if (parameterConfigs_.find(paramId) == parameterConfigs_.end()) continue;
-        
-        std::string jsonName = parameterIDToJSON(paramId);
-        if (jsonName == "unknown") continue;
-        
-        float value = globalParameters_[static_cast<size_t>(paramId)].load(std::memory_order_relaxed);
-        
-        if (!first) json << ",\n";
-        json << "    \"" << jsonName << "\": " << value;
-        first = false;
+        if (parameterConfigs_.find(paramId) != parameterConfigs_.end()) writeValue(paramId);
     }
-    json << "\n  },\n";
+    json.endObject();
     
     // Morph params (advanced parameters)
-    json << "  \"morph_params\": {\n";
-    json << "    \"stereo_spread\": 0.0,\n";
-    json << "    \"chorus_depth\": 0.0,\n";
-    json << "    \"unison_voices\": 0.0,\n";
-    json << "    \"unison_detune\": 0.0,\n";
-    json << "    \"analog_drift\": 0.0,\n";
-    json << "    \"filter_tracking\": 1.0\n";
-    json << "  },\n";
+    json.key("morph_params");
+    json.beginObject();
+    json.member("stereo_spread", 0.0f);
+    json.member("chorus_depth", 0.0f);
+    json.member("unison_voices", 0.0f);
+    json.member("unison_detune", 0.0f);
+    json.member("analog_drift", 0.0f);
+    json.member("filter_tracking", 1.0f);
+    json.endObject();
     
     // Macro assignments (placeholder - could be extended)
-    json << "  \"macro_assignments\": {\n";
-    json << "    \"macro_1\": { \"parameter\": \"filter_cutoff\", \"amount\": 0.8, \"enabled\": true },\n";
-    json << "    \"macro_2\": { \"parameter\": \"reverb_size\", \"amount\": 0.6, \"enabled\": true },\n";
-    json << "    \"macro_3\": { \"parameter\": \"lfo_depth\", \"amount\": 0.7, \"enabled\": true },\n";
-    json << "    \"macro_4\": { \"parameter\": \"env_attack\", \"amount\": 0.5, \"enabled\": true }\n";
-    json << "  },\n";
+    json.key("macro_assignments");
+    json.beginObject();
+    static constexpr std::pair<const char*, float> macros[] = {
+        {"filter_cutoff", 0.8f}, {"reverb_size", 0.6f}, {"lfo_depth", 0.7f}, {"env_attack", 0.5f}
+    };
+    for (size_t m = 0; m < 4; ++m) {
+        json.key("macro_" + std::to_string(m + 1));
+        json.beginObject();
+        json.member("parameter", macros[m].first);
+        json.member("amount", macros[m].second);
+        json.member("enabled", true);
+        json.endObject();
+    }
+    json.endObject();
     
     // FX params
-    json << "  \"fx_params\": {\n";
-    first = true;
-    std::vector<ParameterID> fxParams = {
+    json.key("fx_params");
+    json.beginObject();
+    static constexpr ParameterID fxParams[] = {
         ParameterID::REVERB_SIZE, ParameterID::REVERB_DAMPING, ParameterID::REVERB_MIX,
         ParameterID::DELAY_TIME, ParameterID::DELAY_FEEDBACK
     };
-    
     for (ParameterID paramId : fxParams) {
-        if (parameterConfigs_.find(paramId) == parameterConfigs_.end()) continue;
-        
-        std::string jsonName = parameterIDToJSON(paramId);
-        if (jsonName == "unknown") continue;
-        
-        float value = globalParameters_[static_cast<size_t>(paramId)].load(std::memory_order_relaxed);
-        
-        if (!first) json << ",\n";
-        json << "    \"" << jsonName << "\": " << value;
-        first = false;
+        if (parameterConfigs_.find(paramId) != parameterConfigs_.end()) writeValue(paramId);
     }
     // Add some default FX params
-    if (!first) json << ",\n";
-    json << "    \"chorus_rate\": 0.3,\n";
-    json << "    \"chorus_feedback\": 0.2,\n";
-    json << "    \"tape_saturation\": 0.1\n";
-    json << "  },\n";
+    json.member("chorus_rate", 0.3f);
+    json.member("chorus_feedback", 0.2f);
+    json.member("tape_saturation", 0.1f);
+    json.endObject();
     
     // Velocity configuration
-    json << "  \"velocity_config\": {\n";
-    json << "    \"enable_velocity_to_volume\": true,\n";
-    json << "    \"velocity_mappings\": {\n";
-    first = true;
+    json.key("velocity_config");
+    json.beginObject();
+    json.member("enable_velocity_to_volume", true);
+    json.key("velocity_mappings");
+    json.beginObject();
     
     // Include parameters that have velocity scaling enabled
     for (const auto& [paramId, config] : parameterConfigs_) {
         if (!config.enableVelocityScaling || config.velocityScale <= 0.0f) continue;
-        
-        std::string jsonName = parameterIDToJSON(paramId);
-        if (jsonName == "unknown") continue;
-        
-        if (!first) json << ",\n";
-        json << "      \"" << jsonName << "\": " << config.velocityScale;
-        first = false;
+        std::string_view jsonName = parameterIDToJSON(paramId);
+        if (!jsonName.empty()) json.member(jsonName, config.velocityScale);
     }
-    
-    json << "\n    }\n";
-    json << "  },\n";
+    json.endObject();
+    json.endObject();
     
     // Performance settings
-    json << "  \"performance\": {\n";
-    json << "    \"morph_transition_time\": 200,\n";
-    json << "    \"enable_parameter_smoothing\": true,\n";
-    json << "    \"parameter_smoothing_time\": 50\n";
-    json << "  },\n";
+    json.key("performance");
+    json.beginObject();
+    json.member("morph_transition_time", 200);
+    json.member("enable_parameter_smoothing", true);
+    json.member("parameter_smoothing_time", 50);
+    json.endObject();
     
     // Extended unified parameter system info
-    json << "  \"unified_system_info\": {\n";
-    json << "    \"parameter_count\": " << parameterConfigs_.size() << ",\n";
-    json << "    \"active_smoothers\": " << getActiveSmootherCount() << ",\n";
-    json << "    \"system_version\": \"1.0\"\n";
-    json << "  }\n";
-    
-    json << "}";
-    
-    return json.str();
+    json.key("unified_system_info");
+    json.beginObject();
+    json.member("parameter_count", static_cast<uint64_t>(parameterConfigs_.size()));
+    json.member("active_smoothers", static_cast<uint64_t>(getActiveSmootherCount()));
+    json.member("system_version", "1.0");
+    json.endObject();
+    
+    json.endObject();
+    return out;
 }
 
 bool UnifiedParameterSystem::deserializeFromJSON(const std::string& jsonStr) {
@@ -247,170 +209,115 @@ bool UnifiedParameterSystem::deserializeFromJSON(const std::string& jsonStr) {
         return false;
     }
     
-    // For now, implement a simple parser for the key sections
-    // In a production system, you'd want to use a proper JSON library like nlohmann/json
-    
-    try {
-        std::lock_guard<std::mutex> lock(configMutex_);
-        
-        // Simple JSON parsing - look for parameter sections
-        size_t pos = 0;
-        
-        // Parse hold_params
-        pos = jsonStr.find("\"hold_params\"");
-        if (pos != std::string::npos) {
-            size_t startBrace = jsonStr.find('{', pos);
-            size_t endBrace = jsonStr.find('}', startBrace);
-            if (startBrace != std::string::npos && endBrace != std::string::npos) {
-                parseParameterSection(jsonStr.substr(startBrace + 1, endBrace - startBrace - 1));
-            }
-        }
-        
-        // Parse twist_params
-        pos = jsonStr.find("\"twist_params\"");
-        if (pos != std::string::npos) {
-            size_t startBrace = jsonStr.find('{', pos);
-            size_t endBrace = jsonStr.find('}', startBrace);
-            if (startBrace != std::string::npos && endBrace != std::string::npos) {
-                parseParameterSection(jsonStr.substr(startBrace + 1, endBrace - startBrace - 1));
-            }
-        }
-        
-        // Parse fx_params
-        pos = jsonStr.find("\"fx_params\"");
-        if (pos != std::string::npos) {
-            size_t startBrace = jsonStr.find('{', pos);
-            size_t endBrace = jsonStr.find('}', startBrace);
-            if (startBrace != std::string::npos && endBrace != std::string::npos) {
-                parseParameterSection(jsonStr.substr(startBrace + 1, endBrace - startBrace - 1));
+    // One pass over the document; sections we don't act on are skipped whole
+    std::lock_guard<std::mutex> lock(configMutex_);
+    JsonReader reader(jsonStr);
+    std::string_view key;
+    
+    if (reader.beginObject()) {
+        while (reader.nextMember(key)) {
+            switch (static_cast<Section>(kSectionMap.find(key))) {
+                case Section::HOLD_PARAMS:
+                case Section::TWIST_PARAMS:
+                case Section::FX_PARAMS:
+                    parseParameterSection(reader);
+                    break;
+                case Section::VELOCITY_CONFIG:
+                    parseVelocityConfig(reader);
+                    break;
+                default:
+                    reader.skipValue();
+                    break;
             }
         }
-        
-        // Parse velocity_config
-        parseVelocityConfig(jsonStr);
-        
-        return true;
-        
-    } catch (const std::exception& e) {
-        updateLastError("JSON parsing error: " + std::string(e.what()));
+    }
+    
+    if (reader.hasError()) {
+        updateLastError("JSON parsing error at offset " + std::to_string(reader.getErrorOffset()));
         return false;
     }
+    return true;
 }
 
-void UnifiedParameterSystem::parseParameterSection(const std::string& sectionContent) {
-    // Simple parameter parsing
-    std::istringstream stream(sectionContent);
-    std::string line;
+void UnifiedParameterSystem::parseParameterSection(JsonReader& reader) {
+    if (reader.peek() != JsonReader::Type::OBJECT) {
+        reader.skipValue();
+        return;
+    }
     
-    while (std::getline(stream, line)) {
-        // Remove whitespace
-        line.erase(0, line.find_first_not_of(" \t\n\r"));
-        line.erase(line.find_last_not_of(" \t\n\r") + 1);
+    reader.beginObject();
+    std::string_view paramName;
+    while (reader.nextMember(paramName)) {
+        ParameterID paramId = jsonToParameterID(paramName);
+        float value = 0.0f;
+        
+        // Skip unknown names and non-numeric values
+        if (paramId == ParameterID::COUNT || reader.peek() != JsonReader::Type::NUMBER) {
+            reader.skipValue();
+            continue;
+        }
+        if (!reader.readFloat(value)) return;
         
-        if (line.empty() || line[0] == ',' || line[0] == '}') continue;
+        // Set parameter value directly in atomic storage
+        globalParameters_[static_cast<size_t>(paramId)].store(value, std::memory_order_relaxed);
         
-        // Look for "parameter_name": value pattern
-        size_t colonPos = line.find(':');
-        size_t firstQuote = line.find('"');
-        size_t secondQuote = line.find('"', firstQuote + 1);
+        // Update parameter value record
+        auto valueIt = parameterValues_.find(paramId);
+        if (valueIt != parameterValues_.end()) {
+            valueIt->second.value = value;
+            valueIt->second.rawValue = value;
+            valueIt->second.targetValue = value;
+            valueIt->second.hasBeenSet = true;
+            valueIt->second.lastUpdateTime = std::chrono::steady_clock::now().time_since_epoch().count();
+        }
         
-        if (colonPos != std::string::npos && firstQuote != std::string::npos && secondQuote != std::string::npos) {
-            std::string paramName = line.substr(firstQuote + 1, secondQuote - firstQuote - 1);
-            
-            // Extract value after colon
-            std::string valueStr = line.substr(colonPos + 1);
-            valueStr.erase(0, valueStr.find_first_not_of(" \t"));
-            
-            // Remove trailing comma if present
-            if (!valueStr.empty() && valueStr.back() == ',') {
-                valueStr.pop_back();
-            }
-            
-            try {
-                float value = std::stof(valueStr);
-                ParameterID paramId = jsonToParameterID(paramName);
-                
-                if (paramId != ParameterID::COUNT) {
-                    // Set parameter value directly in atomic storage
-                    globalParameters_[static_cast<size_t>(paramId)].store(value, std::memory_order_relaxed);
-                    
-                    // Update parameter value record
-                    if (parameterValues_.find(paramId) != parameterValues_.end()) {
-                        parameterValues_[paramId].value = value;
-                        parameterValues_[paramId].rawValue = value;
-                        parameterValues_[paramId].targetValue = value;
-                        parameterValues_[paramId].hasBeenSet = true;
-                        parameterValues_[paramId].lastUpdateTime = std::chrono::steady_clock::now().time_since_epoch().count();
-                    }
-                    
-                    // Update smoother target if smoothing is enabled
-                    if (globalSmoothers_.find(paramId) != globalSmoothers_.end()) {
-                        globalSmoothers_[paramId]->setValue(value);
-                    }
-                }
-            } catch (const std::exception&) {
-                // Skip invalid values
-                continue;
-            }
+        // Update smoother target if smoothing is enabled
+        auto smootherIt = globalSmoothers_.find(paramId);
+        if (smootherIt != globalSmoothers_.end()) {
+            smootherIt->second->setValue(value);
         }
     }
 }
 
-void UnifiedParameterSystem::parseVelocityConfig(const std::string& jsonStr) {
-    // Parse velocity_mappings section
-    size_t velocityPos = jsonStr.find("\"velocity_mappings\"");
-    if (velocityPos == std::string::npos) return;
-    
-    size_t startBrace = jsonStr.find('{', velocityPos);
-    size_t endBrace = jsonStr.find('}', startBrace);
-    if (startBrace == std::string::npos || endBrace == std::string::npos) return;
-    
-    std::string mappingsContent = jsonStr.substr(startBrace + 1, endBrace - startBrace - 1);
-    
-    // Parse velocity mappings
-    std::istringstream stream(mappingsContent);
-    std::string line;
+void UnifiedParameterSystem::parseVelocityConfig(JsonReader& reader) {
+    if (reader.peek() != JsonReader::Type::OBJECT) {
+        reader.skipValue();
+        return;
+    }
     
-    while (std::getline(stream, line)) {
-        // Remove whitespace
-        line.erase(0, line.find_first_not_of(" \t\n\r"));
-        line.erase(line.find_last_not_of(" \t\n\r") + 1);
-        
-        if (line.empty() || line[0] == ',' || line[0] == '}') continue;
-        
-        size_t colonPos = line.find(':');
-        size_t firstQuote = line.find('"');
-        size_t secondQuote = line.find('"', firstQuote + 1);
+    reader.beginObject();
+    std::string_view key;
+    while (reader.nextMember(key)) {
+        // Parse velocity_mappings section
+        if (key != "velocity_mappings" || reader.peek() != JsonReader::Type::OBJECT) {
+            reader.skipValue();
+            continue;
+        }
         
-        if (colonPos != std::string::npos && firstQuote != std::string::npos && secondQuote != std::string::npos) {
-            std::string paramName = line.substr(firstQuote + 1, secondQuote - firstQuote - 1);
+        reader.beginObject();
+        std::string_view paramName;
+        while (reader.nextMember(paramName)) {
+            ParameterID paramId = jsonToParameterID(paramName);
+            auto configIt = paramId != ParameterID::COUNT ? parameterConfigs_.find(paramId) : parameterConfigs_.end();
+            float velocityScale = 0.0f;
             
-            std::string valueStr = line.substr(colonPos + 1);
-            valueStr.erase(0, valueStr.find_first_not_of(" \t"));
-            if (!valueStr.empty() && valueStr.back() == ',') {
-                valueStr.pop_back();
+            if (configIt == parameterConfigs_.end() || reader.peek() != JsonReader::Type::NUMBER) {
+                reader.skipValue();
+                continue;
             }
+            if (!reader.readFloat(velocityScale)) return;
             
-            try {
-                float velocityScale = std::stof(valueStr);
-                ParameterID paramId = jsonToParameterID(paramName);
-                
-                if (paramId != ParameterID::COUNT && parameterConfigs_.find(paramId) != parameterConfigs_.end()) {
-                    // Update velocity scaling configuration
-                    auto& config = parameterConfigs_[paramId];
-                    config.velocityScale = std::abs(velocityScale); // Use absolute value
-                    config.enableVelocityScaling = (config.velocityScale > 0.0f);
-                    
-                    // If velocity scaling integration is available, update it too
-                    if (velocityScaling_) {
-                        VelocityParameterScaling::ParameterScalingConfig velConfig;
-                        velConfig.category = config.velocityCategory;
-                        velConfig.velocityScale = config.velocityScale;
-                        velocityScaling_->setParameterScaling(static_cast<uint32_t>(paramId), velConfig);
-                    }
-                }
-            } catch (const std::exception&) {
-                continue;
+            // Update velocity scaling configuration
+            auto& config = configIt->second;
+            config.velocityScale = std::abs(velocityScale); // Use absolute value
+            config.enableVelocityScaling = (config.velocityScale > 0.0f);
+            
+            // If velocity scaling integration is available, update it too
+            if (velocityScaling_) {
+                VelocityParameterScaling::ParameterScalingConfig velConfig;
+                velConfig.category = config.velocityCategory;
+                velConfig.velocityScale = config.velocityScale;
+                velocityScaling_->setParameterScaling(static_cast<uint32_t>(paramId), velConfig);
             }
         }
     }
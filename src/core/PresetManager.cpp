@@ -1,10 +1,197 @@
 #include "PresetManager.h"
+#include "../storage/presets/PresetContainer.h"
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+using Section = PresetContainer::SectionType;
+
+// EFFECTS section ids
+enum EffectsField : uint32_t {
+    FX_REVERB_ENABLED, FX_REVERB_SIZE, FX_REVERB_MIX,
+    FX_DELAY_ENABLED, FX_DELAY_TIME, FX_DELAY_FEEDBACK, FX_DELAY_MIX,
+    FX_CHORUS_ENABLED, FX_CHORUS_RATE, FX_CHORUS_DEPTH, FX_CHORUS_MIX
+};
+
+std::string formatFloat(float value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.9g", static_cast<double>(value));
+    return text;
+}
+
+std::vector<PresetParam> toParams(const std::map<ParameterID, float>& parameters) {
+    std::vector<PresetParam> params;
+    params.reserve(parameters.size());
+    for (const auto& entry : parameters) {
+        params.push_back({static_cast<uint32_t>(entry.first), entry.second});
+    }
+    return params;
+}
+
+bool readParameterMap(const PresetContainer& container, std::map<ParameterID, float>& parameters) {
+    parameters.clear();
+    int section = container.findSection(Section::ENGINE_PARAMS);
+    if (section < 0) return true;
+    const PresetParam* params = nullptr;
+    size_t count = 0;
+    if (!container.readParams(section, params, count)) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (params[i].id < static_cast<uint32_t>(ParameterID::COUNT)) {
+            parameters[static_cast<ParameterID>(params[i].id)] = params[i].value;
+        }
+    }
+    return true;
+}
+
+bool readEngineData(const PresetContainer& container, std::vector<uint8_t>& engineData) {
+    engineData.clear();
+    int section = container.findSection(Section::ENGINE_DATA);
+    if (section < 0) return true;
+    const uint8_t* data = nullptr;
+    size_t bytes = 0;
+    if (!container.readRaw(section, data, bytes)) return false;
+    engineData.assign(data, data + bytes);
+    return true;
+}
+
+void encodePreset(const PresetManager::Preset& preset, PresetContainerWriter& writer) {
+    std::string multiParameters;
+    for (ParameterID id : preset.smartKnob.multiParameters) {
+        if (!multiParameters.empty()) multiParameters += ',';
+        multiParameters += std::to_string(static_cast<int>(id));
+    }
+    writer.addText(Section::META, 0, {
+        {"name", preset.name}, {"description", preset.description},
+        {"category", preset.category}, {"author", preset.author},
+        {"version", std::to_string(preset.version)},
+        {"created", std::to_string(preset.createdTime)},
+        {"modified", std::to_string(preset.modifiedTime)},
+        {"engine", std::to_string(static_cast<int>(preset.engineType))},
+        {"masterVolume", formatFloat(preset.masterVolume)}, {"bpm", formatFloat(preset.bpm)},
+        {"knob.parameter", std::to_string(static_cast<int>(preset.smartKnob.assignedParameter))},
+        {"knob.value", formatFloat(preset.smartKnob.currentValue)},
+        {"knob.macro", preset.smartKnob.macroName}, {"knob.multi", multiParameters}});
+    writer.addParams(Section::ENGINE_PARAMS, 0, toParams(preset.globalParameters));
+    if (!preset.engineData.empty()) {
+        writer.addRaw(Section::ENGINE_DATA, 0, preset.engineData.data(), preset.engineData.size());
+    }
+
+    const auto& fx = preset.effects;
+    writer.addParams(Section::EFFECTS, 0, {
+        {FX_REVERB_ENABLED, fx.reverbEnabled ? 1.0f : 0.0f}, {FX_REVERB_SIZE, fx.reverbSize},
+        {FX_REVERB_MIX, fx.reverbMix}, {FX_DELAY_ENABLED, fx.delayEnabled ? 1.0f : 0.0f},
+        {FX_DELAY_TIME, fx.delayTime}, {FX_DELAY_FEEDBACK, fx.delayFeedback},
+        {FX_DELAY_MIX, fx.delayMix}, {FX_CHORUS_ENABLED, fx.chorusEnabled ? 1.0f : 0.0f},
+        {FX_CHORUS_RATE, fx.chorusRate}, {FX_CHORUS_DEPTH, fx.chorusDepth},
+        {FX_CHORUS_MIX, fx.chorusMix}});
+
+    // One nested container per slot, so a slot can be read on its own
+    for (size_t i = 0; i < preset.instruments.size(); i++) {
+        const auto& instrument = preset.instruments[i];
+        PresetContainerWriter slot;
+        slot.addText(Section::META, 0, {
+            {"name", instrument.name}, {"engine", std::to_string(static_cast<int>(instrument.engineType))},
+            {"muted", instrument.muted ? "1" : "0"}, {"soloed", instrument.soloed ? "1" : "0"},
+            {"volume", formatFloat(instrument.volume)}, {"pan", formatFloat(instrument.pan)}});
+        slot.addParams(Section::ENGINE_PARAMS, 0, toParams(instrument.parameters));
+        if (!instrument.enginePreset.empty()) {
+            slot.addRaw(Section::ENGINE_DATA, 0, instrument.enginePreset.data(), instrument.enginePreset.size());
+        }
+        writer.addContainer(Section::INSTRUMENT, static_cast<uint32_t>(i), slot);
+    }
+}
+
+bool decodePreset(const PresetContainer& container, PresetManager::Preset& preset) {
+    preset = PresetManager::Preset();
+    PresetContainer::TextFields fields;
+    if (!container.readText(container.findSection(Section::META), fields)) return false;
+    for (const auto& field : fields) {
+        const std::string& key = field.first;
+        const char* value = field.second.c_str();
+        if (key == "name") preset.name = field.second;
+        else if (key == "description") preset.description = field.second;
+        else if (key == "category") preset.category = field.second;
+        else if (key == "author") preset.author = field.second;
+        else if (key == "version") preset.version = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (key == "created") preset.createdTime = std::strtoull(value, nullptr, 10);
+        else if (key == "modified") preset.modifiedTime = std::strtoull(value, nullptr, 10);
+        else if (key == "engine") preset.engineType = static_cast<EngineType>(std::atoi(value));
+        else if (key == "masterVolume") preset.masterVolume = std::strtof(value, nullptr);
+        else if (key == "bpm") preset.bpm = std::strtof(value, nullptr);
+        else if (key == "knob.parameter") preset.smartKnob.assignedParameter = static_cast<ParameterID>(std::atoi(value));
+        else if (key == "knob.value") preset.smartKnob.currentValue = std::strtof(value, nullptr);
+        else if (key == "knob.macro") preset.smartKnob.macroName = field.second;
+        else if (key == "knob.multi") {
+            for (const char* p = value; *p;) {
+                char* end = nullptr;
+                long id = std::strtol(p, &end, 10);
+                if (end == p) break;
+                preset.smartKnob.multiParameters.push_back(static_cast<ParameterID>(id));
+                p = *end == ',' ? end + 1 : end;
+            }
+        }
+    }
+    if (!readParameterMap(container, preset.globalParameters) || !readEngineData(container, preset.engineData)) {
+        return false;
+    }
+
+    const PresetParam* params = nullptr;
+    size_t count = 0;
+    int effects = container.findSection(Section::EFFECTS);
+    if (effects >= 0 && container.readParams(effects, params, count)) {
+        auto& fx = preset.effects;
+        for (size_t i = 0; i < count; i++) {
+            const float v = params[i].value;
+            switch (params[i].id) {
+                case FX_REVERB_ENABLED: fx.reverbEnabled = v > 0.5f; break;
+                case FX_REVERB_SIZE: fx.reverbSize = v; break;
+                case FX_REVERB_MIX: fx.reverbMix = v; break;
+                case FX_DELAY_ENABLED: fx.delayEnabled = v > 0.5f; break;
+                case FX_DELAY_TIME: fx.delayTime = v; break;
+                case FX_DELAY_FEEDBACK: fx.delayFeedback = v; break;
+                case FX_DELAY_MIX: fx.delayMix = v; break;
+                case FX_CHORUS_ENABLED: fx.chorusEnabled = v > 0.5f; break;
+                case FX_CHORUS_RATE: fx.chorusRate = v; break;
+                case FX_CHORUS_DEPTH: fx.chorusDepth = v; break;
+                case FX_CHORUS_MIX: fx.chorusMix = v; break;
+                default: break;     // Newer field
+            }
+        }
+    }
+
+    for (size_t i = 0; i < preset.instruments.size(); i++) {
+        int section = container.findSection(Section::INSTRUMENT, static_cast<uint32_t>(i));
+        if (section < 0) continue;
+        PresetContainer slot;
+        if (!container.openNested(section, slot) || !slot.readText(slot.findSection(Section::META), fields)) {
+            return false;
+        }
+        auto& instrument = preset.instruments[i];
+        for (const auto& field : fields) {
+            const char* value = field.second.c_str();
+            if (field.first == "name") instrument.name = field.second;
+            else if (field.first == "engine") instrument.engineType = static_cast<EngineType>(std::atoi(value));
+            else if (field.first == "muted") instrument.muted = field.second == "1";
+            else if (field.first == "soloed") instrument.soloed = field.second == "1";
+            else if (field.first == "volume") instrument.volume = std::strtof(value, nullptr);
+            else if (field.first == "pan") instrument.pan = std::strtof(value, nullptr);
+        }
+        if (!readParameterMap(slot, instrument.parameters) || !readEngineData(slot, instrument.enginePreset)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
 
 PresetManager::PresetManager() {
     std::cout << "PresetManager created" << std::endl;
@@ -353,40 +540,38 @@ bool PresetManager::importPreset(const std::string& filePath) {
 }
 
 bool PresetManager::exportPresetBank(const std::vector<std::string>& presetNames, const std::string& filePath) const {
-    std::ofstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
-        return false;
-    }
-    
-    try {
-        // Write bank header
-        uint32_t magic = PRESET_FILE_MAGIC;
-        uint32_t version = PRESET_FILE_VERSION;
-        uint32_t count = static_cast<uint32_t>(presetNames.size());
-        
-        file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
-        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
-        
-        // Write each preset
-        for (const std::string& name : presetNames) {
-            auto it = presets_.find(name);
-            if (it != presets_.end()) {
-                std::vector<uint8_t> presetData = serializePreset(it->second);
-                uint32_t dataSize = static_cast<uint32_t>(presetData.size());
-                
-                file.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
-                file.write(reinterpret_cast<const char*>(presetData.data()), dataSize);
-            }
+    // One nested container per preset: importers decode only what they open
+    PresetContainerWriter bank;
+    uint32_t index = 0;
+    for (const std::string& name : presetNames) {
+        auto it = presets_.find(name);
+        if (it != presets_.end()) {
+            PresetContainerWriter preset;
+            encodePreset(it->second, preset);
+            bank.addContainer(PresetContainer::SectionType::PRESET, index++, preset);
         }
-        
-        return true;
-    } catch (const std::exception&) {
-        return false;
     }
+    return bank.writeFile(filePath);
 }
 
 bool PresetManager::importPresetBank(const std::string& filePath) {
+    PresetContainer bank;
+    if (bank.open(filePath)) {
+        for (size_t i = 0; i < bank.getSectionCount(); i++) {
+            if (bank.getSection(i).type != PresetContainer::SectionType::PRESET) continue;
+            PresetContainer container;
+            Preset preset;
+            if (bank.openNested(static_cast<int>(i), container) && decodePreset(container, preset)) {
+                if (presets_.find(preset.name) != presets_.end()) {
+                    preset.name = generateUniquePresetName(preset.name);
+                }
+                savePreset(preset);
+            }
+        }
+        return true;
+    }
+    
+    // Legacy "ETHR" bank
     std::ifstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
         return false;
@@ -427,6 +612,21 @@ bool PresetManager::importPresetBank(const std::string& filePath) {
     }
 }
 
+bool PresetManager::exportPresetJSON(const std::string& name, const std::string& filePath) const {
+    auto it = presets_.find(name);
+    if (it == presets_.end()) {
+        return false;
+    }
+    
+    PresetContainer container;
+    if (!container.openBuffer(serializePreset(it->second))) {
+        return false;
+    }
+    std::ofstream file(filePath);
+    file << container.toJSON();
+    return file.good();
+}
+
 bool PresetManager::createCategory(const std::string& category) {
     if (categories_.find(category) != categories_.end()) {
         return false; // Already exists
@@ -649,22 +849,18 @@ bool PresetManager::initializeDirectories() {
 }
 
 bool PresetManager::savePresetToFile(const Preset& preset, const std::string& filePath) const {
-    try {
-        std::ofstream file(filePath, std::ios::binary);
-        if (!file.is_open()) {
-            return false;
-        }
-        
-        std::vector<uint8_t> data = serializePreset(preset);
-        file.write(reinterpret_cast<const char*>(data.data()), data.size());
-        
-        return file.good();
-    } catch (const std::exception&) {
-        return false;
-    }
+    PresetContainerWriter writer;
+    encodePreset(preset, writer);
+    return writer.writeFile(filePath);
 }
 
 bool PresetManager::loadPresetFromFile(const std::string& filePath, Preset& preset) const {
+    PresetContainer container;
+    if (container.open(filePath)) {
+        return decodePreset(container, preset);
+    }
+    
+    // Legacy "ETHR" file
     try {
         std::ifstream file(filePath, std::ios::binary);
         if (!file.is_open()) {
@@ -787,31 +983,19 @@ void PresetManager::createFactoryPreset(const std::string& name, const std::stri
 }
 
 std::vector<uint8_t> PresetManager::serializePreset(const Preset& preset) const {
-    std::vector<uint8_t> data;
-    
-    // Write header
-    uint32_t magic = PRESET_FILE_MAGIC;
-    uint32_t version = PRESET_FILE_VERSION;
-    
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&magic), 
-                reinterpret_cast<const uint8_t*>(&magic) + sizeof(magic));
-    data.insert(data.end(), reinterpret_cast<const uint8_t*>(&version), 
-                reinterpret_cast<const uint8_t*>(&version) + sizeof(version));
-    
-    // Write preset data (simplified serialization)
-    // In a real implementation, this would use a proper serialization format
-    std::stringstream ss;
-    ss << preset.name << "|" << preset.description << "|" << preset.category << "|" 
-       << preset.author << "|" << static_cast<int>(preset.engineType) << "|"
-       << preset.masterVolume << "|" << preset.bpm;
-    
-    std::string serialized = ss.str();
-    data.insert(data.end(), serialized.begin(), serialized.end());
-    
-    return data;
+    PresetContainerWriter writer;
+    encodePreset(preset, writer);
+    return writer.finish();
 }
 
 bool PresetManager::deserializePreset(const std::vector<uint8_t>& data, Preset& preset) const {
+    if (data.size() >= sizeof(PresetContainer::MAGIC) &&
+        std::memcmp(data.data(), PresetContainer::MAGIC, sizeof(PresetContainer::MAGIC)) == 0) {
+        PresetContainer container;
+        return container.openBuffer(data) && decodePreset(container, preset);
+    }
+    
+    // Legacy "ETHR" format: header followed by '|'-separated fields
     if (data.size() < sizeof(uint32_t) * 2) {
         return false;
     }
@@ -106,6 +106,7 @@ public:
     bool importPreset(const std::string& filePath);
     bool exportPresetBank(const std::vector<std::string>& presetNames, const std::string& filePath) const;
     bool importPresetBank(const std::string& filePath);
+    bool exportPresetJSON(const std::string& name, const std::string& filePath) const;  // For diffing
     
     // Preset organization
     bool createCategory(const std::string& category);
@@ -186,8 +187,9 @@ private:
     std::vector<uint8_t> serializePreset(const Preset& preset) const;
     bool deserializePreset(const std::vector<uint8_t>& data, Preset& preset) const;
     
-    // File format constants
-    static constexpr uint32_t PRESET_FILE_MAGIC = 0x45544852; // "ETHR"
+    // File format constants. Presets and banks are written as PresetContainer
+    // files; the "ETHR" format is still read for older files.
+    static constexpr uint32_t PRESET_FILE_MAGIC = 0x45544852; // "ETHR" (legacy)
     static constexpr uint32_t PRESET_FILE_VERSION = 1;
     static constexpr size_t MAX_PRESET_NAME_LENGTH = 64;
     static constexpr size_t MAX_DESCRIPTION_LENGTH = 256;
@@ -3,8 +3,8 @@
 #include <array>
 
 // Core system constants
-constexpr float SAMPLE_RATE = 48000.0f;
-constexpr size_t BUFFER_SIZE = 128;  // Reduced for lower latency
+constexpr float SAMPLE_RATE = 48000.0f;  // Default; the bridge takes the host rate via ether_set_sample_rate
+constexpr size_t BUFFER_SIZE = 128;      // Maximum engine block; larger host buffers are rendered in chunks
 constexpr float TWO_PI = 2.0f * M_PI;
 constexpr size_t MAX_VOICES = 16;
 constexpr size_t MAX_INSTRUMENTS = 8;
@@ -103,6 +103,8 @@ enum class EngineType : uint8_t {
     CLASSIC_4OP_FM,
     GRANULAR,
     SERIAL_HPLP,
+    RINGS_MODAL,
+    ELEMENTS_MODAL,
     COUNT
 };
 
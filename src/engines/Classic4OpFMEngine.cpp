@@ -1,4 +1,5 @@
 #include "Classic4OpFMEngine.h"
+#include <algorithm>
 #include <cmath>
 
 Classic4OpFMEngine::Classic4OpFMEngine() 
@@ -133,12 +134,24 @@ bool Classic4OpFMEngine::hasParameter(ParameterID param) const {
 void Classic4OpFMEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     if (!initialized_) { outputBuffer.fill(AudioFrame(0.0f, 0.0f)); return; }
     for (auto& f : outputBuffer) { f.left = 0.0f; f.right = 0.0f; }
-    for (size_t i = 0; i < BUFFER_SIZE; ++i) {
-        float sum = 0.0f;
-        for (auto& v : voices_) { if (v.active) { v.age++; sum += processVoiceSample(v); } }
-        float theta = pan_ * 1.5707963f; float l = std::cos(theta), r = std::sin(theta);
-        outputBuffer[i].left  += sum * l;
-        outputBuffer[i].right += sum * r;
+    const size_t frames = std::min(bufferSize_, outputBuffer.size());
+    std::fill(mono_.begin(), mono_.begin() + frames, 0.0f);
+    
+    Voice* group[LANES];
+    int count = 0;
+    for (auto& v : voices_) {
+        if (!v.active) continue;
+        group[count++] = &v;
+        if (count == LANES) { processVoiceGroup(group, count, frames); count = 0; }
+    }
+    if (count > 0) processVoiceGroup(group, count, frames);
+    
+    // Equal-power pan: cos(pi/2 * p) is sin(pi/2 * (1 - p))
+    const float pan = std::clamp(pan_, 0.0f, 1.0f);
+    const float l = EtherSynthSIMD::SIMD::sinHalfPi(1.0f - pan), r = EtherSynthSIMD::SIMD::sinHalfPi(pan);
+    for (size_t i = 0; i < frames; ++i) {
+        outputBuffer[i].left  += mono_[i] * l;
+        outputBuffer[i].right += mono_[i] * r;
     }
 }
 
@@ -178,17 +191,35 @@ void Classic4OpFMEngine::setSampleRate(float sampleRate) {
 }
 
 void Classic4OpFMEngine::setBufferSize(size_t bufferSize) {
-    // Buffer size changes handled automatically
+    bufferSize_ = bufferSize;
 }
 
 float Classic4OpFMEngine::getCPUUsage() const { return cpuUsage_; }
 
-float Classic4OpFMEngine::processVoiceSample(Voice& v) {
-    if (!initialized_) return 0.0f;
-    advanceEnvelope(v);
-    if (v.stage == Voice::EnvStage::IDLE) { v.active = false; return 0.0f; }
-    float baseFreq = v.freq;
-
+void Classic4OpFMEngine::processVoiceGroup(Voice* const* group, int count, size_t frames) {
+    using EtherSynthSIMD::SIMD::LaneVec;
+    using EtherSynthSIMD::SIMD::sinCyclesLanes;
+    constexpr int N = LANES;
+    float* gain = groupGain_.data();
+    
+    // Envelopes per voice; a voice whose envelope ends is silent for the rest of the block
+    for (int lane = 0; lane < count; ++lane) {
+        Voice& v = *group[lane];
+        // Simple amplitude: velocity and envelope, with headroom
+        const float level = 0.8f * v.velocity * volume_;
+        size_t i = 0;
+        for (; i < frames; ++i) {
+            v.age++;
+            advanceEnvelope(v);
+            if (v.stage == Voice::EnvStage::IDLE) { v.active = false; break; }
+            gain[i * N + lane] = v.env * level;
+        }
+        for (; i < frames; ++i) gain[i * N + lane] = 0.0f;
+    }
+    for (int lane = count; lane < N; ++lane) {
+        for (size_t i = 0; i < frames; ++i) gain[i * N + lane] = 0.0f;
+    }
+    
     // Limit FM indices to musical ranges
     float idx = 0.2f + harmonics_ * 1.2f;  // gentler index 0.2..1.4
     // Map FILTER_RESONANCE (brightness_) to a subtle extra index lift
@@ -208,30 +239,61 @@ float Classic4OpFMEngine::processVoiceSample(Voice& v) {
         case 6: r1=1; r2=2.5f; r3=3.5f; r4=5.0f; break;   // clang
         case 7: r1=1; r2=1; r3=1; r4=1; break;            // organ-ish
     }
-
-    // Operator 4 (top of stack)
-    float freq4 = baseFreq * r4;
-    v.p4 += freq4 / sampleRate_; if (v.p4 >= 1.0f) v.p4 -= 1.0f; float op4 = std::sin(v.p4 * 2.0f * M_PI);
-    
-    // Operator 3 (modulated by op4)
-    float freq3 = baseFreq * r3;
-    v.p3 += freq3 / sampleRate_; if (v.p3 >= 1.0f) v.p3 -= 1.0f; float op3 = std::sin((v.p3 + op4 * idx) * 2.0f * M_PI);
-    
-    // Operator 2 (modulated by op3)
-    float freq2 = baseFreq * r2;
-    v.p2 += freq2 / sampleRate_; if (v.p2 >= 1.0f) v.p2 -= 1.0f; float op2 = std::sin((v.p2 + op3 * idx) * 2.0f * M_PI);
     
-    // Operator 1 (carrier, modulated by op2, with feedback)
-    float freq1 = baseFreq * r1;
-    v.p1 += freq1 / sampleRate_; if (v.p1 >= 1.0f) v.p1 -= 1.0f; float op1 = std::sin((v.p1 + op2 * idx + v.lastOp1 * fb) * 2.0f * M_PI); v.lastOp1 = op1;
+    // Gather operator state; unused lanes stay zero and are silenced by their gain
+    float p1[N] = {}, p2[N] = {}, p3[N] = {}, p4[N] = {};
+    float i1[N] = {}, i2[N] = {}, i3[N] = {}, i4[N] = {};
+    float lpf[N] = {}, last[N] = {};
+    for (int lane = 0; lane < count; ++lane) {
+        const Voice& v = *group[lane];
+        p1[lane] = v.p1; p2[lane] = v.p2; p3[lane] = v.p3; p4[lane] = v.p4;
+        i1[lane] = v.freq * r1 / sampleRate_; i2[lane] = v.freq * r2 / sampleRate_;
+        i3[lane] = v.freq * r3 / sampleRate_; i4[lane] = v.freq * r4 / sampleRate_;
+        lpf[lane] = v.lpfState; last[lane] = v.lastOp1;
+    }
     
+    // Operator 4 (top of stack) -> 3 -> 2 -> 1 (carrier, with feedback), phases in cycles
+    const LaneVec one = LaneVec::set1(1.0f);
+    const LaneVec index = LaneVec::set1(idx), feedback = LaneVec::set1(fb);
     // Post brightness: simple one-pole LPF (darken when brightness low)
-    float cutoff = 0.05f + brightness_ * 0.45f; // normalized
-    v.lpfState += cutoff * (op1 - v.lpfState);
-    float s = 0.85f * v.lpfState + 0.15f * std::sin(v.p1 * 2.0f * M_PI);
-    // Simple amplitude: velocity and envelope, with headroom
-    float amp = 0.8f * v.velocity * v.env * volume_;
-    return s * amp;
+    const LaneVec cutoff = LaneVec::set1(0.05f + brightness_ * 0.45f); // normalized
+    const LaneVec dry = LaneVec::set1(0.85f), body = LaneVec::set1(0.15f);
+    for (int off = 0; off < count; off += LaneVec::WIDTH) {
+        LaneVec ph1 = LaneVec::load(p1 + off), ph2 = LaneVec::load(p2 + off);
+        LaneVec ph3 = LaneVec::load(p3 + off), ph4 = LaneVec::load(p4 + off);
+        const LaneVec in1 = LaneVec::load(i1 + off), in2 = LaneVec::load(i2 + off);
+        const LaneVec in3 = LaneVec::load(i3 + off), in4 = LaneVec::load(i4 + off);
+        LaneVec state = LaneVec::load(lpf + off), op1 = LaneVec::load(last + off);
+        
+        for (size_t i = 0; i < frames; ++i) {
+            ph4 = LaneVec::wrap(ph4 + in4, one);
+            LaneVec op4 = sinCyclesLanes(ph4);
+            ph3 = LaneVec::wrap(ph3 + in3, one);
+            LaneVec op3 = sinCyclesLanes(ph3 + op4 * index);
+            ph2 = LaneVec::wrap(ph2 + in2, one);
+            LaneVec op2 = sinCyclesLanes(ph2 + op3 * index);
+            ph1 = LaneVec::wrap(ph1 + in1, one);
+            op1 = sinCyclesLanes(ph1 + op2 * index + op1 * feedback);
+            
+            state = state + cutoff * (op1 - state);
+            float* g = gain + i * N + off;
+            ((dry * state + body * sinCyclesLanes(ph1)) * LaneVec::load(g)).store(g);
+        }
+        
+        ph1.store(p1 + off); ph2.store(p2 + off); ph3.store(p3 + off); ph4.store(p4 + off);
+        state.store(lpf + off); op1.store(last + off);
+    }
+    
+    for (int lane = 0; lane < count; ++lane) {
+        Voice& v = *group[lane];
+        v.p1 = p1[lane]; v.p2 = p2[lane]; v.p3 = p3[lane]; v.p4 = p4[lane];
+        v.lpfState = lpf[lane]; v.lastOp1 = last[lane];
+    }
+    for (size_t i = 0; i < frames; ++i) {
+        float sum = 0.0f;
+        for (int lane = 0; lane < count; ++lane) sum += gain[i * N + lane];
+        mono_[i] += sum;
+    }
 }
 
 void Classic4OpFMEngine::advanceEnvelope(Voice& v) {
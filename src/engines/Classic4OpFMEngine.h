@@ -1,9 +1,15 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
 #include "../core/Types.h"
+#include "../audio/SIMDOptimizations.h"
+#include <array>
+#include <vector>
 
 /**
  * Classic4OpFM Engine - Simplified 4-operator FM synthesis engine
+ *
+ * Voices render in groups of LANE_GROUP: envelopes step per voice, then the
+ * operator stack runs across the group's lanes with sinCyclesLanes().
  */
 class Classic4OpFMEngine : public SynthEngine {
 public:
@@ -91,8 +97,13 @@ private:
     float envSustain_ = 0.6f;    // sustain level
     float envRelease_ = 0.08f;   // short release
 
+    // Block scratch: lane-interleaved voice gains, replaced in place by voice output
+    static constexpr int LANES = EtherSynthSIMD::SIMD::LANE_GROUP;
+    std::array<float, BUFFER_SIZE * LANES> groupGain_{};
+    std::array<float, BUFFER_SIZE> mono_{};
+
     // Helpers
-    float processVoiceSample(Voice& v);
+    void processVoiceGroup(Voice* const* group, int count, size_t frames);
     void advanceEnvelope(Voice& v);
     Voice* findFreeVoice();
     Voice* stealVoice();
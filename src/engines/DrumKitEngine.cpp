@@ -529,7 +529,7 @@ void DrumKitEngine::allNotesOff() {
         return s * v.amp * (open?0.76f:0.65f);
     };
  
-    for (size_t i = 0; i < buffer.size(); ++i) {
+    for (size_t i = 0; i < bufferSize_; ++i) {
         float lmix = 0.0f, rmix = 0.0f;
         for (auto &v : voices_) if (v.active) {
             float s = 0.0f;
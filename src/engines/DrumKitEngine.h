@@ -31,7 +31,7 @@ public:
      void savePreset(uint8_t*, size_t, size_t&) const override {}
      bool loadPreset(const uint8_t*, size_t) override { return true; }
      void setSampleRate(float sr) override { sampleRate_ = sr; }
-     void setBufferSize(size_t) override {}
+     void setBufferSize(size_t bs) override { bufferSize_ = bs; }
  
  private:
     enum class Kit { K808, K909 };
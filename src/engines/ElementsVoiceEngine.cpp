@@ -10,6 +10,11 @@ ElementsVoiceEngine::ElementsVoiceEngine() {
     // Initialize modulation array
     modulation_.fill(0.0f);
     
+    // Distinct but fixed seed per voice (repeatable renders)
+    for (size_t i = 0; i < voices_.size(); ++i) {
+        voices_[i].setSeed(12345u + static_cast<uint32_t>(i) * 2654435761u);
+    }
+    
     // Calculate initial derived parameters
     calculateDerivedParams();
     
@@ -149,7 +154,7 @@ void ElementsVoiceEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            for (size_t i = 0; i < bufferSize_; i++) {
                 AudioFrame voiceFrame = voice.processSample();
                 outputBuffer[i] += voiceFrame;
             }
@@ -285,31 +290,30 @@ void ElementsVoiceEngine::ExciterTone::calculateFromHarmonics(float harmonics) {
     turbulence = 0.1f + harmonics * 0.4f;
 }
 
-float ElementsVoiceEngine::ExciterTone::generateExcitation(float velocity, float phase, uint32_t& seed) const {
+float ElementsVoiceEngine::ExciterTone::generateExcitation(float velocity, float phase, uint32_t& seed, float& blowFilter) const {
     switch (type) {
         case Type::BOW:
-            return generateBowExcitation(velocity, phase);
+            return generateBowExcitation(velocity, phase, seed);
         case Type::MALLET:
             return generateMalletExcitation(velocity, phase);
         case Type::BLOW:
-            return generateBlowExcitation(velocity, seed);
+            return generateBlowExcitation(velocity, seed, blowFilter);
         case Type::PLUCK:
-            return generatePluckExcitation(velocity, phase);
+            return generatePluckExcitation(velocity, phase, seed);
         default:
             return 0.0f;
     }
 }
 
-float ElementsVoiceEngine::ExciterTone::generateBowExcitation(float velocity, float phase) const {
+float ElementsVoiceEngine::ExciterTone::generateBowExcitation(float velocity, float phase, uint32_t& seed) const {
     // Sawtooth-like bow excitation with noise
     float bowFreq = 50.0f + color * 200.0f; // 50-250 Hz bow rate
     float bowPhase = std::fmod(phase * bowFreq / 440.0f, 1.0f);
     float sawtooth = (bowPhase * 2.0f - 1.0f) * pressure;
     
     // Add bow noise
-    static uint32_t noiseState = 54321;
-    noiseState = noiseState * 1664525 + 1013904223;
-    float noise = (static_cast<float>(noiseState) / 4294967296.0f - 0.5f) * turbulence;
+    seed = seed * 1664525 + 1013904223;
+    float noise = (static_cast<float>(seed) / 4294967296.0f - 0.5f) * turbulence;
     
     return (sawtooth + noise) * velocity;
 }
@@ -328,26 +332,24 @@ float ElementsVoiceEngine::ExciterTone::generateMalletExcitation(float velocity,
     return excitation * pressure;
 }
 
-float ElementsVoiceEngine::ExciterTone::generateBlowExcitation(float velocity, uint32_t& seed) const {
+float ElementsVoiceEngine::ExciterTone::generateBlowExcitation(float velocity, uint32_t& seed, float& blowFilter) const {
     // Turbulent noise with resonance
     seed = seed * 1664525 + 1013904223;
     float noise = (static_cast<float>(seed) / 4294967296.0f - 0.5f) * 2.0f;
     
     // Filter noise based on color
-    static float filterState = 0.0f;
     float cutoff = 0.1f + color * 0.4f; // 0.1 to 0.5
-    filterState += cutoff * (noise - filterState);
+    blowFilter += cutoff * (noise - blowFilter);
     
-    return filterState * velocity * pressure * (0.5f + turbulence);
+    return blowFilter * velocity * pressure * (0.5f + turbulence);
 }
 
-float ElementsVoiceEngine::ExciterTone::generatePluckExcitation(float velocity, float phase) const {
+float ElementsVoiceEngine::ExciterTone::generatePluckExcitation(float velocity, float phase, uint32_t& seed) const {
     // Quick impulse with spectral content
     if (phase < 0.001f) {
         // Initial pluck burst
-        static uint32_t pluckSeed = 12345;
-        pluckSeed = pluckSeed * 1664525 + 1013904223;
-        float noise = (static_cast<float>(pluckSeed) / 4294967296.0f - 0.5f);
+        seed = seed * 1664525 + 1013904223;
+        float noise = (static_cast<float>(seed) / 4294967296.0f - 0.5f);
         return noise * velocity * pressure;
     }
     return 0.0f;
@@ -501,14 +503,14 @@ void ElementsVoiceEngine::setModulation(ParameterID target, float amount) {
 }
 
 void ElementsVoiceEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
 // ElementsVoiceImpl implementation
 ElementsVoiceEngine::ElementsVoiceImpl::ElementsVoiceImpl() {
     envelope_.sampleRate = 48000.0f;
-    randomSeed_ = 12345 + reinterpret_cast<uintptr_t>(this);
+    randomSeed_ = 12345; // ElementsVoiceEngine gives each voice its own seed
 }
 
 void ElementsVoiceEngine::ElementsVoiceImpl::noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate) {
@@ -564,7 +566,7 @@ AudioFrame ElementsVoiceEngine::ElementsVoiceImpl::processSample() {
     if (excitationPhase_ >= 1.0f) excitationPhase_ -= 1.0f;
     
     // Generate excitation
-    float excitation = exciterTone_.generateExcitation(velocity_, excitationPhase_, randomSeed_);
+    float excitation = exciterTone_.generateExcitation(velocity_, excitationPhase_, randomSeed_, blowFilter_);
     excitation *= balanceSpace_.exciterEnergy;
     
     // Process through physical models
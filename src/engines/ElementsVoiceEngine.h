@@ -76,13 +76,14 @@ private:
         float turbulence = 0.3f;      // Blow turbulence or bow noise
         
         void calculateFromHarmonics(float harmonics);
-        float generateExcitation(float velocity, float phase, uint32_t& seed) const;
+        // seed and blowFilter are the calling voice's state
+        float generateExcitation(float velocity, float phase, uint32_t& seed, float& blowFilter) const;
         
     private:
-        float generateBowExcitation(float velocity, float phase) const;
+        float generateBowExcitation(float velocity, float phase, uint32_t& seed) const;
         float generateMalletExcitation(float velocity, float phase) const;
-        float generateBlowExcitation(float velocity, uint32_t& seed) const;
-        float generatePluckExcitation(float velocity, float phase) const;
+        float generateBlowExcitation(float velocity, uint32_t& seed, float& blowFilter) const;
+        float generatePluckExcitation(float velocity, float phase, uint32_t& seed) const;
     };
     
     // Resonator system
@@ -135,6 +136,7 @@ private:
         void setBalanceSpace(const BalanceSpace& balance);
         void setVolume(float volume);
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
+        void setSeed(uint32_t seed) { randomSeed_ = seed; }
         
     private:
         // Karplus-Strong string model
@@ -234,6 +236,7 @@ private:
         uint32_t age_ = 0;
         float excitationPhase_ = 0.0f;
         uint32_t randomSeed_ = 12345;
+        float blowFilter_ = 0.0f;             // Blow excitation noise filter
         
         // Physical modeling components
         StringModel stringModel_;
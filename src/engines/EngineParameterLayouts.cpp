@@ -48,6 +48,8 @@ void EngineParameterMappings::initializeLayouts() {
     layouts_[EngineType::TIDES_OSC] = createTidesOscLayout();
     layouts_[EngineType::RINGS_VOICE] = createRingsVoiceLayout();
     layouts_[EngineType::ELEMENTS_VOICE] = createElementsVoiceLayout();
+    layouts_[EngineType::RINGS_MODAL] = createRingsModalLayout();
+    layouts_[EngineType::ELEMENTS_MODAL] = createElementsModalLayout();
     layouts_[EngineType::DRUM_KIT] = createDrumKitLayout();
     layouts_[EngineType::SAMPLER_KIT] = createSamplerKitLayout();
     layouts_[EngineType::SAMPLER_SLICER] = createSamplerSlicerLayout();
@@ -313,6 +315,16 @@ EngineParameterLayout EngineParameterMappings::createElementsVoiceLayout() {
     return createBasicLayout("EXCITER", "MATERIAL", "SPACE", "BRIGHT");
 }
 
+// RINGS MODAL: Rings modal resonator
+EngineParameterLayout EngineParameterMappings::createRingsModalLayout() {
+    return createBasicLayout("STRUCTURE", "BRIGHT", "DAMP", "POSITION");
+}
+
+// ELEMENTS MODAL: Elements exciters into the modal resonator
+EngineParameterLayout EngineParameterMappings::createElementsModalLayout() {
+    return createBasicLayout("STRUCTURE", "BRIGHT", "EXCITER", "POSITION");
+}
+
 // DRUM KIT: Drum machine
 EngineParameterLayout EngineParameterMappings::createDrumKitLayout() {
     return createBasicLayout("ACCENT", "HUMANIZE", "SEED", "VARIATION");
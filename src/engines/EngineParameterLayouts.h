@@ -73,6 +73,8 @@ private:
     static EngineParameterLayout createTidesOscLayout();
     static EngineParameterLayout createRingsVoiceLayout();
     static EngineParameterLayout createElementsVoiceLayout();
+    static EngineParameterLayout createRingsModalLayout();
+    static EngineParameterLayout createElementsModalLayout();
     static EngineParameterLayout createDrumKitLayout();
     static EngineParameterLayout createSamplerKitLayout();
     static EngineParameterLayout createSamplerSlicerLayout();
@@ -152,7 +152,7 @@ void FormantEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            for (size_t i = 0; i < bufferSize_; i++) {
                 AudioFrame voiceFrame = voice.processSample();
                 outputBuffer[i] += voiceFrame;
             }
@@ -425,7 +425,7 @@ void FormantEngine::setModulation(ParameterID target, float amount) {
 }
 
 void FormantEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
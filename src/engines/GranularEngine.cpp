@@ -2,7 +2,8 @@
 #include <cmath>
 
 GranularEngine::GranularEngine() {
-    std::random_device rd; rng_ = std::mt19937(rd());
+    // Fixed seed: grain scatter repeats exactly across renders (offline bounces are bit-identical)
+    rng_.seed(GRAIN_SEED);
 }
 
 void GranularEngine::noteOn(uint8_t /*note*/, float velocity, float /*aftertouch*/) {
@@ -43,8 +44,8 @@ void GranularEngine::processAudio(EtherAudioBuffer& output) {
     for (auto &f : output) { f.left = 0.0f; f.right = 0.0f; }
     for (int g=0; g<grains; ++g) {
         float freq = baseHz * (0.8f + 0.4f * (uni_(rng_) - 0.5f) * jitter_);
-        float start = uni_(rng_) * (float)output.size();
-        for (size_t i=0;i<output.size();++i) {
+        float start = uni_(rng_) * (float)bufferSize_;
+        for (size_t i=0;i<bufferSize_;++i) {
             float t = (float)i / sampleRate_;
             float p = 2.0f * (float)M_PI * freq * t + (float)M_PI * 2.0f * uni_(rng_);
             // Hann window over winDur seconds centered at start
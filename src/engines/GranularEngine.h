@@ -48,6 +48,7 @@ private:
     float volume_ = 0.5f;
     bool active_ = false;
 
+    static constexpr uint32_t GRAIN_SEED = 0x6772616Eu;
     std::mt19937 rng_;
     std::uniform_real_distribution<float> uni_{0.0f,1.0f};
 
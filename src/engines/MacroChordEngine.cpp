@@ -1,4 +1,5 @@
 #include "MacroChordEngine.h"
+#include "../audio/VoiceManager.h"
 #include <iostream>
 #include <chrono>
 #include <cstring>
@@ -18,15 +19,16 @@ MacroChordEngine::MacroChordEngine() {
 }
 
 MacroChordEngine::~MacroChordEngine() {
+    detachVoiceManager();
     allNotesOff();
     std::cout << "MacroChord engine destroyed" << std::endl;
 }
 
 void MacroChordEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
-    MacroChordVoice* voice = findFreeVoice();
-    if (!voice) {
-        voice = stealVoice();
-    }
+    MacroChordVoice* voice = acquireVoice(voices_, note, velocity, [this] {
+        MacroChordVoice* free = findFreeVoice();
+        return free ? free : stealVoice();
+    });
     
     if (voice) {
         voice->noteOn(note, velocity, aftertouch, sampleRate_, chordVoicing_);
@@ -38,7 +40,7 @@ void MacroChordEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
 }
 
 void MacroChordEngine::noteOff(uint8_t note) {
-    MacroChordVoice* voice = findVoice(note);
+    MacroChordVoice* voice = releaseVoice(voices_, note, [this, note] { return findVoice(note); });
     if (voice) {
         voice->noteOff();
         
@@ -55,9 +57,11 @@ void MacroChordEngine::setAftertouch(uint8_t note, float aftertouch) {
 }
 
 void MacroChordEngine::allNotesOff() {
-    for (auto& voice : voices_) {
-        voice.noteOff();
-    }
+    releaseAllVoices(voices_);
+}
+
+bool MacroChordEngine::attachVoiceManager(VoiceManager* manager, int slot) {
+    return attachVoices(manager, slot, voices_);
 }
 
 void MacroChordEngine::setParameter(ParameterID param, float value) {
@@ -137,31 +141,28 @@ bool MacroChordEngine::hasParameter(ParameterID param) const {
 void MacroChordEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     auto start = std::chrono::high_resolution_clock::now();
     
-    // Clear output buffer
-    for (auto& frame : outputBuffer) {
-        frame.left = 0.0f;
-        frame.right = 0.0f;
+    // Silence voices stolen by other slots, free finished release tails
+    if (voiceManager_) {
+        voiceManager_->syncVoices(voiceSlot_, this, voices_);
     }
     
-    // Process all active voices
+    const size_t frames = std::min(bufferSize_, BUFFER_SIZE);
+    std::fill(monoBuffer_.begin(), monoBuffer_.begin() + frames, 0.0f);
+    
+    // Process all active voices (mono, identical on both channels)
     size_t activeVoices = 0;
     for (auto& voice : voices_) {
         if (voice.isActive()) {
             activeVoices++;
-            
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
-                AudioFrame voiceFrame = voice.processSample();
-                outputBuffer[i] += voiceFrame;
-            }
+            voice.processBlock(monoBuffer_.data(), nullptr, frames);
         }
     }
     
     // Apply voice scaling to prevent clipping
-    if (activeVoices > 1) {
-        float scale = 0.8f / std::sqrt(static_cast<float>(activeVoices));
-        for (auto& frame : outputBuffer) {
-            frame = frame * scale;
-        }
+    float scale = activeVoices > 1 ? 0.8f / std::sqrt(static_cast<float>(activeVoices)) : 1.0f;
+    for (size_t i = 0; i < frames; i++) {
+        outputBuffer[i].left = monoBuffer_[i] * scale;
+        outputBuffer[i].right = monoBuffer_[i] * scale;
     }
     
     // Update CPU usage
@@ -424,7 +425,7 @@ void MacroChordEngine::setModulation(ParameterID target, float amount) {
 }
 
 void MacroChordEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
@@ -481,55 +482,91 @@ void MacroChordEngine::MacroChordVoice::noteOff() {
     envelope_.noteOff();
 }
 
+void MacroChordEngine::MacroChordVoice::kill() {
+    active_ = false;
+    envelope_.stage = Envelope::Stage::IDLE;
+    envelope_.level = 0.0f;
+}
+
 void MacroChordEngine::MacroChordVoice::setAftertouch(float aftertouch) {
     aftertouch_ = aftertouch;
 }
 
-AudioFrame MacroChordEngine::MacroChordVoice::processSample() {
+void MacroChordEngine::MacroChordVoice::processBlock(float* left, float* right, size_t frames) {
+    using EtherSynthSIMD::SIMD::LaneVec;
+    constexpr int LANES = EtherSynthSIMD::SIMD::LANE_GROUP;
+    static_assert(ChordVoicing::MAX_CHORD_NOTES <= LANES, "chord notes must fit one lane group");
+    
     if (!active_) {
-        return AudioFrame(0.0f, 0.0f);
+        return;
     }
     
-    age_++;
+    frames = std::min(frames, ::BUFFER_SIZE);
+    age_ += static_cast<uint32_t>(frames);
+    
+    // Fold level, sqrt(count) normalization and the chord/single blend into one
+    // weight per oscillator: out = sum((phase / pi - 1) * weight)
+    const int count = std::min(activeOscCount_, ChordVoicing::MAX_CHORD_NOTES);
+    const float chordGain = (1.0f - chordSingleBlend_) /
+                            (count > 1 ? std::sqrt(static_cast<float>(count)) : 1.0f);
+    float phase[LANES] = {}, increment[LANES] = {}, weight[LANES] = {};
+    for (int n = 0; n < count; n++) {
+        const ChordOscillator& osc = oscillators_[n];
+        if (!osc.active) continue;
+        phase[n] = osc.phase;
+        increment[n] = osc.increment;
+        weight[n] = osc.level * (chordGain + (n == 0 ? chordSingleBlend_ : 0.0f));
+    }
     
-    // Mix all active oscillators
-    float mixed = 0.0f;
-    float singleNote = 0.0f;
+    const LaneVec invPi = LaneVec::set1(static_cast<float>(1.0 / M_PI));
+    const LaneVec one = LaneVec::set1(1.0f);
+    const LaneVec twoPi = LaneVec::set1(static_cast<float>(2.0 * M_PI));
+    constexpr int REGS = LANES / LaneVec::WIDTH;
+    LaneVec p[REGS], inc[REGS], w[REGS];
+    for (int r = 0; r < REGS; r++) {
+        p[r] = LaneVec::load(phase + r * LaneVec::WIDTH);
+        inc[r] = LaneVec::load(increment + r * LaneVec::WIDTH);
+        w[r] = LaneVec::load(weight + r * LaneVec::WIDTH);
+    }
     
-    for (int i = 0; i < activeOscCount_; i++) {
-        float oscOut = oscillators_[i].processSaw();
-        
-        if (i == 0) {
-            // Root note for single mode
-            singleNote = oscOut;
+    // Oscillators -> blend -> low-pass
+    float mixed[::BUFFER_SIZE];
+    for (size_t i = 0; i < frames; i++) {
+        LaneVec acc = (p[0] * invPi - one) * w[0];
+        p[0] = LaneVec::wrap(p[0] + inc[0], twoPi);
+        for (int r = 1; r < REGS; r++) {
+            acc = acc + (p[r] * invPi - one) * w[r];
+            p[r] = LaneVec::wrap(p[r] + inc[r], twoPi);
         }
-        
-        mixed += oscOut;
+        float lanes[LaneVec::WIDTH];
+        acc.store(lanes);
+        float blended = 0.0f;
+        for (int l = 0; l < LaneVec::WIDTH; l++) {
+            blended += lanes[l];
+        }
+        mixed[i] = filter_.processLowpass(blended);
     }
     
-    // Normalize mixed signal
-    if (activeOscCount_ > 1) {
-        mixed /= std::sqrt(static_cast<float>(activeOscCount_));
+    for (int r = 0; r < REGS; r++) {
+        p[r].store(phase + r * LaneVec::WIDTH);
+    }
+    for (int n = 0; n < count; n++) {
+        if (oscillators_[n].active) oscillators_[n].phase = phase[n];
     }
     
-    // Blend between chord and single note
-    float blended = mixed * (1.0f - chordSingleBlend_) + singleNote * chordSingleBlend_;
-    
-    // Apply low-pass filter
-    float filtered = filter_.processLowpass(blended);
-    
-    // Apply envelope
-    float envLevel = envelope_.process();
-    
-    // Check if voice should be deactivated
-    if (!envelope_.isActive()) {
+    // Apply envelope, velocity and volume; deactivate once the envelope finishes
+    if (!envelope_.applyBlock(mixed, frames, velocity_ * volume_)) {
         active_ = false;
     }
     
-    // Apply velocity and volume
-    float output = filtered * envLevel * velocity_ * volume_;
-    
-    return AudioFrame(output, output);
+    for (size_t i = 0; i < frames; i++) {
+        left[i] += mixed[i];
+    }
+    if (right) {
+        for (size_t i = 0; i < frames; i++) {
+            right[i] += mixed[i];
+        }
+    }
 }
 
 void MacroChordEngine::MacroChordVoice::setChordParams(const ChordVoicing& voicing) {
@@ -616,4 +653,53 @@ float MacroChordEngine::MacroChordVoice::Envelope::process() {
     }
     
     return level;
-}
\ No newline at end of file
+}
+
+bool MacroChordEngine::MacroChordVoice::Envelope::applyBlock(float* io, size_t frames, float gain) {
+    const float attackRate = 1.0f / (attack * sampleRate);
+    const float decayRate = 1.0f / (decay * sampleRate);
+    const float releaseRate = 1.0f / (release * sampleRate);
+    
+    for (size_t i = 0; i < frames; i++) {
+        switch (stage) {
+            case Stage::IDLE:
+                level = 0.0f;
+                break;
+                
+            case Stage::ATTACK:
+                level += attackRate;
+                if (level >= 1.0f) {
+                    level = 1.0f;
+                    stage = Stage::DECAY;
+                }
+                break;
+                
+            case Stage::DECAY:
+                level -= decayRate;
+                if (level <= sustain) {
+                    level = sustain;
+                    stage = Stage::SUSTAIN;
+                }
+                break;
+                
+            case Stage::SUSTAIN:
+                level = sustain;
+                break;
+                
+            case Stage::RELEASE:
+                level -= releaseRate;
+                if (level <= 0.0f) {
+                    level = 0.0f;
+                    stage = Stage::IDLE;
+                }
+                break;
+        }
+        
+        io[i] *= level * gain;
+        if (stage == Stage::IDLE) {
+            std::fill(io + i + 1, io + frames, 0.0f);
+            return false;
+        }
+    }
+    return true;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
+#include "../audio/SIMDOptimizations.h"
 #include <array>
 #include <memory>
 
@@ -16,6 +17,7 @@
  * - Detuning spread for unison thickness
  * - Chord/single morphing for dynamics
  * - Low-pass filtering integrated with harmonic spread
+ * - Block rendering: chord oscillators stepped together as SIMD lanes
  */
 class MacroChordEngine : public SynthEngine {
 public:
@@ -41,6 +43,7 @@ public:
     size_t getActiveVoiceCount() const override;
     size_t getMaxVoiceCount() const override { return MAX_VOICES; }
     void setVoiceCount(size_t maxVoices) override;
+    bool attachVoiceManager(VoiceManager* manager, int slot) override;
     
     float getCPUUsage() const override { return cpuUsage_; }
     
@@ -104,8 +107,11 @@ private:
                    const ChordVoicing& voicing);
         void noteOff();
         void setAftertouch(float aftertouch);
+        void kill();                        // Silence immediately (voice stolen)
+        float getLevel() const { return envelope_.level * velocity_; }
         
-        AudioFrame processSample();
+        // Adds frames of output to left (and right unless null)
+        void processBlock(float* left, float* right, size_t frames);
         
         bool isActive() const { return active_; }
         bool isReleasing() const { return envelope_.isReleasing(); }
@@ -213,6 +219,7 @@ private:
             }
             
             float process();
+            bool applyBlock(float* io, size_t frames, float gain);  // false once finished
         };
         
         bool active_ = false;
@@ -241,6 +248,8 @@ private:
     MacroChordVoice* findVoice(uint8_t note);
     MacroChordVoice* stealVoice();
     
+    std::array<float, BUFFER_SIZE> monoBuffer_{};
+    
     // H/T/M Parameters
     float harmonics_ = 0.0f;     // detune spread + LPF cutoff
     float timbre_ = 0.3f;        // voicing complexity
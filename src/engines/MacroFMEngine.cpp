@@ -163,7 +163,7 @@ void MacroFMEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            for (size_t i = 0; i < bufferSize_; i++) {
                 AudioFrame voiceFrame = voice.processSample();
                 outputBuffer[i] += voiceFrame;
             }
@@ -383,7 +383,7 @@ void MacroFMEngine::setModulation(ParameterID target, float amount) {
 }
 
 void MacroFMEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
+#include "../audio/SIMDOptimizations.h"
 #include <array>
 #include <memory>
 
@@ -16,6 +17,7 @@
  * - Linked feedback and modulator envelope decay
  * - Optional sub anchor for bass programs
  * - Bright tilt compensation for harsh high frequencies
+ * - Operator and sub sines from the shared sinCycles() kernel
  */
 class MacroFMEngine : public SynthEngine {
 public:
@@ -85,6 +87,8 @@ private:
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
         
     private:
+        static constexpr float INV_TWO_PI = 0.159154943091895f;   // Radians -> cycles for sinCycles()
+        
         // FM Operator
         struct FMOperator {
             float phase = 0.0f;
@@ -105,7 +109,7 @@ private:
             
             float processSine(float modulation = 0.0f) {
                 float input = phase + modulation + (output * feedbackAmount);
-                output = std::sin(input);
+                output = EtherSynthSIMD::SIMD::sinCycles(input * INV_TWO_PI);
                 phase += increment;
                 if (phase >= 2.0f * M_PI) phase -= 2.0f * M_PI;
                 return output;
@@ -134,7 +138,7 @@ private:
             }
             
             float processSine() {
-                float output = std::sin(phase);
+                float output = EtherSynthSIMD::SIMD::sinCycles(phase * INV_TWO_PI);
                 phase += increment;
                 if (phase >= 2.0f * M_PI) phase -= 2.0f * M_PI;
                 return output;
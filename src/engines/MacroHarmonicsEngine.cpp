@@ -1,4 +1,5 @@
 #include "MacroHarmonicsEngine.h"
+#include "../audio/VoiceManager.h"
 #include <iostream>
 #include <chrono>
 #include <cstring>
@@ -18,15 +19,16 @@ MacroHarmonicsEngine::MacroHarmonicsEngine() {
 }
 
 MacroHarmonicsEngine::~MacroHarmonicsEngine() {
+    detachVoiceManager();
     allNotesOff();
     std::cout << "MacroHarmonics engine destroyed" << std::endl;
 }
 
 void MacroHarmonicsEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
-    MacroHarmonicsVoice* voice = findFreeVoice();
-    if (!voice) {
-        voice = stealVoice();
-    }
+    MacroHarmonicsVoice* voice = acquireVoice(voices_, note, velocity, [this] {
+        MacroHarmonicsVoice* free = findFreeVoice();
+        return free ? free : stealVoice();
+    });
     
     if (voice) {
         voice->noteOn(note, velocity, aftertouch, sampleRate_);
@@ -38,7 +40,7 @@ void MacroHarmonicsEngine::noteOn(uint8_t note, float velocity, float aftertouch
 }
 
 void MacroHarmonicsEngine::noteOff(uint8_t note) {
-    MacroHarmonicsVoice* voice = findVoice(note);
+    MacroHarmonicsVoice* voice = releaseVoice(voices_, note, [this, note] { return findVoice(note); });
     if (voice) {
         voice->noteOff();
         
@@ -55,9 +57,11 @@ void MacroHarmonicsEngine::setAftertouch(uint8_t note, float aftertouch) {
 }
 
 void MacroHarmonicsEngine::allNotesOff() {
-    for (auto& voice : voices_) {
-        voice.noteOff();
-    }
+    releaseAllVoices(voices_);
+}
+
+bool MacroHarmonicsEngine::attachVoiceManager(VoiceManager* manager, int slot) {
+    return attachVoices(manager, slot, voices_);
 }
 
 void MacroHarmonicsEngine::setParameter(ParameterID param, float value) {
@@ -136,31 +140,28 @@ bool MacroHarmonicsEngine::hasParameter(ParameterID param) const {
 void MacroHarmonicsEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     auto start = std::chrono::high_resolution_clock::now();
     
-    // Clear output buffer
-    for (auto& frame : outputBuffer) {
-        frame.left = 0.0f;
-        frame.right = 0.0f;
+    // Silence voices stolen by other slots, free finished release tails
+    if (voiceManager_) {
+        voiceManager_->syncVoices(voiceSlot_, this, voices_);
     }
     
-    // Process all active voices
+    const size_t frames = std::min(bufferSize_, BUFFER_SIZE);
+    std::fill(monoBuffer_.begin(), monoBuffer_.begin() + frames, 0.0f);
+    
+    // Process all active voices (mono, identical on both channels)
     size_t activeVoices = 0;
     for (auto& voice : voices_) {
         if (voice.isActive()) {
             activeVoices++;
-            
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
-                AudioFrame voiceFrame = voice.processSample();
-                outputBuffer[i] += voiceFrame;
-            }
+            voice.processBlock(monoBuffer_.data(), nullptr, frames);
         }
     }
     
     // Apply voice scaling to prevent clipping
-    if (activeVoices > 1) {
-        float scale = 0.8f / std::sqrt(static_cast<float>(activeVoices));
-        for (auto& frame : outputBuffer) {
-            frame = frame * scale;
-        }
+    float scale = activeVoices > 1 ? 0.8f / std::sqrt(static_cast<float>(activeVoices)) : 1.0f;
+    for (size_t i = 0; i < frames; i++) {
+        outputBuffer[i].left = monoBuffer_[i] * scale;
+        outputBuffer[i].right = monoBuffer_[i] * scale;
     }
     
     // Update CPU usage
@@ -277,15 +278,11 @@ void MacroHarmonicsEngine::HarmonicSettings::calculateFromTimbre(float timbre) {
 }
 
 void MacroHarmonicsEngine::HarmonicSettings::updateHarmonicLevels() {
-    // Base harmonic levels
-    levels[0] = 1.0f;      // Fundamental
-    levels[1] = 0.8f;      // 2nd harmonic
-    levels[2] = 0.6f;      // 3rd harmonic
-    levels[3] = 0.5f;      // 4th harmonic
-    levels[4] = 0.4f;      // 5th harmonic
-    levels[5] = 0.3f;      // 6th harmonic
-    levels[6] = 0.2f;      // 7th harmonic
-    levels[7] = 0.15f;     // 8th harmonic
+    // Base harmonic levels: 1st-8th voiced by hand, higher ones roll off as 1/n
+    static constexpr float BASE_LEVELS[8] = {1.0f, 0.8f, 0.6f, 0.5f, 0.4f, 0.3f, 0.2f, 0.15f};
+    for (int i = 0; i < NUM_HARMONICS; i++) {
+        levels[i] = i < 8 ? BASE_LEVELS[i] : BASE_LEVELS[7] * 8.0f / (i + 1);
+    }
     
     // Apply odd/even balance
     for (int i = 0; i < NUM_HARMONICS; i++) {
@@ -300,18 +297,11 @@ void MacroHarmonicsEngine::HarmonicSettings::updateHarmonicLevels() {
     
     // Apply drawbar groupings
     // Foundation: 1st, 2nd harmonics
-    levels[0] *= drawbars.foundation;
-    levels[1] *= drawbars.foundation;
-    
     // Principals: 3rd, 4th, 5th harmonics
-    levels[2] *= drawbars.principals;
-    levels[3] *= drawbars.principals;
-    levels[4] *= drawbars.principals;
-    
-    // Mixtures: 6th, 7th, 8th harmonics
-    levels[5] *= drawbars.mixtures;
-    levels[6] *= drawbars.mixtures;
-    levels[7] *= drawbars.mixtures;
+    // Mixtures: 6th harmonic and above
+    for (int i = 0; i < NUM_HARMONICS; i++) {
+        levels[i] *= i < 2 ? drawbars.foundation : (i < 5 ? drawbars.principals : drawbars.mixtures);
+    }
     
     // Apply overall level scaler
     for (int i = 0; i < NUM_HARMONICS; i++) {
@@ -329,8 +319,8 @@ void MacroHarmonicsEngine::TonewheelModel::calculateFromMorph(float morph) {
 
 void MacroHarmonicsEngine::TonewheelModel::updateLeakageMatrix() {
     // Initialize leakage matrix
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
             if (i == j) {
                 leakageMatrix[i][j] = 1.0f; // Self
             } else {
@@ -341,12 +331,20 @@ void MacroHarmonicsEngine::TonewheelModel::updateLeakageMatrix() {
             }
         }
     }
+    
+    for (int h = 0; h < N; h++) {
+        float column = 0.0f;
+        for (int t = 0; t < N; t++) {
+            column += leakageMatrix[t][h];
+        }
+        leakageWeights[h] = column / N;
+    }
 }
 
-float MacroHarmonicsEngine::TonewheelModel::applyLeakage(const std::array<float, 8>& harmonics, int targetHarmonic) const {
+float MacroHarmonicsEngine::TonewheelModel::applyLeakage(const std::array<float, N>& harmonics, int targetHarmonic) const {
     float result = 0.0f;
     
-    for (int i = 0; i < 8; i++) {
+    for (int i = 0; i < N; i++) {
         result += harmonics[i] * leakageMatrix[targetHarmonic][i];
     }
     
@@ -472,13 +470,15 @@ void MacroHarmonicsEngine::setModulation(ParameterID target, float amount) {
 }
 
 void MacroHarmonicsEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
 // MacroHarmonicsVoice implementation
 MacroHarmonicsEngine::MacroHarmonicsVoice::MacroHarmonicsVoice() {
     envelope_.sampleRate = 48000.0f;
+    harmonics_.setPartialCount(HarmonicSettings::NUM_HARMONICS);
+    harmonics_.setSmoothing(0.01f);
 }
 
 void MacroHarmonicsEngine::MacroHarmonicsVoice::noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate) {
@@ -491,11 +491,11 @@ void MacroHarmonicsEngine::MacroHarmonicsVoice::noteOn(uint8_t note, float veloc
     // Calculate note frequency
     noteFrequency_ = 440.0f * std::pow(2.0f, (note - 69) / 12.0f);
     
-    // Set up harmonic oscillators
+    // Set up harmonic oscillators; the bank culls harmonics above Nyquist
     for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
         float harmonicFreq = noteFrequency_ * (i + 1); // 1st, 2nd, 3rd... harmonics
-        harmonics_[i].setFrequency(harmonicFreq, sampleRate);
-        harmonics_[i].setTargetLevel(harmonicSettings_.levels[i]);
+        harmonics_.setFrequency(i, harmonicFreq / sampleRate);
+        harmonics_.setTargetLevel(i, harmonicSettings_.levels[i]);
     }
     
     // Update envelope sample rate
@@ -509,50 +509,40 @@ void MacroHarmonicsEngine::MacroHarmonicsVoice::noteOff() {
     envelope_.noteOff();
 }
 
+void MacroHarmonicsEngine::MacroHarmonicsVoice::kill() {
+    active_ = false;
+    envelope_.stage = OrganEnvelope::Stage::IDLE;
+    envelope_.level = 0.0f;
+}
+
 void MacroHarmonicsEngine::MacroHarmonicsVoice::setAftertouch(float aftertouch) {
     aftertouch_ = aftertouch;
 }
 
-AudioFrame MacroHarmonicsEngine::MacroHarmonicsVoice::processSample() {
+void MacroHarmonicsEngine::MacroHarmonicsVoice::processBlock(float* left, float* right, size_t frames) {
     if (!active_) {
-        return AudioFrame(0.0f, 0.0f);
+        return;
     }
     
-    age_++;
+    frames = std::min(frames, ::BUFFER_SIZE);
+    age_ += static_cast<uint32_t>(frames);
     
-    // Update harmonic levels smoothly
-    for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
-        harmonics_[i].updateLevel();
-    }
+    float mixed[::BUFFER_SIZE];
+    harmonics_.render(mixed, frames);
     
-    // Generate harmonic outputs
-    std::array<float, HarmonicSettings::NUM_HARMONICS> harmonicOutputs;
-    for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
-        harmonicOutputs[i] = harmonics_[i].processSine();
+    // Apply envelope, velocity and volume; deactivate once the envelope finishes
+    if (!envelope_.applyBlock(mixed, frames, velocity_ * volume_)) {
+        active_ = false;
     }
     
-    // Apply tonewheel leakage
-    float mixed = 0.0f;
-    for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
-        float harmonicWithLeakage = tonewheelModel_.applyLeakage(harmonicOutputs, i);
-        mixed += harmonicWithLeakage;
+    for (size_t i = 0; i < frames; i++) {
+        left[i] += mixed[i];
     }
-    
-    // Normalize
-    mixed /= HarmonicSettings::NUM_HARMONICS;
-    
-    // Apply envelope
-    float envLevel = envelope_.process();
-    
-    // Check if voice should be deactivated
-    if (!envelope_.isActive()) {
-        active_ = false;
+    if (right) {
+        for (size_t i = 0; i < frames; i++) {
+            right[i] += mixed[i];
+        }
     }
-    
-    // Apply velocity and volume
-    float output = mixed * envLevel * velocity_ * volume_;
-    
-    return AudioFrame(output, output);
 }
 
 void MacroHarmonicsEngine::MacroHarmonicsVoice::setHarmonicParams(const HarmonicSettings& settings) {
@@ -560,12 +550,15 @@ void MacroHarmonicsEngine::MacroHarmonicsVoice::setHarmonicParams(const Harmonic
     
     // Update target levels for smooth transitions
     for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
-        harmonics_[i].setTargetLevel(settings.levels[i]);
+        harmonics_.setTargetLevel(i, settings.levels[i]);
     }
 }
 
 void MacroHarmonicsEngine::MacroHarmonicsVoice::setTonewheelParams(const TonewheelModel& model) {
     tonewheelModel_ = model;
+    for (int i = 0; i < HarmonicSettings::NUM_HARMONICS; i++) {
+        harmonics_.setWeight(i, model.leakageWeights[i]);
+    }
 }
 
 void MacroHarmonicsEngine::MacroHarmonicsVoice::setVolume(float volume) {
@@ -610,4 +603,44 @@ float MacroHarmonicsEngine::MacroHarmonicsVoice::OrganEnvelope::process() {
     }
     
     return level;
-}
\ No newline at end of file
+}
+
+bool MacroHarmonicsEngine::MacroHarmonicsVoice::OrganEnvelope::applyBlock(float* io, size_t frames, float gain) {
+    const float attackRate = 1.0f / (attack * sampleRate);
+    const float releaseRate = 1.0f / (release * sampleRate);
+    
+    for (size_t i = 0; i < frames; i++) {
+        switch (stage) {
+            case Stage::IDLE:
+                level = 0.0f;
+                break;
+                
+            case Stage::ATTACK:
+                level += attackRate;
+                if (level >= 1.0f) {
+                    level = 1.0f;
+                    stage = Stage::SUSTAIN;
+                }
+                break;
+                
+            case Stage::SUSTAIN:
+                level = sustain;
+                break;
+                
+            case Stage::RELEASE:
+                level -= releaseRate;
+                if (level <= 0.0f) {
+                    level = 0.0f;
+                    stage = Stage::IDLE;
+                }
+                break;
+        }
+        
+        io[i] *= level * gain;
+        if (stage == Stage::IDLE) {
+            std::fill(io + i + 1, io + frames, 0.0f);
+            return false;
+        }
+    }
+    return true;
+}
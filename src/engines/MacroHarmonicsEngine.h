@@ -1,5 +1,6 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
+#include "../audio/AdditiveOscillatorBank.h"
 #include <array>
 #include <memory>
 
@@ -12,10 +13,13 @@
  * 
  * Features:
  * - 8-harmonic additive synthesis with independent level control
+ *   (NUM_HARMONICS may be raised up to AdditiveOscillatorBank::MAX_PARTIALS)
  * - Organ-style drawbar groupings for musical control
  * - Tonewheel leakage and decay modeling
  * - Odd/even harmonic balance for timbre shaping
  * - Real-time harmonic level interpolation
+ * - Block rendering on an AdditiveOscillatorBank: harmonics run as SIMD
+ *   lanes of rotating phasors, harmonics above Nyquist are culled
  */
 class MacroHarmonicsEngine : public SynthEngine {
 public:
@@ -41,6 +45,7 @@ public:
     size_t getActiveVoiceCount() const override;
     size_t getMaxVoiceCount() const override { return MAX_VOICES; }
     void setVoiceCount(size_t maxVoices) override;
+    bool attachVoiceManager(VoiceManager* manager, int slot) override;
     
     float getCPUUsage() const override { return cpuUsage_; }
     
@@ -64,14 +69,16 @@ private:
     struct HarmonicSettings {
         static constexpr int NUM_HARMONICS = 8;
         
+        static_assert(NUM_HARMONICS <= AdditiveOscillatorBank::MAX_PARTIALS, "too many harmonics");
+        
         // Individual harmonic levels (0-1)
-        std::array<float, NUM_HARMONICS> levels = {0.8f, 0.6f, 0.4f, 0.3f, 0.2f, 0.15f, 0.1f, 0.05f};
+        std::array<float, NUM_HARMONICS> levels{};
         
         // Drawbar groupings (organ-style)
         struct DrawbarGroups {
             float foundation = 0.8f;   // 1st, 2nd harmonics
             float principals = 0.6f;   // 3rd, 4th, 5th harmonics  
-            float mixtures = 0.3f;     // 6th, 7th, 8th harmonics
+            float mixtures = 0.3f;     // 6th harmonic and above
         };
         
         DrawbarGroups drawbars;
@@ -85,16 +92,22 @@ private:
     
     // Tonewheel modeling system
     struct TonewheelModel {
+        static constexpr int N = HarmonicSettings::NUM_HARMONICS;
+        
         float leakage = 0.0f;          // Cross-harmonic bleeding (0-0.3)
         float decay = 0.0f;            // Harmonic decay rate (0-0.5)
         float crosstalk = 0.0f;        // Adjacent note interference
         
         // Leakage matrix for harmonic cross-bleeding
-        std::array<std::array<float, 8>, 8> leakageMatrix;
+        std::array<std::array<float, N>, N> leakageMatrix;
+        
+        // Leakage summed over all targets: one output weight per harmonic
+        // (column sums of the matrix, with the 1/N mix normalization)
+        std::array<float, N> leakageWeights;
         
         void calculateFromMorph(float morph);
         void updateLeakageMatrix();
-        float applyLeakage(const std::array<float, 8>& harmonics, int targetHarmonic) const;
+        float applyLeakage(const std::array<float, N>& harmonics, int targetHarmonic) const;
     };
     
     // Additive Voice implementation
@@ -105,8 +118,11 @@ private:
         void noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate);
         void noteOff();
         void setAftertouch(float aftertouch);
+        void kill();                        // Silence immediately (voice stolen)
+        float getLevel() const { return envelope_.level * velocity_; }
         
-        AudioFrame processSample();
+        // Adds frames of output to left (and right unless null)
+        void processBlock(float* left, float* right, size_t frames);
         
         bool isActive() const { return active_; }
         bool isReleasing() const { return envelope_.isReleasing(); }
@@ -120,37 +136,6 @@ private:
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
         
     private:
-        // Individual harmonic oscillator
-        struct HarmonicOscillator {
-            float phase = 0.0f;
-            float frequency = 440.0f;
-            float increment = 0.0f;
-            float level = 0.0f;
-            float targetLevel = 0.0f;   // For smooth level transitions
-            float leakageInput = 0.0f;  // Input from other harmonics
-            
-            void setFrequency(float freq, float sampleRate) {
-                frequency = freq;
-                increment = 2.0f * M_PI * freq / sampleRate;
-            }
-            
-            void setTargetLevel(float lvl) {
-                targetLevel = std::clamp(lvl, 0.0f, 1.0f);
-            }
-            
-            void updateLevel(float smoothingRate = 0.01f) {
-                // Smooth level changes
-                level += (targetLevel - level) * smoothingRate;
-            }
-            
-            float processSine() {
-                float output = std::sin(phase) * level;
-                phase += increment;
-                if (phase >= 2.0f * M_PI) phase -= 2.0f * M_PI;
-                return output;
-            }
-        };
-        
         // Click-free envelope for organ-style sounds
         struct OrganEnvelope {
             enum class Stage { IDLE, ATTACK, SUSTAIN, RELEASE };
@@ -187,6 +172,7 @@ private:
             }
             
             float process();
+            bool applyBlock(float* io, size_t frames, float gain);  // false once finished
         };
         
         bool active_ = false;
@@ -195,8 +181,8 @@ private:
         float aftertouch_ = 0.0f;
         uint32_t age_ = 0;
         
-        // 8 harmonic oscillators
-        std::array<HarmonicOscillator, HarmonicSettings::NUM_HARMONICS> harmonics_;
+        // One partial per harmonic; level smoothing and leakage weights live in the bank
+        AdditiveOscillatorBank harmonics_;
         OrganEnvelope envelope_;
         
         // Voice parameters
@@ -216,6 +202,8 @@ private:
     MacroHarmonicsVoice* findVoice(uint8_t note);
     MacroHarmonicsVoice* stealVoice();
     
+    std::array<float, BUFFER_SIZE> monoBuffer_{};
+    
     // H/T/M Parameters
     float harmonics_ = 0.5f;     // odd/even balance + level scaler
     float timbre_ = 0.5f;        // drawbar groups
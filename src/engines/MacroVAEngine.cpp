@@ -1,4 +1,5 @@
 #include "MacroVAEngine.h"
+#include "../audio/VoiceManager.h"
 #include <iostream>
 #include <chrono>
 #include <cstring>
@@ -18,15 +19,16 @@ MacroVAEngine::MacroVAEngine()
 }
 
 MacroVAEngine::~MacroVAEngine() {
+    detachVoiceManager();
     allNotesOff();
     std::cout << "MacroVA engine destroyed" << std::endl;
 }
 
 void MacroVAEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
-    MacroVAVoice* voice = findFreeVoice();
-    if (!voice) {
-        voice = stealVoice();
-    }
+    MacroVAVoice* voice = acquireVoice(voices_, note, velocity, [this] {
+        MacroVAVoice* free = findFreeVoice();
+        return free ? free : stealVoice();
+    });
     
     if (voice) {
         voice->noteOn(note, velocity, aftertouch, sampleRate_);
@@ -38,7 +40,7 @@ void MacroVAEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
 }
 
 void MacroVAEngine::noteOff(uint8_t note) {
-    MacroVAVoice* voice = findVoice(note);
+    MacroVAVoice* voice = releaseVoice(voices_, note, [this, note] { return findVoice(note); });
     if (voice) {
         voice->noteOff();
         
@@ -55,9 +57,11 @@ void MacroVAEngine::setAftertouch(uint8_t note, float aftertouch) {
 }
 
 void MacroVAEngine::allNotesOff() {
-    for (auto& voice : voices_) {
-        voice.noteOff();
-    }
+    releaseAllVoices(voices_);
+}
+
+bool MacroVAEngine::attachVoiceManager(VoiceManager* manager, int slot) {
+    return attachVoices(manager, slot, voices_);
 }
 
 void MacroVAEngine::setParameter(ParameterID param, float value) {
@@ -76,7 +80,6 @@ void MacroVAEngine::setParameter(ParameterID param, float value) {
             
         case ParameterID::VOLUME:
             volume_ = std::clamp(value, 0.0f, 1.0f);
-            updateAllVoices();
             break;
         case ParameterID::PAN:
             pan_ = std::clamp(value, 0.0f, 1.0f);
@@ -165,41 +168,57 @@ bool MacroVAEngine::hasParameter(ParameterID param) const {
 void MacroVAEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     auto start = std::chrono::high_resolution_clock::now();
     
-    // Clear output buffer
-    for (auto& frame : outputBuffer) {
-        frame.left = 0.0f;
-        frame.right = 0.0f;
+    // Silence voices stolen by other slots, free finished release tails
+    if (voiceManager_) {
+        voiceManager_->syncVoices(voiceSlot_, this, voices_);
     }
     
-    // Process all active voices (mono)
-    size_t activeVoices = 0;
+    const size_t frames = std::min(bufferSize_, BUFFER_SIZE);
+    std::fill(monoBuffer_.begin(), monoBuffer_.begin() + frames, 0.0f);
+    
+    // Render active voices (mono) in groups of LANES
+    std::array<MacroVAVoice*, MAX_VOICES> active;
+    int activeVoices = 0;
     for (auto& voice : voices_) {
         if (voice.isActive()) {
-            activeVoices++;
-            
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
-                AudioFrame voiceFrame = voice.processSample();
-                outputBuffer[i] += voiceFrame; // mono summed
-            }
+            active[activeVoices++] = &voice;
         }
     }
-    
-    // Apply voice scaling to prevent clipping
-    if (activeVoices > 1) {
-        float scale = 0.8f / std::sqrt(static_cast<float>(activeVoices));
-        for (auto& frame : outputBuffer) {
-            frame = frame * scale;
+    // Cutoff modulation splits the block so the filters follow the ramp
+    const size_t segment = cutoffModActive_ ? CUTOFF_MOD_SEGMENT : frames;
+    for (size_t offset = 0; offset < frames; offset += segment) {
+        const size_t length = std::min(segment, frames - offset);
+        if (cutoffModActive_) {
+            const float hz = filterCutoff_ * std::exp2(cutoffMod_[offset] * CUTOFF_MOD_OCTAVES);
+            for (int v = 0; v < activeVoices; v++) {
+                active[v]->setFilterCutoff(hz);
+            }
+        }
+        for (int first = 0; first < activeVoices; first += LANES) {
+            int count = std::min(LANES, activeVoices - first);
+            MacroVAVoice::processGroup(&active[first], count, groupMix_.data(), groupGain_.data(),
+                                       monoBuffer_.data() + offset, length);
         }
     }
     
-    // Apply engine-level pan (equal-power)
+    // Voice scaling to prevent clipping, folded into the equal-power pan
+    float scale = activeVoices > 1 ? 0.8f / std::sqrt(static_cast<float>(activeVoices)) : 1.0f;
     float theta = pan_ * 3.14159265f * 0.5f; // 0..pi/2
-    float lGain = std::cos(theta);
-    float rGain = std::sin(theta);
-    for (auto& frame : outputBuffer) {
-        float mono = frame.left; // mono content
-        frame.left = mono * lGain;
-        frame.right = mono * rGain;
+    float lGain = std::cos(theta) * scale;
+    float rGain = std::sin(theta) * scale;
+    if (volumeModActive_) {
+        for (size_t i = 0; i < frames; i++) {
+            const float sample = monoBuffer_[i] * std::clamp(volume_ + volumeMod_[i], 0.0f, 1.0f);
+            outputBuffer[i].left = sample * lGain;
+            outputBuffer[i].right = sample * rGain;
+        }
+    } else {
+        lGain *= volume_;
+        rGain *= volume_;
+        for (size_t i = 0; i < frames; i++) {
+            outputBuffer[i].left = monoBuffer_[i] * lGain;
+            outputBuffer[i].right = monoBuffer_[i] * rGain;
+        }
     }
 
     // Update CPU usage
@@ -325,7 +344,6 @@ void MacroVAEngine::updateAllVoices() {
     for (auto& voice : voices_) {
         voice.setFilterParams(filterCutoff_, filterAutoQ_, baseResonance_);
         voice.setEnvelopeParams(attack_, decay_, sustain_, release_);
-        voice.setVolume(volume_);
         voice.setOscParams(sawPulseBlend_, pwm_);
         voice.setSubNoiseParams(subLevel_, noiseLevel_);
         voice.setHighTilt(highTilt_);
@@ -408,9 +426,49 @@ bool MacroVAEngine::supportsModulation(ParameterID target) const {
 }
 
 void MacroVAEngine::setModulation(ParameterID target, float amount) {
-    size_t index = static_cast<size_t>(target);
-    if (parameterManager_) {
-        parameterManager_->setModulation(target, amount);
+    switch (target) {
+        case ParameterID::FILTER_CUTOFF:
+            cutoffMod_.fill(amount);
+            if (cutoffModActive_ && amount == 0.0f) {
+                setVoiceCutoffs(filterCutoff_);
+            }
+            cutoffModActive_ = amount != 0.0f;
+            break;
+            
+        case ParameterID::VOLUME:
+            volumeMod_.fill(amount);
+            volumeModActive_ = amount != 0.0f;
+            break;
+            
+        default:
+            if (parameterManager_) {
+                parameterManager_->setModulation(target, amount);
+            }
+            break;
+    }
+}
+
+void MacroVAEngine::setModulationBuffer(ParameterID target, const float* values, size_t frames) {
+    switch (target) {
+        case ParameterID::FILTER_CUTOFF:
+            copyModulationRamp(cutoffMod_, values, frames);
+            cutoffModActive_ = true;
+            break;
+            
+        case ParameterID::VOLUME:
+            copyModulationRamp(volumeMod_, values, frames);
+            volumeModActive_ = true;
+            break;
+            
+        default:
+            SynthEngine::setModulationBuffer(target, values, frames);
+            break;
+    }
+}
+
+void MacroVAEngine::setVoiceCutoffs(float hz) {
+    for (auto& voice : voices_) {
+        voice.setFilterCutoff(hz);
     }
 }
 
@@ -457,61 +515,137 @@ void MacroVAEngine::MacroVAVoice::noteOff() {
     }
 }
 
+void MacroVAEngine::MacroVAVoice::kill() {
+    voiceState_.kill();
+    if (envelope_) {
+        envelope_->reset();
+    }
+}
+
 void MacroVAEngine::MacroVAVoice::setAftertouch(float aftertouch) {
     voiceState_.aftertouch_ = aftertouch;
 }
 
-AudioFrame MacroVAEngine::MacroVAVoice::processSample() {
-    if (!voiceState_.isActive()) {
-        return AudioFrame(0.0f, 0.0f);
-    }
-    
-    // Age is tracked by voiceState_ internally
-    
-    // Generate main oscillator output
-    float oscOut;
+void MacroVAEngine::MacroVAVoice::renderSources(float* mix, float* gain, size_t frames, size_t stride) {
+    // Main oscillator
     if (sawPulseBlend_ < 0.5f) {
         // Saw mode: blend between saw and less saw
         float sawAmount = 1.0f - (sawPulseBlend_ * 2.0f);
-        oscOut = mainOsc_.processSaw() * sawAmount;
+        for (size_t i = 0; i < frames; i++) {
+            mix[i * stride] = mainOsc_.processSaw() * sawAmount;
+        }
     } else {
         // Pulse mode
         mainOsc_.setPWM(pwm_);
-        oscOut = mainOsc_.processPulse();
+        for (size_t i = 0; i < frames; i++) {
+            mix[i * stride] = mainOsc_.processPulse();
+        }
     }
     
-    // Add sub oscillator
-    float subOut = subOsc_.processSine() * subLevel_;
-    
-    // Add noise
-    float noiseOut = noise_.processWhite() * noiseLevel_;
-    
-    // Mix all sources
-    float mixed = oscOut + subOut + noiseOut;
+    // Add sub oscillator and noise
+    subOsc_.processBlock(mix, frames, stride, subLevel_);
+    if (noiseLevel_ > 0.0f) {
+        for (size_t i = 0; i < frames; i++) {
+            mix[i * stride] += noise_.processWhite() * noiseLevel_;
+        }
+    }
     
-    // Apply main filter
-    float filtered = filter_.process(mixed);
-    // Gentle per-voice soft saturation to prevent harsh clipping
-    auto softclip = [](float x){ return std::tanh(x * 0.8f); };
-    filtered = softclip(filtered);
+    // Envelope with velocity (engine volume is applied to the mix); the voice dies once the envelope does
+    const float level = voiceState_.velocity_ * 0.9f; // audible but safe
+    size_t i = 0;
+    for (; i < frames; i++) {
+        gain[i * stride] = envelope_->process() * level;
+        if (!envelope_->isActive()) {
+            voiceState_.kill();
+            i++;
+            break;
+        }
+    }
+    for (; i < frames; i++) {
+        gain[i * stride] = 0.0f;
+    }
+}
+
+void MacroVAEngine::MacroVAVoice::processGroup(MacroVAVoice* const* voices, int count,
+                                               float* mix, float* gain, float* out, size_t frames) {
+    using EtherSynthSIMD::SIMD::LaneVec;
+    constexpr int N = EtherSynthSIMD::SIMD::LANE_GROUP;
     
-    // Apply high-frequency tilt
-    float tilted = tiltFilter_.process(filtered);
-    // Apply HPF low-cut after tilt
-    float lowcut = hpf_.process(tilted);
+    for (int lane = 0; lane < count; lane++) {
+        voices[lane]->renderSources(mix + lane, gain + lane, frames, N);
+    }
+    for (int lane = count; lane < N; lane++) {
+        for (size_t i = 0; i < frames; i++) {
+            mix[i * N + lane] = 0.0f;
+            gain[i * N + lane] = 0.0f;
+        }
+    }
     
-    // Apply envelope
-    float envLevel = envelope_->process();
+    // Gather filter state; unused lanes stay zero and produce silence
+    float fa0[N] = {}, fa1[N] = {}, fa2[N] = {}, fb1[N] = {}, fb2[N] = {};
+    float fx1[N] = {}, fx2[N] = {}, fy1[N] = {}, fy2[N] = {};
+    float ta0[N] = {}, ta1[N] = {}, tb1[N] = {}, tx1[N] = {}, ty1[N] = {};
+    float ha[N] = {}, hx1[N] = {}, hy1[N] = {};
+    for (int lane = 0; lane < count; lane++) {
+        const MacroVAVoice& v = *voices[lane];
+        fa0[lane] = v.filter_.a0; fa1[lane] = v.filter_.a1; fa2[lane] = v.filter_.a2;
+        fb1[lane] = v.filter_.b1; fb2[lane] = v.filter_.b2;
+        fx1[lane] = v.filter_.x1; fx2[lane] = v.filter_.x2;
+        fy1[lane] = v.filter_.y1; fy2[lane] = v.filter_.y2;
+        ta0[lane] = v.tiltFilter_.a0; ta1[lane] = v.tiltFilter_.a1; tb1[lane] = v.tiltFilter_.b1;
+        tx1[lane] = v.tiltFilter_.x1; ty1[lane] = v.tiltFilter_.y1;
+        ha[lane] = v.hpf_.a; hx1[lane] = v.hpf_.x1; hy1[lane] = v.hpf_.y1;
+    }
     
-    // Check if voice should be deactivated
-    if (!envelope_->isActive()) {
-        voiceState_.kill();
+    // Filter -> soft saturation -> tilt -> low-cut -> gain, one register of voices at a time
+    const LaneVec drive = LaneVec::set1(0.8f);
+    for (int off = 0; off < count; off += LaneVec::WIDTH) {
+        LaneVec a0 = LaneVec::load(fa0 + off), a1 = LaneVec::load(fa1 + off), a2 = LaneVec::load(fa2 + off);
+        LaneVec b1 = LaneVec::load(fb1 + off), b2 = LaneVec::load(fb2 + off);
+        LaneVec x1 = LaneVec::load(fx1 + off), x2 = LaneVec::load(fx2 + off);
+        LaneVec y1 = LaneVec::load(fy1 + off), y2 = LaneVec::load(fy2 + off);
+        LaneVec t0 = LaneVec::load(ta0 + off), t1 = LaneVec::load(ta1 + off), tb = LaneVec::load(tb1 + off);
+        LaneVec tx = LaneVec::load(tx1 + off), ty = LaneVec::load(ty1 + off);
+        LaneVec h = LaneVec::load(ha + off), hx = LaneVec::load(hx1 + off), hy = LaneVec::load(hy1 + off);
+        
+        for (size_t i = 0; i < frames; i++) {
+            float* m = mix + i * N + off;
+            LaneVec x = LaneVec::load(m);
+            LaneVec y = a0 * x + a1 * x1 + a2 * x2 - b1 * y1 - b2 * y2;
+            x2 = x1; x1 = x;
+            y2 = y1; y1 = y;
+            
+            LaneVec s = EtherSynthSIMD::SIMD::tanhLanes(y * drive);
+            LaneVec t = t0 * s + t1 * tx - tb * ty;
+            tx = s; ty = t;
+            
+            hy = h * (hy + t - hx);
+            hx = t;
+            (hy * LaneVec::load(gain + i * N + off)).store(m);
+        }
+        
+        x1.store(fx1 + off); x2.store(fx2 + off); y1.store(fy1 + off); y2.store(fy2 + off);
+        tx.store(tx1 + off); ty.store(ty1 + off);
+        hx.store(hx1 + off); hy.store(hy1 + off);
     }
     
-    // Apply velocity and volume
-    float output = lowcut * envLevel * voiceState_.velocity_ * volume_ * 0.9f; // audible but safe
+    for (int lane = 0; lane < count; lane++) {
+        MacroVAVoice& v = *voices[lane];
+        v.filter_.x1 = fx1[lane]; v.filter_.x2 = fx2[lane];
+        v.filter_.y1 = fy1[lane]; v.filter_.y2 = fy2[lane];
+        v.tiltFilter_.x1 = tx1[lane]; v.tiltFilter_.y1 = ty1[lane];
+        v.hpf_.x1 = hx1[lane]; v.hpf_.y1 = hy1[lane];
+    }
     
-    return AudioFrame(output, output);
+    // Mono sum of the group
+    for (size_t i = 0; i < frames; i++) {
+        const float* m = mix + i * N;
+        float sum = 0.0f;
+        for (int lane = 0; lane < count; lane++) {
+            sum += m[lane];
+        }
+        out[i] += sum;
+    }
 }
 
 void MacroVAEngine::MacroVAVoice::setFilterParams(float cutoff, float autoQ, float baseRes) {
@@ -535,10 +669,6 @@ void MacroVAEngine::MacroVAVoice::setHighTilt(float tiltAmount) {
     tiltFilter_.setTilt(tiltAmount);
 }
 
-void MacroVAEngine::MacroVAVoice::setVolume(float volume) {
-    volume_ = volume;
-}
-
 void MacroVAEngine::MacroVAVoice::setEnvelopeParams(float attack, float decay, float sustain, float release) {
     envelope_->setADSR(attack, decay, sustain, release);
 }
@@ -627,26 +757,16 @@ void MacroVAEngine::MacroVAVoice::TiltFilter::setTilt(float tiltDb) {
 }
 
 void MacroVAEngine::MacroVAVoice::TiltFilter::updateCoefficients() {
-    // Simple high-shelf filter at 4kHz
-    float omega = 2.0f * M_PI * freq / sampleRate;
-    float sinOmega = std::sin(omega);
-    float cosOmega = std::cos(omega);
-    float A = std::pow(10.0f, gain / 40.0f); // Convert dB to amplitude
-    float beta = std::sqrt(A) / 1.0f; // Q = 1.0
+    // First-order high shelf at 4kHz (bilinear), unity at DC and gain dB above
+    float K = std::tan(M_PI * freq / sampleRate);
+    float G = std::pow(10.0f, gain / 20.0f);
+    float norm = 1.0f / (1.0f + K);
     
-    float b0 = A * ((A + 1.0f) + (A - 1.0f) * cosOmega + beta * sinOmega);
-    float b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosOmega);
-    float b2 = A * ((A + 1.0f) + (A - 1.0f) * cosOmega - beta * sinOmega);
-    float a0_denom = (A + 1.0f) - (A - 1.0f) * cosOmega + beta * sinOmega;
-    float a1_val = 2.0f * ((A - 1.0f) - (A + 1.0f) * cosOmega);
-    float a2_val = (A + 1.0f) - (A - 1.0f) * cosOmega - beta * sinOmega;
-    
-    a0 = b0 / a0_denom;
-    a1 = b1 / a0_denom;
-    this->b1 = a1_val / a0_denom;
+    a0 = (G + K) * norm;
+    a1 = (K - G) * norm;
+    b1 = (K - 1.0f) * norm;
 }
 
-
 float MacroVAEngine::MacroVAVoice::TiltFilter::process(float input) {
     float output = a0 * input + a1 * x1 - b1 * y1;
     
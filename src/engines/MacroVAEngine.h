@@ -1,6 +1,7 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
 #include "../synthesis/SharedEngineComponents.h"
+#include "../audio/SIMDOptimizations.h"
 #include <array>
 #include <memory>
 
@@ -17,6 +18,7 @@
  * - Safe PWM range to prevent extreme timbres
  * - Sub oscillator and noise for fullness
  * - High-frequency tilt for air and presence
+ * - Block rendering: voices run filter/saturation stages as SoA lane groups
  */
 class MacroVAEngine : public SynthEngine {
 public:
@@ -42,6 +44,7 @@ public:
     size_t getActiveVoiceCount() const override;
     size_t getMaxVoiceCount() const override { return MAX_VOICES; }
     void setVoiceCount(size_t maxVoices) override;
+    bool attachVoiceManager(VoiceManager* manager, int slot) override;
     
     float getCPUUsage() const override { return cpuTracker_ ? cpuTracker_->getCPUUsage() : 0.0f; }
     
@@ -54,6 +57,7 @@ public:
     bool supportsPolyAftertouch() const override { return true; }
     bool supportsModulation(ParameterID target) const override;
     void setModulation(ParameterID target, float amount) override;
+    void setModulationBuffer(ParameterID target, const float* values, size_t frames) override;
     
     // H/T/M Macro Controls
     void setHarmonics(float harmonics);    // 0-1: LPF cutoff + auto-Q
@@ -69,8 +73,14 @@ private:
         void noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate);
         void noteOff();
         void setAftertouch(float aftertouch);
+        void kill();                        // Silence immediately (voice stolen)
+        float getLevel() const { return envelope_ ? envelope_->getOutput() * voiceState_.velocity_ : 0.0f; }
         
-        AudioFrame processSample();
+        // Block rendering: each voice writes its oscillator mix and envelope gain into
+        // its lane, then processGroup() runs the per-voice filters across lanes
+        void renderSources(float* mix, float* gain, size_t frames, size_t stride);
+        static void processGroup(MacroVAVoice* const* voices, int count,
+                                 float* mix, float* gain, float* out, size_t frames);
         
         bool isActive() const { return voiceState_.isActive(); }
         bool isReleasing() const { return voiceState_.isReleasing(); }
@@ -82,9 +92,9 @@ private:
         void setOscParams(float sawPulseBlend, float pwm);
         void setSubNoiseParams(float subLevel, float noiseLevel);
         void setHighTilt(float tiltAmount);
-        void setVolume(float volume);
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
         void setHPF(float hz) { hpf_.setCutoff(hz); }
+        void setFilterCutoff(float hz) { filter_.setCutoff(hz); }
         
     private:
         // Enhanced oscillator with PWM
@@ -168,6 +178,22 @@ private:
                 if (phase >= 1.0f) phase -= 1.0f;
                 return output;
             }
+            
+            // Adds level * sine to out[i * stride]; a rotating phasor replaces per-sample sin()
+            void processBlock(float* out, size_t frames, size_t stride, float level) {
+                const float w = 2.0f * M_PI * increment;
+                const float cw = std::cos(w), sw = std::sin(w);
+                float s = std::sin(2.0f * M_PI * phase);
+                float c = std::cos(2.0f * M_PI * phase);
+                for (size_t i = 0; i < frames; ++i) {
+                    out[i * stride] += s * level;
+                    float ns = s * cw + c * sw;
+                    c = c * cw - s * sw;
+                    s = ns;
+                }
+                phase += increment * static_cast<float>(frames);
+                phase -= std::floor(phase);
+            }
         };
         
         // Noise generator
@@ -251,7 +277,7 @@ private:
             float process(float input);
         };
         
-        // High-frequency tilt filter
+        // High-frequency tilt filter (first-order shelf)
         struct TiltFilter {
             float gain = 0.0f; // ±2 dB @ 4kHz
             float freq = 4000.0f;
@@ -282,7 +308,6 @@ private:
         float subLevel_ = 0.0f;      // -12 to 0 dB
         float noiseLevel_ = 0.0f;    // -∞ to -18 dB
         float highTilt_ = 0.0f;      // ±2 dB @ 4kHz
-        float volume_ = 0.8f;
         float noteFrequency_ = 440.0f;
         
         // moved public
@@ -296,6 +321,21 @@ private:
     MacroVAVoice* findVoice(uint8_t note);
     MacroVAVoice* stealVoice();
     
+    // Block scratch: lane-interleaved source mix and gain for one voice group
+    static constexpr int LANES = EtherSynthSIMD::SIMD::LANE_GROUP;
+    std::array<float, BUFFER_SIZE * LANES> groupMix_{};
+    std::array<float, BUFFER_SIZE * LANES> groupGain_{};
+    std::array<float, BUFFER_SIZE> monoBuffer_{};
+    
+    // Per-frame modulation (normalized offsets) from setModulationBuffer(). Volume is
+    // applied per sample to the mix; cutoff re-tunes the voice filters every segment.
+    static constexpr size_t CUTOFF_MOD_SEGMENT = 16;
+    static constexpr float CUTOFF_MOD_OCTAVES = 9.23f;   // Full HARMONICS cutoff range
+    std::array<float, BUFFER_SIZE> cutoffMod_{};
+    std::array<float, BUFFER_SIZE> volumeMod_{};
+    bool cutoffModActive_ = false;
+    bool volumeModActive_ = false;
+    
     // H/T/M Parameters
     float harmonics_ = 0.5f;    // LPF cutoff + auto-Q
     float timbre_ = 0.0f;       // saw↔pulse blend + PWM
@@ -327,6 +367,7 @@ private:
     // Parameter calculation and voice updates
     void calculateDerivedParams();
     void updateAllVoices();
+    void setVoiceCutoffs(float hz);
     
     // Mapping functions
     float mapCutoffExp(float harmonics) const;
@@ -149,10 +149,7 @@ void MacroWaveshaperEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
-                AudioFrame voiceFrame = voice.processSample();
-                outputBuffer[i] += voiceFrame;
-            }
+            voice.renderBlock(outputBuffer.data(), bufferSize_);
         }
     }
     
@@ -365,7 +362,7 @@ void MacroWaveshaperEngine::setModulation(ParameterID target, float amount) {
 }
 
 void MacroWaveshaperEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
@@ -376,6 +373,8 @@ MacroWaveshaperEngine::MacroWaveshaperVoice::MacroWaveshaperVoice() {
     postFilter_.sampleRate = 48000.0f;
     postFilter_.updateCoefficients();
     envelope_.sampleRate = 48000.0f;
+    oversampler_.initialize(48000.0f, OversamplingProcessor::Factor::X4,
+                            OversamplingProcessor::Quality::SHORT_FIR, static_cast<int>(BUFFER_SIZE));
 }
 
 void MacroWaveshaperEngine::MacroWaveshaperVoice::noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate) {
@@ -412,43 +411,45 @@ void MacroWaveshaperEngine::MacroWaveshaperVoice::setAftertouch(float aftertouch
     aftertouch_ = aftertouch;
 }
 
-AudioFrame MacroWaveshaperEngine::MacroWaveshaperVoice::processSample() {
+void MacroWaveshaperEngine::MacroWaveshaperVoice::renderBlock(AudioFrame* output, size_t frames) {
     if (!active_) {
-        return AudioFrame(0.0f, 0.0f);
+        return;
     }
     
-    age_++;
-    
-    // Generate oscillator output
-    float oscOut = osc_.processSaw();
-    
-    // Apply pre-gain
-    float preGained = oscOut * preGain_;
-    
-    // Apply pre-emphasis EQ
-    float preEmphasized = preEmphasis_.process(preGained);
-    
-    // Apply waveshaping with oversampling
-    float shaped = oversampler_.process(preEmphasized, waveshaper_);
-    
-    // Apply post low-pass filter
-    float filtered = postFilter_.process(shaped);
-    
-    // Apply post saturation
-    float saturated = postSat_.process(filtered);
-    
-    // Apply envelope
-    float envLevel = envelope_.process();
+    const int count = static_cast<int>(std::min(frames, BUFFER_SIZE));
+    float preEmphasized[BUFFER_SIZE];
+    float shaped[BUFFER_SIZE];
     
-    // Check if voice should be deactivated
-    if (!envelope_.isActive()) {
-        active_ = false;
+    // Oscillator, pre-gain and pre-emphasis EQ
+    for (int i = 0; i < count; i++) {
+        preEmphasized[i] = preEmphasis_.process(osc_.processSaw() * preGain_);
     }
     
-    // Apply velocity and volume
-    float output = saturated * envLevel * velocity_ * volume_;
+    // Waveshaping at 4x over the whole block
+    oversampler_.processBlock(preEmphasized, shaped, count,
+                              [this](float x) { return waveshaper_.process(x); });
     
-    return AudioFrame(output, output);
+    for (int i = 0; i < count; i++) {
+        age_++;
+        
+        // Apply post low-pass filter and post saturation
+        float filtered = postFilter_.process(shaped[i]);
+        float saturated = postSat_.process(filtered);
+        
+        // Apply envelope
+        float envLevel = envelope_.process();
+        
+        // Apply velocity and volume
+        float out = saturated * envLevel * velocity_ * volume_;
+        output[i].left += out;
+        output[i].right += out;
+        
+        // Check if voice should be deactivated
+        if (!envelope_.isActive()) {
+            active_ = false;
+            break;
+        }
+    }
 }
 
 void MacroWaveshaperEngine::MacroWaveshaperVoice::setWaveshapeParams(float drive, float asymmetry) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
+#include "../audio/OversamplingProcessor.h"
 #include <array>
 #include <memory>
 
@@ -69,7 +70,7 @@ private:
         void noteOff();
         void setAftertouch(float aftertouch);
         
-        AudioFrame processSample();
+        void renderBlock(AudioFrame* output, size_t frames);   // Adds into output
         
         bool isActive() const { return active_; }
         bool isReleasing() const { return envelope_.isReleasing(); }
@@ -172,47 +173,6 @@ private:
             }
         };
         
-        // Oversampling processor
-        struct OversamplingProcessor {
-            static constexpr int OVERSAMPLE_FACTOR = 4;
-            static constexpr int FILTER_TAPS = 8;
-            
-            float upsampleBuffer[OVERSAMPLE_FACTOR];
-            float downsampleBuffer[FILTER_TAPS];
-            int bufferIndex = 0;
-            
-            // Simple anti-aliasing filter coefficients (8-tap FIR)
-            static constexpr float FILTER_COEFFS[FILTER_TAPS] = {
-                -0.02f, 0.06f, -0.18f, 0.64f, 0.64f, -0.18f, 0.06f, -0.02f
-            };
-            
-            float process(float input, Waveshaper& shaper) {
-                // Upsample: insert zeros
-                upsampleBuffer[0] = input * OVERSAMPLE_FACTOR;
-                for (int i = 1; i < OVERSAMPLE_FACTOR; i++) {
-                    upsampleBuffer[i] = 0.0f;
-                }
-                
-                // Process each upsampled sample through waveshaper
-                for (int i = 0; i < OVERSAMPLE_FACTOR; i++) {
-                    upsampleBuffer[i] = shaper.process(upsampleBuffer[i]);
-                }
-                
-                // Downsample with filtering
-                float sum = 0.0f;
-                for (int i = 0; i < FILTER_TAPS; i++) {
-                    int index = (bufferIndex - i + FILTER_TAPS) % FILTER_TAPS;
-                    sum += downsampleBuffer[index] * FILTER_COEFFS[i];
-                }
-                
-                // Store current sample in circular buffer
-                downsampleBuffer[bufferIndex] = upsampleBuffer[0];
-                bufferIndex = (bufferIndex + 1) % FILTER_TAPS;
-                
-                return sum;
-            }
-        };
-        
         // Pre-emphasis filter
         struct PreEmphasisFilter {
             float gain = 0.0f; // ±2 dB @ 2kHz
@@ -297,7 +257,7 @@ private:
         
         Oscillator osc_;
         Waveshaper waveshaper_;
-        OversamplingProcessor oversampler_;
+        OversamplingProcessor oversampler_;     // 4x around the shaper only
         PreEmphasisFilter preEmphasis_;
         PostLPFilter postFilter_;
         PostSaturator postSat_;
@@ -1,14 +1,11 @@
 #include "MacroWavetableEngine.h"
+#include "../audio/VoiceManager.h"
 #include <iostream>
 #include <chrono>
 #include <cstring>
 #include <cmath>
 #include <algorithm>
 
-// Static wavetable data initialization
-float MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::wavetables[NUM_WAVETABLES][WAVETABLE_SIZE];
-bool MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::wavetablesInitialized = false;
-
 MacroWavetableEngine::MacroWavetableEngine() {
     std::cout << "MacroWavetable engine created" << std::endl;
     
@@ -31,15 +28,16 @@ MacroWavetableEngine::MacroWavetableEngine() {
 }
 
 MacroWavetableEngine::~MacroWavetableEngine() {
+    detachVoiceManager();
     allNotesOff();
     std::cout << "MacroWavetable engine destroyed" << std::endl;
 }
 
 void MacroWavetableEngine::noteOn(uint8_t note, float velocity, float aftertouch) {
-    MacroWavetableVoice* voice = findFreeVoice();
-    if (!voice) {
-        voice = stealVoice();
-    }
+    MacroWavetableVoice* voice = acquireVoice(voices_, note, velocity, [this] {
+        MacroWavetableVoice* free = findFreeVoice();
+        return free ? free : stealVoice();
+    });
     
     if (voice) {
         voice->noteOn(note, velocity, aftertouch, sampleRate_);
@@ -51,7 +49,7 @@ void MacroWavetableEngine::noteOn(uint8_t note, float velocity, float aftertouch
 }
 
 void MacroWavetableEngine::noteOff(uint8_t note) {
-    MacroWavetableVoice* voice = findVoice(note);
+    MacroWavetableVoice* voice = releaseVoice(voices_, note, [this, note] { return findVoice(note); });
     if (voice) {
         voice->noteOff();
         
@@ -68,44 +66,52 @@ void MacroWavetableEngine::setAftertouch(uint8_t note, float aftertouch) {
 }
 
 void MacroWavetableEngine::allNotesOff() {
-    for (auto& voice : voices_) {
-        voice.noteOff();
-    }
+    releaseAllVoices(voices_);
+}
+
+bool MacroWavetableEngine::attachVoiceManager(VoiceManager* manager, int slot) {
+    return attachVoices(manager, slot, voices_);
 }
 
 void MacroWavetableEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     auto start = std::chrono::high_resolution_clock::now();
     
+    // Silence voices stolen by other slots, free finished release tails
+    if (voiceManager_) {
+        voiceManager_->syncVoices(voiceSlot_, this, voices_);
+    }
+    
     // Update vector path if latched
     if (vectorPath_.latched) {
-        float deltaTime = BUFFER_SIZE / sampleRate_;
+        float deltaTime = bufferSize_ / sampleRate_;
         updateVectorPath(deltaTime);
     }
     
-    // Clear output buffer
-    for (auto& frame : outputBuffer) {
-        frame.left = 0.0f;
-        frame.right = 0.0f;
-    }
+    const size_t frames = std::min(bufferSize_, BUFFER_SIZE);
+    std::fill(monoBuffer_.begin(), monoBuffer_.begin() + frames, 0.0f);
     
-    // Process all active voices
+    // Process all active voices (mono, identical on both channels)
     size_t activeVoices = 0;
     for (auto& voice : voices_) {
         if (voice.isActive()) {
             activeVoices++;
-            
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
-                AudioFrame voiceFrame = voice.processSample();
-                outputBuffer[i] += voiceFrame;
-            }
+            voice.processBlock(monoBuffer_.data(), nullptr, frames);
         }
     }
     
-    // Apply voice scaling to prevent clipping
-    if (activeVoices > 1) {
-        float scale = 0.8f / std::sqrt(static_cast<float>(activeVoices));
-        for (auto& frame : outputBuffer) {
-            frame = frame * scale;
+    // Apply volume and voice scaling to prevent clipping
+    float scale = activeVoices > 1 ? 0.8f / std::sqrt(static_cast<float>(activeVoices)) : 1.0f;
+    if (volumeModActive_) {
+        for (size_t i = 0; i < frames; i++) {
+            const float sample = monoBuffer_[i] * scale * std::clamp(volume_ + volumeMod_[i], 0.0f, 1.0f);
+            outputBuffer[i].left = sample;
+            outputBuffer[i].right = sample;
+        }
+    } else {
+        scale *= volume_;
+        for (size_t i = 0; i < frames; i++) {
+            outputBuffer[i].left = monoBuffer_[i] * scale;
+            outputBuffer[i].right = monoBuffer_[i] * scale;
         }
     }
     
@@ -374,7 +380,6 @@ void MacroWavetableEngine::updateAllVoices() {
     for (auto& voice : voices_) {
         voice.setWavetableParams(wavetablePosition_, currentBlend_);
         voice.setFormantParams(formantShift_, spectralTilt_);
-        voice.setVolume(volume_);
         voice.setEnvelopeParams(attack_, decay_, sustain_, release_);
     }
 }
@@ -396,7 +401,6 @@ void MacroWavetableEngine::setParameter(ParameterID param, float value) {
             
         case ParameterID::VOLUME:
             volume_ = std::clamp(value, 0.0f, 1.0f);
-            updateAllVoices();
             break;
             
         case ParameterID::ATTACK:
@@ -539,10 +543,24 @@ void MacroWavetableEngine::setModulation(ParameterID target, float amount) {
     if (index < modulation_.size()) {
         modulation_[index] = amount;
     }
+    if (target == ParameterID::VOLUME) {
+        volumeMod_.fill(amount);
+        volumeModActive_ = amount != 0.0f;
+    }
+}
+
+void MacroWavetableEngine::setModulationBuffer(ParameterID target, const float* values, size_t frames) {
+    if (target == ParameterID::VOLUME) {
+        copyModulationRamp(volumeMod_, values, frames);
+        volumeModActive_ = true;
+        modulation_[static_cast<size_t>(target)] = frames > 0 ? values[frames - 1] : 0.0f;
+        return;
+    }
+    SynthEngine::setModulationBuffer(target, values, frames);
 }
 
 void MacroWavetableEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
@@ -603,13 +621,9 @@ void MacroWavetableEngine::VectorPathEditor::setSelectedPointPosition(float x, f
 // Voice implementation would continue here...
 // Simplified for length - voice contains wavetable oscillators, formant shifter, etc.
 
-MacroWavetableEngine::MacroWavetableVoice::MacroWavetableVoice() {
+MacroWavetableEngine::MacroWavetableVoice::MacroWavetableVoice()
+    : bank_(WavetableBank::getShared()) {
     envelope_.sampleRate = 48000.0f;
-    
-    // Initialize wavetables if needed
-    if (!WavetableOscillator::wavetablesInitialized) {
-        WavetableOscillator::initializeWavetables();
-    }
 }
 
 void MacroWavetableEngine::MacroWavetableVoice::noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate) {
@@ -623,10 +637,10 @@ void MacroWavetableEngine::MacroWavetableVoice::noteOn(uint8_t note, float veloc
     noteFrequency_ = 440.0f * std::pow(2.0f, (note - 69) / 12.0f);
     
     // Set oscillator frequencies
-    oscA_.setFrequency(noteFrequency_, sampleRate);
-    oscB_.setFrequency(noteFrequency_, sampleRate);
-    oscC_.setFrequency(noteFrequency_, sampleRate);
-    oscD_.setFrequency(noteFrequency_, sampleRate);
+    oscA_.setFrequency(*bank_, noteFrequency_, sampleRate);
+    oscB_.setFrequency(*bank_, noteFrequency_, sampleRate);
+    oscC_.setFrequency(*bank_, noteFrequency_, sampleRate);
+    oscD_.setFrequency(*bank_, noteFrequency_, sampleRate);
     
     // Update envelope sample rate
     envelope_.sampleRate = sampleRate;
@@ -639,16 +653,23 @@ void MacroWavetableEngine::MacroWavetableVoice::noteOff() {
     envelope_.noteOff();
 }
 
+void MacroWavetableEngine::MacroWavetableVoice::kill() {
+    active_ = false;
+    envelope_.stage = Envelope::Stage::IDLE;
+    envelope_.level = 0.0f;
+}
+
 void MacroWavetableEngine::MacroWavetableVoice::setAftertouch(float aftertouch) {
     aftertouch_ = aftertouch;
 }
 
-AudioFrame MacroWavetableEngine::MacroWavetableVoice::processSample() {
+void MacroWavetableEngine::MacroWavetableVoice::processBlock(float* left, float* right, size_t frames) {
     if (!active_) {
-        return AudioFrame(0.0f, 0.0f);
+        return;
     }
     
-    age_++;
+    frames = std::min(frames, ::BUFFER_SIZE);
+    age_ += static_cast<uint32_t>(frames);
     
     // Set wavetable positions for all oscillators
     oscA_.setPosition(wavetablePosition_);
@@ -656,98 +677,52 @@ AudioFrame MacroWavetableEngine::MacroWavetableVoice::processSample() {
     oscC_.setPosition(wavetablePosition_);
     oscD_.setPosition(wavetablePosition_);
     
-    // Generate oscillator outputs
-    float outA = oscA_.process() * currentBlend_.gA;
-    float outB = oscB_.process() * currentBlend_.gB;
-    float outC = oscC_.process() * currentBlend_.gC;
-    float outD = oscD_.process() * currentBlend_.gD;
-    
     // Blend corner sources
-    float mixed = outA + outB + outC + outD;
+    float mixed[::BUFFER_SIZE];
+    std::fill(mixed, mixed + frames, 0.0f);
+    oscA_.processBlock(*bank_, mixed, frames, currentBlend_.gA);
+    oscB_.processBlock(*bank_, mixed, frames, currentBlend_.gB);
+    oscC_.processBlock(*bank_, mixed, frames, currentBlend_.gC);
+    oscD_.processBlock(*bank_, mixed, frames, currentBlend_.gD);
     
     // Apply formant shifting and spectral tilt
-    float processed = formantShifter_.process(mixed);
+    formantShifter_.processBlock(mixed, frames);
     
-    // Apply envelope
-    float envLevel = envelope_.process();
-    
-    // Check if voice should be deactivated
-    if (!envelope_.isActive()) {
+    // Apply envelope and velocity (engine volume is applied to the mix); deactivate once the envelope finishes
+    if (!envelope_.applyBlock(mixed, frames, velocity_)) {
         active_ = false;
     }
     
-    // Apply velocity and volume
-    float output = processed * envLevel * velocity_ * volume_;
-    
-    return AudioFrame(output, output);
-}
-
-// Simplified implementations for wavetable oscillator and formant shifter
-void MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::initializeWavetables() {
-    // Generate basic wavetables (sine, saw, square, etc.)
-    for (int table = 0; table < NUM_WAVETABLES; table++) {
-        for (int i = 0; i < WAVETABLE_SIZE; i++) {
-            float phase = 2.0f * M_PI * i / WAVETABLE_SIZE;
-            
-            if (table == 0) {
-                // Sine wave
-                wavetables[table][i] = std::sin(phase);
-            } else {
-                // Progressive harmonic content
-                float harmonic = 1.0f + table * 0.1f;
-                wavetables[table][i] = std::sin(phase * harmonic) * (1.0f / harmonic);
-            }
+    for (size_t i = 0; i < frames; i++) {
+        left[i] += mixed[i];
+    }
+    if (right) {
+        for (size_t i = 0; i < frames; i++) {
+            right[i] += mixed[i];
         }
     }
-    wavetablesInitialized = true;
 }
 
-void MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::setFrequency(float freq, float sampleRate) {
+// Wavetable oscillator
+void MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::setFrequency(const WavetableBank& bank, float freq, float sampleRate) {
     frequency = freq;
     this->sampleRate = sampleRate;
     increment = frequency / sampleRate;
+    mipLevel = bank.selectLevel(increment);
 }
 
 void MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::setPosition(float pos) {
     position = std::clamp(pos, 0.0f, 1.0f);
 }
 
-float MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::process() {
-    if (!wavetablesInitialized) return 0.0f;
-    
-    // Select wavetables for interpolation
-    float scaledPos = position * (NUM_WAVETABLES - 1);
+void MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::processBlock(const WavetableBank& bank, float* out, size_t frames, float gain) {
+    // Table pair is fixed for the block
+    float scaledPos = position * static_cast<float>(bank.getTableCount() - 1);
     int tableA = static_cast<int>(scaledPos);
-    int tableB = std::min(tableA + 1, NUM_WAVETABLES - 1);
-    float fraction = scaledPos - tableA;
-    
-    // Interpolate between wavetables
-    float output = interpolateWavetable(tableA, tableB, fraction, phase);
-    
-    // Update phase
-    phase += increment;
-    if (phase >= 1.0f) phase -= 1.0f;
-    
-    return output;
-}
-
-float MacroWavetableEngine::MacroWavetableVoice::WavetableOscillator::interpolateWavetable(int tableA, int tableB, float fraction, float phase) const {
-    // Simple linear interpolation between tables and samples
-    float scaledPhase = phase * WAVETABLE_SIZE;
-    int sampleA = static_cast<int>(scaledPhase) % WAVETABLE_SIZE;
-    int sampleB = (sampleA + 1) % WAVETABLE_SIZE;
-    float sampleFraction = scaledPhase - static_cast<int>(scaledPhase);
-    
-    // Interpolate within table A
-    float outputA = wavetables[tableA][sampleA] * (1.0f - sampleFraction) + 
-                    wavetables[tableA][sampleB] * sampleFraction;
+    int tableB = std::min(tableA + 1, bank.getTableCount() - 1);
+    float fraction = scaledPos - static_cast<float>(tableA);
     
-    // Interpolate within table B
-    float outputB = wavetables[tableB][sampleA] * (1.0f - sampleFraction) + 
-                    wavetables[tableB][sampleB] * sampleFraction;
-    
-    // Interpolate between tables
-    return outputA * (1.0f - fraction) + outputB * fraction;
+    bank.render(tableA, tableB, fraction, mipLevel, phase, increment, gain, out, frames);
 }
 
 // Simplified formant shifter
@@ -780,6 +755,20 @@ float MacroWavetableEngine::MacroWavetableVoice::FormantShifter::process(float i
     return tilted;
 }
 
+void MacroWavetableEngine::MacroWavetableVoice::FormantShifter::processBlock(float* io, size_t frames) {
+    // Same as process() with the shift offset and tilt gain computed once per block
+    float shiftRatio = std::pow(2.0f, shiftSemitones / 12.0f);
+    float readOffset = 1.0f / shiftRatio;
+    int readIdx = static_cast<int>(readIndex + readOffset * BUFFER_SIZE) % BUFFER_SIZE;
+    float tiltGain = std::pow(10.0f, spectralTilt / 20.0f);
+    
+    for (size_t i = 0; i < frames; i++) {
+        buffer[writeIndex] = io[i];
+        writeIndex = (writeIndex + 1) & (BUFFER_SIZE - 1);
+        io[i] = buffer[readIdx] * tiltGain;
+    }
+}
+
 float MacroWavetableEngine::MacroWavetableVoice::FormantShifter::applySpectralTilt(float input) {
     // Simple high-frequency emphasis/de-emphasis
     float tiltGain = std::pow(10.0f, spectralTilt / 20.0f);
@@ -828,6 +817,55 @@ float MacroWavetableEngine::MacroWavetableVoice::Envelope::process() {
     return level;
 }
 
+bool MacroWavetableEngine::MacroWavetableVoice::Envelope::applyBlock(float* io, size_t frames, float gain) {
+    const float attackRate = 1.0f / (attack * sampleRate);
+    const float decayRate = 1.0f / (decay * sampleRate);
+    const float releaseRate = 1.0f / (release * sampleRate);
+    
+    for (size_t i = 0; i < frames; i++) {
+        switch (stage) {
+            case Stage::IDLE:
+                level = 0.0f;
+                break;
+                
+            case Stage::ATTACK:
+                level += attackRate;
+                if (level >= 1.0f) {
+                    level = 1.0f;
+                    stage = Stage::DECAY;
+                }
+                break;
+                
+            case Stage::DECAY:
+                level -= decayRate;
+                if (level <= sustain) {
+                    level = sustain;
+                    stage = Stage::SUSTAIN;
+                }
+                break;
+                
+            case Stage::SUSTAIN:
+                level = sustain;
+                break;
+                
+            case Stage::RELEASE:
+                level -= releaseRate;
+                if (level <= 0.0f) {
+                    level = 0.0f;
+                    stage = Stage::IDLE;
+                }
+                break;
+        }
+        
+        io[i] *= level * gain;
+        if (stage == Stage::IDLE) {
+            std::fill(io + i + 1, io + frames, 0.0f);
+            return false;
+        }
+    }
+    return true;
+}
+
 void MacroWavetableEngine::MacroWavetableVoice::setWavetableParams(float position, const CornerSources::BlendWeights& blend) {
     wavetablePosition_ = position;
     currentBlend_ = blend;
@@ -840,9 +878,6 @@ void MacroWavetableEngine::MacroWavetableVoice::setFormantParams(float formantSh
     formantShifter_.setTilt(spectralTilt);
 }
 
-void MacroWavetableEngine::MacroWavetableVoice::setVolume(float volume) {
-    volume_ = volume;
-}
 
 void MacroWavetableEngine::MacroWavetableVoice::setEnvelopeParams(float attack, float decay, float sustain, float release) {
     envelope_.attack = attack;
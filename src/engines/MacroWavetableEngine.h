@@ -1,5 +1,6 @@
 #pragma once
 #include "../synthesis/SynthEngine.h"
+#include "../audio/WavetableBank.h"
 #include <array>
 #include <memory>
 #include <vector>
@@ -12,12 +13,13 @@
  * MORPH: Vector Path Scrub (see Vector Path system)
  * 
  * Features:
- * - Band-limited wavetable interpolation
+ * - Mip-mapped, band-limited tables from the shared WavetableBank
  * - Formant shifting and spectral tilt
  * - Vector Path scrubbing with 4 corner sources (A/B/C/D)
  * - Catmull-Rom interpolation between waypoints
  * - Equal-power bilinear blending
  * - Latch mode for automatic path traversal
+ * - Block rendering: per-block table/gain setup, tight per-sample loops
  */
 class MacroWavetableEngine : public SynthEngine {
 public:
@@ -43,6 +45,7 @@ public:
     size_t getActiveVoiceCount() const override;
     size_t getMaxVoiceCount() const override { return MAX_VOICES; }
     void setVoiceCount(size_t maxVoices) override;
+    bool attachVoiceManager(VoiceManager* manager, int slot) override;
     
     float getCPUUsage() const override { return cpuUsage_; }
     
@@ -55,6 +58,7 @@ public:
     bool supportsPolyAftertouch() const override { return true; }
     bool supportsModulation(ParameterID target) const override;
     void setModulation(ParameterID target, float amount) override;
+    void setModulationBuffer(ParameterID target, const float* values, size_t frames) override;
     
     // H/T/M Macro Controls
     void setHarmonics(float harmonics);    // 0-1: wavetable position scan
@@ -119,8 +123,11 @@ private:
         void noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate);
         void noteOff();
         void setAftertouch(float aftertouch);
+        void kill();                        // Silence immediately (voice stolen)
+        float getLevel() const { return envelope_.level * velocity_; }
         
-        AudioFrame processSample();
+        // Adds frames of output to left (and right unless null)
+        void processBlock(float* left, float* right, size_t frames);
         
         bool isActive() const { return active_; }
         bool isReleasing() const { return envelope_.isReleasing(); }
@@ -130,34 +137,21 @@ private:
         // Parameter control
         void setWavetableParams(float position, const CornerSources::BlendWeights& blend);
         void setFormantParams(float formantShift, float spectralTilt);
-        void setVolume(float volume);
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
         
     private:
-        // Wavetable oscillator with band-limited interpolation
+        // Wavetable oscillator: scans the bank's tables, mip level chosen per note
         struct WavetableOscillator {
-            static constexpr int WAVETABLE_SIZE = 2048;
-            static constexpr int NUM_WAVETABLES = 64;
-            
             float phase = 0.0f;
             float frequency = 440.0f;
             float increment = 0.0f;
             float position = 0.0f;        // 0-1 through wavetables
             float sampleRate = 48000.0f;
+            int mipLevel = 0;
             
-            // Simplified wavetable data (in practice, loaded from files)
-            static float wavetables[NUM_WAVETABLES][WAVETABLE_SIZE];
-            static bool wavetablesInitialized;
-            
-            void setFrequency(float freq, float sampleRate);
+            void setFrequency(const WavetableBank& bank, float freq, float sampleRate);
             void setPosition(float pos);
-            float process();
-            
-            static void initializeWavetables();
-            
-        private:
-            float interpolateWavetable(int tableA, int tableB, float fraction, float phase) const;
-            float bandLimitedInterpolation(const float* table, float phase, float freq) const;
+            void processBlock(const WavetableBank& bank, float* out, size_t frames, float gain);  // Accumulates gain * output
         };
         
         // Formant shifter (simplified implementation)
@@ -167,7 +161,7 @@ private:
             
             // Ring buffer for pitch shifting
             static constexpr int BUFFER_SIZE = 4096;
-            float buffer[BUFFER_SIZE];
+            float buffer[BUFFER_SIZE] = {};
             int writeIndex = 0;
             int readIndex = 0;
             float crossfade = 0.0f;
@@ -175,6 +169,7 @@ private:
             void setShift(float semitones);
             void setTilt(float tiltDb);
             float process(float input);
+            void processBlock(float* io, size_t frames);
             
         private:
             float applySpectralTilt(float input);
@@ -211,6 +206,7 @@ private:
             }
             
             float process();
+            bool applyBlock(float* io, size_t frames, float gain);  // false once finished
         };
         
         bool active_ = false;
@@ -220,6 +216,7 @@ private:
         uint32_t age_ = 0;
         
         // Four wavetable oscillators for corner blending
+        std::shared_ptr<const WavetableBank> bank_;
         WavetableOscillator oscA_, oscB_, oscC_, oscD_;
         FormantShifter formantShifter_;
         Envelope envelope_;
@@ -229,7 +226,6 @@ private:
         CornerSources::BlendWeights currentBlend_;
         float formantShift_ = 0.0f;    // -6 to +6 semitones
         float spectralTilt_ = 0.0f;    // ±3 dB
-        float volume_ = 0.8f;
         float noteFrequency_ = 440.0f;
     };
     
@@ -241,6 +237,8 @@ private:
     MacroWavetableVoice* findVoice(uint8_t note);
     MacroWavetableVoice* stealVoice();
     
+    std::array<float, BUFFER_SIZE> monoBuffer_{};
+    
     // H/T/M Parameters
     float harmonics_ = 0.0f;     // wavetable position scan
     float timbre_ = 0.5f;        // formant shift + spectral tilt
@@ -269,6 +267,8 @@ private:
     
     // Modulation
     std::array<float, static_cast<size_t>(ParameterID::COUNT)> modulation_;
+    std::array<float, BUFFER_SIZE> volumeMod_{};   // Per-frame volume offset, applied to the mix
+    bool volumeModActive_ = false;
     
     // Parameter calculation and voice updates
     void calculateDerivedParams();
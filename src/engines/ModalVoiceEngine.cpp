@@ -0,0 +1,323 @@
+#include "ModalVoiceEngine.h"
+#include "../audio/SIMDOptimizations.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float SILENCE = 1e-5f;   // Peak below which a voice has rung out
+
+    float noiseSample(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return static_cast<float>(static_cast<int32_t>(state)) * (1.0f / 2147483648.0f);
+    }
+}
+
+ModalVoiceEngine::ModalVoiceEngine(Model model)
+    : model_(model), sampleRate_(44100.0f), initialized_(false), cpuUsage_(0.0f) {
+    if (model_ == Model::ELEMENTS) damping_ = 0.5f;
+    voices_.resize(maxVoices_);
+    for (size_t i = 0; i < voices_.size(); ++i) voices_[i].noise = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+}
+
+ModalVoiceEngine::~ModalVoiceEngine() {
+    shutdown();
+}
+
+bool ModalVoiceEngine::initialize(float sampleRate) {
+    if (initialized_) {
+        return true;
+    }
+
+    sampleRate_ = sampleRate;
+    initialized_ = true;
+    const int resolution = resolutionFor(voices_.size());
+    for (auto& v : voices_) {
+        v.active = false;
+        v.bank.reset();
+        v.bank.setResolution(resolution);
+    }
+    return true;
+}
+
+void ModalVoiceEngine::shutdown() {
+    if (!initialized_) {
+        return;
+    }
+
+    allNotesOff();
+    initialized_ = false;
+}
+
+EngineType ModalVoiceEngine::getType() const {
+    return model_ == Model::RINGS ? EngineType::RINGS_MODAL : EngineType::ELEMENTS_MODAL;
+}
+
+const char* ModalVoiceEngine::getName() const {
+    return model_ == Model::RINGS ? "RingsModal" : "ElementsModal";
+}
+
+const char* ModalVoiceEngine::getDescription() const {
+    return model_ == Model::RINGS ? "Rings modal resonator with strike exciter"
+                                  : "Elements modal resonator with bow/blow and strike exciters";
+}
+
+void ModalVoiceEngine::noteOn(uint8_t note, float velocity, float /*aftertouch*/) {
+    Voice* v = findFreeVoice();
+    if (!v) v = stealVoice();
+    if (!v) return;
+    if (!v->active) v->bank.reset();   // A retriggered voice keeps ringing into the new strike
+    v->active = true;
+    v->gate = true;
+    v->note = note;
+    v->velocity = std::clamp(velocity, 0.0f, 1.0f);
+    v->frequency = noteToFrequency(note);
+    v->impulse = true;
+    v->strike = 1.0f;
+    v->level = 1.0f;
+    v->age = 0;
+}
+
+void ModalVoiceEngine::noteOff(uint8_t note) {
+    for (auto& v : voices_) if (v.active && v.note == note) v.gate = false;
+}
+
+void ModalVoiceEngine::setAftertouch(uint8_t /*note*/, float /*aftertouch*/) {
+    // Not supported
+}
+
+void ModalVoiceEngine::allNotesOff() {
+    for (auto& v : voices_) {
+        v.active = false;
+        v.gate = false;
+        v.blow = 0.0f;
+        v.impulse = false;
+        v.strike = 0.0f;
+        v.bank.reset();
+    }
+}
+
+void ModalVoiceEngine::setParameter(ParameterID param, float value) {
+    switch (param) {
+        case ParameterID::HARMONICS:
+            structure_ = value;
+            break;
+        case ParameterID::TIMBRE:
+            brightness_ = value;
+            break;
+        case ParameterID::MORPH:
+            if (model_ == Model::RINGS) damping_ = value; else morph_ = value;
+            break;
+        case ParameterID::OSC_MIX:
+            position_ = value;
+            break;
+        case ParameterID::DECAY:
+            damping_ = value;
+            break;
+        case ParameterID::ATTACK:
+            attack_ = 0.001f + value * 0.5f;
+            break;
+        case ParameterID::RELEASE:
+            release_ = 0.01f + value * 2.0f;
+            break;
+        case ParameterID::VOLUME:
+            volume_ = value;
+            break;
+        case ParameterID::PAN:
+            pan_ = value;
+            break;
+        default:
+            break;
+    }
+}
+
+float ModalVoiceEngine::getParameter(ParameterID param) const {
+    switch (param) {
+        case ParameterID::HARMONICS: return structure_;
+        case ParameterID::TIMBRE: return brightness_;
+        case ParameterID::MORPH: return model_ == Model::RINGS ? damping_ : morph_;
+        case ParameterID::OSC_MIX: return position_;
+        case ParameterID::DECAY: return damping_;
+        case ParameterID::ATTACK: return attack_;
+        case ParameterID::RELEASE: return release_;
+        case ParameterID::VOLUME: return volume_;
+        case ParameterID::PAN: return pan_;
+        default:
+            return 0.0f;
+    }
+}
+
+bool ModalVoiceEngine::hasParameter(ParameterID param) const {
+    switch (param) {
+        case ParameterID::HARMONICS:
+        case ParameterID::TIMBRE:
+        case ParameterID::MORPH:
+        case ParameterID::OSC_MIX:
+        case ParameterID::DECAY:
+        case ParameterID::RELEASE:
+        case ParameterID::VOLUME:
+        case ParameterID::PAN:
+            return true;
+        case ParameterID::ATTACK:
+            return model_ == Model::ELEMENTS;   // Only the bow/blow exciter has a rise
+        default:
+            return false;
+    }
+}
+
+void ModalVoiceEngine::processAudio(EtherAudioBuffer& outputBuffer) {
+    outputBuffer.fill(AudioFrame(0.0f, 0.0f));
+    if (!initialized_) return;
+    const size_t frames = std::min(bufferSize_, outputBuffer.size());
+
+    // Released voices fade by this much per block (-60 dB over release_)
+    const float releaseStep = std::exp(-6.9f * static_cast<float>(frames) / (release_ * sampleRate_));
+    for (auto& v : voices_) {
+        if (!v.active) continue;
+        v.age += static_cast<uint32_t>(frames);
+
+        v.bank.setFrequency(v.frequency, sampleRate_);
+        v.bank.setStructure(structure_);
+        v.bank.setBrightness(brightness_);
+        v.bank.setDamping(damping_);
+        v.bank.setPosition(position_);
+        renderExcitation(v, frames);
+
+        // The bank adds into its outputs
+        std::fill(odd_.begin(), odd_.begin() + frames, 0.0f);
+        std::fill(even_.begin(), even_.begin() + frames, 0.0f);
+        v.bank.process(excitation_.data(), odd_.data(), even_.data(), frames);
+
+        const float start = v.level;
+        const float end = v.gate ? 1.0f : start * releaseStep;
+        const float step = (end - start) / static_cast<float>(frames);
+        float level = start, peak = 0.0f;
+        for (size_t i = 0; i < frames; ++i) {
+            level += step;
+            outputBuffer[i].left += odd_[i] * level;
+            outputBuffer[i].right += even_[i] * level;
+            peak = std::max(peak, std::max(std::fabs(odd_[i]), std::fabs(even_[i])) * level);
+        }
+        v.level = end;
+
+        const bool exciting = v.impulse || v.strike > 0.0f || v.blow > 0.0f;
+        if (!exciting && peak < SILENCE) v.active = false;
+    }
+
+    // Odd modes left, even right; pan balances them, unity at centre
+    const float pan = std::clamp(pan_, 0.0f, 1.0f);
+    const float l = 1.41421356f * volume_ * EtherSynthSIMD::SIMD::sinHalfPi(1.0f - pan);
+    const float r = 1.41421356f * volume_ * EtherSynthSIMD::SIMD::sinHalfPi(pan);
+    for (size_t i = 0; i < frames; ++i) {
+        outputBuffer[i].left *= l;
+        outputBuffer[i].right *= r;
+    }
+}
+
+void ModalVoiceEngine::renderExcitation(Voice& v, size_t frames) {
+    // Strike: an impulse and a short noise burst, like Rings' internal exciter,
+    // through a one-pole lowpass that opens with brightness
+    const float tone = 0.05f + 0.9f * brightness_ * brightness_;
+    const float burst = std::exp(-1.0f / (0.002f * sampleRate_));     // ~2 ms
+    const float strikeLevel = model_ == Model::ELEMENTS ? 1.0f - morph_ : 1.0f;
+    const float blowLevel = model_ == Model::ELEMENTS ? morph_ * 0.25f : 0.0f;
+    const float rise = 1.0f / (attack_ * sampleRate_);
+    const float fall = 1.0f / (0.05f * sampleRate_);
+    float* out = excitation_.data();
+
+    for (size_t i = 0; i < frames; ++i) {
+        const float noise = noiseSample(v.noise);
+        float x = 0.0f;
+        if (v.impulse) {
+            x += 2.0f * strikeLevel;
+            v.impulse = false;
+        }
+        if (v.strike > SILENCE) {
+            x += v.strike * noise * strikeLevel;
+            v.strike *= burst;
+        } else {
+            v.strike = 0.0f;
+        }
+        // Bow/blow: noise held under the gate, ELEMENTS only
+        if (blowLevel > 0.0f) {
+            v.blow = v.gate ? std::min(1.0f, v.blow + rise) : std::max(0.0f, v.blow - fall);
+            x += noise * v.blow * blowLevel;
+        } else {
+            v.blow = 0.0f;
+        }
+        v.tone += tone * (x - v.tone);
+        out[i] = v.tone * v.velocity;
+    }
+    if (std::fabs(v.tone) < 1e-20f) v.tone = 0.0f;   // Keep the idle lowpass out of denormals
+}
+
+int ModalVoiceEngine::resolutionFor(size_t voices) const {
+    const int modes = static_cast<int>(128 / std::max<size_t>(voices, 1));
+    return std::clamp(modes, 16, ModalResonatorBank::MAX_MODES) & ~7;
+}
+
+size_t ModalVoiceEngine::getActiveVoiceCount() const { size_t n = 0; for (auto& v : voices_) if (v.active) n++; return n; }
+
+void ModalVoiceEngine::setVoiceCount(size_t maxVoices) {
+    maxVoices_ = std::clamp<size_t>(maxVoices, 1, MAX_VOICES);
+    voices_.assign(maxVoices_, Voice{});
+    const int resolution = resolutionFor(maxVoices_);
+    for (size_t i = 0; i < voices_.size(); ++i) {
+        voices_[i].noise = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        voices_[i].bank.setResolution(resolution);
+    }
+}
+
+void ModalVoiceEngine::savePreset(uint8_t* data, size_t maxSize, size_t& actualSize) const {
+    actualSize = 0;
+    if (maxSize < sizeof(float) * 5) {
+        return;
+    }
+
+    float* floatData = reinterpret_cast<float*>(data);
+    floatData[0] = structure_;
+    floatData[1] = brightness_;
+    floatData[2] = damping_;
+    floatData[3] = position_;
+    floatData[4] = morph_;
+    actualSize = sizeof(float) * 5;
+}
+
+bool ModalVoiceEngine::loadPreset(const uint8_t* data, size_t size) {
+    if (size < sizeof(float) * 5) {
+        return false;
+    }
+
+    const float* floatData = reinterpret_cast<const float*>(data);
+    structure_ = floatData[0];
+    brightness_ = floatData[1];
+    damping_ = floatData[2];
+    position_ = floatData[3];
+    morph_ = floatData[4];
+    return true;
+}
+
+void ModalVoiceEngine::setSampleRate(float sampleRate) {
+    if (sampleRate_ != sampleRate || !initialized_) {
+        shutdown();
+        initialize(sampleRate);
+    }
+}
+
+void ModalVoiceEngine::setBufferSize(size_t bufferSize) {
+    bufferSize_ = bufferSize;
+}
+
+float ModalVoiceEngine::getCPUUsage() const { return cpuUsage_; }
+
+ModalVoiceEngine::Voice* ModalVoiceEngine::findFreeVoice() { for (auto& v : voices_) if (!v.active) return &v; return nullptr; }
+
+ModalVoiceEngine::Voice* ModalVoiceEngine::stealVoice() {
+    // Prefer the oldest released voice, then the oldest held one
+    Voice* oldest = nullptr;
+    for (auto& v : voices_) {
+        if (!oldest || (oldest->gate && !v.gate) || (oldest->gate == v.gate && v.age > oldest->age)) oldest = &v;
+    }
+    return oldest;
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include "../synthesis/SynthEngine.h"
+#include "../core/Types.h"
+#include "../audio/ModalResonatorBank.h"
+#include <array>
+#include <vector>
+
+/**
+ * ModalVoice Engine - Polyphonic modal resonator voices after Rings and Elements
+ *
+ * Each voice is an exciter feeding a ModalResonatorBank, the block-processed
+ * port of Rings' modal resonator. The RINGS model plucks/strikes the bank on
+ * note-on like Rings' internal exciter; the ELEMENTS model adds Elements'
+ * sustained bow/blow noise under a gate, blended with the strike.
+ *
+ * HARMONICS: structure (bell .. harmonic .. stretched partials)
+ * TIMBRE: brightness
+ * MORPH: damping (RINGS) or strike <-> bow/blow balance (ELEMENTS)
+ * OSC_MIX: excitation position
+ *
+ * Features:
+ * - Whole blocks per voice: exciter block, then one resonator pass
+ * - Mode count per voice scales with polyphony, as Rings trades resolution
+ *   for voices (64 modes at 2 voices, 16 at 8 and above)
+ * - Odd modes left, even modes right, Rings' stereo split
+ * - Voices free themselves once released or rung out
+ */
+class ModalVoiceEngine : public SynthEngine {
+public:
+    enum class Model { RINGS, ELEMENTS };
+
+    explicit ModalVoiceEngine(Model model = Model::RINGS);
+    ~ModalVoiceEngine();
+
+    // Initialization
+    bool initialize(float sampleRate);
+    void shutdown();
+
+    // SynthEngine interface implementation
+    EngineType getType() const override;
+    const char* getName() const override;
+    const char* getDescription() const override;
+
+    // SynthEngine note methods
+    void noteOn(uint8_t note, float velocity, float aftertouch = 0.0f) override;
+    void noteOff(uint8_t note) override;
+    void setAftertouch(uint8_t note, float aftertouch) override;
+    void allNotesOff() override;
+
+    // SynthEngine parameter methods
+    void setParameter(ParameterID param, float value) override;
+    float getParameter(ParameterID param) const override;
+    bool hasParameter(ParameterID param) const override;
+
+    // SynthEngine audio processing
+    void processAudio(EtherAudioBuffer& outputBuffer) override;
+
+    // SynthEngine voice management
+    size_t getActiveVoiceCount() const override;
+    size_t getMaxVoiceCount() const override { return voices_.size(); }
+    void setVoiceCount(size_t maxVoices) override;
+
+    // SynthEngine preset methods
+    void savePreset(uint8_t* data, size_t maxSize, size_t& actualSize) const override;
+    bool loadPreset(const uint8_t* data, size_t size) override;
+
+    // SynthEngine configuration
+    void setSampleRate(float sampleRate) override;
+    void setBufferSize(size_t bufferSize) override;
+    float getCPUUsage() const override;
+
+    Model getModel() const { return model_; }
+
+private:
+    Model model_;
+
+    // Core state
+    float sampleRate_;
+    bool initialized_;
+
+    // Resonator
+    float structure_ = 0.25f;
+    float brightness_ = 0.5f;
+    float damping_ = 0.7f;
+    float position_ = 0.3f;
+
+    // Exciter
+    float morph_ = 0.5f;           // ELEMENTS: 0 strike .. 1 bow/blow
+    float attack_ = 0.05f;         // Bow/blow rise, seconds
+    float release_ = 0.5f;         // Fade after note-off, seconds
+
+    // Global params
+    float volume_ = 0.8f;
+    float pan_ = 0.5f;
+
+    // Performance
+    float cpuUsage_;
+
+    struct Voice {
+        bool active = false;
+        bool gate = false;
+        bool impulse = false;      // Strike transient due on the next sample
+        uint8_t note = 0;
+        float velocity = 0.8f;
+        float frequency = 220.0f;
+        float strike = 0.0f;       // Strike burst envelope
+        float blow = 0.0f;         // Sustained exciter envelope
+        float tone = 0.0f;         // Exciter lowpass state
+        float level = 1.0f;        // Release fade
+        uint32_t noise = 1;
+        uint32_t age = 0;          // For stealing
+        ModalResonatorBank bank;
+    };
+
+    // Voices
+    std::vector<Voice> voices_;
+    size_t maxVoices_ = 4;
+
+    // Block scratch, one voice at a time
+    std::array<float, BUFFER_SIZE> excitation_{};
+    std::array<float, BUFFER_SIZE> odd_{};
+    std::array<float, BUFFER_SIZE> even_{};
+
+    // Helpers
+    void renderExcitation(Voice& v, size_t frames);
+    int resolutionFor(size_t voices) const;
+    Voice* findFreeVoice();
+    Voice* stealVoice();
+};
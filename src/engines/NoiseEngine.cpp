@@ -10,6 +10,11 @@ NoiseEngine::NoiseEngine() {
     // Initialize modulation array
     modulation_.fill(0.0f);
     
+    // Distinct but fixed seed per voice (repeatable renders)
+    for (size_t i = 0; i < voices_.size(); ++i) {
+        voices_[i].setSeed(12345u + static_cast<uint32_t>(i) * 2654435761u);
+    }
+    
     // Calculate initial derived parameters
     calculateDerivedParams();
     
@@ -149,7 +154,7 @@ void NoiseEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            for (size_t i = 0; i < bufferSize_; i++) {
                 AudioFrame voiceFrame = voice.processSample();
                 outputBuffer[i] += voiceFrame;
             }
@@ -262,7 +267,7 @@ void NoiseEngine::NoiseSource::calculateFromMorph(float morph) {
     currentType = static_cast<Type>(typeIndex);
 }
 
-float NoiseEngine::NoiseSource::generateSample(uint32_t& seed) const {
+float NoiseEngine::NoiseSource::generateSample(uint32_t& seed, State& state) const {
     float sample1 = 0.0f;
     float sample2 = 0.0f;
     
@@ -270,26 +275,26 @@ float NoiseEngine::NoiseSource::generateSample(uint32_t& seed) const {
     switch (currentType) {
         case Type::WHITE:
             sample1 = generateWhite(seed);
-            sample2 = generatePink(seed);
+            sample2 = generatePink(seed, state);
             break;
         case Type::PINK:
-            sample1 = generatePink(seed);
-            sample2 = generateBrown(seed);
+            sample1 = generatePink(seed, state);
+            sample2 = generateBrown(seed, state);
             break;
         case Type::BROWN:
-            sample1 = generateBrown(seed);
-            sample2 = generateBlue(seed);
+            sample1 = generateBrown(seed, state);
+            sample2 = generateBlue(seed, state);
             break;
         case Type::BLUE:
-            sample1 = generateBlue(seed);
+            sample1 = generateBlue(seed, state);
             sample2 = generateVelvet(seed);
             break;
         case Type::VELVET:
             sample1 = generateVelvet(seed);
-            sample2 = generateCrackle(seed);
+            sample2 = generateCrackle(seed, state);
             break;
         case Type::CRACKLE:
-            sample1 = generateCrackle(seed);
+            sample1 = generateCrackle(seed, state);
             sample2 = generateWhite(seed);
             break;
     }
@@ -303,9 +308,10 @@ float NoiseEngine::NoiseSource::generateWhite(uint32_t& seed) const {
     return (static_cast<float>(seed) / 4294967296.0f) - 0.5f;
 }
 
-float NoiseEngine::NoiseSource::generatePink(uint32_t& seed) const {
+float NoiseEngine::NoiseSource::generatePink(uint32_t& seed, State& state) const {
     // Simplified pink noise using white noise and filtering
-    static float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f, b3 = 0.0f, b4 = 0.0f, b5 = 0.0f, b6 = 0.0f;
+    float& b0 = state.pink[0]; float& b1 = state.pink[1]; float& b2 = state.pink[2]; float& b3 = state.pink[3];
+    float& b4 = state.pink[4]; float& b5 = state.pink[5]; float& b6 = state.pink[6];
     
     float white = generateWhite(seed);
     b0 = 0.99886f * b0 + white * 0.0555179f;
@@ -321,9 +327,9 @@ float NoiseEngine::NoiseSource::generatePink(uint32_t& seed) const {
     return pink * 0.11f; // Scale down
 }
 
-float NoiseEngine::NoiseSource::generateBrown(uint32_t& seed) const {
+float NoiseEngine::NoiseSource::generateBrown(uint32_t& seed, State& state) const {
     // Brown noise (integrated white noise)
-    static float lastBrown = 0.0f;
+    float& lastBrown = state.lastBrown;
     
     float white = generateWhite(seed);
     lastBrown = (lastBrown + white * 0.02f);
@@ -332,9 +338,9 @@ float NoiseEngine::NoiseSource::generateBrown(uint32_t& seed) const {
     return lastBrown;
 }
 
-float NoiseEngine::NoiseSource::generateBlue(uint32_t& seed) const {
+float NoiseEngine::NoiseSource::generateBlue(uint32_t& seed, State& state) const {
     // Blue noise (differentiated white noise)
-    static float lastWhite = 0.0f;
+    float& lastWhite = state.lastWhite;
     
     float white = generateWhite(seed);
     float blue = white - lastWhite;
@@ -354,10 +360,10 @@ float NoiseEngine::NoiseSource::generateVelvet(uint32_t& seed) const {
     return sample;
 }
 
-float NoiseEngine::NoiseSource::generateCrackle(uint32_t& seed) const {
+float NoiseEngine::NoiseSource::generateCrackle(uint32_t& seed, State& state) const {
     // Crackle noise (chaotic bursts)
-    static float energy = 0.0f;
-    static int burstLength = 0;
+    float& energy = state.energy;
+    int& burstLength = state.burstLength;
     
     if (burstLength > 0) {
         burstLength--;
@@ -492,14 +498,14 @@ void NoiseEngine::setModulation(ParameterID target, float amount) {
 }
 
 void NoiseEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
 // NoiseVoice implementation
 NoiseEngine::NoiseVoice::NoiseVoice() {
     envelope_.sampleRate = 48000.0f;
-    randomSeed_ = 12345 + reinterpret_cast<uintptr_t>(this); // Unique seed per voice
+    randomSeed_ = 12345; // NoiseEngine gives each voice its own seed
 }
 
 void NoiseEngine::NoiseVoice::noteOn(uint8_t note, float velocity, float aftertouch, float sampleRate) {
@@ -662,7 +668,7 @@ void NoiseEngine::NoiseVoice::triggerGrain() {
 }
 
 float NoiseEngine::NoiseVoice::generateNoiseSample() {
-    return noiseSource_.generateSample(randomSeed_);
+    return noiseSource_.generateSample(randomSeed_, noiseState_);
 }
 
 float NoiseEngine::NoiseVoice::randomFloat() {
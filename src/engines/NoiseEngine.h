@@ -84,19 +84,28 @@ private:
             CRACKLE         // Crackle noise (chaotic)
         };
         
+        // Filter and burst memory; owned by each voice so voices never share it
+        struct State {
+            float pink[7] = { };
+            float lastBrown = 0.0f;
+            float lastWhite = 0.0f;
+            float energy = 0.0f;
+            int burstLength = 0;
+        };
+        
         Type currentType = Type::WHITE;
         float blend = 0.0f;            // Blend between two sources
         
         void calculateFromMorph(float morph);
-        float generateSample(uint32_t& seed) const;
+        float generateSample(uint32_t& seed, State& state) const;
         
     private:
         float generateWhite(uint32_t& seed) const;
-        float generatePink(uint32_t& seed) const;
-        float generateBrown(uint32_t& seed) const;
-        float generateBlue(uint32_t& seed) const;
+        float generatePink(uint32_t& seed, State& state) const;
+        float generateBrown(uint32_t& seed, State& state) const;
+        float generateBlue(uint32_t& seed, State& state) const;
         float generateVelvet(uint32_t& seed) const;
-        float generateCrackle(uint32_t& seed) const;
+        float generateCrackle(uint32_t& seed, State& state) const;
     };
     
     // Individual grain
@@ -156,6 +165,7 @@ private:
         void setNoiseSource(const NoiseSource& source);
         void setVolume(float volume);
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
+        void setSeed(uint32_t seed) { randomSeed_ = seed; }
         
     private:
         // Grain scheduler
@@ -239,6 +249,7 @@ private:
         // Current granular and noise settings
         GranularParams granularParams_;
         NoiseSource noiseSource_;
+        NoiseSource::State noiseState_;
         Envelope envelope_;
         
         // Helper methods
@@ -10,6 +10,11 @@ RingsVoiceEngine::RingsVoiceEngine() {
     // Initialize modulation array
     modulation_.fill(0.0f);
     
+    // Distinct but fixed seed per voice (repeatable renders)
+    for (size_t i = 0; i < voices_.size(); ++i) {
+        voices_[i].setSeed(12345u + static_cast<uint32_t>(i) * 2654435761u);
+    }
+    
     // Calculate initial derived parameters
     calculateDerivedParams();
     
@@ -153,7 +158,7 @@ void RingsVoiceEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         if (voice.isActive()) {
             activeVoices++;
             
-            for (size_t i = 0; i < BUFFER_SIZE; i++) {
+            for (size_t i = 0; i < bufferSize_; i++) {
                 AudioFrame voiceFrame = voice.processSample();
                 outputBuffer[i] += voiceFrame;
             }
@@ -406,15 +411,11 @@ void RingsVoiceEngine::ExciterSystem::calculateFromMorph(float morph) {
     }
 }
 
-float RingsVoiceEngine::ExciterSystem::generateExcitation(float velocity, float sampleRate) const {
-    static float phase = 0.0f;
-    static float time = 0.0f;
-    static uint32_t noiseState = 54321;
-    
-    phase += 1.0f / sampleRate;
-    time += 1.0f / sampleRate;
+float RingsVoiceEngine::ExciterSystem::generateExcitation(float velocity, float sampleRate, float time,
+                                                         float& bowPhase, uint32_t& noiseState) const {
+    bowPhase += 1.0f / sampleRate;
     
-    float bowEx = generateBowExcitation(velocity, phase);
+    float bowEx = generateBowExcitation(velocity, bowPhase);
     float blowEx = generateBlowExcitation(velocity, noiseState / 4294967296.0f);
     float strikeEx = generateStrikeExcitation(velocity, time);
     
@@ -562,14 +563,14 @@ void RingsVoiceEngine::setModulation(ParameterID target, float amount) {
 }
 
 void RingsVoiceEngine::updateCPUUsage(float processingTime) {
-    float maxTime = (BUFFER_SIZE / sampleRate_) * 1000.0f;
+    float maxTime = (bufferSize_ / sampleRate_) * 1000.0f;
     cpuUsage_ = std::min(100.0f, (processingTime / maxTime) * 100.0f);
 }
 
 // RingsVoiceImpl implementation
 RingsVoiceEngine::RingsVoiceImpl::RingsVoiceImpl() {
     envelope_.sampleRate = 48000.0f;
-    noiseState_ = 12345 + reinterpret_cast<uintptr_t>(this);
+    noiseState_ = 12345; // RingsVoiceEngine gives each voice its own seed
     
     // Initialize resonators with harmonic frequencies
     for (int i = 0; i < 4; i++) {
@@ -627,7 +628,8 @@ AudioFrame RingsVoiceEngine::RingsVoiceImpl::processSample() {
     excitationTime_ += 1.0f / sampleRate_;
     
     // Generate excitation
-    float excitation = exciterSystem_.generateExcitation(velocity_, sampleRate_);
+    float excitation = exciterSystem_.generateExcitation(velocity_, sampleRate_, excitationTime_,
+                                                          bowPhase_, exciterNoise_);
     
     // Process through resonators
     std::array<float, 4> resonatorOutputs;
@@ -109,7 +109,9 @@ private:
         float intensity = 0.5f;       // Overall excitation intensity
         
         void calculateFromMorph(float morph);
-        float generateExcitation(float velocity, float sampleRate) const;
+        // time: since note on; bowPhase and noiseState are the calling voice's state
+        float generateExcitation(float velocity, float sampleRate, float time,
+                                 float& bowPhase, uint32_t& noiseState) const;
         
     private:
         float generateBowExcitation(float velocity, float phase) const;
@@ -139,6 +141,7 @@ private:
         void setExciterSystem(const ExciterSystem& system);
         void setVolume(float volume);
         void setEnvelopeParams(float attack, float decay, float sustain, float release);
+        void setSeed(uint32_t seed) { noiseState_ = seed; exciterNoise_ = seed ^ 0x5bd1e995u; }
         
     private:
         // Multi-mode resonator filter
@@ -302,6 +305,8 @@ private:
         CouplingNetwork coupling_;
         Envelope envelope_;
         uint32_t noiseState_ = 12345;  // For breath noise generation
+        float bowPhase_ = 0.0f;        // Exciter bow clock
+        uint32_t exciterNoise_ = 54321; // Exciter blow noise
         
         // Voice parameters
         float volume_ = 0.8f;
@@ -91,7 +91,7 @@ void SamplerSlicerEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         return;
     }
     
-    for (size_t i = 0; i < BUFFER_SIZE; i++) {
+    for (size_t i = 0; i < bufferSize_; i++) {
         float sample = processSample();
         outputBuffer[i] = AudioFrame(sample, sample);
     }
@@ -134,7 +134,7 @@ void SamplerSlicerEngine::setSampleRate(float sampleRate) {
 }
 
 void SamplerSlicerEngine::setBufferSize(size_t bufferSize) {
-    // Buffer size changes handled automatically
+    bufferSize_ = bufferSize;
 }
 
 float SamplerSlicerEngine::getCPUUsage() const {
@@ -147,10 +147,9 @@ float SamplerSlicerEngine::processSample() {
     }
     
     // Simple oscillator for testing
-    static float phase = 0.0f;
     float freq = 440.0f * (1.0f + harmonics_);
-    phase += freq / sampleRate_;
-    if (phase >= 1.0f) phase -= 1.0f;
+    phase_ += freq / sampleRate_;
+    if (phase_ >= 1.0f) phase_ -= 1.0f;
     
-    return std::sin(phase * 2.0f * M_PI) * 0.1f;
+    return std::sin(phase_ * 2.0f * M_PI) * 0.1f;
 }
\ No newline at end of file
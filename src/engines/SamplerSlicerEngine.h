@@ -54,6 +54,7 @@ private:
     float sampleRate_;
     bool initialized_;
     bool active_;
+    float phase_ = 0.0f;       // Test oscillator phase (per instance)
     
     // HTM parameters
     float harmonics_ = 0.5f;   // Sensitivity
@@ -91,7 +91,7 @@ void SerialHPLPEngine::processAudio(EtherAudioBuffer& outputBuffer) {
         return;
     }
     
-    for (size_t i = 0; i < BUFFER_SIZE; i++) {
+    for (size_t i = 0; i < bufferSize_; i++) {
         float sample = processSample();
         outputBuffer[i] = AudioFrame(sample, sample);
     }
@@ -134,7 +134,7 @@ void SerialHPLPEngine::setSampleRate(float sampleRate) {
 }
 
 void SerialHPLPEngine::setBufferSize(size_t bufferSize) {
-    // Buffer size changes handled automatically
+    bufferSize_ = bufferSize;
 }
 
 float SerialHPLPEngine::getCPUUsage() const {
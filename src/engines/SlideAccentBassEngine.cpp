@@ -432,7 +432,8 @@ float SlideAccentBassEngine::processSample() {
     float subSignal = subOsc_.processSample();
     
     // Add noise for character
-    float noise = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 2.0f;
+    noiseState_ = noiseState_ * 1664525u + 1013904223u;
+    float noise = static_cast<float>(noiseState_ >> 8) * (2.0f / 16777216.0f) - 1.0f;
     mainSignal += noise * oscConfig_.noiseLevel;
     
     // Mix main and sub oscillators
@@ -849,7 +850,7 @@ bool SlideAccentBassEngine::hasParameter(ParameterID param) const {
 void SlideAccentBassEngine::processAudio(EtherAudioBuffer& outputBuffer) {
     // EtherAudioBuffer is std::array<AudioFrame, BUFFER_SIZE>
     // Process mono and duplicate to stereo
-    for (size_t i = 0; i < outputBuffer.size(); i++) {
+    for (size_t i = 0; i < bufferSize_; i++) {
         float sample = processSample();
         outputBuffer[i].left = sample;
         outputBuffer[i].right = sample;
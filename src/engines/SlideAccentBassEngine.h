@@ -213,6 +213,7 @@ private:
     ZDFLadderFilter filter_;
     ADSREnvelope ampEnvelope_;
     ADSREnvelope filterEnvelope_;
+    uint32_t noiseState_ = 0x1F123BB5u;   // Character noise (own generator, not rand())
     
     // Parameter smoothing
     ParameterSmoother cutoffSmoother_;
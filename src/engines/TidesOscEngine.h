@@ -215,6 +215,7 @@ private:
             float low = 0.0f, band = 0.0f, high = 0.0f;
             float f = 0.1f, q = 0.5f;
             float sampleRate = 48000.0f;
+            float modPhase = 0.0f;       // Material shimmer clock
             
             void setMaterial(FrequencyMaterial::MaterialType mat, float amt) {
                 type = mat;
@@ -278,9 +279,8 @@ private:
                 }
             }
             
-            float getMaterialModulation(float freq) const {
+            float getMaterialModulation(float freq) {
                 // Add subtle material-specific modulation
-                static float modPhase = 0.0f;
                 modPhase += 0.001f; // Slow modulation
                 
                 switch (type) {
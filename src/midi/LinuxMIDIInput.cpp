@@ -0,0 +1,322 @@
+#include "LinuxMIDIInput.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace {
+    constexpr int READER_PRIORITY = 70;      // Above UI threads, below a typical JACK/ALSA audio thread (80+)
+    constexpr uint8_t ACTIVE_SENSING = 0xFE;
+
+    bool startsWith(const std::string& s, const char* prefix) {
+        return s.compare(0, std::strlen(prefix), prefix) == 0;
+    }
+}
+
+LinuxMIDIInput::LinuxMIDIInput(MIDIInputQueue& queue) : queue_(queue) {}
+
+LinuxMIDIInput::~LinuxMIDIInput() {
+    close();
+}
+
+std::vector<LinuxMIDIInput::Port> LinuxMIDIInput::listPorts() {
+    std::vector<Port> ports;
+
+    // Raw MIDI devices: /dev/snd/midiC<card>D<device>
+    if (DIR* dir = opendir("/dev/snd")) {
+        std::vector<std::string> names;
+        while (dirent* entry = readdir(dir)) {
+            if (startsWith(entry->d_name, "midiC")) names.push_back(entry->d_name);
+        }
+        closedir(dir);
+        std::sort(names.begin(), names.end());
+        for (const auto& name : names) {
+            ports.push_back({"Raw MIDI " + name.substr(4), "raw:/dev/snd/" + name, Backend::RAW});
+        }
+    }
+
+#if ETHER_ENABLE_ALSA
+    // Sequencer ports other clients can be read from
+    snd_seq_t* seq = nullptr;
+    if (snd_seq_open(&seq, "default", SND_SEQ_OPEN_INPUT, SND_SEQ_NONBLOCK) == 0) {
+        snd_seq_client_info_t* client;
+        snd_seq_port_info_t* port;
+        snd_seq_client_info_alloca(&client);
+        snd_seq_port_info_alloca(&port);
+        snd_seq_client_info_set_client(client, -1);
+        while (snd_seq_query_next_client(seq, client) >= 0) {
+            const int id = snd_seq_client_info_get_client(client);
+            if (id == SND_SEQ_CLIENT_SYSTEM) continue;
+            snd_seq_port_info_set_client(port, id);
+            snd_seq_port_info_set_port(port, -1);
+            while (snd_seq_query_next_port(seq, port) >= 0) {
+                const unsigned int caps = snd_seq_port_info_get_capability(port);
+                const unsigned int wanted = SND_SEQ_PORT_CAP_READ | SND_SEQ_PORT_CAP_SUBS_READ;
+                if ((caps & wanted) != wanted) continue;
+                const int portId = snd_seq_port_info_get_port(port);
+                ports.push_back({std::string(snd_seq_client_info_get_name(client)) + ": " + snd_seq_port_info_get_name(port),
+                                 "seq:" + std::to_string(id) + ":" + std::to_string(portId), Backend::ALSA_SEQ});
+            }
+        }
+        snd_seq_close(seq);
+    }
+#endif
+
+#if ETHER_ENABLE_JACK
+    ports.push_back({"JACK MIDI input", "jack", Backend::JACK});
+#endif
+    return ports;
+}
+
+bool LinuxMIDIInput::open(const std::string& address) {
+    close();
+    lastError_.clear();
+
+    if (startsWith(address, "raw:")) {
+        const std::string path = address.substr(4);
+        int fd = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) {
+            lastError_ = "Cannot open " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        return openFd(fd);
+    }
+
+    if (startsWith(address, "seq")) {
+#if ETHER_ENABLE_ALSA
+        return openSequencer(address.size() > 4 ? address.substr(4) : std::string());
+#else
+        lastError_ = "ALSA sequencer support not compiled in (build with ETHER_ALSA=1)";
+        return false;
+#endif
+    }
+
+    if (startsWith(address, "jack")) {
+#if ETHER_ENABLE_JACK
+        return openJack(address.size() > 5 ? address.substr(5) : std::string());
+#else
+        lastError_ = "JACK support not compiled in (build with ETHER_JACK=1)";
+        return false;
+#endif
+    }
+
+    lastError_ = "Unknown MIDI address: " + address;
+    return false;
+}
+
+bool LinuxMIDIInput::openFd(int fd) {
+    if (fd < 0) return false;
+    if (isOpen()) close();
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    fd_ = fd;
+    backend_ = Backend::RAW;
+    parser_.reset();
+    if (!startReader(&LinuxMIDIInput::rawLoop)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void LinuxMIDIInput::close() {
+    if (running_.exchange(false)) {
+        if (wakePipe_[1] >= 0) {
+            const uint8_t wake = 1;
+            (void)!write(wakePipe_[1], &wake, 1);
+        }
+    }
+    if (reader_.joinable()) reader_.join();
+    for (int& end : wakePipe_) {
+        if (end >= 0) ::close(end);
+        end = -1;
+    }
+
+#if ETHER_ENABLE_JACK
+    if (jack_) {
+        jack_deactivate(jack_);
+        jack_client_close(jack_);
+        jack_ = nullptr;
+        jackPort_ = nullptr;
+    }
+#endif
+
+#if ETHER_ENABLE_ALSA
+    if (decoder_) {
+        snd_midi_event_free(decoder_);
+        decoder_ = nullptr;
+    }
+    if (seq_) {
+        snd_seq_close(seq_);
+        seq_ = nullptr;
+        seqPort_ = -1;
+    }
+#endif
+
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    backend_ = Backend::NONE;
+    realtime_.store(false, std::memory_order_relaxed);
+}
+
+bool LinuxMIDIInput::startReader(void (LinuxMIDIInput::*loop)()) {
+    if (pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+        lastError_ = std::string("Cannot create wake pipe: ") + std::strerror(errno);
+        return false;
+    }
+    running_.store(true, std::memory_order_release);
+    reader_ = std::thread(loop, this);
+
+    // Realtime priority keeps read-time stamps close to arrival; needs rtprio or CAP_SYS_NICE
+    sched_param param{};
+    param.sched_priority = std::min(READER_PRIORITY, sched_get_priority_max(SCHED_FIFO));
+    realtime_.store(pthread_setschedparam(reader_.native_handle(), SCHED_FIFO, &param) == 0,
+                    std::memory_order_relaxed);
+    return true;
+}
+
+bool LinuxMIDIInput::waitReadable(int fd) {
+    pollfd fds[2] = {{fd, POLLIN, 0}, {wakePipe_[0], POLLIN, 0}};
+    const int ready = poll(fds, 2, -1);
+    if (ready < 0) return errno == EINTR;
+    if (fds[1].revents) return false;                        // close() requested
+    return (fds[0].revents & POLLIN) || !(fds[0].revents & (POLLHUP | POLLERR | POLLNVAL));
+}
+
+void LinuxMIDIInput::rawLoop() {
+    uint8_t buffer[256];
+    while (running_.load(std::memory_order_acquire)) {
+        if (!waitReadable(fd_)) break;
+        const ssize_t n = read(fd_, buffer, sizeof(buffer));
+        if (n > 0) {
+            feed(buffer, static_cast<size_t>(n), MIDIInputQueue::hostTimeNs());
+        } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+            break;                                           // Writer closed or device unplugged
+        }
+    }
+}
+
+void LinuxMIDIInput::feed(const uint8_t* bytes, size_t count, uint64_t hostTimeNs) {
+    TimedMIDIMessage message;
+    for (size_t i = 0; i < count; ++i) {
+        if (!parser_.feed(bytes[i], message) || message.status == ACTIVE_SENSING) continue;
+        message.hostTimeNs = hostTimeNs;
+        if (queue_.push(message)) messageCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+#if ETHER_ENABLE_ALSA
+
+bool LinuxMIDIInput::openSequencer(const std::string& source) {
+    if (snd_seq_open(&seq_, "default", SND_SEQ_OPEN_INPUT, SND_SEQ_NONBLOCK) < 0) {
+        seq_ = nullptr;
+        lastError_ = "Cannot open ALSA sequencer";
+        return false;
+    }
+    snd_seq_set_client_name(seq_, "ether");
+    seqPort_ = snd_seq_create_simple_port(seq_, "ether MIDI In",
+                                          SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_SUBS_WRITE,
+                                          SND_SEQ_PORT_TYPE_MIDI_GENERIC | SND_SEQ_PORT_TYPE_APPLICATION);
+    if (seqPort_ < 0 || snd_midi_event_new(256, &decoder_) < 0) {
+        lastError_ = "Cannot create ALSA sequencer port";
+        close();
+        return false;
+    }
+    snd_midi_event_no_status(decoder_, 1);                   // Full status byte on every message
+
+    if (!source.empty()) {
+        snd_seq_addr_t addr;
+        if (snd_seq_parse_address(seq_, &addr, source.c_str()) < 0 ||
+            snd_seq_connect_from(seq_, seqPort_, addr.client, addr.port) < 0) {
+            lastError_ = "Cannot subscribe to ALSA sequencer port " + source;
+            close();
+            return false;
+        }
+    }
+
+    backend_ = Backend::ALSA_SEQ;
+    parser_.reset();
+    if (!startReader(&LinuxMIDIInput::sequencerLoop)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void LinuxMIDIInput::sequencerLoop() {
+    const int count = snd_seq_poll_descriptors_count(seq_, POLLIN);
+    std::vector<pollfd> fds(static_cast<size_t>(count) + 1);
+    snd_seq_poll_descriptors(seq_, fds.data(), static_cast<unsigned int>(count), POLLIN);
+    fds[count] = {wakePipe_[0], POLLIN, 0};
+
+    uint8_t bytes[256];
+    while (running_.load(std::memory_order_acquire)) {
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (fds[count].revents) break;
+
+        snd_seq_event_t* event = nullptr;
+        while (snd_seq_event_input(seq_, &event) >= 0 && event) {
+            const uint64_t now = MIDIInputQueue::hostTimeNs();
+            const long n = snd_midi_event_decode(decoder_, bytes, sizeof(bytes), event);
+            if (n > 0) feed(bytes, static_cast<size_t>(n), now);   // Port/client notifications decode to nothing
+        }
+    }
+}
+
+#endif
+
+#if ETHER_ENABLE_JACK
+
+bool LinuxMIDIInput::openJack(const std::string& source) {
+    jack_ = jack_client_open("ether-midi", JackNoStartServer, nullptr);
+    if (!jack_) {
+        lastError_ = "JACK server not running";
+        return false;
+    }
+    jackPort_ = jack_port_register(jack_, "midi_in", JACK_DEFAULT_MIDI_TYPE, JackPortIsInput, 0);
+    if (!jackPort_ || jack_set_process_callback(jack_, &LinuxMIDIInput::jackProcess, this) != 0 ||
+        jack_activate(jack_) != 0) {
+        lastError_ = "Cannot register JACK MIDI port";
+        close();
+        return false;
+    }
+    if (!source.empty() && jack_connect(jack_, source.c_str(), jack_port_name(jackPort_)) != 0) {
+        lastError_ = "Cannot connect JACK port " + source;
+        close();
+        return false;
+    }
+    backend_ = Backend::JACK;
+    parser_.reset();
+    realtime_.store(jack_is_realtime(jack_) != 0, std::memory_order_relaxed);
+    return true;
+}
+
+int LinuxMIDIInput::jackProcess(jack_nframes_t frames, void* arg) {
+    auto* self = static_cast<LinuxMIDIInput*>(arg);
+    void* buffer = jack_port_get_buffer(self->jackPort_, frames);
+    const uint32_t count = jack_midi_get_event_count(buffer);
+    if (count == 0) return 0;
+
+    // JACK stamps events in frames; convert through its microsecond clock to ours
+    const int64_t offsetNs = static_cast<int64_t>(MIDIInputQueue::hostTimeNs()) -
+                             static_cast<int64_t>(jack_get_time()) * 1000;
+    const jack_nframes_t cycleStart = jack_last_frame_time(self->jack_);
+    for (uint32_t i = 0; i < count; ++i) {
+        jack_midi_event_t event;
+        if (jack_midi_event_get(&event, buffer, i) != 0) continue;
+        const int64_t eventNs = static_cast<int64_t>(jack_frames_to_time(self->jack_, cycleStart + event.time)) * 1000;
+        self->feed(event.buffer, event.size, static_cast<uint64_t>(std::max<int64_t>(0, eventNs + offsetNs)));
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+#include "MIDIInputQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef ETHER_ENABLE_ALSA
+#define ETHER_ENABLE_ALSA 0
+#endif
+
+#ifndef ETHER_ENABLE_JACK
+#define ETHER_ENABLE_JACK 0
+#endif
+
+#if ETHER_ENABLE_ALSA
+#include <alsa/asoundlib.h>
+#endif
+
+#if ETHER_ENABLE_JACK
+#include <jack/jack.h>
+#include <jack/midiport.h>
+#endif
+
+/**
+ * LinuxMIDIInput - Headless MIDI input for Linux feeding a MIDIInputQueue
+ *
+ * Opens one input stream and stamps every message with MIDIInputQueue's host
+ * clock the moment it is read, so the audio callback can place it at the
+ * right sample. Addresses select the backend:
+ *   "raw:/dev/snd/midiC1D0"  raw MIDI device (or any byte stream: FIFO, pipe)
+ *   "seq" / "seq:20:0"       ALSA sequencer port, optionally subscribed to a source
+ *   "jack" / "jack:<port>"   JACK MIDI port, optionally connected to a source
+ *
+ * Features:
+ * - Dedicated reader thread, SCHED_FIFO when permitted (falls back silently)
+ * - Raw backend needs no libraries; ALSA sequencer under ETHER_ENABLE_ALSA,
+ *   JACK under ETHER_ENABLE_JACK, both opt-in (`make ETHER_ALSA=1`,
+ *   `make ETHER_JACK=1`). JACK reads in its own realtime process callback
+ *   and stamps events with their frame time
+ * - Shared byte parser: running status, interleaved realtime, SysEx skipped
+ * - Active sensing filtered before it reaches the queue
+ */
+class LinuxMIDIInput {
+public:
+    enum class Backend { NONE, RAW, ALSA_SEQ, JACK };
+
+    struct Port {
+        std::string name;
+        std::string address;     // Pass to open()
+        Backend backend = Backend::NONE;
+    };
+
+    explicit LinuxMIDIInput(MIDIInputQueue& queue);
+    ~LinuxMIDIInput();
+
+    LinuxMIDIInput(const LinuxMIDIInput&) = delete;
+    LinuxMIDIInput& operator=(const LinuxMIDIInput&) = delete;
+
+    static std::vector<Port> listPorts();
+
+    bool open(const std::string& address);
+    bool openFd(int fd);                          // Raw bytes from an open descriptor; takes ownership
+    void close();
+
+    bool isOpen() const { return backend_ != Backend::NONE; }
+    Backend getBackend() const { return backend_; }
+    bool isRealtime() const { return realtime_.load(std::memory_order_relaxed); }
+    uint32_t getMessageCount() const { return messageCount_.load(std::memory_order_relaxed); }
+    const std::string& getLastError() const { return lastError_; }
+
+private:
+    MIDIInputQueue& queue_;
+    MIDIByteParser parser_;
+    Backend backend_ = Backend::NONE;
+    std::string lastError_;
+
+    std::thread reader_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> realtime_{false};
+    std::atomic<uint32_t> messageCount_{0};
+    int fd_ = -1;
+    int wakePipe_[2] = {-1, -1};                  // Unblocks poll() on close()
+
+#if ETHER_ENABLE_ALSA
+    snd_seq_t* seq_ = nullptr;
+    snd_midi_event_t* decoder_ = nullptr;
+    int seqPort_ = -1;
+    bool openSequencer(const std::string& source);
+    void sequencerLoop();
+#endif
+
+#if ETHER_ENABLE_JACK
+    jack_client_t* jack_ = nullptr;
+    jack_port_t* jackPort_ = nullptr;
+    bool openJack(const std::string& source);
+    static int jackProcess(jack_nframes_t frames, void* arg);
+#endif
+
+    bool startReader(void (LinuxMIDIInput::*loop)());
+    void rawLoop();
+    void feed(const uint8_t* bytes, size_t count, uint64_t hostTimeNs);
+    bool waitReadable(int fd);
+};
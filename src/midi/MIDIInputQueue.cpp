@@ -0,0 +1,137 @@
+#include "MIDIInputQueue.h"
+#include <chrono>
+#include <cmath>
+
+// MIDIByteParser
+
+int MIDIByteParser::expectedDataBytes(uint8_t status) {
+    if (status < 0x80) return -1;
+    if (status < 0xF0) {
+        const uint8_t type = status & 0xF0;
+        return (type == 0xC0 || type == 0xD0) ? 1 : 2;
+    }
+    switch (status) {
+        case 0xF1: return 1;    // MTC quarter frame
+        case 0xF2: return 2;    // Song position
+        case 0xF3: return 1;    // Song select
+        case 0xF6: return 0;    // Tune request
+        default:
+            return status >= 0xF8 ? 0 : -1;
+    }
+}
+
+void MIDIByteParser::reset() {
+    runningStatus_ = 0;
+    count_ = 0;
+    expected_ = 0;
+    inSysEx_ = false;
+}
+
+bool MIDIByteParser::feed(uint8_t byte, TimedMIDIMessage& out) {
+    // Realtime bytes may appear anywhere, even inside another message
+    if (byte >= 0xF8) {
+        out.status = byte;
+        out.data1 = out.data2 = 0;
+        out.size = 1;
+        return true;
+    }
+
+    if (byte & 0x80) {
+        count_ = 0;
+        inSysEx_ = (byte == 0xF0);
+        expected_ = expectedDataBytes(byte);
+        // SysEx, its end marker and undefined statuses cancel running status
+        runningStatus_ = expected_ < 0 ? 0 : byte;
+        if (expected_ == 0) {
+            out.status = byte;
+            out.data1 = out.data2 = 0;
+            out.size = 1;
+            runningStatus_ = 0;
+            return true;
+        }
+        return false;
+    }
+
+    if (inSysEx_ || runningStatus_ == 0) return false;
+
+    data_[count_++] = byte;
+    if (count_ < expected_) return false;
+
+    out.status = runningStatus_;
+    out.data1 = data_[0];
+    out.data2 = expected_ > 1 ? data_[1] : 0;
+    out.size = static_cast<uint8_t>(1 + expected_);
+    count_ = 0;
+    if (runningStatus_ >= 0xF0) runningStatus_ = 0;   // Only channel messages run on
+    return true;
+}
+
+// MIDIInputQueue
+
+uint64_t MIDIInputQueue::hostTimeNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void MIDIInputQueue::setSampleRate(double sampleRate) {
+    if (sampleRate > 0.0) {
+        sampleRate_ = sampleRate;
+        anchored_ = false;
+    }
+}
+
+void MIDIInputQueue::setLatencySamples(uint32_t samples) {
+    latencySamples_ = samples;
+}
+
+bool MIDIInputQueue::push(const TimedMIDIMessage& message) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= CAPACITY) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    ring_[head & (CAPACITY - 1)] = message;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void MIDIInputQueue::beginBlock(uint64_t blockSampleTime, uint32_t frames, uint64_t hostNowNs) {
+    const double blockNs = frames * 1e9 / sampleRate_;
+    const double now = static_cast<double>(hostNowNs);
+    if (anchored_ && blockSampleTime >= anchorSample_) {
+        // Where this block should start if callbacks ran exactly on time
+        const double predicted = anchorNs_ + (blockSampleTime - anchorSample_) * 1e9 / sampleRate_;
+        const double error = now - predicted;
+        if (std::fabs(error) < 2.0 * blockNs) {
+            // Follow the mean wake-up time, not each callback's jitter
+            anchorNs_ = predicted + 0.05 * error;
+            anchorSample_ = blockSampleTime;
+            return;
+        }
+    }
+    // First block, stream restart or xrun: take this callback's time as is
+    anchorNs_ = now;
+    anchorSample_ = blockSampleTime;
+    anchored_ = true;
+}
+
+uint64_t MIDIInputQueue::toSampleTime(uint64_t hostTimeNs) const {
+    const double delta = (static_cast<double>(hostTimeNs) - anchorNs_) * sampleRate_ * 1e-9;
+    const double time = static_cast<double>(anchorSample_ + latencySamples_) + std::floor(delta);
+    return time > 0.0 ? static_cast<uint64_t>(time) : 0;
+}
+
+bool MIDIInputQueue::pop(TimedMIDIMessage& message, uint64_t& sampleTime) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t head = head_.load(std::memory_order_acquire);
+    if (tail == head) return false;
+    message = ring_[tail & (CAPACITY - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    sampleTime = toSampleTime(message.hostTimeNs);
+    return true;
+}
+
+size_t MIDIInputQueue::getPendingCount() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * TimedMIDIMessage - One channel or realtime MIDI message with its arrival time
+ */
+struct TimedMIDIMessage {
+    uint64_t hostTimeNs = 0;     // MIDIInputQueue::hostTimeNs() when the message was read
+    uint8_t status = 0;
+    uint8_t data1 = 0;
+    uint8_t data2 = 0;
+    uint8_t size = 0;            // 1..3 bytes
+};
+
+/**
+ * MIDIByteParser - Raw MIDI byte stream to complete messages
+ *
+ * Handles running status, realtime bytes interleaved inside other messages,
+ * and skips SysEx. Used by byte-oriented inputs (raw MIDI devices, pipes,
+ * JACK) so every backend delivers the same messages.
+ */
+class MIDIByteParser {
+public:
+    // Feed one byte; true when `out` holds a completed message
+    bool feed(uint8_t byte, TimedMIDIMessage& out);
+    void reset();
+
+    static int expectedDataBytes(uint8_t status);   // -1 for SysEx/undefined
+
+private:
+    uint8_t runningStatus_ = 0;
+    uint8_t data_[2] = {0, 0};
+    int count_ = 0;
+    int expected_ = 0;
+    bool inSysEx_ = false;
+};
+
+/**
+ * MIDIInputQueue - Lock-free MIDI input timestamped against the audio clock
+ *
+ * A reader thread stamps each message with a monotonic host time and pushes
+ * it into a single-producer/single-consumer ring. The audio callback anchors
+ * the host clock to its sample clock once per block and pops messages with
+ * the sample time they should sound at. Messages land one latency period
+ * (normally one block) after they arrived, so their spacing inside a block is
+ * preserved instead of piling up at offset 0.
+ *
+ * Features:
+ * - Wait-free SPSC ring (reader thread -> audio thread), no allocation
+ * - Block-start anchor smoothed against callback wake-up jitter, re-synced
+ *   after xruns or stream restarts
+ * - Dropped messages counted when the ring is full
+ */
+class MIDIInputQueue {
+public:
+    static constexpr size_t CAPACITY = 1024;   // Power of two
+
+    MIDIInputQueue() = default;
+
+    static uint64_t hostTimeNs();              // Monotonic clock shared by readers and the audio side
+
+    // Configuration (before the stream starts, or from the audio thread)
+    void setSampleRate(double sampleRate);
+    void setLatencySamples(uint32_t samples);  // Arrival -> playback delay; normally the block size
+    double getSampleRate() const { return sampleRate_; }
+    uint32_t getLatencySamples() const { return latencySamples_; }
+
+    // Reader thread (single producer)
+    bool push(const TimedMIDIMessage& message);
+
+    // Audio thread (single consumer)
+    void beginBlock(uint64_t blockSampleTime, uint32_t frames, uint64_t hostNowNs);
+    bool pop(TimedMIDIMessage& message, uint64_t& sampleTime);
+    uint64_t toSampleTime(uint64_t hostTimeNs) const;
+
+    // Diagnostics
+    uint32_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+    size_t getPendingCount() const;
+
+private:
+    double sampleRate_ = 48000.0;
+    uint32_t latencySamples_ = 128;
+
+    // Host time of the current block's first sample (audio thread only)
+    uint64_t anchorSample_ = 0;
+    double anchorNs_ = 0.0;
+    bool anchored_ = false;
+
+    std::array<TimedMIDIMessage, CAPACITY> ring_;
+    std::atomic<size_t> head_{0};   // Written by producer
+    std::atomic<size_t> tail_{0};   // Written by consumer
+    std::atomic<uint32_t> dropped_{0};
+};
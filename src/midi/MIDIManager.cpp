@@ -2,6 +2,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <sstream>
 
 #ifdef PLATFORM_MAC
@@ -143,6 +144,9 @@ void MIDIManager::disconnectInputDevice(uint32_t deviceId) {
     
     if (it != availableDevices_.end() && it->isConnected) {
         it->isConnected = false;
+#if !defined(PLATFORM_MAC) && defined(__linux__)
+        if (linuxInput_) linuxInput_->close();
+#endif
         std::cout << "Disconnected MIDI input: " << it->name << std::endl;
     }
 }
@@ -167,6 +171,8 @@ void MIDIManager::disconnectAllDevices() {
 #ifdef PLATFORM_MAC
     connectedInputs_.clear();
     connectedOutputs_.clear();
+#elif defined(__linux__)
+    if (linuxInput_) linuxInput_->close();
 #endif
     
     std::cout << "Disconnected all MIDI devices" << std::endl;
@@ -856,9 +862,95 @@ MIDIManager::MIDIMessage MIDIManager::parseMIDIData(const uint8_t* data, size_t
     return message;
 }
 
+#elif defined(__linux__)
+
+bool MIDIManager::initializePlatform() {
+    linuxInput_ = std::make_unique<LinuxMIDIInput>(inputQueue_);
+    hasPendingInput_ = false;
+    return true;
+}
+
+void MIDIManager::shutdownPlatform() {
+    linuxInput_.reset();
+    linuxPorts_.clear();
+}
+
+void MIDIManager::scanDevices() {
+    availableDevices_.clear();
+    linuxPorts_ = LinuxMIDIInput::listPorts();
+    
+    for (size_t i = 0; i < linuxPorts_.size(); i++) {
+        const LinuxMIDIInput::Port& port = linuxPorts_[i];
+        
+        MIDIDevice device;
+        device.name = port.name;
+        device.id = static_cast<uint32_t>(i);
+        device.isInput = true;
+        device.isOutput = false;
+        device.isConnected = false;
+        device.manufacturer = port.backend == LinuxMIDIInput::Backend::RAW ? "ALSA raw MIDI" :
+                              port.backend == LinuxMIDIInput::Backend::ALSA_SEQ ? "ALSA sequencer" : "JACK";
+        device.model = port.address;
+        
+        availableDevices_.push_back(device);
+    }
+}
+
+bool MIDIManager::connectInputDevicePlatform(uint32_t deviceId) {
+    if (!linuxInput_ || deviceId >= linuxPorts_.size()) {
+        return false;
+    }
+    
+    // Opening a port replaces the previous input stream
+    for (auto& device : availableDevices_) {
+        if (device.isInput) device.isConnected = false;
+    }
+    
+    if (!linuxInput_->open(linuxPorts_[deviceId].address)) {
+        std::cout << "Failed to open MIDI input: " << linuxInput_->getLastError() << std::endl;
+        return false;
+    }
+    
+    hasPendingInput_ = false;
+    return true;
+}
+
+// Output is not implemented on Linux yet; the backend is input-only
+bool MIDIManager::connectOutputDevicePlatform(uint32_t) { return false; }
+void MIDIManager::sendMIDIMessagePlatform(const std::vector<uint8_t>&) {}
+
+void MIDIManager::processInput(uint64_t blockSampleTime, uint32_t frames) {
+    inputQueue_.beginBlock(blockSampleTime, frames, MIDIInputQueue::hostTimeNs());
+    const uint64_t blockEnd = blockSampleTime + frames;
+    
+    for (;;) {
+        uint64_t sampleTime = 0;
+        if (hasPendingInput_) {
+            sampleTime = inputQueue_.toSampleTime(pendingInput_.hostTimeNs);
+        } else if (inputQueue_.pop(pendingInput_, sampleTime)) {
+            hasPendingInput_ = true;
+        } else {
+            break;
+        }
+        
+        // Arrival order is time order: everything after this one is later too
+        if (sampleTime >= blockEnd) break;
+        hasPendingInput_ = false;
+        
+        MIDIMessage message;
+        const uint8_t status = pendingInput_.status;
+        message.type = static_cast<MessageType>(status < 0xF0 ? (status & 0xF0) : status);
+        message.channel = status < 0xF0 ? (status & 0x0F) : 0;
+        message.data1 = pendingInput_.data1;
+        message.data2 = pendingInput_.data2;
+        message.timestamp = sampleTime > blockSampleTime ? static_cast<uint32_t>(sampleTime - blockSampleTime) : 0;
+        processMIDIMessage(message);
+    }
+}
+
 #else
 
-// Stub implementations for non-Mac platforms
+// Stub implementations for other platforms
 bool MIDIManager::initializePlatform() {
     std::cout << "MIDI not implemented for this platform" << std::endl;
     return false;
@@ -7,6 +7,8 @@
 
 #ifdef PLATFORM_MAC
 #include <CoreMIDI/CoreMIDI.h>
+#elif defined(__linux__)
+#include "LinuxMIDIInput.h"
 #endif
 
 /**
@@ -169,6 +171,14 @@ public:
     void enableMIDIThru(bool enable);
     bool isMIDIThruEnabled() const { return midiThru_; }
     
+#if !defined(PLATFORM_MAC) && defined(__linux__)
+    // Linux input is queued and delivered from the audio callback: call once at
+    // the top of each block. Callbacks run on the calling thread, with
+    // `timestamp` set to the message's frame offset inside the block.
+    void processInput(uint64_t blockSampleTime, uint32_t frames);
+    MIDIInputQueue& getInputQueue() { return inputQueue_; }
+#endif
+    
     // Preset integration
     void saveMIDISettings(std::vector<uint8_t>& data) const;
     bool loadMIDISettings(const std::vector<uint8_t>& data);
@@ -184,6 +194,12 @@ private:
     MIDIPortRef outputPort_ = 0;
     std::vector<MIDIEndpointRef> connectedInputs_;
     std::vector<MIDIEndpointRef> connectedOutputs_;
+#elif defined(__linux__)
+    MIDIInputQueue inputQueue_;
+    std::unique_ptr<LinuxMIDIInput> linuxInput_;    // One input stream; a sequencer port can merge several sources
+    std::vector<LinuxMIDIInput::Port> linuxPorts_;  // Indexed by MIDIDevice::id
+    TimedMIDIMessage pendingInput_;                 // Popped but due in a later block
+    bool hasPendingInput_ = false;
 #endif
     
     // Device lists
@@ -1,11 +1,15 @@
 #include "GlobalLFOSystem.h"
+#include "../audio/SIMDOptimizations.h"
 #include <cmath>
-#include <random>
 #include <algorithm>
 
+using EtherSynthSIMD::SIMD::LaneVec;
+
 // Static clock division array definition
 constexpr float GlobalLFOSystem::CLOCK_DIVISIONS[];
 
+static_assert(GlobalLFOSystem::MAX_LFOS % LaneVec::WIDTH == 0, "LFOs must fill whole SIMD groups");
+
 GlobalLFOSystem::GlobalLFOSystem() {
     // Initialize all assignments as empty
     for (auto& slotAssignments : assignments_) {
@@ -16,6 +20,7 @@ GlobalLFOSystem::GlobalLFOSystem() {
     }
     
     // Initialize all LFO states
+    uint32_t seed = 0x9E3779B9u;
     for (auto& slotLFOs : lfoStates_) {
         for (auto& lfo : slotLFOs) {
             lfo.phase = 0.0f;
@@ -26,6 +31,8 @@ GlobalLFOSystem::GlobalLFOSystem() {
             lfo.holdValue = 0.0f;
             lfo.noiseTarget = 0.0f;
             lfo.noiseSmooth = 0.0f;
+            lfo.randomState = seed;
+            seed = seed * 1664525u + 1013904223u;
         }
     }
 }
@@ -33,17 +40,20 @@ GlobalLFOSystem::GlobalLFOSystem() {
 void GlobalLFOSystem::init(float sampleRate, float bpm) {
     sampleRate_ = sampleRate;
     bpm_ = bpm;
+    markLanesDirty();
 }
 
 void GlobalLFOSystem::setBPM(float bpm) {
     bpm_ = std::clamp(bpm, 60.0f, 200.0f);
+    markLanesDirty();
 }
 
 void GlobalLFOSystem::setSampleRate(float sampleRate) {
     sampleRate_ = std::max(8000.0f, sampleRate);
+    markLanesDirty();
 }
 
-void GlobalLFOSystem::setLFO(int slot, int idx, const LFOSettings& settings) {
+void GlobalLFOSystem::setLFO(int slot, int idx, const LFOSettings& settings, bool restart) {
     if (!isValidSlot(slot) || !isValidLFO(idx)) return;
     
     auto& lfo = lfoStates_[slot][idx];
@@ -52,7 +62,9 @@ void GlobalLFOSystem::setLFO(int slot, int idx, const LFOSettings& settings) {
     lfo.settings.pulseWidth = clamp(settings.pulseWidth, 0.1f, 0.9f);
     
     // Reset LFO state when settings change
-    if (settings.sync == SyncMode::Envelope) {
+    if (!restart) {
+        // Keep running: edits from a live control surface
+    } else if (settings.sync == SyncMode::Envelope) {
         lfo.envPhase = LFOState::ENV_IDLE;
         lfo.envLevel = 0.0f;
     } else {
@@ -60,6 +72,7 @@ void GlobalLFOSystem::setLFO(int slot, int idx, const LFOSettings& settings) {
     }
     
     lfo.active = (settings.depth > 0.001f);
+    laneParams_[slot].dirty = true;
 }
 
 void GlobalLFOSystem::getLFO(int slot, int idx, LFOSettings& settings) const {
@@ -103,11 +116,13 @@ void GlobalLFOSystem::retriggerLFO(int slot, int idx) {
     if (!isValidSlot(slot) || !isValidLFO(idx)) return;
     
     auto& lfo = lfoStates_[slot][idx];
+    laneParams_[slot].dirty = true;
     
     switch (lfo.settings.sync) {
         case SyncMode::Key:
         case SyncMode::OneShot:
             lfo.phase = 0.0f;
+            lfo.active = (lfo.settings.depth > 0.001f);   // A finished one-shot runs again
             break;
             
         case SyncMode::Envelope:
@@ -136,6 +151,7 @@ void GlobalLFOSystem::releaseEnvelopes(int slot) {
 
 void GlobalLFOSystem::stepBlock(int slot, int frames) {
     if (!isValidSlot(slot)) return;
+    laneParams_[slot].dirty = true;     // Phases move outside the lanes
     
     for (auto& lfo : lfoStates_[slot]) {
         if (lfo.active) {
@@ -146,6 +162,180 @@ void GlobalLFOSystem::stepBlock(int slot, int frames) {
     }
 }
 
+void GlobalLFOSystem::setControlInterval(int samples) {
+    controlInterval_ = std::clamp(samples, 1, MAX_BLOCK_FRAMES);
+}
+
+void GlobalLFOSystem::renderBlock(int slot, int frames) {
+    if (!isValidSlot(slot)) return;
+    
+    auto& lfos = lfoStates_[slot];
+    auto& points = controlPoints_[slot];
+    auto& lanes = laneParams_[slot];
+    if (lanes.dirty) {
+        updateLaneParams(slot);
+    }
+    
+    frames = std::clamp(frames, 0, MAX_BLOCK_FRAMES);
+    points.frames = frames;
+    points.interval = controlInterval_;
+    points.count = (frames + controlInterval_ - 1) / controlInterval_;
+    for (int i = 0; i < MAX_LFOS; ++i) {
+        points.start[i] = lfos[i].active ? lfos[i].lastValue : 0.0f;
+    }
+    const bool anySine = lanes.anySine, anySquare = lanes.anySquare, anyOneShot = lanes.anyOneShot;
+    
+    // Each control point's phase comes straight from the block start phase (a
+    // block advances less than one cycle), so points evaluate independently.
+    // All shapes derive from one saw: triangle = 1 - 2|saw|, and a triangle a
+    // quarter cycle ahead through sin(pi/2 t) is the sine.
+    const LaneVec zero = LaneVec::set1(0.0f);
+    const LaneVec one = LaneVec::set1(1.0f);
+    for (int g = 0; g < MAX_LFOS; g += LaneVec::WIDTH) {
+        const LaneVec start = LaneVec::load(lanes.phase.data() + g);
+        const LaneVec step = LaneVec::load(lanes.inc.data() + g);
+        const LaneVec wrap = LaneVec::load(lanes.wrapAt.data() + g);
+        const LaneVec end = LaneVec::load(lanes.endAt.data() + g);
+        const LaneVec shift = LaneVec::load(lanes.shift.data() + g);
+        const LaneVec gain = LaneVec::load(lanes.depth.data() + g);
+        const LaneVec width = LaneVec::load(lanes.pulseWidth.data() + g);
+        const LaneVec ws = LaneVec::load(lanes.sineW.data() + g);
+        const LaneVec wt = LaneVec::load(lanes.triW.data() + g);
+        const LaneVec wsaw = LaneVec::load(lanes.sawW.data() + g);
+        const LaneVec wsq = LaneVec::load(lanes.squareW.data() + g);
+        LaneVec p = start;
+        for (int k = 0; k < points.count; ++k) {
+            const float offset = static_cast<float>(std::min((k + 1) * points.interval, frames));
+            p = LaneVec::min(LaneVec::wrap(start + step * LaneVec::set1(offset), wrap), end);
+            const LaneVec q = anySine ? LaneVec::wrap(p + shift, one) : p;
+            const LaneVec saw = q + q - one;
+            const LaneVec tri = one - LaneVec::max(saw, zero - saw) * LaneVec::set1(2.0f);
+            LaneVec v = wsaw * saw + wt * tri;
+            if (anySine) {
+                v = v + ws * EtherSynthSIMD::SIMD::sinHalfPiLanes(tri);
+            }
+            if (anySquare) {
+                v = v + wsq * LaneVec::select(p, width, one, zero - one);
+            }
+            v = v * gain;
+            if (anyOneShot) {
+                v = LaneVec::select(p, end, v, zero);
+            }
+            v.store(points.values[k].data() + g);
+        }
+        p.store(lanes.phase.data() + g);
+    }
+    
+    // Write back; envelopes are piecewise linear and step once per segment
+    if (points.count == 0) return;
+    const auto& last = points.values[points.count - 1];
+    if (!lanes.anyOneShot && !lanes.anyEnvelope) {
+        for (int i = 0; i < MAX_LFOS; ++i) {
+            lfos[i].phase = lanes.phase[i] * TWO_PI;
+            lfos[i].lastValue = last[i];        // Inactive LFOs have zero depth
+        }
+        return;
+    }
+    for (int i = 0; i < MAX_LFOS; ++i) {
+        auto& lfo = lfos[i];
+        if (!lfo.active) {
+            lfo.lastValue = 0.0f;
+            continue;
+        }
+        if (lfo.settings.sync == SyncMode::Envelope) {
+            for (int k = 0; k < points.count; ++k) {
+                updateEnvelope(lfo, std::min(points.interval, frames - k * points.interval));
+                points.values[k][i] = lfo.lastValue;
+            }
+            continue;
+        }
+        lfo.phase = lanes.phase[i] * TWO_PI;
+        lfo.lastValue = last[i];
+        if (lfo.settings.sync == SyncMode::OneShot && lanes.phase[i] >= 1.0f) {
+            lfo.active = false;
+            lfo.lastValue = 0.0f;
+            lanes.dirty = true;
+        }
+    }
+}
+
+void GlobalLFOSystem::updateLaneParams(int slot) {
+    auto& lanes = laneParams_[slot];
+    lanes.anySine = lanes.anySquare = false;
+    lanes.anyOneShot = lanes.anyEnvelope = false;
+    for (int i = 0; i < MAX_LFOS; ++i) {
+        const auto& lfo = lfoStates_[slot][i];
+        const Waveform wave = lfo.settings.wave;
+        const bool envelope = lfo.settings.sync == SyncMode::Envelope;
+        const bool periodic = lfo.active && !envelope;
+        const bool oneShot = lfo.settings.sync == SyncMode::OneShot;
+        
+        // Saw down is a negative saw up; unimplemented shapes weigh zero
+        lanes.phase[i] = lfo.phase / (2.0f * M_PI);
+        lanes.inc[i] = periodic ? calculatePhaseIncrement(lfo, 1) / (2.0f * M_PI) : 0.0f;
+        lanes.depth[i] = periodic ? lfo.settings.depth : 0.0f;
+        lanes.pulseWidth[i] = lfo.settings.pulseWidth;
+        lanes.wrapAt[i] = oneShot ? 2.0f : 1.0f;
+        lanes.endAt[i] = oneShot ? 1.0f : 2.0f;
+        lanes.shift[i] = (wave == Waveform::Sine) ? 0.25f : 0.0f;
+        lanes.sineW[i] = (wave == Waveform::Sine) ? 1.0f : 0.0f;
+        lanes.triW[i] = (wave == Waveform::Tri) ? 1.0f : 0.0f;
+        lanes.sawW[i] = (wave == Waveform::SawUp) ? 1.0f : (wave == Waveform::SawDown) ? -1.0f : 0.0f;
+        lanes.squareW[i] = (wave == Waveform::Square || wave == Waveform::Pulse) ? 1.0f : 0.0f;
+        
+        lanes.anySine = lanes.anySine || (periodic && lanes.sineW[i] != 0.0f);
+        lanes.anySquare = lanes.anySquare || (periodic && lanes.squareW[i] != 0.0f);
+        lanes.anyOneShot = lanes.anyOneShot || oneShot;
+        lanes.anyEnvelope = lanes.anyEnvelope || (lfo.active && envelope);
+    }
+    lanes.dirty = false;
+}
+
+void GlobalLFOSystem::markLanesDirty() {
+    for (auto& lanes : laneParams_) {
+        lanes.dirty = true;
+    }
+}
+
+void GlobalLFOSystem::renderLFOBuffer(int slot, int idx, float* output, int frames) const {
+    if (!isValidSlot(slot) || !isValidLFO(idx)) return;
+    
+    const auto& points = controlPoints_[slot];
+    float values[MAX_BLOCK_FRAMES];
+    for (int k = 0; k < points.count; ++k) {
+        values[k] = points.values[k][idx];
+    }
+    expandRamp(points, points.start[idx], values, output, frames);
+}
+
+bool GlobalLFOSystem::renderParamBuffer(int slot, int paramId, float* output, int frames) const {
+    if (!isValidSlot(slot) || !isValidParam(paramId)) return false;
+    
+    const auto& assignment = assignments_[slot][paramId];
+    if (assignment.mask == 0) return false;
+    
+    // Combine at the control points, then interpolate once
+    const auto& points = controlPoints_[slot];
+    float weights[MAX_LFOS];
+    for (int i = 0; i < MAX_LFOS; ++i) {
+        weights[i] = (assignment.mask & (1 << i)) ? assignment.depths[i] : 0.0f;
+    }
+    auto combine = [&](const std::array<float, MAX_LFOS>& lfoValues) {
+        float sum = 0.0f;
+        for (int i = 0; i < MAX_LFOS; ++i) {
+            sum += lfoValues[i] * weights[i];
+        }
+        return std::min(1.0f, std::max(-1.0f, sum));
+    };
+    
+    float values[MAX_BLOCK_FRAMES];
+    for (int k = 0; k < points.count; ++k) {
+        values[k] = combine(points.values[k]);
+    }
+    expandRamp(points, combine(points.start), values, output, frames);
+    return true;
+}
+
 float GlobalLFOSystem::combinedValue(int slot, int paramId) const {
     if (!isValidSlot(slot) || !isValidParam(paramId)) return 0.0f;
     
@@ -207,8 +397,6 @@ void GlobalLFOSystem::updateLFO(LFOState& lfo, int frames) {
 }
 
 void GlobalLFOSystem::updateEnvelope(LFOState& lfo, int frames) {
-    float frameRate = 1.0f / sampleRate_ * frames;
-    
     switch (lfo.envPhase) {
         case LFOState::ENV_ATTACK:
             lfo.envLevel += lfo.envRate * frames;
@@ -278,6 +466,22 @@ float GlobalLFOSystem::calculatePhaseIncrement(const LFOState& lfo, int frames)
     return (2.0f * M_PI * rate * frames) / sampleRate_;
 }
 
+void GlobalLFOSystem::expandRamp(const ControlPoints& points, float start, const float* values,
+                                 float* output, int frames) const {
+    frames = std::min(frames, points.frames);
+    float previous = start;
+    for (int k = 0, s = 0; k < points.count && s < frames; ++k) {
+        const int segment = std::min(points.interval, points.frames - s);
+        const float slope = (values[k] - previous) / segment;
+        const int end = std::min(frames, s + segment);
+        for (int j = s; j < end; ++j) {
+            output[j] = previous + slope * static_cast<float>(j - s + 1);
+        }
+        previous = values[k];
+        s += segment;
+    }
+}
+
 float GlobalLFOSystem::generateWaveform(Waveform wave, float phase, float pulseWidth) {
     switch (wave) {
         case Waveform::Sine:
@@ -328,15 +532,17 @@ float GlobalLFOSystem::generateSquare(float phase, float pulseWidth) {
     return (normalized < pulseWidth) ? 1.0f : -1.0f;
 }
 
+float GlobalLFOSystem::randomBipolar(LFOState& lfo) {
+    lfo.randomState = lfo.randomState * 1664525u + 1013904223u;
+    return (float)(lfo.randomState >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
 float GlobalLFOSystem::generateSampleHold(LFOState& lfo) {
     float normalized = lfo.phase / (2.0f * M_PI); // 0-1
     
     // Trigger new value when phase wraps
     if (normalized < lfo.lastPhase) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-        lfo.holdValue = dist(gen);
+        lfo.holdValue = randomBipolar(lfo);
     }
     lfo.lastPhase = normalized;
     
@@ -345,12 +551,8 @@ float GlobalLFOSystem::generateSampleHold(LFOState& lfo) {
 
 float GlobalLFOSystem::generateNoise(LFOState& lfo) {
     // Generate new target occasionally
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-    
     if (std::abs(lfo.noiseSmooth - lfo.noiseTarget) < 0.01f) {
-        lfo.noiseTarget = dist(gen);
+        lfo.noiseTarget = randomBipolar(lfo);
     }
     
     // Smooth toward target (simple lowpass)
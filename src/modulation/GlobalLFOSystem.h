@@ -9,12 +9,19 @@
  * Provides 8 LFOs per slot with comprehensive waveform generation,
  * sync modes, and parameter assignment system. Optimized for 
  * block-based processing with minimal CPU overhead.
+ *
+ * renderBlock() evaluates a slot's LFOs every getControlInterval() samples
+ * (1 = audio rate) and the render*Buffer() calls expand those control points
+ * into per-sample linear ramps, so fast LFOs and envelopes do not zipper.
+ * The 8 LFOs of a slot are evaluated together in SIMD lanes.
  */
 class GlobalLFOSystem {
 public:
     static constexpr int MAX_SLOTS = 16;
     static constexpr int MAX_LFOS = 8;
     static constexpr int MAX_PARAMS = static_cast<int>(ParameterID::COUNT);
+    static constexpr int MAX_BLOCK_FRAMES = static_cast<int>(BUFFER_SIZE);
+    static constexpr int DEFAULT_CONTROL_INTERVAL = 32;
     
     // Waveform types
     enum class Waveform : uint8_t {
@@ -66,7 +73,7 @@ public:
     void setSampleRate(float sampleRate);
     
     // LFO control
-    void setLFO(int slot, int idx, const LFOSettings& settings);
+    void setLFO(int slot, int idx, const LFOSettings& settings, bool restart = true);  // restart=false keeps phase/envelope
     void getLFO(int slot, int idx, LFOSettings& settings) const;
     
     // Parameter assignment
@@ -82,6 +89,13 @@ public:
     // Block processing
     void stepBlock(int slot, int frames);       // Update LFO values for block
     
+    // Control-rate processing (frames <= MAX_BLOCK_FRAMES)
+    void setControlInterval(int samples);       // 1 (audio rate) to MAX_BLOCK_FRAMES
+    int getControlInterval() const { return controlInterval_; }
+    void renderBlock(int slot, int frames);     // Advance LFOs, evaluating them at each control point
+    void renderLFOBuffer(int slot, int idx, float* output, int frames) const;
+    bool renderParamBuffer(int slot, int paramId, float* output, int frames) const;  // false (output untouched) when unassigned
+    
     // Value queries
     float combinedValue(int slot, int paramId) const;  // Sum of assigned LFO contributions
     uint8_t mask(int slot, int paramId) const;         // Assignment mask
@@ -109,6 +123,10 @@ private:
         // Noise smoothing
         float noiseTarget = 0.0f;               // Target noise value
         float noiseSmooth = 0.0f;               // Smoothed noise output
+        
+        // Random source for S&H and noise: per LFO and seeded from its position,
+        // so slots rendering concurrently never share it and renders repeat exactly
+        uint32_t randomState = 1;
     };
     
     // Parameter assignment
@@ -117,13 +135,40 @@ private:
         std::array<float, MAX_LFOS> depths{};   // Assignment depths
     };
     
+    // LFO values at the end of each control segment of the last renderBlock()
+    struct ControlPoints {
+        int frames = 0;
+        int interval = DEFAULT_CONTROL_INTERVAL;
+        int count = 0;
+        std::array<float, MAX_LFOS> start{};                                // Values before the block
+        std::array<std::array<float, MAX_LFOS>, MAX_BLOCK_FRAMES> values{};
+    };
+    
+    // Per-slot SIMD lane parameters, rebuilt from LFOState when marked dirty
+    struct LaneParams {
+        bool dirty = true;
+        std::array<float, MAX_LFOS> phase{};        // Normalized 0-1
+        std::array<float, MAX_LFOS> inc{};          // Per sample; 0 for envelopes and inactive LFOs
+        std::array<float, MAX_LFOS> depth{};
+        std::array<float, MAX_LFOS> pulseWidth{};
+        std::array<float, MAX_LFOS> wrapAt{};       // 1, or 2 for one-shots (never wrap)
+        std::array<float, MAX_LFOS> endAt{};        // 1 for one-shots, else 2 (never ends)
+        std::array<float, MAX_LFOS> shift{};        // Quarter cycle for sines
+        std::array<float, MAX_LFOS> sineW{}, triW{}, sawW{}, squareW{};  // One-hot waveform weights
+        bool anySine = false, anySquare = false;
+        bool anyOneShot = false, anyEnvelope = false;
+    };
+    
     // System state
     float sampleRate_ = 48000.0f;
     float bpm_ = 120.0f;
+    int controlInterval_ = DEFAULT_CONTROL_INTERVAL;
     
     // Per-slot data
     std::array<std::array<LFOState, MAX_LFOS>, MAX_SLOTS> lfoStates_;
     std::array<std::array<ParamAssignment, MAX_PARAMS>, MAX_SLOTS> assignments_;
+    std::array<ControlPoints, MAX_SLOTS> controlPoints_;
+    std::array<LaneParams, MAX_SLOTS> laneParams_;
     
     // Clock division mapping
     static constexpr float CLOCK_DIVISIONS[] = {
@@ -141,6 +186,9 @@ private:
     float generateWaveform(Waveform wave, float phase, float pulseWidth);
     void updateEnvelope(LFOState& lfo, int frames);
     float calculatePhaseIncrement(const LFOState& lfo, int frames);
+    void updateLaneParams(int slot);
+    void markLanesDirty();
+    void expandRamp(const ControlPoints& points, float start, const float* values, float* output, int frames) const;
     
     // Waveform generators
     float generateSine(float phase);
@@ -149,10 +197,11 @@ private:
     float generateSquare(float phase, float pulseWidth);
     float generateSampleHold(LFOState& lfo);
     float generateNoise(LFOState& lfo);
+    static float randomBipolar(LFOState& lfo);  // -1..1 from the LFO's own generator
     float generateExponential(float phase, bool rising);
     
     // Utility functions
-    float clamp(float value, float min = -1.0f, float max = 1.0f);
+    static float clamp(float value, float min = -1.0f, float max = 1.0f);
     bool isValidSlot(int slot) const;
     bool isValidLFO(int idx) const;
     bool isValidParam(int paramId) const;
@@ -288,13 +288,19 @@ uint32_t PerformanceMacros::captureScene(const std::string& name) {
     SceneSnapshot scene;
     scene.name = name;
     
-    // Capture current synth state
-    // This would interface with the actual synth state
     Logger::getInstance().log("PerformanceMacros: Capturing scene '" + name + "'");
     
     uint32_t id = scene.id;
     scenes_[id] = scene;
     
+    // Capture current synth state as a flat scene for morphing
+    if (sceneCapture_) {
+        SceneMorphEngine::Scene flat;
+        flat.name = name;
+        sceneCapture_(flat);
+        sceneMorph_.storeScene(id, flat);
+    }
+    
     stats_.scenesRecalled++;
     return id;
 }
@@ -308,20 +314,32 @@ bool PerformanceMacros::recallScene(uint32_t sceneId, float morphTime) {
     Logger::getInstance().log("PerformanceMacros: Recalling scene '" + scene.name + 
                              "' with morph time " + std::to_string(morphTime));
     
-    if (morphTime <= 0.0f) {
-        // Immediate recall
-        applySceneParameters(scene);
+    // Morph from the current state; a zero morph time lands on the scene at the next block
+    const SceneMorphEngine::Scene* target = sceneMorph_.getScene(sceneId);
+    if (target && sceneCapture_) {
+        SceneMorphEngine::Scene current;
+        sceneCapture_(current);
+        sceneMorph_.recall(current, *target, std::max(0.0f, morphTime));
     } else {
-        // Start morphing
-        morphingActive_ = true;
-        morphToScene_ = sceneId;
-        morphDuration_ = morphTime;
-        morphProgress_ = 0.0f;
+        applySceneParameters(scene);
     }
     
+    stats_.scenesRecalled++;
     return true;
 }
 
+void PerformanceMacros::morphBetweenScenes(uint32_t fromSceneId, uint32_t toSceneId, float morphPosition) {
+    // The plan is compiled when the pair changes; knob moves only publish the position
+    if (sceneMorph_.setMorph(fromSceneId, toSceneId)) {
+        sceneMorph_.setPosition(morphPosition);
+    }
+}
+
+bool PerformanceMacros::deleteScene(uint32_t sceneId) {
+    sceneMorph_.deleteScene(sceneId);
+    return scenes_.erase(sceneId) > 0;
+}
+
 void PerformanceMacros::loadFactoryMacros() {
     // Create factory performance macros
     
@@ -1,5 +1,6 @@
 #pragma once
 #include "../core/Types.h"
+#include "../audio/SceneMorphEngine.h"
 #include <vector>
 #include <string>
 #include <map>
@@ -193,6 +194,12 @@ public:
     bool isPerformanceMode() const { return performanceMode_; }
     
     // Scene Management
+    // Scenes are also captured as flat vectors through the capture hook; recall and
+    // morphing then run on SceneMorphEngine plans, which the host's audio thread
+    // applies with getSceneMorphEngine().process() at block start.
+    using SceneCapture = std::function<void(SceneMorphEngine::Scene&)>;
+    void setSceneCapture(SceneCapture capture) { sceneCapture_ = std::move(capture); }
+    SceneMorphEngine& getSceneMorphEngine() { return sceneMorph_; }
     uint32_t captureScene(const std::string& name);
     bool recallScene(uint32_t sceneId, float morphTime = 0.5f);
     void morphBetweenScenes(uint32_t fromSceneId, uint32_t toSceneId, float morphPosition);
@@ -249,12 +256,9 @@ private:
     std::map<uint32_t, float> activeMacroTimers_; // macroId -> remaining time
     std::map<uint32_t, bool> macroHoldStates_;    // macroId -> hold state
     
-    // Scene morphing state
-    bool morphingActive_ = false;
-    uint32_t morphFromScene_ = 0;
-    uint32_t morphToScene_ = 0;
-    float morphProgress_ = 0.0f;
-    float morphDuration_ = 0.5f;
+    // Scene morphing: flat copies of scenes_ under the same ids
+    SceneMorphEngine sceneMorph_;
+    SceneCapture sceneCapture_;
     
     // Live loop state
     std::map<uint32_t, float> loopTimers_;        // loopId -> recording time
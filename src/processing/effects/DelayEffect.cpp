@@ -0,0 +1,146 @@
+#include "DelayEffect.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float MAX_MOD_SECONDS = 0.005f;      // Modulation swing at depth 1.0
+}
+
+DelayEffect::DelayEffect() {
+    setSampleRate(SAMPLE_RATE);
+}
+
+DelayEffect::~DelayEffect() = default;
+
+void DelayEffect::setSampleRate(float sampleRate) {
+    sampleRate_ = std::max(8000.0f, sampleRate);
+    // Room for the longest delay plus the modulation swing and the interpolation tap
+    bufferSize_ = static_cast<size_t>((MAX_DELAY_TIME + MAX_MOD_SECONDS) * sampleRate_) + 2;
+    delayBuffer_.assign(bufferSize_, AudioFrame());
+    updateModulation();
+    updateFilterCoefficients();
+    reset();
+}
+
+void DelayEffect::process(EtherAudioBuffer& buffer) {
+    process(buffer, buffer.size());
+}
+
+void DelayEffect::process(EtherAudioBuffer& buffer, size_t frames) {
+    frames = std::min(frames, buffer.size());
+    for (size_t i = 0; i < frames; ++i) {
+        const AudioFrame input = buffer[i];
+        const AudioFrame delayed = readDelayInterpolated(getDelayTimeSamples());
+
+        // Feedback path is band-limited so repeats darken and thin out
+        const AudioFrame filtered = applyFiltering(delayed);
+        writeDelayFeedback(AudioFrame(input.left + filtered.left * feedback_,
+                                      input.right + filtered.right * feedback_));
+
+        buffer[i].left = input.left * (1.0f - mix_) + delayed.left * mix_;
+        buffer[i].right = input.right * (1.0f - mix_) + delayed.right * mix_;
+
+        modPhase_ += modPhaseIncrement_;
+        if (modPhase_ >= TWO_PI) modPhase_ -= TWO_PI;
+    }
+}
+
+void DelayEffect::reset() {
+    std::fill(delayBuffer_.begin(), delayBuffer_.end(), AudioFrame());
+    writeIndex_ = 0;
+    modPhase_ = 0.0f;
+    filterState_ = AudioFrame();
+    lowCutState_ = AudioFrame();
+}
+
+// Parameters
+void DelayEffect::setDelayTime(float timeSeconds) {
+    delayTime_ = std::clamp(timeSeconds, 0.001f, MAX_DELAY_TIME);
+}
+
+void DelayEffect::setFeedback(float feedback) {
+    feedback_ = std::clamp(feedback, 0.0f, 0.95f);
+}
+
+void DelayEffect::setMix(float mix) {
+    mix_ = std::clamp(mix, 0.0f, 1.0f);
+}
+
+void DelayEffect::setModulationRate(float rateHz) {
+    modRate_ = std::clamp(rateHz, 0.1f, 10.0f);
+    updateModulation();
+}
+
+void DelayEffect::setModulationDepth(float depth) {
+    modDepth_ = std::clamp(depth, 0.0f, 1.0f);
+}
+
+void DelayEffect::setHighCut(float frequency) {
+    highCutFreq_ = std::clamp(frequency, 100.0f, 20000.0f);
+    updateFilterCoefficients();
+}
+
+void DelayEffect::setLowCut(float frequency) {
+    lowCutFreq_ = std::clamp(frequency, 20.0f, 2000.0f);
+    updateFilterCoefficients();
+}
+
+void DelayEffect::loadPreset(const std::string& presetName) {
+    if (presetName == "slapback") {
+        setDelayTime(0.09f); setFeedback(0.1f); setMix(0.35f); setModulationDepth(0.0f);
+        setHighCut(6000.0f); setLowCut(150.0f);
+    } else if (presetName == "tape") {
+        setDelayTime(0.35f); setFeedback(0.45f); setMix(0.3f);
+        setModulationRate(0.8f); setModulationDepth(0.3f); setHighCut(4000.0f); setLowCut(120.0f);
+    } else if (presetName == "ambient") {
+        setDelayTime(0.6f); setFeedback(0.7f); setMix(0.4f);
+        setModulationRate(0.3f); setModulationDepth(0.5f); setHighCut(5000.0f); setLowCut(200.0f);
+    } else {
+        // "clean" and unknown names
+        setDelayTime(0.25f); setFeedback(0.3f); setMix(0.3f); setModulationDepth(0.0f);
+        setHighCut(8000.0f); setLowCut(100.0f);
+    }
+}
+
+// Helper methods
+void DelayEffect::updateModulation() {
+    modPhaseIncrement_ = TWO_PI * modRate_ / sampleRate_;
+}
+
+float DelayEffect::getDelayTimeSamples() const {
+    float seconds = delayTime_;
+    if (modDepth_ > 0.0f) {
+        seconds += modDepth_ * MAX_MOD_SECONDS * 0.5f * (1.0f + std::sin(modPhase_));
+    }
+    return std::max(1.0f, seconds * sampleRate_);
+}
+
+AudioFrame DelayEffect::readDelayInterpolated(float delaySamples) {
+    float readPos = static_cast<float>(writeIndex_) - delaySamples;
+    if (readPos < 0.0f) readPos += static_cast<float>(bufferSize_);
+    const size_t index0 = static_cast<size_t>(readPos) % bufferSize_;
+    const size_t index1 = (index0 + 1) % bufferSize_;
+    const float frac = readPos - std::floor(readPos);
+    const AudioFrame& a = delayBuffer_[index0];
+    const AudioFrame& b = delayBuffer_[index1];
+    return AudioFrame(a.left + (b.left - a.left) * frac, a.right + (b.right - a.right) * frac);
+}
+
+void DelayEffect::writeDelayFeedback(const AudioFrame& sample) {
+    delayBuffer_[writeIndex_] = sample;
+    if (++writeIndex_ >= bufferSize_) writeIndex_ = 0;
+}
+
+AudioFrame DelayEffect::applyFiltering(const AudioFrame& input) {
+    // One-pole lowpass (high cut), then one-pole highpass (low cut)
+    filterState_.left += highCutCoeff_ * (input.left - filterState_.left);
+    filterState_.right += highCutCoeff_ * (input.right - filterState_.right);
+    lowCutState_.left += lowCutCoeff_ * (filterState_.left - lowCutState_.left);
+    lowCutState_.right += lowCutCoeff_ * (filterState_.right - lowCutState_.right);
+    return AudioFrame(filterState_.left - lowCutState_.left, filterState_.right - lowCutState_.right);
+}
+
+void DelayEffect::updateFilterCoefficients() {
+    highCutCoeff_ = 1.0f - std::exp(-TWO_PI * std::min(highCutFreq_, sampleRate_ * 0.45f) / sampleRate_);
+    lowCutCoeff_ = 1.0f - std::exp(-TWO_PI * lowCutFreq_ / sampleRate_);
+}
@@ -1,11 +1,16 @@
 #pragma once
-#include "../core/Types.h"
+#include "../../core/Types.h"
+#include <array>
+#include <string>
 #include <vector>
 #include <memory>
 
 /**
  * High-quality delay effect with modulation and filtering
  * Perfect for creating spacious, evolving sounds
+ *
+ * The delay line is sized for MAX_DELAY_TIME by setSampleRate(); process()
+ * and the parameter setters do not allocate. The reverb lives in ReverbEffect.h.
  */
 class DelayEffect {
 public:
@@ -13,7 +18,9 @@ public:
     ~DelayEffect();
     
     // Core processing
+    void setSampleRate(float sampleRate);      // Reallocates the delay line
     void process(EtherAudioBuffer& buffer);
+    void process(EtherAudioBuffer& buffer, size_t frames);
     void reset();
     
     // Parameters
@@ -38,8 +45,9 @@ public:
 private:
     // Delay line
     std::vector<AudioFrame> delayBuffer_;
-    size_t bufferSize_;
-    size_t writeIndex_;
+    size_t bufferSize_ = 0;
+    size_t writeIndex_ = 0;
+    float sampleRate_ = SAMPLE_RATE;
     
     // Parameters
     float delayTime_ = 0.25f;        // seconds
@@ -57,7 +65,8 @@ private:
     float lowCutFreq_ = 100.0f;
     float highCutCoeff_ = 0.9f;
     float lowCutCoeff_ = 0.1f;
-    AudioFrame filterState_;
+    AudioFrame filterState_;         // High-cut (lowpass) state
+    AudioFrame lowCutState_;         // Low-cut (highpass) state
     
     // Helper methods
     void updateModulation();
@@ -72,95 +81,6 @@ private:
     static constexpr size_t MAX_BUFFER_SIZE = static_cast<size_t>(MAX_DELAY_TIME * SAMPLE_RATE);
 };
 
-/**
- * Reverb effect using multiple delay lines and allpass filters
- * Creates lush, realistic reverb tails
- */
-class ReverbEffect {
-public:
-    ReverbEffect();
-    ~ReverbEffect();
-    
-    // Core processing
-    void process(EtherAudioBuffer& buffer);
-    void reset();
-    
-    // Parameters
-    void setRoomSize(float size);              // 0.0 - 1.0
-    void setDamping(float damping);            // 0.0 - 1.0
-    void setMix(float mix);                    // 0.0 - 1.0
-    void setPreDelay(float delayMs);           // 0 - 100 ms
-    void setDiffusion(float diffusion);        // 0.0 - 1.0
-    
-    // Getters
-    float getRoomSize() const { return roomSize_; }
-    float getDamping() const { return damping_; }
-    float getMix() const { return mix_; }
-    
-    // Presets
-    void loadPreset(const std::string& presetName);
-    
-private:
-    // Reverb topology based on Freeverb algorithm
-    static constexpr size_t NUM_COMBS = 8;
-    static constexpr size_t NUM_ALLPASS = 4;
-    
-    struct CombFilter {
-        std::vector<float> buffer;
-        size_t bufferSize;
-        size_t index;
-        float feedback;
-        float filterStore;
-        float damp1;
-        float damp2;
-        
-        CombFilter(size_t size);
-        float process(float input);
-    };
-    
-    struct AllpassFilter {
-        std::vector<float> buffer;
-        size_t bufferSize;
-        size_t index;
-        float feedback;
-        
-        AllpassFilter(size_t size);
-        float process(float input);
-    };
-    
-    // Filter banks
-    std::array<CombFilter, NUM_COMBS> combFiltersL_;
-    std::array<CombFilter, NUM_COMBS> combFiltersR_;
-    std::array<AllpassFilter, NUM_ALLPASS> allpassFiltersL_;
-    std::array<AllpassFilter, NUM_ALLPASS> allpassFiltersR_;
-    
-    // Pre-delay
-    std::vector<AudioFrame> preDelayBuffer_;
-    size_t preDelaySize_ = 0;
-    size_t preDelayIndex_ = 0;
-    
-    // Parameters
-    float roomSize_ = 0.5f;
-    float damping_ = 0.5f;
-    float mix_ = 0.3f;
-    float gain_ = 0.015f;
-    
-    // Update methods
-    void updateCombFilters();
-    void setRoomSizeInternal(float value);
-    void setDampingInternal(float value);
-    
-    // Comb filter sizes (in samples) - optimized for minimal coloration
-    static constexpr std::array<size_t, NUM_COMBS> COMB_SIZES = {
-        1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617
-    };
-    
-    // Allpass filter sizes
-    static constexpr std::array<size_t, NUM_ALLPASS> ALLPASS_SIZES = {
-        556, 441, 341, 225
-    };
-};
-
 /**
  * Chorus effect with multiple delay lines for rich modulation
  */
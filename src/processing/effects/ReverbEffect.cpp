@@ -0,0 +1,350 @@
+#include "ReverbEffect.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float REFERENCE_RATE = 44100.0f;
+    constexpr int STEREO_SPREAD = 23;               // Extra samples on the right channel's lines
+    constexpr float MAX_PRE_DELAY_MS = 100.0f;
+
+    // Early reflection pattern: delay (ms), gain, pan
+    constexpr float EARLY_PATTERN[6][3] = {
+        {  7.1f, 0.60f, -0.7f },
+        { 11.3f, 0.50f,  0.6f },
+        { 17.9f, 0.42f, -0.3f },
+        { 23.3f, 0.35f,  0.8f },
+        { 31.7f, 0.28f, -0.9f },
+        { 41.9f, 0.22f,  0.2f }
+    };
+}
+
+ReverbEffect::ReverbEffect() {
+    initialize(sampleRate_);
+}
+
+ReverbEffect::~ReverbEffect() = default;
+
+void ReverbEffect::initialize(float sampleRate) {
+    sampleRate_ = std::max(8000.0f, sampleRate);
+    setupBuffers();
+    calculateEarlyReflections();
+    modulationLFO_.setSampleRate(sampleRate_);
+    modulationLFO_.setFrequency(modulationRate_);
+    highCutL_.setFrequency(highCutFreq_, sampleRate_);
+    highCutR_.setFrequency(highCutFreq_, sampleRate_);
+    lowCutL_.setFrequency(lowCutFreq_, sampleRate_, true);
+    lowCutR_.setFrequency(lowCutFreq_, sampleRate_, true);
+    setPreDelay(preDelayMs_);
+    updateParameters();
+    reset();
+}
+
+void ReverbEffect::process(EtherAudioBuffer& buffer) {
+    process(buffer, buffer.size());
+}
+
+void ReverbEffect::process(EtherAudioBuffer& buffer, size_t frames) {
+    if (!enabled_) return;
+    frames = std::min(frames, buffer.size());
+
+    const bool modulate = modulationDepth_ > 0.0f;
+    for (size_t i = 0; i < frames; ++i) {
+        const float inL = buffer[i].left;
+        const float inR = buffer[i].right;
+
+        // Mono feed into the tank, as in Freeverb
+        const float input = (inL + inR) * gain_;
+        const float delayedL = preDelayL_.process(input);
+        const float delayedR = preDelayR_.process(input);
+
+        // Slow allpass feedback wobble breaks up metallic ringing
+        if (modulate && (i & 15) == 0) {
+            const float feedback = 0.5f + modulationDepth_ * 0.1f * modulationLFO_.process();
+            for (int a = 0; a < NUM_ALLPASS; ++a) {
+                allpassFiltersL_[a].setFeedback(feedback);
+                allpassFiltersR_[a].setFeedback(feedback);
+            }
+        }
+
+        float outL = 0.0f, outR = 0.0f;
+        for (int c = 0; c < NUM_COMBS; ++c) {
+            outL += combFiltersL_[c].process(delayedL);
+            outR += combFiltersR_[c].process(delayedR);
+        }
+        for (int a = 0; a < NUM_ALLPASS; ++a) {
+            outL = allpassFiltersL_[a].process(outL);
+            outR = allpassFiltersR_[a].process(outR);
+        }
+
+        if (earlyReflections_) {
+            float earlyL = 0.0f, earlyR = 0.0f;
+            processEarlyReflections((inL + inR) * 0.25f, earlyL, earlyR);
+            outL += earlyL;
+            outR += earlyR;
+        }
+
+        // Tone shaping on the wet signal only
+        outL = lowCutL_.process(highCutL_.process(outL));
+        outR = lowCutR_.process(highCutR_.process(outR));
+
+        buffer[i].left = outL * wet1_ + outR * wet2_ + inL * dry_;
+        buffer[i].right = outR * wet1_ + outL * wet2_ + inR * dry_;
+    }
+}
+
+void ReverbEffect::reset() {
+    for (int c = 0; c < NUM_COMBS; ++c) {
+        combFiltersL_[c].clear();
+        combFiltersR_[c].clear();
+    }
+    for (int a = 0; a < NUM_ALLPASS; ++a) {
+        allpassFiltersL_[a].clear();
+        allpassFiltersR_[a].clear();
+    }
+    preDelayL_.clear();
+    preDelayR_.clear();
+    highCutL_.clear();
+    highCutR_.clear();
+    lowCutL_.clear();
+    lowCutR_.clear();
+    modulationLFO_.reset();
+    for (int e = 0; e < NUM_EARLY_REFLECTIONS; ++e) {
+        std::fill(earlyBuffers_[e].begin(), earlyBuffers_[e].end(), 0.0f);
+        earlyIndices_[e] = 0;
+    }
+}
+
+// Parameters
+void ReverbEffect::setRoomSize(float roomSize) {
+    roomSize_ = std::clamp(roomSize, 0.0f, 1.0f);
+    updateParameters();
+}
+
+void ReverbEffect::setDamping(float damping) {
+    damping_ = std::clamp(damping, 0.0f, 1.0f);
+    updateParameters();
+}
+
+void ReverbEffect::setWetLevel(float wetLevel) {
+    wetLevel_ = std::clamp(wetLevel, 0.0f, 1.0f);
+    updateParameters();
+}
+
+void ReverbEffect::setDryLevel(float dryLevel) {
+    dryLevel_ = std::clamp(dryLevel, 0.0f, 1.0f);
+    updateParameters();
+}
+
+void ReverbEffect::setWidth(float width) {
+    width_ = std::clamp(width, 0.0f, 1.0f);
+    updateParameters();
+}
+
+void ReverbEffect::setPreDelay(float preDelayMs) {
+    preDelayMs_ = std::clamp(preDelayMs, 0.0f, MAX_PRE_DELAY_MS);
+    const int samples = static_cast<int>(preDelayMs_ * 0.001f * sampleRate_);
+    preDelayL_.setDelay(samples);
+    preDelayR_.setDelay(samples);
+}
+
+void ReverbEffect::setEarlyReflections(bool enable) {
+    earlyReflections_ = enable;
+}
+
+void ReverbEffect::setHighCut(float frequency) {
+    highCutFreq_ = std::clamp(frequency, 1000.0f, sampleRate_ * 0.45f);
+    highCutL_.setFrequency(highCutFreq_, sampleRate_);
+    highCutR_.setFrequency(highCutFreq_, sampleRate_);
+}
+
+void ReverbEffect::setLowCut(float frequency) {
+    lowCutFreq_ = std::clamp(frequency, 20.0f, 1000.0f);
+    lowCutL_.setFrequency(lowCutFreq_, sampleRate_, true);
+    lowCutR_.setFrequency(lowCutFreq_, sampleRate_, true);
+}
+
+void ReverbEffect::setModulation(float rate, float depth) {
+    modulationRate_ = std::clamp(rate, 0.01f, 10.0f);
+    modulationDepth_ = std::clamp(depth, 0.0f, 1.0f);
+    modulationLFO_.setFrequency(modulationRate_);
+    if (modulationDepth_ <= 0.0f) {
+        for (int a = 0; a < NUM_ALLPASS; ++a) {
+            allpassFiltersL_[a].setFeedback(0.5f);
+            allpassFiltersR_[a].setFeedback(0.5f);
+        }
+    }
+}
+
+// Private methods
+void ReverbEffect::updateParameters() {
+    wet1_ = wetLevel_ * SCALE_WET * (width_ * 0.5f + 0.5f);
+    wet2_ = wetLevel_ * SCALE_WET * ((1.0f - width_) * 0.5f);
+    dry_ = dryLevel_ * SCALE_DRY;
+    roomSize1_ = roomSize_ * SCALE_ROOM + OFFSET_ROOM;
+    damping1_ = damping_ * SCALE_DAMP;
+
+    for (int c = 0; c < NUM_COMBS; ++c) {
+        combFiltersL_[c].setFeedback(roomSize1_);
+        combFiltersR_[c].setFeedback(roomSize1_);
+        combFiltersL_[c].setDamping(damping1_);
+        combFiltersR_[c].setDamping(damping1_);
+    }
+}
+
+void ReverbEffect::calculateEarlyReflections() {
+    for (int e = 0; e < NUM_EARLY_REFLECTIONS; ++e) {
+        earlyReflectionTaps_[e].delay = std::max(1, static_cast<int>(EARLY_PATTERN[e][0] * 0.001f * sampleRate_));
+        earlyReflectionTaps_[e].gain = EARLY_PATTERN[e][1];
+        earlyReflectionTaps_[e].pan = EARLY_PATTERN[e][2];
+        earlyBuffers_[e].assign(static_cast<size_t>(earlyReflectionTaps_[e].delay), 0.0f);
+        earlyIndices_[e] = 0;
+    }
+}
+
+void ReverbEffect::processEarlyReflections(float input, float& outputL, float& outputR) {
+    for (int e = 0; e < NUM_EARLY_REFLECTIONS; ++e) {
+        // Each line is exactly `delay` samples long: read the oldest sample, then overwrite it
+        auto& line = earlyBuffers_[e];
+        int& index = earlyIndices_[e];
+        const float tap = line[index] * earlyReflectionTaps_[e].gain;
+        line[index] = input;
+        if (++index >= static_cast<int>(line.size())) index = 0;
+
+        const float pan = earlyReflectionTaps_[e].pan;
+        outputL += tap * (0.5f - 0.5f * pan);
+        outputR += tap * (0.5f + 0.5f * pan);
+    }
+}
+
+void ReverbEffect::setupBuffers() {
+    for (int c = 0; c < NUM_COMBS; ++c) {
+        combFiltersL_[c].setBuffer(adjustDelay(COMB_DELAYS[c]));
+        combFiltersR_[c].setBuffer(adjustDelay(COMB_DELAYS[c] + STEREO_SPREAD));
+    }
+    for (int a = 0; a < NUM_ALLPASS; ++a) {
+        allpassFiltersL_[a].setBuffer(adjustDelay(ALLPASS_DELAYS[a]));
+        allpassFiltersR_[a].setBuffer(adjustDelay(ALLPASS_DELAYS[a] + STEREO_SPREAD));
+        allpassFiltersL_[a].setFeedback(0.5f);
+        allpassFiltersR_[a].setFeedback(0.5f);
+    }
+
+    // Pre-delay lines are sized for the maximum so setPreDelay never allocates
+    const size_t preDelayCapacity = static_cast<size_t>(MAX_PRE_DELAY_MS * 0.001f * sampleRate_) + 1;
+    preDelayL_.buffer.assign(preDelayCapacity, 0.0f);
+    preDelayR_.buffer.assign(preDelayCapacity, 0.0f);
+}
+
+int ReverbEffect::adjustDelay(int baseDelay) const {
+    return std::max(1, static_cast<int>(std::lround(baseDelay * sampleRate_ / REFERENCE_RATE)));
+}
+
+// Comb filter
+void ReverbEffect::CombFilter::setBuffer(int size) {
+    bufferSize = std::max(1, size);
+    buffer.assign(static_cast<size_t>(bufferSize), 0.0f);
+    bufferIndex = 0;
+}
+
+void ReverbEffect::CombFilter::setDamping(float val) {
+    damping1 = val;
+    damping2 = 1.0f - val;
+}
+
+void ReverbEffect::CombFilter::setFeedback(float val) {
+    feedback = val;
+}
+
+float ReverbEffect::CombFilter::process(float input) {
+    const float output = buffer[bufferIndex];
+    filterStore = output * damping2 + filterStore * damping1;
+    buffer[bufferIndex] = input + filterStore * feedback;
+    if (++bufferIndex >= bufferSize) bufferIndex = 0;
+    return output;
+}
+
+void ReverbEffect::CombFilter::clear() {
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+    filterStore = 0.0f;
+    bufferIndex = 0;
+}
+
+// Allpass filter
+void ReverbEffect::AllpassFilter::setBuffer(int size) {
+    bufferSize = std::max(1, size);
+    buffer.assign(static_cast<size_t>(bufferSize), 0.0f);
+    bufferIndex = 0;
+}
+
+void ReverbEffect::AllpassFilter::setFeedback(float val) {
+    feedback = val;
+}
+
+float ReverbEffect::AllpassFilter::process(float input) {
+    const float buffered = buffer[bufferIndex];
+    buffer[bufferIndex] = input + buffered * feedback;
+    if (++bufferIndex >= bufferSize) bufferIndex = 0;
+    return buffered - input;
+}
+
+void ReverbEffect::AllpassFilter::clear() {
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+    bufferIndex = 0;
+}
+
+// Pre-delay
+void ReverbEffect::PreDelayBuffer::setDelay(int samples) {
+    const int capacity = static_cast<int>(buffer.size());
+    delayLength = capacity > 0 ? std::clamp(samples, 0, capacity - 1) : 0;
+    readIndex = capacity > 0 ? (writeIndex - delayLength + capacity) % capacity : 0;
+}
+
+float ReverbEffect::PreDelayBuffer::process(float input) {
+    if (delayLength == 0 || buffer.empty()) return input;
+    const int capacity = static_cast<int>(buffer.size());
+    buffer[writeIndex] = input;
+    const float output = buffer[readIndex];
+    if (++writeIndex >= capacity) writeIndex = 0;
+    if (++readIndex >= capacity) readIndex = 0;
+    return output;
+}
+
+void ReverbEffect::PreDelayBuffer::clear() {
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+}
+
+// One-pole filter
+void ReverbEffect::OneThePoleFilter::setFrequency(float frequency, float sampleRate, bool highpass) {
+    this->highpass = highpass;
+    coefficient = std::exp(-TWO_PI * frequency / sampleRate);
+}
+
+float ReverbEffect::OneThePoleFilter::process(float input) {
+    state = input * (1.0f - coefficient) + state * coefficient;
+    return highpass ? input - state : state;
+}
+
+void ReverbEffect::OneThePoleFilter::clear() {
+    state = 0.0f;
+}
+
+// LFO
+float ReverbEffect::LFO::process() {
+    const float value = std::sin(phase * TWO_PI);
+    phase += frequency * 16.0f / sampleRate;    // Advanced once per 16 samples
+    if (phase >= 1.0f) phase -= 1.0f;
+    return value;
+}
+
+// Factory presets
+namespace ReverbPresets {
+    const ReverbSettings SMALL_ROOM  = { 0.30f, 0.60f, 0.25f, 0.0f, 0.7f,  5.0f,  7000.0f, 150.0f, true,  "Small Room" };
+    const ReverbSettings MEDIUM_ROOM = { 0.50f, 0.50f, 0.30f, 0.0f, 0.8f, 10.0f,  8000.0f, 120.0f, true,  "Medium Room" };
+    const ReverbSettings LARGE_ROOM  = { 0.70f, 0.45f, 0.33f, 0.0f, 0.9f, 20.0f,  9000.0f, 100.0f, true,  "Large Room" };
+    const ReverbSettings HALL        = { 0.85f, 0.40f, 0.35f, 0.0f, 1.0f, 30.0f, 10000.0f,  80.0f, true,  "Hall" };
+    const ReverbSettings CATHEDRAL   = { 0.98f, 0.30f, 0.40f, 0.0f, 1.0f, 50.0f, 12000.0f,  60.0f, false, "Cathedral" };
+    const ReverbSettings PLATE       = { 0.75f, 0.20f, 0.33f, 0.0f, 1.0f,  0.0f, 14000.0f, 200.0f, false, "Plate" };
+    const ReverbSettings SPRING      = { 0.55f, 0.70f, 0.30f, 0.0f, 0.5f,  0.0f,  5000.0f, 300.0f, false, "Spring" };
+    const ReverbSettings AMBIENT     = { 0.95f, 0.55f, 0.45f, 0.0f, 1.0f, 80.0f,  7000.0f, 100.0f, false, "Ambient" };
+    const ReverbSettings VOCAL_HALL  = { 0.80f, 0.50f, 0.30f, 0.0f, 0.9f, 40.0f,  9000.0f, 180.0f, true,  "Vocal Hall" };
+    const ReverbSettings DRUM_ROOM   = { 0.40f, 0.65f, 0.28f, 0.0f, 0.8f,  3.0f,  8000.0f, 150.0f, true,  "Drum Room" };
+}
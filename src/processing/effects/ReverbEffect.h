@@ -1,11 +1,14 @@
 #pragma once
-#include "../core/Types.h"
+#include "../../core/Types.h"
 #include <vector>
 #include <array>
 
 /**
  * High-Quality Reverb Effect
  * Implements Schroeder reverb with Freeverb enhancements
+ *
+ * initialize() sizes every delay line for the sample rate; process() and the
+ * parameter setters do not allocate, so they are safe on the audio thread.
  */
 class ReverbEffect {
 public:
@@ -14,6 +17,7 @@ public:
     
     void initialize(float sampleRate);
     void process(EtherAudioBuffer& buffer);
+    void process(EtherAudioBuffer& buffer, size_t frames);
     void reset();
     
     // Parameters
@@ -112,6 +116,7 @@ private:
     struct OneThePoleFilter {
         float state = 0.0f;
         float coefficient = 0.0f;
+        bool highpass = false;
         
         void setFrequency(float frequency, float sampleRate, bool highpass = false);
         float process(float input);
@@ -181,7 +186,7 @@ private:
     };
     
     static constexpr int NUM_EARLY_REFLECTIONS = 6;
-    std::array<EarlyReflection, NUM_EARLY_REFLECTIONS> earlyReflections_;
+    std::array<EarlyReflection, NUM_EARLY_REFLECTIONS> earlyReflectionTaps_;
     std::array<std::vector<float>, NUM_EARLY_REFLECTIONS> earlyBuffers_;
     std::array<int, NUM_EARLY_REFLECTIONS> earlyIndices_;
     
@@ -220,4 +225,4 @@ namespace ReverbPresets {
     extern const ReverbSettings AMBIENT;
     extern const ReverbSettings VOCAL_HALL;
     extern const ReverbSettings DRUM_ROOM;
-}
\ No newline at end of file
+}
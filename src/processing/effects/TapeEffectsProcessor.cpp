@@ -13,6 +13,11 @@ TapeEffectsProcessor::TapeEffectsProcessor() {
     // Initialize presets
     initializePresets();
     
+    // Oversampling for the saturation stage
+    for (auto& oversampler : saturationOversamplers_) {
+        oversampler.initialize(sampleRate_, oversampleFactor_, oversampleQuality_);
+    }
+    
     // Initialize filters
     state_.lowShelfFilter.setSampleRate(sampleRate_);
     state_.highShelfFilter.setSampleRate(sampleRate_);
@@ -70,18 +75,35 @@ void TapeEffectsProcessor::setBypassed(bool bypassed) {
     bypassed_ = bypassed;
 }
 
+void TapeEffectsProcessor::setOversampling(OversamplingProcessor::Factor factor,
+                                           OversamplingProcessor::Quality quality) {
+    oversampleFactor_ = factor;
+    oversampleQuality_ = quality;
+    for (auto& oversampler : saturationOversamplers_) {
+        oversampler.initialize(sampleRate_, oversampleFactor_, oversampleQuality_);
+    }
+}
+
 float TapeEffectsProcessor::processSample(float input) {
     if (bypassed_ || !config_.bypassable) {
         return input;
     }
     
-    float processed = input;
-    
     // 1. Input gain and bias
-    processed = calculateBiasEffect(processed);
+    float processed = calculateBiasEffect(input);
     
     // 2. Saturation processing
-    processed = processSaturation(processed);
+    processed = processSaturation(processed, 0);
+    
+    // 3-9. Dynamics, coloration, modulation and mix
+    return processAfterSaturation(input, processed);
+}
+
+float TapeEffectsProcessor::processAfterSaturation(float input, float saturated) {
+    float processed = saturated;
+    if (config_.saturationAmount > 0.0f) {
+        processed = smoothSaturation(processed);
+    }
     
     // 3. Compression processing
     processed = processCompression(processed, state_.compressorEnvelope);
@@ -108,25 +130,80 @@ float TapeEffectsProcessor::processSample(float input) {
 }
 
 void TapeEffectsProcessor::processBlock(const float* input, float* output, int numSamples) {
-    for (int i = 0; i < numSamples; i++) {
-        output[i] = processSample(input[i]);
+    if (bypassed_ || !config_.bypassable) {
+        std::memmove(output, input, sizeof(float) * numSamples);
+        return;
+    }
+    
+    // Chunked so the saturation stage runs oversampled over whole blocks;
+    // input and output may be the same buffer
+    float saturated[PROCESS_CHUNK];
+    for (int start = 0; start < numSamples; start += PROCESS_CHUNK) {
+        const int count = std::min(PROCESS_CHUNK, numSamples - start);
+        const float* in = input + start;
+        
+        for (int i = 0; i < count; i++) {
+            saturated[i] = calculateBiasEffect(in[i]);
+        }
+        processSaturationBlock(saturated, count, 0);
+        
+        for (int i = 0; i < count; i++) {
+            output[start + i] = processAfterSaturation(in[i], saturated[i]);
+        }
     }
 }
 
 void TapeEffectsProcessor::processStereo(const float* inputL, const float* inputR, 
                                        float* outputL, float* outputR, int numSamples) {
-    for (int i = 0; i < numSamples; i++) {
-        outputL[i] = processSample(inputL[i]);
-        outputR[i] = processSample(inputR[i]);
+    if (bypassed_ || !config_.bypassable) {
+        std::memmove(outputL, inputL, sizeof(float) * numSamples);
+        std::memmove(outputR, inputR, sizeof(float) * numSamples);
+        return;
+    }
+    
+    // Each channel has its own oversampler; the rest of the chain interleaves L and R as before
+    float saturatedL[PROCESS_CHUNK];
+    float saturatedR[PROCESS_CHUNK];
+    for (int start = 0; start < numSamples; start += PROCESS_CHUNK) {
+        const int count = std::min(PROCESS_CHUNK, numSamples - start);
+        const float* inL = inputL + start;
+        const float* inR = inputR + start;
+        
+        for (int i = 0; i < count; i++) {
+            saturatedL[i] = calculateBiasEffect(inL[i]);
+            saturatedR[i] = calculateBiasEffect(inR[i]);
+        }
+        processSaturationBlock(saturatedL, count, 0);
+        processSaturationBlock(saturatedR, count, 1);
+        
+        for (int i = 0; i < count; i++) {
+            outputL[start + i] = processAfterSaturation(inL[i], saturatedL[i]);
+            outputR[start + i] = processAfterSaturation(inR[i], saturatedR[i]);
+        }
     }
 }
 
-float TapeEffectsProcessor::processSaturation(float input) {
-    float amount = config_.saturationAmount;
-    if (amount <= 0.0f) {
+float TapeEffectsProcessor::processSaturation(float input, int channel) {
+    if (config_.saturationAmount <= 0.0f) {
         return input;
     }
     
+    return saturationOversamplers_[channel].processSample(
+        input, [this](float x) { return saturationCurve(x); });
+}
+
+void TapeEffectsProcessor::processSaturationBlock(float* buffer, int numSamples, int channel) {
+    if (config_.saturationAmount <= 0.0f) {
+        return;
+    }
+    
+    saturationOversamplers_[channel].processBlock(
+        buffer, buffer, numSamples, [this](float x) { return saturationCurve(x); });
+}
+
+float TapeEffectsProcessor::saturationCurve(float input) {
+    float amount = config_.saturationAmount;
+    
     // Apply appropriate saturation algorithm based on tape type
     float saturated = input;
     
@@ -163,6 +240,10 @@ float TapeEffectsProcessor::processSaturation(float input) {
         }
     }
     
+    return saturated;
+}
+
+float TapeEffectsProcessor::smoothSaturation(float saturated) {
     // Smooth the saturation to avoid artifacts
     state_.saturationSmoothing.setTarget(saturated);
     return state_.saturationSmoothing.process();
@@ -535,6 +616,9 @@ void TapeEffectsProcessor::reset() {
     state_.saturationSmoothing.setSampleRate(sampleRate_);
     state_.attackSmoothing.setSampleRate(sampleRate_);
     state_.releaseSmoothing.setSampleRate(sampleRate_);
+    for (auto& oversampler : saturationOversamplers_) {
+        oversampler.reset();
+    }
 }
 
 void TapeEffectsProcessor::setSampleRate(float sampleRate) {
@@ -545,6 +629,9 @@ void TapeEffectsProcessor::setSampleRate(float sampleRate) {
     state_.saturationSmoothing.setSampleRate(sampleRate);
     state_.attackSmoothing.setSampleRate(sampleRate);
     state_.releaseSmoothing.setSampleRate(sampleRate);
+    for (auto& oversampler : saturationOversamplers_) {
+        oversampler.initialize(sampleRate, oversampleFactor_, oversampleQuality_);
+    }
 }
 
 void TapeEffectsProcessor::generateSaturationLUT() {
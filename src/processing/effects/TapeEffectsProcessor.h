@@ -5,6 +5,7 @@
 #include <map>
 #include <string>
 #include "../synthesis/DSPUtils.h"
+#include "../../audio/OversamplingProcessor.h"
 
 /**
  * TapeEffectsProcessor - Comprehensive analog tape saturation and dynamics
@@ -16,6 +17,7 @@
  * - Multiple tape machine types (vintage, modern, exotic)
  * - Wow/flutter simulation for authentic tape movement
  * - Bias and equalization modeling
+ * - Saturation curves run oversampled (2x short FIR by default)
  * 
  * STM32 H7 optimized with lookup tables and efficient algorithms.
  */
@@ -146,6 +148,8 @@ public:
     void setCompressionAmount(float amount);
     void setWetDryMix(float mix);
     void setBypassed(bool bypassed);
+    void setOversampling(OversamplingProcessor::Factor factor,
+                         OversamplingProcessor::Quality quality = OversamplingProcessor::Quality::SHORT_FIR);
     
     // Processing
     float processSample(float input);
@@ -163,6 +167,7 @@ public:
     float getCompressionReduction() const;
     float getHarmonicContent() const;
     float getOutputLevel() const;
+    float getLatencySamples() const { return saturationOversamplers_[0].getLatencySamples(); }
     
     // System control
     void reset();
@@ -181,6 +186,12 @@ private:
     float sampleRate_ = 48000.0f;
     bool bypassed_ = false;
     
+    // Oversampling around the saturation curve, one per stereo channel
+    OversamplingProcessor saturationOversamplers_[2];
+    OversamplingProcessor::Factor oversampleFactor_ = OversamplingProcessor::Factor::X2;
+    OversamplingProcessor::Quality oversampleQuality_ = OversamplingProcessor::Quality::SHORT_FIR;
+    static constexpr int PROCESS_CHUNK = 64;
+    
     // Lookup tables for efficiency
     static constexpr int SATURATION_TABLE_SIZE = 1024;
     std::array<float, SATURATION_TABLE_SIZE> saturationLUT_;
@@ -190,7 +201,11 @@ private:
     std::map<std::string, TapeConfig> presets_;
     
     // Processing components
-    float processSaturation(float input);
+    float processSaturation(float input, int channel);
+    void processSaturationBlock(float* buffer, int numSamples, int channel);
+    float saturationCurve(float input);
+    float smoothSaturation(float saturated);
+    float processAfterSaturation(float input, float saturated);
     float processCompression(float input, float& envelope);
     float processFrequencyResponse(float input);
     float processModulation(float input);
@@ -0,0 +1,136 @@
+#include "EventScheduler.h"
+#include <algorithm>
+#include <cmath>
+
+EventScheduler::EventScheduler() {
+    sampleRate_ = 48000.0;
+    queueSize_ = 0;
+    sequence_ = 0;
+}
+
+void EventScheduler::setSampleRate(double sampleRate) {
+    if (sampleRate > 0.0) {
+        sampleRate_ = sampleRate;
+    }
+}
+
+uint64_t EventScheduler::msToSamples(double ms) const {
+    if (ms <= 0.0) return 0;
+    return static_cast<uint64_t>(std::llround(ms * 0.001 * sampleRate_));
+}
+
+bool EventScheduler::post(const SequencerEvent& event) {
+    size_t head = inboxHead_.load(std::memory_order_relaxed);
+    size_t tail = inboxTail_.load(std::memory_order_acquire);
+    if (head - tail >= INBOX_CAPACITY) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    inbox_[head & (INBOX_CAPACITY - 1)] = event;
+    inboxHead_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+void EventScheduler::requestFlush() {
+    flushRequested_.store(true, std::memory_order_release);
+}
+
+void EventScheduler::beginBlock(uint32_t frames) {
+    blockFrames_ = frames;
+    if (flushRequested_.exchange(false, std::memory_order_acq_rel)) {
+        // Discard both the inbox and the timed queue
+        inboxTail_.store(inboxHead_.load(std::memory_order_acquire), std::memory_order_release);
+        queueSize_ = 0;
+        return;
+    }
+    drainInbox();
+}
+
+bool EventScheduler::popDue(SequencerEvent& event, uint32_t& offset) {
+    if (queueSize_ == 0) return false;
+
+    uint64_t blockStart = clock_.load(std::memory_order_relaxed);
+    uint64_t blockEnd = blockStart + blockFrames_;
+    if (queue_[0].time >= blockEnd) return false;
+
+    event = queue_[0];
+    if (event.time < blockStart) {
+        late_.fetch_add(1, std::memory_order_relaxed);
+        offset = 0;
+    } else {
+        offset = static_cast<uint32_t>(event.time - blockStart);
+    }
+
+    --queueSize_;
+    if (queueSize_ > 0) {
+        queue_[0] = queue_[queueSize_];
+        order_[0] = order_[queueSize_];
+        siftDown(0);
+    }
+    return true;
+}
+
+bool EventScheduler::schedule(const SequencerEvent& event) {
+    if (queueSize_ >= QUEUE_CAPACITY) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    queue_[queueSize_] = event;
+    order_[queueSize_] = sequence_++;
+    siftUp(queueSize_);
+    ++queueSize_;
+    return true;
+}
+
+void EventScheduler::endBlock() {
+    clock_.fetch_add(blockFrames_, std::memory_order_acq_rel);
+    blockFrames_ = 0;
+}
+
+void EventScheduler::drainInbox() {
+    size_t tail = inboxTail_.load(std::memory_order_relaxed);
+    size_t head = inboxHead_.load(std::memory_order_acquire);
+    // Leave events in the inbox while the timed queue is full (back-pressure)
+    while (tail != head && queueSize_ < QUEUE_CAPACITY) {
+        schedule(inbox_[tail & (INBOX_CAPACITY - 1)]);
+        ++tail;
+    }
+    inboxTail_.store(tail, std::memory_order_release);
+}
+
+bool EventScheduler::earlier(size_t a, size_t b) const {
+    const SequencerEvent& ea = queue_[a];
+    const SequencerEvent& eb = queue_[b];
+    if (ea.time != eb.time) return ea.time < eb.time;
+    // Note-offs before note-ons at the same sample so retriggers are not cut
+    if (ea.type != eb.type) return ea.type < eb.type;
+    // Wrap-safe insertion order comparison
+    return static_cast<int32_t>(order_[a] - order_[b]) < 0;
+}
+
+void EventScheduler::swapEntries(size_t a, size_t b) {
+    std::swap(queue_[a], queue_[b]);
+    std::swap(order_[a], order_[b]);
+}
+
+void EventScheduler::siftUp(size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!earlier(index, parent)) break;
+        swapEntries(index, parent);
+        index = parent;
+    }
+}
+
+void EventScheduler::siftDown(size_t index) {
+    for (;;) {
+        size_t left = index * 2 + 1;
+        size_t right = left + 1;
+        size_t best = index;
+        if (left < queueSize_ && earlier(left, best)) best = left;
+        if (right < queueSize_ && earlier(right, best)) best = right;
+        if (best == index) break;
+        swapEntries(index, best);
+        index = best;
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * SequencerEvent - A single timestamped sequencer action
+ *
+ * Times are absolute positions on the audio sample clock owned by
+ * EventScheduler, so events never drift relative to the rendered audio.
+ */
+struct SequencerEvent {
+    enum class Type : uint8_t {
+        NOTE_OFF = 0,        // Release a step's note, or `note` on slot `slot` when step < 0 (ordered first at equal times)
+        STEP_ADVANCE,        // Playhead moved to `step` (UI/transport)
+        STEP_TRIGGER,        // Fire pattern step `step` of engine row `slot`
+        NOTE_ON,             // Plain note-on on instrument slot
+        DRUM_HIT,            // Drum pad note-on with temporary pad tune
+        MIDI_INPUT           // Live MIDI message (`status`, `note` = data1, `velocity` = data2 / 127)
+    };
+
+    uint64_t time = 0;           // Absolute sample time
+    Type type = Type::NOTE_ON;
+    int16_t slot = 0;            // Instrument slot (engine row for STEP_TRIGGER)
+    int16_t step = 0;            // Pattern step index
+    int16_t note = 60;           // MIDI note
+    float velocity = 0.0f;       // 0..1
+    float tune = 0.0f;           // Drum pad tune for DRUM_HIT (-1..+1)
+    uint32_t duration = 0;       // Step length in samples (ratchet spacing)
+    uint8_t status = 0;          // MIDI status byte for MIDI_INPUT
+};
+
+/**
+ * EventScheduler - Sample-accurate, lock-free sequencer event scheduling
+ *
+ * Replaces sleep-timed sequencer threads and detached note-off threads.
+ * A control thread (the sequencer look-ahead producer) posts timestamped
+ * events into a single-producer/single-consumer inbox. At the top of each
+ * audio block the callback drains the inbox into a preallocated timed queue
+ * (binary min-heap on the sample clock) and pops due events together with
+ * their frame offset inside the block, rendering audio up to each offset
+ * before dispatching. Note-offs, ratchets and micro-timed steps therefore
+ * land on exact samples regardless of thread scheduling.
+ *
+ * Features:
+ * - Wait-free SPSC inbox (control -> audio)
+ * - Fixed-capacity timed queue, no allocation after construction
+ * - Audio-side scheduling for events derived at dispatch (ratchets, note-offs)
+ * - Late events are delivered at offset 0 and counted
+ * - Flush request for transport stop
+ */
+class EventScheduler {
+public:
+    static constexpr size_t INBOX_CAPACITY = 1024;   // Power of two
+    static constexpr size_t QUEUE_CAPACITY = 2048;
+
+    EventScheduler();
+    ~EventScheduler() = default;
+
+    // Configuration
+    void setSampleRate(double sampleRate);
+    double getSampleRate() const { return sampleRate_; }
+    uint64_t msToSamples(double ms) const;
+
+    // Control thread (single producer)
+    bool post(const SequencerEvent& event);
+    void requestFlush();                      // Drop everything pending at next block
+    uint64_t now() const { return clock_.load(std::memory_order_acquire); }
+
+    // Audio thread (single consumer)
+    void beginBlock(uint32_t frames);
+    bool popDue(SequencerEvent& event, uint32_t& offset);
+    bool schedule(const SequencerEvent& event); // Insert directly into the timed queue
+    void endBlock();
+
+    // Diagnostics
+    size_t getPendingCount() const { return queueSize_; }
+    uint32_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+    uint32_t getLateCount() const { return late_.load(std::memory_order_relaxed); }
+
+private:
+    double sampleRate_ = 48000.0;
+
+    // Audio sample clock: start of the current block
+    std::atomic<uint64_t> clock_{0};
+    uint32_t blockFrames_ = 0;
+
+    // SPSC inbox
+    std::array<SequencerEvent, INBOX_CAPACITY> inbox_;
+    std::atomic<size_t> inboxHead_{0};   // Written by producer
+    std::atomic<size_t> inboxTail_{0};   // Written by consumer
+    std::atomic<bool> flushRequested_{false};
+
+    // Timed queue (audio thread only)
+    std::array<SequencerEvent, QUEUE_CAPACITY> queue_;
+    size_t queueSize_ = 0;
+    uint32_t sequence_ = 0;
+    std::array<uint32_t, QUEUE_CAPACITY> order_{};   // Insertion order tie-break
+
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint32_t> late_{0};
+
+    void drainInbox();
+    bool earlier(size_t a, size_t b) const;
+    void swapEntries(size_t a, size_t b);
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+};
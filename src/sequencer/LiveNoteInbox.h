@@ -0,0 +1,70 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * LiveNote - A note played live (pads, keyboard) or by a sleep-timed sequencer
+ */
+struct LiveNote {
+    bool on = true;              // false = release
+    int16_t slot = 0;            // Instrument slot
+    int16_t note = 60;           // MIDI note
+    float velocity = 0.0f;       // 0..1
+};
+
+/**
+ * LiveNoteInbox - Hands notes from one non-RT thread to the audio callback
+ *
+ * Engine note events must not overlap rendering (see VoiceManager), so input
+ * threads post here instead of calling ether_note_on/off directly. The audio
+ * callback drains the inbox before it renders, setting the active instrument
+ * and playing each note on its own thread. One inbox per producer thread:
+ * the sequencer's EventScheduler inbox stays single-producer too.
+ *
+ * Features:
+ * - Wait-free SPSC ring (producer -> audio), no allocation
+ * - Full inbox drops the note and counts it rather than blocking the producer
+ */
+class LiveNoteInbox {
+public:
+    static constexpr size_t CAPACITY = 256;   // Power of two
+
+    // Producer thread
+    bool post(const LiveNote& note) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= CAPACITY) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        ring_[head & (CAPACITY - 1)] = note;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool postNoteOn(int slot, int note, float velocity) {
+        return post(LiveNote{true, static_cast<int16_t>(slot), static_cast<int16_t>(note), velocity});
+    }
+
+    bool postNoteOff(int slot, int note) {
+        return post(LiveNote{false, static_cast<int16_t>(slot), static_cast<int16_t>(note), 0.0f});
+    }
+
+    // Audio thread
+    bool pop(LiveNote& note) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        note = ring_[tail & (CAPACITY - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::array<LiveNote, CAPACITY> ring_{ };
+    std::atomic<size_t> head_{0};   // Written by producer
+    std::atomic<size_t> tail_{0};   // Written by audio thread
+    std::atomic<uint32_t> dropped_{0};
+};
@@ -7,5 +7,6 @@ struct StepData {
     bool hasAccent = false;      // Accent mode flag
     bool hasRetrigger = false;   // Retrigger mode flag
     bool hasArpeggiator = false; // Arpeggiator mode flag
+    float microTiming = 0.0f;    // Step offset as a fraction of a step (-0.5..+0.5)
 };
 
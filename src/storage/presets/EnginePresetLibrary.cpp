@@ -1,5 +1,7 @@
 #include "EnginePresetLibrary.h"
+#include "../../core/JsonStream.h"
 #include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <iostream>
 #include <sstream>
@@ -9,6 +11,72 @@
 const std::string EnginePresetLibrary::PRESET_FILE_EXTENSION = ".ethpreset";
 const std::string EnginePresetLibrary::PRESET_SCHEMA_VERSION = "1.0";
 
+namespace {
+    using EngineType = EnginePresetLibrary::EngineType;
+
+    // Every key the preset schema uses, resolved through a compile-time perfect hash
+    enum class PresetKey {
+        SCHEMA_VERSION, PRESET_INFO, HOLD_PARAMS, TWIST_PARAMS, MORPH_PARAMS, MACRO_ASSIGNMENTS,
+        FX_PARAMS, VELOCITY_CONFIG, PERFORMANCE,
+        NAME, DESCRIPTION, AUTHOR, ENGINE_TYPE, CATEGORY, CREATION_TIME, MODIFICATION_TIME, TAGS,
+        PARAMETER, AMOUNT, ENABLED,
+        ENABLE_VELOCITY_TO_VOLUME, VELOCITY_MAPPINGS,
+        MORPH_TRANSITION_TIME, ENABLE_PARAMETER_SMOOTHING, PARAMETER_SMOOTHING_TIME,
+        PRESETS
+    };
+
+    constexpr JsonKey kPresetKeys[] = {
+        {"schema_version", static_cast<int>(PresetKey::SCHEMA_VERSION)},
+        {"preset_info", static_cast<int>(PresetKey::PRESET_INFO)},
+        {"hold_params", static_cast<int>(PresetKey::HOLD_PARAMS)},
+        {"twist_params", static_cast<int>(PresetKey::TWIST_PARAMS)},
+        {"morph_params", static_cast<int>(PresetKey::MORPH_PARAMS)},
+        {"macro_assignments", static_cast<int>(PresetKey::MACRO_ASSIGNMENTS)},
+        {"fx_params", static_cast<int>(PresetKey::FX_PARAMS)},
+        {"velocity_config", static_cast<int>(PresetKey::VELOCITY_CONFIG)},
+        {"performance", static_cast<int>(PresetKey::PERFORMANCE)},
+        {"name", static_cast<int>(PresetKey::NAME)},
+        {"description", static_cast<int>(PresetKey::DESCRIPTION)},
+        {"author", static_cast<int>(PresetKey::AUTHOR)},
+        {"engine_type", static_cast<int>(PresetKey::ENGINE_TYPE)},
+        {"category", static_cast<int>(PresetKey::CATEGORY)},
+        {"creation_time", static_cast<int>(PresetKey::CREATION_TIME)},
+        {"modification_time", static_cast<int>(PresetKey::MODIFICATION_TIME)},
+        {"tags", static_cast<int>(PresetKey::TAGS)},
+        {"parameter", static_cast<int>(PresetKey::PARAMETER)},
+        {"amount", static_cast<int>(PresetKey::AMOUNT)},
+        {"enabled", static_cast<int>(PresetKey::ENABLED)},
+        {"enable_velocity_to_volume", static_cast<int>(PresetKey::ENABLE_VELOCITY_TO_VOLUME)},
+        {"velocity_mappings", static_cast<int>(PresetKey::VELOCITY_MAPPINGS)},
+        {"morph_transition_time", static_cast<int>(PresetKey::MORPH_TRANSITION_TIME)},
+        {"enable_parameter_smoothing", static_cast<int>(PresetKey::ENABLE_PARAMETER_SMOOTHING)},
+        {"parameter_smoothing_time", static_cast<int>(PresetKey::PARAMETER_SMOOTHING_TIME)},
+        {"presets", static_cast<int>(PresetKey::PRESETS)}
+    };
+    constexpr auto kPresetKeyMap = makeJsonKeyMap(kPresetKeys);
+
+    PresetKey lookupKey(std::string_view key) {
+        return static_cast<PresetKey>(kPresetKeyMap.find(key));
+    }
+
+    std::string presetKey(EngineType engineType, const std::string& name) {
+        return std::to_string(static_cast<int>(engineType)) + ":" + name;
+    }
+
+    // Case-insensitive substring match; an empty needle matches everything
+    bool containsIgnoreCase(const std::string& haystack, const std::string& needle) {
+        auto it = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end(),
+            [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            });
+        return it != haystack.end() || needle.empty();
+    }
+
+    bool hasTag(const EnginePresetLibrary::EnginePreset& preset, const std::string& tag) {
+        return std::find(preset.tags.begin(), preset.tags.end(), tag) != preset.tags.end();
+    }
+}
+
 EnginePresetLibrary::EnginePresetLibrary() {
     enabled_ = true;
     presetDirectory_ = "./presets/";
@@ -117,27 +185,12 @@ bool EnginePresetLibrary::hasPreset(const std::string& presetName, EngineType en
 }
 
 const EnginePresetLibrary::EnginePreset* EnginePresetLibrary::getPreset(const std::string& presetName, EngineType engineType) const {
-    // Search factory presets
-    auto factoryIt = factoryPresets_.find(engineType);
-    if (factoryIt != factoryPresets_.end()) {
-        for (const auto& preset : factoryIt->second) {
-            if (preset->name == presetName) {
-                return preset.get();
-            }
-        }
-    }
-    
-    // Search user presets
-    auto userIt = userPresets_.find(engineType);
-    if (userIt != userPresets_.end()) {
-        for (const auto& preset : userIt->second) {
-            if (preset->name == presetName) {
-                return preset.get();
-            }
-        }
+    if (!cacheValid_) {
+        updatePresetCache();
     }
     
-    return nullptr;
+    auto it = presetCache_.find(presetKey(engineType, presetName));
+    return (it != presetCache_.end()) ? it->second : nullptr;
 }
 
 EnginePresetLibrary::EnginePreset* EnginePresetLibrary::getPresetMutable(const std::string& presetName, EngineType engineType) {
@@ -983,259 +1036,378 @@ void EnginePresetLibrary::createSignaturePresets() {
     invalidateCache();
 }
 
-// JSON serialization implementation
-std::string EnginePresetLibrary::serializePreset(const EnginePreset& preset) const {
-    std::ostringstream json;
-    
-    json << "{\n";
-    json << "  \"schema_version\": \"" << preset.version << "\",\n";
-    json << "  \"preset_info\": {\n";
-    json << "    \"name\": \"" << preset.name << "\",\n";
-    json << "    \"description\": \"" << preset.description << "\",\n";
-    json << "    \"author\": \"" << preset.author << "\",\n";
-    json << "    \"engine_type\": " << static_cast<int>(preset.engineType) << ",\n";
-    json << "    \"category\": " << static_cast<int>(preset.category) << ",\n";
-    json << "    \"creation_time\": " << preset.creationTime << ",\n";
-    json << "    \"modification_time\": " << preset.modificationTime << ",\n";
-    json << "    \"tags\": [";
-    for (size_t i = 0; i < preset.tags.size(); ++i) {
-        json << "\"" << preset.tags[i] << "\"";
-        if (i < preset.tags.size() - 1) json << ", ";
-    }
-    json << "]\n";
-    json << "  },\n";
-    
-    // Hold parameters (H)
-    json << "  \"hold_params\": {\n";
-    json << serializeParameterMap(preset.holdParams);
-    json << "  },\n";
+// Preset searching and filtering
+std::vector<const EnginePresetLibrary::EnginePreset*> EnginePresetLibrary::searchPresets(const PresetSearchCriteria& criteria) const {
+    std::vector<const EnginePreset*> results;
     
-    // Twist parameters (T)
-    json << "  \"twist_params\": {\n";
-    json << serializeParameterMap(preset.twistParams);
-    json << "  },\n";
-    
-    // Morph parameters (M)
-    json << "  \"morph_params\": {\n";
-    json << serializeParameterMap(preset.morphParams);
-    json << "  },\n";
+    auto matches = [&criteria](const EnginePreset& preset) {
+        for (const auto& tag : criteria.tags) {
+            if (!hasTag(preset, tag)) return false;
+        }
+        return containsIgnoreCase(preset.name, criteria.nameFilter) &&
+               containsIgnoreCase(preset.author, criteria.authorFilter);
+    };
     
-    // Macro assignments
-    json << "  \"macro_assignments\": {\n";
-    bool first = true;
-    for (const auto& [macroId, assignment] : preset.macroAssignments) {
-        if (!first) json << ",\n";
-        json << "    \"macro_" << static_cast<int>(macroId) << "\": {\n";
-        json << "      \"parameter\": \"" << assignment.parameterName << "\",\n";
-        json << "      \"amount\": " << assignment.amount << ",\n";
-        json << "      \"enabled\": " << (assignment.enabled ? "true" : "false") << "\n";
-        json << "    }";
-        first = false;
+    // Factory presets must match the category; user presets are all USER_CUSTOM
+    auto factoryIt = factoryPresets_.find(criteria.engineType);
+    if (factoryIt != factoryPresets_.end()) {
+        for (const auto& preset : factoryIt->second) {
+            if (preset->category == criteria.category && matches(*preset)) {
+                results.push_back(preset.get());
+            }
+        }
     }
-    json << "\n  },\n";
     
-    // Effects parameters
-    json << "  \"fx_params\": {\n";
-    json << serializeParameterMap(preset.fxParams);
-    json << "  },\n";
-    
-    // Velocity configuration
-    json << "  \"velocity_config\": {\n";
-    json << "    \"enable_velocity_to_volume\": " << (preset.velocityConfig.enableVelocityToVolume ? "true" : "false") << ",\n";
-    json << "    \"velocity_mappings\": {\n";
-    first = true;
-    for (const auto& [param, amount] : preset.velocityConfig.velocityMappings) {
-        if (!first) json << ",\n";
-        json << "      \"" << param << "\": " << amount;
-        first = false;
+    auto userIt = userPresets_.find(criteria.engineType);
+    if (criteria.includeUserPresets && userIt != userPresets_.end()) {
+        for (const auto& preset : userIt->second) {
+            if (matches(*preset)) {
+                results.push_back(preset.get());
+            }
+        }
     }
-    json << "\n    }\n";
-    json << "  },\n";
     
-    // Performance settings
-    json << "  \"performance\": {\n";
-    json << "    \"morph_transition_time\": " << preset.morphTransitionTime << ",\n";
-    json << "    \"enable_parameter_smoothing\": " << (preset.enableParameterSmoothing ? "true" : "false") << ",\n";
-    json << "    \"parameter_smoothing_time\": " << preset.parameterSmoothingTime << "\n";
-    json << "  }\n";
+    return results;
+}
+
+std::vector<const EnginePresetLibrary::EnginePreset*> EnginePresetLibrary::getPresetsByTag(const std::string& tag) const {
+    std::vector<const EnginePreset*> results;
     
-    json << "}";
+    for (const auto* storage : {&factoryPresets_, &userPresets_}) {
+        for (const auto& [engineType, presets] : *storage) {
+            for (const auto& preset : presets) {
+                if (hasTag(*preset, tag)) {
+                    results.push_back(preset.get());
+                }
+            }
+        }
+    }
     
-    return json.str();
+    return results;
+}
+
+// JSON serialization implementation
+std::string EnginePresetLibrary::serializePreset(const EnginePreset& preset) const {
+    std::string out;
+    out.reserve(2048);
+    JsonWriter json(out);
+    writePreset(json, preset);
+    return out;
 }
 
 bool EnginePresetLibrary::deserializePreset(const std::string& json, EnginePreset& preset) const {
-    // Simple JSON parsing implementation
-    // In a production system, this would use a proper JSON library
+    // Reset preset to defaults
+    preset = EnginePreset();
     
-    try {
-        // Reset preset to defaults
-        preset = EnginePreset();
-        
-        // Parse basic fields (simplified implementation)
-        size_t namePos = json.find("\"name\": \"");
-        if (namePos != std::string::npos) {
-            namePos += 9; // Skip "\"name\": \""
-            size_t nameEnd = json.find("\"", namePos);
-            if (nameEnd != std::string::npos) {
-                preset.name = json.substr(namePos, nameEnd - namePos);
-            }
-        }
-        
-        size_t descPos = json.find("\"description\": \"");
-        if (descPos != std::string::npos) {
-            descPos += 15; // Skip "\"description\": \""
-            size_t descEnd = json.find("\"", descPos);
-            if (descEnd != std::string::npos) {
-                preset.description = json.substr(descPos, descEnd - descPos);
-            }
-        }
-        
-        size_t authorPos = json.find("\"author\": \"");
-        if (authorPos != std::string::npos) {
-            authorPos += 11; // Skip "\"author\": \""
-            size_t authorEnd = json.find("\"", authorPos);
-            if (authorEnd != std::string::npos) {
-                preset.author = json.substr(authorPos, authorEnd - authorPos);
-            }
-        }
-        
-        // Parse engine type
-        size_t enginePos = json.find("\"engine_type\": ");
-        if (enginePos != std::string::npos) {
-            enginePos += 15; // Skip "\"engine_type\": "
-            size_t engineEnd = json.find(",", enginePos);
-            if (engineEnd != std::string::npos) {
-                int engineType = std::stoi(json.substr(enginePos, engineEnd - enginePos));
-                preset.engineType = static_cast<EngineType>(engineType);
-            }
-        }
-        
-        // Parse category
-        size_t categoryPos = json.find("\"category\": ");
-        if (categoryPos != std::string::npos) {
-            categoryPos += 12; // Skip "\"category\": "
-            size_t categoryEnd = json.find(",", categoryPos);
-            if (categoryEnd != std::string::npos) {
-                int category = std::stoi(json.substr(categoryPos, categoryEnd - categoryPos));
-                preset.category = static_cast<PresetCategory>(category);
-            }
-        }
-        
-        // Parse parameter sections (simplified)
-        if (!deserializeParameterMap(json, preset.holdParams)) return false;
-        if (!deserializeParameterMap(json, preset.twistParams)) return false;
-        if (!deserializeParameterMap(json, preset.morphParams)) return false;
-        if (!deserializeParameterMap(json, preset.fxParams)) return false;
-        
-        return true;
-        
-    } catch (const std::exception& e) {
-        std::cerr << "JSON deserialization error: " << e.what() << std::endl;
+    JsonReader reader(json);
+    if (!readPreset(reader, preset) || !reader.atEnd()) {
+        std::cerr << "JSON deserialization error at offset " << reader.getErrorOffset() << std::endl;
         return false;
     }
+    return true;
 }
 
 std::string EnginePresetLibrary::exportPresetLibrary(EngineType engineType) const {
-    std::ostringstream json;
-    
-    json << "{\n";
-    json << "  \"library_info\": {\n";
-    json << "    \"engine_type\": " << static_cast<int>(engineType) << ",\n";
-    json << "    \"export_time\": " << getCurrentTimestamp() << ",\n";
-    json << "    \"schema_version\": \"" << PRESET_SCHEMA_VERSION << "\"\n";
-    json << "  },\n";
-    json << "  \"presets\": [\n";
-    
-    // Export factory presets
-    bool first = true;
-    auto factoryIt = factoryPresets_.find(engineType);
-    if (factoryIt != factoryPresets_.end()) {
-        for (const auto& preset : factoryIt->second) {
-            if (!first) json << ",\n";
-            json << serializePreset(*preset);
-            first = false;
+    std::string out;
+    JsonWriter json(out);
+    
+    json.beginObject();
+    json.key("library_info");
+    json.beginObject();
+    json.member("engine_type", static_cast<int>(engineType));
+    json.member("export_time", getCurrentTimestamp());
+    json.member("schema_version", PRESET_SCHEMA_VERSION);
+    json.endObject();
+    
+    json.key("presets");
+    json.beginArray();
+    
+    // Export factory presets, then user presets
+    for (const auto* storage : {&factoryPresets_, &userPresets_}) {
+        auto it = storage->find(engineType);
+        if (it == storage->end()) continue;
+        for (const auto& preset : it->second) {
+            writePreset(json, *preset);
         }
     }
     
-    // Export user presets
-    auto userIt = userPresets_.find(engineType);
-    if (userIt != userPresets_.end()) {
-        for (const auto& preset : userIt->second) {
-            if (!first) json << ",\n";
-            json << serializePreset(*preset);
-            first = false;
-        }
-    }
+    json.endArray();
+    json.endObject();
     
-    json << "\n  ]\n";
-    json << "}";
-    
-    return json.str();
+    return out;
 }
 
 bool EnginePresetLibrary::importPresetLibrary(const std::string& json, EngineType engineType) {
-    // Simplified JSON import implementation
-    try {
-        // Parse the presets array and import each preset
-        size_t presetsPos = json.find("\"presets\": [");
-        if (presetsPos == std::string::npos) return false;
-        
-        // For now, just return success - full implementation would parse each preset
-        return true;
+    JsonReader reader(json);
+    std::string_view key;
+    bool foundPresets = false;
+    
+    if (!reader.beginObject()) return false;
+    while (reader.nextMember(key)) {
+        if (lookupKey(key) != PresetKey::PRESETS || reader.peek() != JsonReader::Type::ARRAY) {
+            reader.skipValue();
+            continue;
+        }
         
-    } catch (const std::exception& e) {
-        std::cerr << "JSON import error: " << e.what() << std::endl;
+        foundPresets = true;
+        reader.beginArray();
+        while (reader.nextElement()) {
+            EnginePreset preset;
+            if (!readPreset(reader, preset)) break;
+            
+            // Presets for other engines don't belong in this library; invalid ones are rejected by addPreset
+            if (preset.engineType == engineType) {
+                addPreset(preset);
+            }
+        }
+    }
+    
+    if (reader.hasError()) {
+        std::cerr << "JSON import error at offset " << reader.getErrorOffset() << std::endl;
         return false;
     }
+    return foundPresets;
+}
+
+void EnginePresetLibrary::writePreset(JsonWriter& json, const EnginePreset& preset) const {
+    json.beginObject();
+    json.member("schema_version", preset.version);
+    
+    json.key("preset_info");
+    json.beginObject();
+    json.member("name", preset.name);
+    json.member("description", preset.description);
+    json.member("author", preset.author);
+    json.member("engine_type", static_cast<int>(preset.engineType));
+    json.member("category", static_cast<int>(preset.category));
+    json.member("creation_time", preset.creationTime);
+    json.member("modification_time", preset.modificationTime);
+    json.key("tags");
+    json.beginArray(true);
+    for (const auto& tag : preset.tags) {
+        json.value(tag);
+    }
+    json.endArray();
+    json.endObject();
+    
+    // Hold parameters (H)
+    json.key("hold_params");
+    serializeParameterMap(json, preset.holdParams);
+    
+    // Twist parameters (T)
+    json.key("twist_params");
+    serializeParameterMap(json, preset.twistParams);
+    
+    // Morph parameters (M)
+    json.key("morph_params");
+    serializeParameterMap(json, preset.morphParams);
+    
+    // Macro assignments
+    json.key("macro_assignments");
+    json.beginObject();
+    for (const auto& [macroId, assignment] : preset.macroAssignments) {
+        json.key("macro_" + std::to_string(macroId));
+        json.beginObject();
+        json.member("parameter", assignment.parameterName);
+        json.member("amount", assignment.amount);
+        json.member("enabled", assignment.enabled);
+        json.endObject();
+    }
+    json.endObject();
+    
+    // Effects parameters
+    json.key("fx_params");
+    serializeParameterMap(json, preset.fxParams);
+    
+    // Velocity configuration
+    json.key("velocity_config");
+    json.beginObject();
+    json.member("enable_velocity_to_volume", preset.velocityConfig.enableVelocityToVolume);
+    json.key("velocity_mappings");
+    serializeParameterMap(json, preset.velocityConfig.velocityMappings);
+    json.endObject();
+    
+    // Performance settings
+    json.key("performance");
+    json.beginObject();
+    json.member("morph_transition_time", preset.morphTransitionTime);
+    json.member("enable_parameter_smoothing", preset.enableParameterSmoothing);
+    json.member("parameter_smoothing_time", preset.parameterSmoothingTime);
+    json.endObject();
+    
+    json.endObject();
+}
+
+bool EnginePresetLibrary::readPreset(JsonReader& reader, EnginePreset& preset) const {
+    std::string_view key;
+    int64_t number = 0;
+    
+    if (!reader.beginObject()) return false;
+    while (reader.nextMember(key)) {
+        switch (lookupKey(key)) {
+            case PresetKey::SCHEMA_VERSION:
+                reader.readString(preset.version);
+                break;
+                
+            case PresetKey::PRESET_INFO:
+                if (!reader.beginObject()) return false;
+                while (reader.nextMember(key)) {
+                    switch (lookupKey(key)) {
+                        case PresetKey::NAME: reader.readString(preset.name); break;
+                        case PresetKey::DESCRIPTION: reader.readString(preset.description); break;
+                        case PresetKey::AUTHOR: reader.readString(preset.author); break;
+                        case PresetKey::ENGINE_TYPE:
+                            if (reader.readInt(number)) preset.engineType = static_cast<EngineType>(number);
+                            break;
+                        case PresetKey::CATEGORY:
+                            if (reader.readInt(number)) preset.category = static_cast<PresetCategory>(number);
+                            break;
+                        case PresetKey::CREATION_TIME:
+                            if (reader.readInt(number)) preset.creationTime = static_cast<uint64_t>(number);
+                            break;
+                        case PresetKey::MODIFICATION_TIME:
+                            if (reader.readInt(number)) preset.modificationTime = static_cast<uint64_t>(number);
+                            break;
+                        case PresetKey::TAGS:
+                            if (!reader.beginArray()) return false;
+                            preset.tags.clear();
+                            while (reader.nextElement()) {
+                                preset.tags.emplace_back();
+                                reader.readString(preset.tags.back());
+                            }
+                            break;
+                        default:
+                            reader.skipValue();
+                            break;
+                    }
+                }
+                break;
+                
+            case PresetKey::HOLD_PARAMS:
+                deserializeParameterMap(reader, preset.holdParams);
+                break;
+            case PresetKey::TWIST_PARAMS:
+                deserializeParameterMap(reader, preset.twistParams);
+                break;
+            case PresetKey::MORPH_PARAMS:
+                deserializeParameterMap(reader, preset.morphParams);
+                break;
+            case PresetKey::FX_PARAMS:
+                deserializeParameterMap(reader, preset.fxParams);
+                break;
+                
+            case PresetKey::MACRO_ASSIGNMENTS:
+                if (!reader.beginObject()) return false;
+                preset.macroAssignments.clear();
+                while (reader.nextMember(key)) {
+                    // Keys are "macro_<id>"
+                    int macroId = -1;
+                    if (key.size() > 6 && key.substr(0, 6) == "macro_") {
+                        macroId = 0;
+                        for (char c : key.substr(6)) {
+                            macroId = (c >= '0' && c <= '9' && macroId < 256) ? macroId * 10 + (c - '0') : -1;
+                            if (macroId < 0) break;
+                        }
+                    }
+                    if (macroId < 0 || macroId > 255 || reader.peek() != JsonReader::Type::OBJECT) {
+                        reader.skipValue();
+                        continue;
+                    }
+                    
+                    auto& assignment = preset.macroAssignments[static_cast<uint8_t>(macroId)];
+                    reader.beginObject();
+                    while (reader.nextMember(key)) {
+                        switch (lookupKey(key)) {
+                            case PresetKey::PARAMETER: reader.readString(assignment.parameterName); break;
+                            case PresetKey::AMOUNT: reader.readFloat(assignment.amount); break;
+                            case PresetKey::ENABLED: reader.readBool(assignment.enabled); break;
+                            default: reader.skipValue(); break;
+                        }
+                    }
+                }
+                break;
+                
+            case PresetKey::VELOCITY_CONFIG:
+                if (!reader.beginObject()) return false;
+                while (reader.nextMember(key)) {
+                    switch (lookupKey(key)) {
+                        case PresetKey::ENABLE_VELOCITY_TO_VOLUME:
+                            reader.readBool(preset.velocityConfig.enableVelocityToVolume);
+                            break;
+                        case PresetKey::VELOCITY_MAPPINGS:
+                            deserializeParameterMap(reader, preset.velocityConfig.velocityMappings);
+                            break;
+                        default:
+                            reader.skipValue();
+                            break;
+                    }
+                }
+                break;
+                
+            case PresetKey::PERFORMANCE:
+                if (!reader.beginObject()) return false;
+                while (reader.nextMember(key)) {
+                    switch (lookupKey(key)) {
+                        case PresetKey::MORPH_TRANSITION_TIME: reader.readFloat(preset.morphTransitionTime); break;
+                        case PresetKey::ENABLE_PARAMETER_SMOOTHING: reader.readBool(preset.enableParameterSmoothing); break;
+                        case PresetKey::PARAMETER_SMOOTHING_TIME: reader.readFloat(preset.parameterSmoothingTime); break;
+                        default: reader.skipValue(); break;
+                    }
+                }
+                break;
+                
+            default:
+                reader.skipValue();
+                break;
+        }
+    }
+    
+    return !reader.hasError();
 }
 
 // Helper methods for parameter map serialization
-std::string EnginePresetLibrary::serializeParameterMap(const std::unordered_map<std::string, float>& params) const {
-    std::ostringstream result;
-    bool first = true;
-    
+void EnginePresetLibrary::serializeParameterMap(JsonWriter& json, const std::unordered_map<std::string, float>& params) const {
+    json.beginObject();
     for (const auto& [paramName, value] : params) {
-        if (!first) result << ",\n";
-        result << "    \"" << paramName << "\": " << std::fixed << std::setprecision(3) << value;
-        first = false;
+        json.member(paramName, value);
     }
-    
-    if (!params.empty()) result << "\n";
-    return result.str();
+    json.endObject();
 }
 
-bool EnginePresetLibrary::deserializeParameterMap(const std::string& json, std::unordered_map<std::string, float>& params) const {
-    // Simplified parameter parsing - in production would use proper JSON parser
+bool EnginePresetLibrary::deserializeParameterMap(JsonReader& reader, std::unordered_map<std::string, float>& params) const {
     params.clear();
     
-    // Example: parse hold_params section
-    size_t holdStart = json.find("\"hold_params\": {");
-    if (holdStart != std::string::npos) {
-        holdStart += 16; // Skip "\"hold_params\": {"
-        size_t holdEnd = json.find("},", holdStart);
-        if (holdEnd != std::string::npos) {
-            std::string holdSection = json.substr(holdStart, holdEnd - holdStart);
-            // Parse individual parameters (simplified)
-            size_t pos = 0;
-            while ((pos = holdSection.find("\"", pos)) != std::string::npos) {
-                pos++;
-                size_t nameEnd = holdSection.find("\"", pos);
-                if (nameEnd != std::string::npos) {
-                    std::string paramName = holdSection.substr(pos, nameEnd - pos);
-                    size_t valueStart = holdSection.find(": ", nameEnd) + 2;
-                    size_t valueEnd = holdSection.find_first_of(",\n}", valueStart);
-                    if (valueEnd != std::string::npos) {
-                        float value = std::stof(holdSection.substr(valueStart, valueEnd - valueStart));
-                        params[paramName] = value;
-                    }
-                    pos = nameEnd + 1;
-                } else {
-                    break;
-                }
+    std::string_view paramName;
+    float value = 0.0f;
+    if (!reader.beginObject()) return false;
+    while (reader.nextMember(paramName)) {
+        if (!reader.readFloat(value)) return false;
+        params[std::string(paramName)] = value;
+    }
+    
+    return !reader.hasError();
+}
+
+// Utility methods
+std::string EnginePresetLibrary::generatePresetId(const EnginePreset& preset) const {
+    return presetKey(preset.engineType, preset.name);
+}
+
+void EnginePresetLibrary::updatePresetCache() const {
+    presetCache_.clear();
+    
+    // Factory presets win over user presets with the same name, matching lookup order
+    for (const auto* storage : {&factoryPresets_, &userPresets_}) {
+        for (const auto& [engineType, presets] : *storage) {
+            for (const auto& preset : presets) {
+                presetCache_.emplace(generatePresetId(*preset), preset.get());
             }
         }
     }
     
-    return true;
-}
\ No newline at end of file
+    cacheValid_ = true;
+}
+
+void EnginePresetLibrary::rebuildPresetCache() {
+    updatePresetCache();
+}
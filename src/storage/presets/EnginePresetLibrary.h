@@ -41,6 +41,8 @@ class MacroFMEngine;
 class MacroHarmonicsEngine;
 class MacroWavetableEngine;
 class EngineVelocityMapping;
+class JsonReader;
+class JsonWriter;
 
 class EnginePresetLibrary {
 public:
@@ -288,7 +290,7 @@ private:
     EngineVelocityMapping* velocityMapping_;
     std::function<void(uint32_t, const std::string&, float)> engineParameterCallback_;
     
-    // Cache for performance
+    // Cache for performance: generatePresetId() -> preset, rebuilt lazily after edits
     mutable std::unordered_map<std::string, const EnginePreset*> presetCache_;
     mutable bool cacheValid_;
     
@@ -327,8 +329,10 @@ private:
     void initializePlaitsHiHatPresets();
     
     // JSON helpers
-    std::string serializeParameterMap(const std::unordered_map<std::string, float>& params) const;
-    bool deserializeParameterMap(const std::string& json, std::unordered_map<std::string, float>& params) const;
+    void writePreset(JsonWriter& json, const EnginePreset& preset) const;
+    bool readPreset(JsonReader& reader, EnginePreset& preset) const;
+    void serializeParameterMap(JsonWriter& json, const std::unordered_map<std::string, float>& params) const;
+    bool deserializeParameterMap(JsonReader& reader, std::unordered_map<std::string, float>& params) const;
     
     // Validation helpers
     bool validateParameterRanges(const EnginePreset& preset) const;
@@ -0,0 +1,454 @@
+#include "PresetContainer.h"
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PRESET_CONTAINER_MMAP 1
+#endif
+
+namespace {
+
+// On-disk layout (little-endian, all payload offsets ALIGNMENT-aligned)
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerBytes;
+    uint32_t sectionCount;
+    uint32_t reserved;
+    uint64_t fileBytes;
+    uint64_t tableOffset;
+};
+
+struct SectionEntry {
+    uint16_t type;
+    uint16_t encoding;
+    uint32_t index;
+    uint32_t count;
+    uint32_t checksum;
+    uint64_t offset;
+    uint64_t bytes;
+};
+
+static_assert(sizeof(FileHeader) == 32, "FileHeader layout");
+static_assert(sizeof(SectionEntry) == 32, "SectionEntry layout");
+static_assert(sizeof(PresetParam) == 8, "PresetParam layout");
+
+size_t alignUp(size_t value) {
+    return (value + PresetContainer::ALIGNMENT - 1) & ~(PresetContainer::ALIGNMENT - 1);
+}
+
+void appendEscaped(std::string& out, const char* text, size_t length) {
+    out += '"';
+    for (size_t i = 0; i < length; ++i) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            case '\r': out += "\\r"; break;
+            default:
+                if (c < 0x20) {
+                    char escape[8];
+                    std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    out += escape;
+                } else {
+                    out += static_cast<char>(c);
+                }
+        }
+    }
+    out += '"';
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// Storage: the mapping (or buffer) shared by a container and its nested views
+//-----------------------------------------------------------------------------
+
+struct PresetContainer::Storage {
+    void* mapping = nullptr;
+    size_t mappingBytes = 0;
+    std::vector<uint8_t> buffer;
+
+    ~Storage() {
+#if defined(PRESET_CONTAINER_MMAP)
+        if (mapping) ::munmap(mapping, mappingBytes);
+#endif
+    }
+};
+
+PresetContainer::PresetContainer() = default;
+PresetContainer::~PresetContainer() = default;
+
+bool PresetContainer::open(const std::string& path) {
+    close();
+    auto storage = std::make_shared<Storage>();
+#if defined(PRESET_CONTAINER_MMAP)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        return false;
+    }
+    size_t bytes = static_cast<size_t>(status.st_size);
+    void* mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) return false;
+    storage->mapping = mapping;
+    storage->mappingBytes = bytes;
+    const uint8_t* data = static_cast<const uint8_t*>(mapping);
+#else
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    bool ok = std::fseek(file, 0, SEEK_END) == 0;
+    long length = ok ? std::ftell(file) : -1;
+    ok = ok && length >= static_cast<long>(sizeof(FileHeader)) && std::fseek(file, 0, SEEK_SET) == 0;
+    if (ok) {
+        storage->buffer.resize(static_cast<size_t>(length));
+        ok = std::fread(storage->buffer.data(), 1, storage->buffer.size(), file) == storage->buffer.size();
+    }
+    std::fclose(file);
+    if (!ok) return false;
+    const uint8_t* data = storage->buffer.data();
+    size_t bytes = storage->buffer.size();
+#endif
+    return parse(std::move(storage), data, bytes);
+}
+
+bool PresetContainer::openBuffer(std::vector<uint8_t> data) {
+    close();
+    auto storage = std::make_shared<Storage>();
+    storage->buffer = std::move(data);
+    const uint8_t* begin = storage->buffer.data();
+    const size_t bytes = storage->buffer.size();
+    return parse(std::move(storage), begin, bytes);
+}
+
+void PresetContainer::close() {
+    storage_.reset();
+    data_ = nullptr;
+    bytes_ = 0;
+    version_ = 0;
+    sections_.clear();
+}
+
+// Validates the header and table only; payloads are checked on first read
+bool PresetContainer::parse(std::shared_ptr<const Storage> storage, const uint8_t* data, size_t bytes) {
+    if (bytes < sizeof(FileHeader)) return false;
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version == 0 ||
+        header.version > SCHEMA_VERSION || header.headerBytes != sizeof(FileHeader) ||
+        header.fileBytes > bytes || header.tableOffset < sizeof(FileHeader) ||
+        header.tableOffset > header.fileBytes ||
+        header.sectionCount > (header.fileBytes - header.tableOffset) / sizeof(SectionEntry)) {
+        return false;
+    }
+
+    std::vector<SectionRecord> sections;
+    sections.reserve(header.sectionCount);
+    for (uint32_t i = 0; i < header.sectionCount; ++i) {
+        SectionEntry entry;
+        std::memcpy(&entry, data + header.tableOffset + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % ALIGNMENT != 0 || entry.offset > header.fileBytes ||
+            entry.bytes > header.fileBytes - entry.offset) {
+            return false;
+        }
+        SectionRecord record;
+        record.info = {static_cast<SectionType>(entry.type), static_cast<Encoding>(entry.encoding),
+                       entry.index, entry.count};
+        record.offset = entry.offset;
+        record.bytes = entry.bytes;
+        record.checksum = entry.checksum;
+        record.state = 0;
+        sections.push_back(record);
+    }
+
+    storage_ = std::move(storage);
+    data_ = data;
+    bytes_ = static_cast<size_t>(header.fileBytes);
+    version_ = header.version;
+    sections_ = std::move(sections);
+    return true;
+}
+
+int PresetContainer::findSection(SectionType type, uint32_t index) const {
+    for (size_t i = 0; i < sections_.size(); ++i) {
+        if (sections_[i].info.type == type && sections_[i].info.index == index) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+const PresetContainer::SectionRecord* PresetContainer::checkedSection(int position, Encoding encoding) const {
+    if (position < 0 || position >= static_cast<int>(sections_.size())) return nullptr;
+    const SectionRecord& record = sections_[position];
+    if (record.info.encoding != encoding) return nullptr;
+
+    if (record.state == 0) {
+        const uint8_t* payload = data_ + record.offset;
+        bool ok = checksum(payload, record.bytes) == record.checksum;
+        if (ok && encoding == Encoding::PARAMS) {
+            ok = record.bytes == static_cast<uint64_t>(record.info.count) * sizeof(PresetParam);
+        } else if (ok && encoding == Encoding::TEXT) {
+            // count key/value pairs, each string NUL-terminated
+            size_t terminators = 0;
+            for (uint64_t i = 0; i < record.bytes; ++i) terminators += payload[i] == 0;
+            ok = terminators == static_cast<size_t>(record.info.count) * 2 &&
+                 (record.bytes == 0 || payload[record.bytes - 1] == 0);
+        }
+        record.state = ok ? 1 : 2;
+    }
+    return record.state == 1 ? &record : nullptr;
+}
+
+bool PresetContainer::readParams(int position, const PresetParam*& params, size_t& count) const {
+    const SectionRecord* record = checkedSection(position, Encoding::PARAMS);
+    if (!record) return false;
+    params = reinterpret_cast<const PresetParam*>(data_ + record->offset);
+    count = record->info.count;
+    return true;
+}
+
+bool PresetContainer::readText(int position, TextFields& fields) const {
+    const SectionRecord* record = checkedSection(position, Encoding::TEXT);
+    if (!record) return false;
+    fields.clear();
+    fields.reserve(record->info.count);
+    const char* text = reinterpret_cast<const char*>(data_ + record->offset);
+    for (uint32_t i = 0; i < record->info.count; ++i) {
+        const size_t keyLength = std::strlen(text);
+        const char* value = text + keyLength + 1;
+        const size_t valueLength = std::strlen(value);
+        fields.emplace_back(std::string(text, keyLength), std::string(value, valueLength));
+        text = value + valueLength + 1;
+    }
+    return true;
+}
+
+bool PresetContainer::readRaw(int position, const uint8_t*& data, size_t& bytes) const {
+    const SectionRecord* record = checkedSection(position, Encoding::RAW);
+    if (!record) return false;
+    data = data_ + record->offset;
+    bytes = static_cast<size_t>(record->bytes);
+    return true;
+}
+
+bool PresetContainer::openNested(int position, PresetContainer& child) const {
+    const SectionRecord* record = checkedSection(position, Encoding::CONTAINER);
+    if (!record) return false;
+    child.close();
+    return child.parse(storage_, data_ + record->offset, static_cast<size_t>(record->bytes));
+}
+
+uint32_t PresetContainer::checksum(const uint8_t* data, size_t bytes) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < bytes; ++i) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+const char* PresetContainer::getTypeName(SectionType type) {
+    switch (type) {
+        case SectionType::META: return "meta";
+        case SectionType::ENGINE_PARAMS: return "engine_params";
+        case SectionType::PATTERNS: return "patterns";
+        case SectionType::MOD_MATRIX: return "mod_matrix";
+        case SectionType::LFOS: return "lfos";
+        case SectionType::SAMPLE_REFS: return "sample_refs";
+        case SectionType::ENGINE_DATA: return "engine_data";
+        case SectionType::INSTRUMENT: return "instrument";
+        case SectionType::EFFECTS: return "effects";
+        case SectionType::PRESET: return "preset";
+    }
+    return "unknown";
+}
+
+//-----------------------------------------------------------------------------
+// JSON export: one section per block, stable ordering, for diffing
+//-----------------------------------------------------------------------------
+
+std::string PresetContainer::toJSON() const {
+    std::string out;
+    if (!isOpen()) return "null\n";
+    appendJSON(out, 0);
+    out += '\n';
+    return out;
+}
+
+void PresetContainer::appendJSON(std::string& out, int indent) const {
+    const std::string pad(indent, ' ');
+    char number[32];
+    out += "{\n" + pad + "  \"version\": " + std::to_string(version_) + ",\n";
+    out += pad + "  \"sections\": [";
+    for (size_t i = 0; i < sections_.size(); ++i) {
+        const Section& section = sections_[i].info;
+        const int position = static_cast<int>(i);
+        out += i == 0 ? "\n" : ",\n";
+        out += pad + "    {\"type\": \"";
+        out += getTypeName(section.type);
+        out += "\", \"index\": " + std::to_string(section.index) + ", ";
+
+        switch (section.encoding) {
+            case Encoding::PARAMS: {
+                const PresetParam* params = nullptr;
+                size_t count = 0;
+                if (!readParams(position, params, count)) { out += "\"error\": \"corrupt\"}"; break; }
+                out += "\"params\": {";
+                for (size_t p = 0; p < count; ++p) {
+                    std::snprintf(number, sizeof(number), "%.9g", static_cast<double>(params[p].value));
+                    out += (p == 0 ? "\"" : ", \"") + std::to_string(params[p].id) + "\": " + number;
+                }
+                out += "}}";
+                break;
+            }
+            case Encoding::TEXT: {
+                TextFields fields;
+                if (!readText(position, fields)) { out += "\"error\": \"corrupt\"}"; break; }
+                out += "\"text\": {";
+                for (size_t f = 0; f < fields.size(); ++f) {
+                    if (f > 0) out += ", ";
+                    appendEscaped(out, fields[f].first.data(), fields[f].first.size());
+                    out += ": ";
+                    appendEscaped(out, fields[f].second.data(), fields[f].second.size());
+                }
+                out += "}}";
+                break;
+            }
+            case Encoding::RAW: {
+                const uint8_t* data = nullptr;
+                size_t bytes = 0;
+                if (!readRaw(position, data, bytes)) { out += "\"error\": \"corrupt\"}"; break; }
+                out += "\"raw\": \"";
+                static const char hex[] = "0123456789abcdef";
+                for (size_t b = 0; b < bytes; ++b) {
+                    out += hex[data[b] >> 4];
+                    out += hex[data[b] & 0xF];
+                }
+                out += "\"}";
+                break;
+            }
+            case Encoding::CONTAINER: {
+                PresetContainer child;
+                if (!openNested(position, child)) { out += "\"error\": \"corrupt\"}"; break; }
+                out += "\"container\": ";
+                child.appendJSON(out, indent + 4);
+                out += "}";
+                break;
+            }
+            default:
+                out += "\"encoding\": " + std::to_string(static_cast<int>(section.encoding)) + "}";
+                break;
+        }
+    }
+    out += sections_.empty() ? "]\n" : "\n" + pad + "  ]\n";
+    out += pad + "}";
+}
+
+//-----------------------------------------------------------------------------
+// PresetContainerWriter
+//-----------------------------------------------------------------------------
+
+size_t PresetContainerWriter::beginPayload(size_t bytes) {
+    const size_t offset = alignUp(payload_.size());
+    payload_.resize(offset + bytes, 0);
+    return offset;
+}
+
+void PresetContainerWriter::addParams(SectionType type, uint32_t index, const PresetParam* params, size_t count) {
+    const size_t bytes = count * sizeof(PresetParam);
+    const size_t offset = beginPayload(bytes);
+    if (bytes > 0) std::memcpy(payload_.data() + offset, params, bytes);
+    sections_.push_back({{type, PresetContainer::Encoding::PARAMS, index, static_cast<uint32_t>(count)}, offset, bytes});
+}
+
+void PresetContainerWriter::addText(SectionType type, uint32_t index, const PresetContainer::TextFields& fields) {
+    size_t bytes = 0;
+    for (const auto& field : fields) bytes += field.first.size() + field.second.size() + 2;
+    const size_t offset = beginPayload(bytes);
+    uint8_t* out = payload_.data() + offset;
+    for (const auto& field : fields) {
+        // Embedded NULs would split a field; strings are cut there
+        const size_t keyLength = std::strlen(field.first.c_str());
+        const size_t valueLength = std::strlen(field.second.c_str());
+        std::memcpy(out, field.first.data(), keyLength);
+        out += keyLength;
+        *out++ = 0;
+        std::memcpy(out, field.second.data(), valueLength);
+        out += valueLength;
+        *out++ = 0;
+    }
+    bytes = static_cast<size_t>(out - (payload_.data() + offset));
+    payload_.resize(offset + bytes);
+    sections_.push_back({{type, PresetContainer::Encoding::TEXT, index, static_cast<uint32_t>(fields.size())}, offset, bytes});
+}
+
+void PresetContainerWriter::addRaw(SectionType type, uint32_t index, const void* data, size_t bytes) {
+    const size_t offset = beginPayload(bytes);
+    if (bytes > 0) std::memcpy(payload_.data() + offset, data, bytes);
+    sections_.push_back({{type, PresetContainer::Encoding::RAW, index, 0}, offset, bytes});
+}
+
+void PresetContainerWriter::addContainer(SectionType type, uint32_t index, const PresetContainerWriter& child) {
+    const std::vector<uint8_t> image = child.finish();
+    const size_t offset = beginPayload(image.size());
+    std::memcpy(payload_.data() + offset, image.data(), image.size());
+    sections_.push_back({{type, PresetContainer::Encoding::CONTAINER, index, 0}, offset, image.size()});
+}
+
+void PresetContainerWriter::clear() {
+    sections_.clear();
+    payload_.clear();
+}
+
+std::vector<uint8_t> PresetContainerWriter::finish() const {
+    const size_t tableOffset = sizeof(FileHeader);
+    const size_t payloadOffset = alignUp(tableOffset + sections_.size() * sizeof(SectionEntry));
+    std::vector<uint8_t> image(payloadOffset + alignUp(payload_.size()), 0);
+
+    FileHeader header{};
+    std::memcpy(header.magic, PresetContainer::MAGIC, sizeof(header.magic));
+    header.version = PresetContainer::SCHEMA_VERSION;
+    header.headerBytes = sizeof(FileHeader);
+    header.sectionCount = static_cast<uint32_t>(sections_.size());
+    header.fileBytes = image.size();
+    header.tableOffset = tableOffset;
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    for (size_t i = 0; i < sections_.size(); ++i) {
+        const Pending& pending = sections_[i];
+        SectionEntry entry{};
+        entry.type = static_cast<uint16_t>(pending.info.type);
+        entry.encoding = static_cast<uint16_t>(pending.info.encoding);
+        entry.index = pending.info.index;
+        entry.count = pending.info.count;
+        entry.checksum = PresetContainer::checksum(payload_.data() + pending.offset, pending.bytes);
+        entry.offset = payloadOffset + pending.offset;
+        entry.bytes = pending.bytes;
+        std::memcpy(image.data() + tableOffset + i * sizeof(SectionEntry), &entry, sizeof(entry));
+    }
+    if (!payload_.empty()) std::memcpy(image.data() + payloadOffset, payload_.data(), payload_.size());
+    return image;
+}
+
+bool PresetContainerWriter::writeFile(const std::string& path) const {
+    const std::vector<uint8_t> image = finish();
+    const std::string temporary = path + ".tmp";
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) return false;
+    bool ok = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (ok) ok = std::rename(temporary.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(temporary.c_str());
+    return ok;
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * PresetContainer - Versioned binary container for presets, banks and projects
+ *
+ * A file is a fixed header, a section table and 8-byte aligned payloads, all
+ * little-endian. Opening a file maps it and checks only the header and the
+ * table. Each section's bounds and checksum are checked the first time it is
+ * read, so a thousand-preset bank opens in constant time and a load pays only
+ * for the sections it touches. A section can hold a whole nested container:
+ * a bank holds presets, and a preset holds per-slot instruments.
+ *
+ * Features:
+ * - Sections keyed by (type, index): engine params, patterns, mod matrix,
+ *   LFOs, sample references, engine data, instruments, presets
+ * - Payload encodings: PARAMS (packed id/value pairs read in place), TEXT
+ *   (key/value strings), RAW bytes, nested CONTAINER
+ * - Schema version in the header; unknown section types are skipped
+ * - toJSON() export for diffing and inspection
+ * - Read-into-memory fallback where mmap is unavailable
+ */
+
+struct PresetParam {
+    uint32_t id;
+    float value;
+};
+
+class PresetContainerWriter;
+
+class PresetContainer {
+public:
+    static constexpr char MAGIC[4] = {'E', 'T', 'P', 'C'};
+    static constexpr uint16_t SCHEMA_VERSION = 1;
+    static constexpr size_t ALIGNMENT = 8;
+
+    enum class SectionType : uint16_t {
+        META = 1,           // TEXT: names, authoring, scalar settings
+        ENGINE_PARAMS,      // PARAMS: ParameterID -> value
+        PATTERNS,
+        MOD_MATRIX,
+        LFOS,
+        SAMPLE_REFS,
+        ENGINE_DATA,        // RAW: engine-specific preset blob
+        INSTRUMENT,         // CONTAINER: one slot, index = slot
+        EFFECTS,
+        PRESET              // CONTAINER: one preset in a bank
+    };
+
+    enum class Encoding : uint16_t { RAW = 0, PARAMS, TEXT, CONTAINER };
+
+    struct Section {
+        SectionType type;
+        Encoding encoding;
+        uint32_t index;
+        uint32_t count;         // Params or text fields; 0 for RAW/CONTAINER
+    };
+
+    using TextFields = std::vector<std::pair<std::string, std::string>>;
+
+    PresetContainer();
+    ~PresetContainer();
+
+    bool open(const std::string& path);                 // Maps the file
+    bool openBuffer(std::vector<uint8_t> data);         // Takes ownership
+    void close();
+    bool isOpen() const { return data_ != nullptr; }
+
+    uint16_t getVersion() const { return version_; }
+    size_t getSectionCount() const { return sections_.size(); }
+    const Section& getSection(size_t position) const { return sections_[position].info; }
+    int findSection(SectionType type, uint32_t index = 0) const;   // -1 if absent
+
+    // Section readers: check the section on first use, false if it is corrupt
+    // or has another encoding. Params point into the file.
+    bool readParams(int position, const PresetParam*& params, size_t& count) const;
+    bool readText(int position, TextFields& fields) const;
+    bool readRaw(int position, const uint8_t*& data, size_t& bytes) const;
+    bool openNested(int position, PresetContainer& child) const;   // Shares this file
+
+    std::string toJSON() const;
+
+    static const char* getTypeName(SectionType type);
+
+private:
+    friend class PresetContainerWriter;
+
+    struct Storage;
+    struct SectionRecord {
+        Section info;
+        uint64_t offset;
+        uint64_t bytes;
+        uint32_t checksum;
+        mutable uint8_t state;      // 0 unchecked, 1 good, 2 corrupt
+    };
+
+    std::shared_ptr<const Storage> storage_;
+    const uint8_t* data_ = nullptr;
+    size_t bytes_ = 0;
+    uint16_t version_ = 0;
+    std::vector<SectionRecord> sections_;
+
+    bool parse(std::shared_ptr<const Storage> storage, const uint8_t* data, size_t bytes);
+    const SectionRecord* checkedSection(int position, Encoding encoding) const;
+    void appendJSON(std::string& out, int indent) const;
+
+    static uint32_t checksum(const uint8_t* data, size_t bytes);
+};
+
+/**
+ * PresetContainerWriter - Builds a PresetContainer image
+ *
+ * Sections are written in the order they are added. writeFile() writes a
+ * temporary file and renames it over the target, so an interrupted save
+ * leaves the previous file intact.
+ */
+class PresetContainerWriter {
+public:
+    using SectionType = PresetContainer::SectionType;
+
+    void addParams(SectionType type, uint32_t index, const PresetParam* params, size_t count);
+    void addParams(SectionType type, uint32_t index, const std::vector<PresetParam>& params) {
+        addParams(type, index, params.data(), params.size());
+    }
+    void addText(SectionType type, uint32_t index, const PresetContainer::TextFields& fields);
+    void addRaw(SectionType type, uint32_t index, const void* data, size_t bytes);
+    void addContainer(SectionType type, uint32_t index, const PresetContainerWriter& child);
+    void clear();
+
+    size_t getSectionCount() const { return sections_.size(); }
+    std::vector<uint8_t> finish() const;
+    bool writeFile(const std::string& path) const;
+
+private:
+    struct Pending {
+        PresetContainer::Section info;
+        size_t offset;              // Into payload_
+        size_t bytes;
+    };
+
+    std::vector<Pending> sections_;
+    std::vector<uint8_t> payload_;  // Aligned payloads, back to back
+
+    size_t beginPayload(size_t bytes);
+};
@@ -4,7 +4,7 @@
 
 // ChannelStrip Implementation
 ChannelStrip::ChannelStrip() 
-    : mode_(Clean), enabled_(true), sampleRate_(48000.0f),
+    : mode_(Clean), enabled_(true), sampleRate_(48000.0f), controlCounter_(0),
       compAmount_(0.0f), compAttack_(0.01f), compRelease_(0.12f),
       compEnvelope_(0.0f), compGainReduction_(1.0f),
       punch_(0.0f), transientState_(0.0f) {
@@ -14,6 +14,8 @@ ChannelStrip::ChannelStrip()
     lpf_.setMode(DSP::SVF::LP);
     bodyShelf_.setMode(DSP::SVF::LP); // Low shelf approximation
     airShelf_.setMode(DSP::SVF::HP);  // High shelf approximation
+    bodyShelf_.setCutoff(120.0f);
+    airShelf_.setCutoff(7000.0f);
     
     // Default settings for pitched instruments
     setHPFCutoff(0.1f);      // ~30 Hz
@@ -44,6 +46,7 @@ void ChannelStrip::setSampleRate(float sampleRate) {
     driveTone_.setSampleRate(sampleRate);
     bodyGain_.setSampleRate(sampleRate);
     airGain_.setSampleRate(sampleRate);
+    controlCounter_ = 0;
 }
 
 void ChannelStrip::setHPFCutoff(float cutoff01) {
@@ -159,16 +162,14 @@ float ChannelStrip::processTiltEQ(float input) {
     float body = bodyGain_.process();
     float air = airGain_.process();
     
-    // Simplified tilt EQ using shelving filters
+    // Simplified tilt EQ using shelving filters (cutoffs fixed in the constructor)
     float output = input;
     
     if (std::abs(body - 1.0f) > 0.001f) {
-        bodyShelf_.setCutoff(120.0f);
         output = DSP::Interp::linear(output, bodyShelf_.process(output), body - 1.0f);
     }
     
     if (std::abs(air - 1.0f) > 0.001f) {
-        airShelf_.setCutoff(7000.0f);
         output = DSP::Interp::linear(output, airShelf_.process(output), air - 1.0f);
     }
     
@@ -194,8 +195,12 @@ float ChannelStrip::process(float input, float keytrackNote) {
     float envModulation = envValue * envAmt * cutoff * 0.5f; // Up to 50% modulation
     cutoff = std::clamp(cutoff + envModulation, 200.0f, 18000.0f);
     
-    lpf_.setCutoff(cutoff);
-    lpf_.setResonance(res);
+    // Coefficients (a tan per update) at control rate
+    if (controlCounter_ <= 0) {
+        lpf_.setCutoffAndResonance(cutoff, res);
+        controlCounter_ = CONTROL_INTERVAL;
+    }
+    --controlCounter_;
     
     // Processing order depends on mode
     if (mode_ == Clean) {
@@ -234,6 +239,7 @@ void ChannelStrip::reset() {
     compEnvelope_ = 0.0f;
     compGainReduction_ = 1.0f;
     transientState_ = 0.0f;
+    controlCounter_ = 0;
 }
 
 // BaseEngine Implementation
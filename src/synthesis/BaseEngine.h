@@ -11,6 +11,10 @@
 /**
  * Channel Strip implementation for per-voice processing
  * HPF -> LPF(SVF) -> Comp -> Drive -> TiltEQ
+ *
+ * The LPF cutoff (smoothed base + keytrack + filter envelope) is followed
+ * every sample, but its coefficients are recomputed once per
+ * CONTROL_INTERVAL samples; the tilt-EQ shelves are fixed and set up once.
  */
 class ChannelStrip {
 public:
@@ -47,10 +51,13 @@ public:
     
     void reset();
     
+    static constexpr int CONTROL_INTERVAL = 16;    // Samples between LPF coefficient updates
+    
 private:
     Mode mode_;
     bool enabled_;
     float sampleRate_;
+    int controlCounter_;
     
     // Filters
     DSP::SVF hpf_, lpf_;
@@ -45,6 +45,11 @@ public:
     void setSampleRate(float sr) { sampleRate_ = sr; updateCoeffs(); }
     void setCutoff(float freq) { cutoff_ = freq; updateCoeffs(); }
     void setResonance(float res) { resonance_ = std::clamp(res, 0.0f, 0.95f); updateCoeffs(); }
+    void setCutoffAndResonance(float freq, float res) {
+        cutoff_ = freq;
+        resonance_ = std::clamp(res, 0.0f, 0.95f);
+        updateCoeffs();
+    }
     void setMode(Mode mode) { mode_ = mode; }
     
     float process(float input);
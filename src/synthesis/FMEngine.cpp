@@ -1,4 +1,5 @@
 #include "FMEngine.h"
+#include "../audio/SIMDOptimizations.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -208,7 +209,7 @@ float FMEngine::FMOperator::process(float modulation) {
     float modulatedPhase = phase + modulation + (feedback * lastOutput);
     
     // Generate sine wave
-    float output = std::sin(modulatedPhase * 2.0f * M_PI) * level * envValue;
+    float output = EtherSynthSIMD::SIMD::sinCycles(modulatedPhase) * level * envValue;
     
     // Update phase
     phase += frequency / SAMPLE_RATE;
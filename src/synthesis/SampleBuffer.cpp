@@ -1,4 +1,6 @@
 #include "SampleBuffer.h"
+#include "SampleStore.h"
+#include "SampleStreamer.h"
 #include <algorithm>
 #include <cstring>
 #include <cstdio>
@@ -7,8 +9,9 @@
 
 namespace Sample {
 
-// Static cache instance
+// Static cache and streamer instances
 std::shared_ptr<SampleCache> SampleBuffer::globalCache_ = nullptr;
+std::shared_ptr<SampleStreamer> SampleBuffer::globalStreamer_ = nullptr;
 
 //-----------------------------------------------------------------------------
 // RingBuffer Implementation
@@ -273,6 +276,76 @@ bool WavLoader::loadToRAM(const std::string& filePath, std::vector<int16_t>& buf
     return true;
 }
 
+namespace {
+// Open stream: file positioned inside the data chunk
+struct StreamHandle {
+    FILE* file = nullptr;
+    long dataOffset = 0;
+    int channels = 1;
+    int bytesPerSample = 2;
+    size_t totalFrames = 0;
+    size_t position = 0;                // Next frame
+    std::vector<uint8_t> raw;           // 24-bit conversion buffer
+};
+}
+
+bool WavLoader::openForStreaming(const std::string& filePath, SampleInfo& info, void*& fileHandle) {
+    fileHandle = nullptr;
+    FILE* file = fopen(filePath.c_str(), "rb");
+    if (!file) return false;
+    
+    WavHeader header;
+    if (!parseHeader(file, header, info)) {
+        fclose(file);
+        return false;
+    }
+    info.filePath = filePath;
+    
+    auto* handle = new StreamHandle();
+    handle->file = file;
+    handle->dataOffset = ftell(file);
+    handle->channels = info.channels;
+    handle->bytesPerSample = info.bitDepth / 8;
+    handle->totalFrames = info.totalFrames;
+    fileHandle = handle;
+    return true;
+}
+
+size_t WavLoader::readFrames(void* fileHandle, int16_t* buffer, size_t frames) {
+    auto* handle = static_cast<StreamHandle*>(fileHandle);
+    if (!handle) return 0;
+    
+    frames = std::min(frames, handle->totalFrames - std::min(handle->position, handle->totalFrames));
+    const size_t samples = frames * handle->channels;
+    size_t framesRead = 0;
+    if (handle->bytesPerSample == 2) {
+        framesRead = fread(buffer, sizeof(int16_t), samples, handle->file) / handle->channels;
+    } else {
+        handle->raw.resize(samples * handle->bytesPerSample);
+        framesRead = fread(handle->raw.data(), handle->bytesPerSample * handle->channels, frames, handle->file);
+        convertTo16Bit(handle->raw.data(), buffer, framesRead, handle->channels, handle->bytesPerSample * 8);
+    }
+    handle->position += framesRead;
+    return framesRead;
+}
+
+bool WavLoader::seekFrame(void* fileHandle, size_t frame) {
+    auto* handle = static_cast<StreamHandle*>(fileHandle);
+    if (!handle || frame > handle->totalFrames) return false;
+    if (frame == handle->position) return true;
+    long offset = handle->dataOffset + static_cast<long>(frame * handle->channels * handle->bytesPerSample);
+    if (fseek(handle->file, offset, SEEK_SET) != 0) return false;
+    handle->position = frame;
+    return true;
+}
+
+void WavLoader::closeFile(void* fileHandle) {
+    auto* handle = static_cast<StreamHandle*>(fileHandle);
+    if (!handle) return;
+    if (handle->file) fclose(handle->file);
+    delete handle;
+}
+
 void WavLoader::convertTo16Bit(const uint8_t* input, int16_t* output, size_t frames, 
                               int channels, int bitDepth) {
     if (bitDepth == 24) {
@@ -301,24 +374,27 @@ SampleCache::SampleCache(size_t maxSizeBytes) : maxSize_(maxSizeBytes), currentS
 
 SampleCache::~SampleCache() = default;
 
-bool SampleCache::get(const std::string& key, std::vector<int16_t>& buffer, SampleInfo& info) {
+SampleHandle SampleCache::get(const std::string& key) {
     std::lock_guard<std::mutex> lock(cacheMutex_);
     
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-        buffer = it->second.buffer;
-        info = it->second.info;
         it->second.lastAccess = std::chrono::steady_clock::now();
-        return true;
+        return it->second.sample;
     }
     
-    return false;
+    return nullptr;
 }
 
-void SampleCache::put(const std::string& key, const std::vector<int16_t>& buffer, const SampleInfo& info) {
+void SampleCache::put(const std::string& key, SampleHandle sample) {
     std::lock_guard<std::mutex> lock(cacheMutex_);
     
-    size_t entrySize = calculateSize(buffer);
+    size_t entrySize = calculateSize(sample);
+    auto existing = cache_.find(key);
+    if (existing != cache_.end()) {
+        currentSize_ -= existing->second.size;
+        cache_.erase(existing);
+    }
     
     // Evict if necessary
     while (currentSize_ + entrySize > maxSize_ && !cache_.empty()) {
@@ -327,7 +403,7 @@ void SampleCache::put(const std::string& key, const std::vector<int16_t>& buffer
     
     // Add new entry
     if (currentSize_ + entrySize <= maxSize_) {
-        cache_[key] = {buffer, info, std::chrono::steady_clock::now(), entrySize};
+        cache_[key] = {std::move(sample), std::chrono::steady_clock::now(), entrySize};
         currentSize_ += entrySize;
     }
 }
@@ -347,8 +423,8 @@ void SampleCache::evictLRU() {
     cache_.erase(oldestIt);
 }
 
-size_t SampleCache::calculateSize(const std::vector<int16_t>& buffer) const {
-    return buffer.size() * sizeof(int16_t);
+size_t SampleCache::calculateSize(const SampleHandle& sample) const {
+    return sample ? sample->getDataBytes() : 0;
 }
 
 void SampleCache::clear() {
@@ -363,7 +439,7 @@ void SampleCache::clear() {
 
 SampleBuffer::SampleBuffer() 
     : mode_(Mode::RAM), loaded_(false), playing_(false), loop_(false),
-      playPosition_(0), fileHandle_(nullptr), stopStreaming_(false),
+      playPosition_(0), streamSource_(-1), streamVoice_(-1),
       pitchRatio_(1.0f), hasStub_(false), hasPreview_(false) {
     
     resampler_ = std::make_unique<LagrangeResampler>();
@@ -376,104 +452,88 @@ SampleBuffer::~SampleBuffer() {
 bool SampleBuffer::load(const std::string& filePath, float thresholdMB) {
     unload();
     
-    // Load sample info first
-    if (!WavLoader::loadSampleInfo(filePath, info_)) {
-        return false;
+    // Check cache first
+    SampleHandle sample = globalCache_ ? globalCache_->get(filePath) : nullptr;
+    bool cached = sample != nullptr;
+    if (!sample) {
+        sample = SampleStore::shared().open(filePath);
+        if (!sample) {
+            return false;
+        }
     }
+    info_ = sample->getInfo();
     
-    // Estimate file size
+    // Estimate decoded size
     size_t estimatedSize = info_.totalFrames * info_.channels * sizeof(int16_t);
     float sizeMB = static_cast<float>(estimatedSize) / (1024.0f * 1024.0f);
     
-    // Check cache first
-    if (globalCache_) {
-        std::vector<int16_t> cachedBuffer;
-        SampleInfo cachedInfo;
-        if (globalCache_->get(filePath, cachedBuffer, cachedInfo)) {
-            ramBuffer_ = std::move(cachedBuffer);
-            info_ = cachedInfo;
-            mode_ = Mode::RAM;
-            loaded_ = true;
-            return true;
-        }
-    }
-    
-    if (sizeMB <= thresholdMB) {
-        // Load to RAM
-        if (WavLoader::loadToRAM(filePath, ramBuffer_, info_)) {
-            mode_ = Mode::RAM;
-            loaded_ = true;
-            
-            // Add to cache
-            if (globalCache_) {
-                globalCache_->put(filePath, ramBuffer_, info_);
-            }
-            
-            return true;
+    if (cached || sizeMB <= thresholdMB) {
+        // Play straight from the mapping; start paging it in now
+        mapped_ = std::move(sample);
+        mapped_->prefetchAll();
+        mode_ = Mode::RAM;
+        loaded_ = true;
+        
+        // Add to cache
+        if (globalCache_ && !cached) {
+            globalCache_->put(filePath, mapped_);
         }
+        
+        return true;
     } else {
-        // Set up streaming
-        if (WavLoader::openForStreaming(filePath, info_, fileHandle_)) {
+        // Stream through the shared service: head in RAM, tail read ahead from disk
+        if (!globalStreamer_) {
+            globalStreamer_ = std::make_shared<SampleStreamer>();
+        }
+        streamer_ = globalStreamer_;
+        streamSource_ = streamer_->registerSample(filePath);
+        if (streamSource_ >= 0) {
+            info_ = *streamer_->getInfo(streamSource_);
             mode_ = Mode::STREAMING;
-            ringBuffer_ = std::make_unique<RingBuffer>(48000 * 4);  // 4 seconds buffer
             loaded_ = true;
             return true;
         }
+        streamer_.reset();
     }
     
     return false;
 }
 
+void SampleBuffer::unload() {
+    stopPlayback();
+    if (streamer_ && streamSource_ >= 0) {
+        streamer_->unregisterSample(streamSource_);
+    }
+    streamer_.reset();
+    streamSource_ = -1;
+    mapped_.reset();
+    playPosition_.store(0);
+    loaded_ = false;
+}
+
 void SampleBuffer::startPlayback(float startPosition, bool loop) {
     if (!loaded_) return;
     
     loop_.store(loop);
     playing_.store(true);
     
+    size_t startFrame = static_cast<size_t>(startPosition * info_.totalFrames);
     if (mode_ == Mode::RAM) {
-        size_t startFrame = static_cast<size_t>(startPosition * info_.totalFrames);
+        mapped_->prefetch(startFrame, NOTE_PREFETCH_FRAMES);   // Non-blocking hint
         playPosition_.store(startFrame * info_.channels);
     } else {
-        // Start streaming thread
-        stopStreaming_.store(false);
-        if (streamThread_.joinable()) streamThread_.join();
-        streamThread_ = std::thread(&SampleBuffer::streamingThread, this);
+        if (streamVoice_ >= 0) streamer_->stopVoice(streamVoice_);
+        streamVoice_ = streamer_->startVoice(streamSource_, startFrame, pitchRatio_, loop);
+        if (streamVoice_ < 0) playing_.store(false);   // Voice pool exhausted
     }
 }
 
 void SampleBuffer::stopPlayback() {
     playing_.store(false);
     
-    if (mode_ == Mode::STREAMING) {
-        stopStreaming_.store(true);
-        if (streamThread_.joinable()) {
-            streamThread_.join();
-        }
-    }
-}
-
-void SampleBuffer::streamingThread() {
-    constexpr size_t CHUNK_SIZE = 1024;
-    int16_t chunk[CHUNK_SIZE];
-    
-    while (!stopStreaming_.load() && fileHandle_) {
-        if (ringBuffer_->space() >= CHUNK_SIZE) {
-            size_t framesRead = WavLoader::readFrames(fileHandle_, chunk, CHUNK_SIZE / info_.channels);
-            if (framesRead > 0) {
-                ringBuffer_->write(chunk, framesRead * info_.channels);
-            } else {
-                // End of file
-                if (loop_.load()) {
-                    // Restart file
-                    // TODO: Implement file seeking for loop
-                } else {
-                    break;
-                }
-            }
-        } else {
-            // Buffer full, wait a bit
-            std::this_thread::sleep_for(std::chrono::microseconds(100));
-        }
+    if (mode_ == Mode::STREAMING && streamer_ && streamVoice_ >= 0) {
+        streamer_->stopVoice(streamVoice_);
+        streamVoice_ = -1;
     }
 }
 
@@ -510,7 +570,7 @@ void SampleBuffer::renderSamples(int16_t* output, size_t frames, float gain) {
 
 size_t SampleBuffer::renderRAM(int16_t* output, size_t frames, float gain) {
     size_t pos = playPosition_.load();
-    size_t totalSamples = ramBuffer_.size();
+    size_t totalSamples = info_.totalFrames * info_.channels;
     
     if (pos >= totalSamples) {
         playing_.store(false);
@@ -519,10 +579,18 @@ size_t SampleBuffer::renderRAM(int16_t* output, size_t frames, float gain) {
     
     size_t samplesToRender = std::min(frames, totalSamples - pos);
     
-    // Copy with gain
+    // Copy with gain: straight from the mapping when it is native 16-bit,
+    // otherwise converted into the output first
     int32_t gainFixed = static_cast<int32_t>(gain * 32768.0f);
+    const int16_t* source = mapped_->pcm16();
+    if (source) {
+        source += pos;
+    } else {
+        mapped_->readSamples(pos, output, samplesToRender);
+        source = output;
+    }
     for (size_t i = 0; i < samplesToRender; ++i) {
-        int32_t sample = (ramBuffer_[pos + i] * gainFixed) >> 15;
+        int32_t sample = (source[i] * gainFixed) >> 15;
         output[i] = static_cast<int16_t>(std::clamp(sample, -32768, 32767));
     }
     
@@ -541,9 +609,14 @@ size_t SampleBuffer::renderRAM(int16_t* output, size_t frames, float gain) {
 }
 
 size_t SampleBuffer::renderStreaming(int16_t* output, size_t frames, float gain) {
-    if (!ringBuffer_) return 0;
+    if (!streamer_ || streamVoice_ < 0) return 0;
     
-    size_t rendered = ringBuffer_->read(output, frames);
+    // frames counts interleaved samples here, as in renderRAM()
+    const size_t channels = static_cast<size_t>(info_.channels);
+    size_t rendered = streamer_->readVoice(streamVoice_, output, frames / channels) * channels;
+    if (streamer_->isVoiceFinished(streamVoice_)) {
+        playing_.store(false);
+    }
     
     // Apply gain
     int32_t gainFixed = static_cast<int32_t>(gain * 32768.0f);
@@ -563,4 +636,12 @@ std::shared_ptr<SampleCache> SampleBuffer::getCacheInstance() {
     return globalCache_;
 }
 
+void SampleBuffer::setStreamerInstance(std::shared_ptr<SampleStreamer> streamer) {
+    globalStreamer_ = streamer;
+}
+
+std::shared_ptr<SampleStreamer> SampleBuffer::getStreamerInstance() {
+    return globalStreamer_;
+}
+
 } // namespace Sample
\ No newline at end of file
@@ -3,13 +3,17 @@
 #include <memory>
 #include <string>
 #include <atomic>
-#include <thread>
+#include <chrono>
 #include <vector>
 #include <unordered_map>
 #include <mutex>
 
 namespace Sample {
 
+class SampleStreamer;
+class MappedSample;
+using SampleHandle = std::shared_ptr<const MappedSample>;
+
 /**
  * Sample metadata and format information
  */
@@ -88,7 +92,8 @@ public:
     static bool loadSampleInfo(const std::string& filePath, SampleInfo& info);
     static bool loadToRAM(const std::string& filePath, std::vector<int16_t>& buffer, SampleInfo& info);
     static bool openForStreaming(const std::string& filePath, SampleInfo& info, void*& fileHandle);
-    static size_t readFrames(void* fileHandle, int16_t* buffer, size_t frames);
+    static size_t readFrames(void* fileHandle, int16_t* buffer, size_t frames);   // Interleaved 16-bit
+    static bool seekFrame(void* fileHandle, size_t frame);
     static void closeFile(void* fileHandle);
     
 private:
@@ -115,22 +120,22 @@ private:
 
 /**
  * LRU cache for frequently accessed samples
+ * Keeps mapped samples alive between loads; entries are shared handles, not copies
  */
 class SampleCache {
 public:
     SampleCache(size_t maxSizeBytes = 64 * 1024 * 1024);  // 64MB default
     ~SampleCache();
     
-    bool get(const std::string& key, std::vector<int16_t>& buffer, SampleInfo& info);
-    void put(const std::string& key, const std::vector<int16_t>& buffer, const SampleInfo& info);
+    SampleHandle get(const std::string& key);
+    void put(const std::string& key, SampleHandle sample);
     void clear();
     size_t getCurrentSize() const { return currentSize_; }
     size_t getMaxSize() const { return maxSize_; }
     
 private:
     struct CacheEntry {
-        std::vector<int16_t> buffer;
-        SampleInfo info;
+        SampleHandle sample;
         std::chrono::steady_clock::time_point lastAccess;
         size_t size;
     };
@@ -141,7 +146,7 @@ private:
     size_t currentSize_;
     
     void evictLRU();
-    size_t calculateSize(const std::vector<int16_t>& buffer) const;
+    size_t calculateSize(const SampleHandle& sample) const;
 };
 
 /**
@@ -150,7 +155,7 @@ private:
 class SampleBuffer {
 public:
     enum class Mode {
-        RAM,        // Entire sample loaded in RAM
+        RAM,        // Entire sample mapped and prefetched
         STREAMING   // Sample streamed from disk with ring buffer
     };
     
@@ -185,6 +190,10 @@ public:
     static void setCacheInstance(std::shared_ptr<SampleCache> cache);
     static std::shared_ptr<SampleCache> getCacheInstance();
     
+    // Shared streaming service (created on the first streaming load if unset)
+    static void setStreamerInstance(std::shared_ptr<SampleStreamer> streamer);
+    static std::shared_ptr<SampleStreamer> getStreamerInstance();
+    
 private:
     SampleInfo info_;
     Mode mode_;
@@ -192,15 +201,14 @@ private:
     std::atomic<bool> playing_;
     std::atomic<bool> loop_;
     
-    // RAM mode
-    std::vector<int16_t> ramBuffer_;
+    // RAM mode: read-only view of the mapped file
+    SampleHandle mapped_;
     std::atomic<size_t> playPosition_;
     
-    // Streaming mode
-    std::unique_ptr<RingBuffer> ringBuffer_;
-    void* fileHandle_;
-    std::thread streamThread_;
-    std::atomic<bool> stopStreaming_;
+    // Streaming mode: a source and voice in the shared streamer
+    std::shared_ptr<SampleStreamer> streamer_;
+    int streamSource_;
+    int streamVoice_;
     
     // Resampling
     std::unique_ptr<LagrangeResampler> resampler_;
@@ -212,11 +220,13 @@ private:
     bool hasStub_;
     bool hasPreview_;
     
-    // Static cache
+    // Static cache and streamer
     static std::shared_ptr<SampleCache> globalCache_;
+    static std::shared_ptr<SampleStreamer> globalStreamer_;
+    
+    static constexpr size_t NOTE_PREFETCH_FRAMES = 16384;   // Paged in ahead of each note
     
     // Private methods
-    void streamingThread();
     void updatePitchRatio(float semitones);
     size_t renderRAM(int16_t* output, size_t frames, float gain);
     size_t renderStreaming(int16_t* output, size_t frames, float gain);
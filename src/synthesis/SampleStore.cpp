@@ -0,0 +1,340 @@
+#include "SampleStore.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SAMPLE_STORE_MMAP 1
+#endif
+
+namespace Sample {
+
+namespace {
+
+constexpr uint16_t WAVE_FORMAT_PCM = 1;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+constexpr int MAX_CHANNELS = 8;
+
+bool isLittleEndianHost() {
+    const uint16_t probe = 1;
+    uint8_t first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+uint16_t le16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+uint32_t le32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+uint16_t be16(const uint8_t* p) { return static_cast<uint16_t>((p[0] << 8) | p[1]); }
+uint32_t be32(const uint8_t* p) { return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+// IEEE 754 80-bit extended, as used for the AIFF sample rate
+double extended80(const uint8_t* p) {
+    const int exponent = ((p[0] & 0x7F) << 8) | p[1];
+    uint64_t mantissa = 0;
+    for (int i = 2; i < 10; ++i) mantissa = (mantissa << 8) | p[i];
+    if (exponent == 0 && mantissa == 0) return 0.0;
+    const double value = std::ldexp(static_cast<double>(mantissa), exponent - 16383 - 63);
+    return (p[0] & 0x80) ? -value : value;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+// MappedSample
+//-----------------------------------------------------------------------------
+
+MappedSample::~MappedSample() {
+#if defined(SAMPLE_STORE_MMAP)
+    if (mapping_) {
+        ::munmap(mapping_, mappingBytes_);
+    }
+#endif
+}
+
+bool MappedSample::open(const std::string& path) {
+    const uint8_t* file = nullptr;
+    size_t bytes = 0;
+#if defined(SAMPLE_STORE_MMAP)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || status.st_size < 12) {
+        ::close(fd);
+        return false;
+    }
+    bytes = static_cast<size_t>(status.st_size);
+    void* mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) return false;
+    mapping_ = mapping;
+    mappingBytes_ = bytes;
+    file = static_cast<const uint8_t*>(mapping);
+#else
+    FILE* handle = std::fopen(path.c_str(), "rb");
+    if (!handle) return false;
+    bool ok = std::fseek(handle, 0, SEEK_END) == 0;
+    long length = ok ? std::ftell(handle) : -1;
+    ok = ok && length >= 12 && std::fseek(handle, 0, SEEK_SET) == 0;
+    if (ok) {
+        storage_.resize(static_cast<size_t>(length));
+        ok = std::fread(storage_.data(), 1, storage_.size(), handle) == storage_.size();
+    }
+    std::fclose(handle);
+    if (!ok) return false;
+    file = storage_.data();
+    bytes = storage_.size();
+#endif
+
+    bool parsed = false;
+    if (std::memcmp(file, "RIFF", 4) == 0 && std::memcmp(file + 8, "WAVE", 4) == 0) {
+        parsed = parseWav(file, bytes);
+    } else if (std::memcmp(file, "FORM", 4) == 0 &&
+               (std::memcmp(file + 8, "AIFF", 4) == 0 || std::memcmp(file + 8, "AIFC", 4) == 0)) {
+        parsed = parseAiff(file, bytes);
+    }
+    if (!parsed) return false;     // The destructor unmaps
+
+    info_.filePath = path;
+    info_.durationSeconds = static_cast<float>(info_.totalFrames) / static_cast<float>(info_.sampleRate);
+    info_.isValid = true;
+    return true;
+}
+
+bool MappedSample::parseWav(const uint8_t* file, size_t bytes) {
+    bool haveFormat = false;
+    size_t frameBytes = 0;
+    for (size_t pos = 12; pos + 8 <= bytes;) {
+        const uint8_t* id = file + pos;
+        const size_t size = le32(file + pos + 4);
+        const uint8_t* body = file + pos + 8;
+        const size_t available = std::min(size, bytes - pos - 8);
+
+        if (std::memcmp(id, "fmt ", 4) == 0 && available >= 16) {
+            uint16_t format = le16(body);
+            if (format == WAVE_FORMAT_EXTENSIBLE && available >= 26) {
+                format = le16(body + 24);   // Sub-format GUID starts with the format tag
+            }
+            info_.channels = le16(body + 2);
+            info_.sampleRate = static_cast<int>(le32(body + 4));
+            info_.bitDepth = le16(body + 14);
+            if (format != WAVE_FORMAT_PCM || info_.channels < 1 || info_.channels > MAX_CHANNELS ||
+                info_.sampleRate <= 0 || (info_.bitDepth != 16 && info_.bitDepth != 24)) {
+                return false;
+            }
+            encoding_ = info_.bitDepth == 16 ? Encoding::PCM16_LE : Encoding::PCM24_LE;
+            frameBytes = static_cast<size_t>(info_.channels) * (info_.bitDepth / 8);
+            haveFormat = true;
+        } else if (std::memcmp(id, "data", 4) == 0) {
+            data_ = body;
+            dataBytes_ = available;     // Tolerates truncated files
+        } else if (std::memcmp(id, "smpl", 4) == 0 && available >= 36) {
+            info_.rootNote = static_cast<float>(le32(body + 12));
+            if (le32(body + 28) > 0 && available >= 60) {
+                info_.loopStart = le32(body + 44);
+                info_.loopEnd = static_cast<size_t>(le32(body + 48)) + 1;   // smpl end is inclusive
+                info_.hasLoopPoints = true;
+            }
+        }
+        pos += 8 + size + (size & 1);
+    }
+    if (!haveFormat || !data_) return false;
+
+    info_.totalFrames = dataBytes_ / frameBytes;
+    dataBytes_ = info_.totalFrames * frameBytes;
+    if (info_.hasLoopPoints && (info_.loopStart >= info_.loopEnd || info_.loopEnd > info_.totalFrames)) {
+        info_.hasLoopPoints = false;
+    }
+    return info_.totalFrames > 0;
+}
+
+bool MappedSample::parseAiff(const uint8_t* file, size_t bytes) {
+    const bool compressed = std::memcmp(file + 8, "AIFC", 4) == 0;
+    bool haveFormat = false;
+    size_t declaredFrames = 0;
+    const uint8_t* markers = nullptr;
+    size_t markerBytes = 0;
+    int sustainMode = 0, sustainBegin = -1, sustainEnd = -1;
+
+    for (size_t pos = 12; pos + 8 <= bytes;) {
+        const uint8_t* id = file + pos;
+        const size_t size = be32(file + pos + 4);
+        const uint8_t* body = file + pos + 8;
+        const size_t available = std::min(size, bytes - pos - 8);
+
+        if (std::memcmp(id, "COMM", 4) == 0 && available >= 18) {
+            info_.channels = static_cast<int16_t>(be16(body));
+            declaredFrames = be32(body + 2);
+            info_.bitDepth = static_cast<int16_t>(be16(body + 6));
+            info_.sampleRate = static_cast<int>(std::lround(extended80(body + 8)));
+            bool littleEndian = false;
+            if (compressed) {
+                if (available < 22) return false;
+                if (std::memcmp(body + 18, "sowt", 4) == 0) {
+                    littleEndian = true;
+                } else if (std::memcmp(body + 18, "NONE", 4) != 0) {
+                    return false;       // Compressed AIFF-C is not supported
+                }
+            }
+            if (info_.channels < 1 || info_.channels > MAX_CHANNELS || info_.sampleRate <= 0 ||
+                (info_.bitDepth != 16 && info_.bitDepth != 24)) {
+                return false;
+            }
+            if (info_.bitDepth == 16) {
+                encoding_ = littleEndian ? Encoding::PCM16_LE : Encoding::PCM16_BE;
+            } else {
+                encoding_ = littleEndian ? Encoding::PCM24_LE : Encoding::PCM24_BE;
+            }
+            haveFormat = true;
+        } else if (std::memcmp(id, "SSND", 4) == 0 && available >= 8) {
+            const size_t offset = be32(body);
+            if (8 + offset > available) return false;
+            data_ = body + 8 + offset;
+            dataBytes_ = available - 8 - offset;
+        } else if (std::memcmp(id, "MARK", 4) == 0 && available >= 2) {
+            markers = body;
+            markerBytes = available;
+        } else if (std::memcmp(id, "INST", 4) == 0 && available >= 14) {
+            info_.rootNote = static_cast<float>(body[0]);
+            sustainMode = static_cast<int16_t>(be16(body + 8));
+            sustainBegin = static_cast<int16_t>(be16(body + 10));
+            sustainEnd = static_cast<int16_t>(be16(body + 12));
+        }
+        pos += 8 + size + (size & 1);
+    }
+    if (!haveFormat || !data_) return false;
+
+    const size_t frameBytes = static_cast<size_t>(info_.channels) * (info_.bitDepth / 8);
+    info_.totalFrames = std::min(declaredFrames, dataBytes_ / frameBytes);
+    dataBytes_ = info_.totalFrames * frameBytes;
+
+    // Sustain loop: INST names two MARK markers
+    if (markers && sustainMode != 0) {
+        long begin = -1, end = -1;
+        const size_t count = be16(markers);
+        size_t pos = 2;
+        for (size_t m = 0; m < count && pos + 7 <= markerBytes; ++m) {
+            const int markerId = static_cast<int16_t>(be16(markers + pos));
+            const long position = static_cast<long>(be32(markers + pos + 2));
+            if (markerId == sustainBegin) begin = position;
+            if (markerId == sustainEnd) end = position;
+            const size_t nameBytes = 1 + markers[pos + 6];
+            pos += 6 + nameBytes + (nameBytes & 1);     // Pascal string padded to even
+        }
+        if (begin >= 0 && end > begin && static_cast<size_t>(end) <= info_.totalFrames) {
+            info_.loopStart = static_cast<size_t>(begin);
+            info_.loopEnd = static_cast<size_t>(end);
+            info_.hasLoopPoints = true;
+        }
+    }
+    return info_.totalFrames > 0;
+}
+
+const int16_t* MappedSample::pcm16() const {
+    if (encoding_ != Encoding::PCM16_LE || !isLittleEndianHost()) return nullptr;
+    if (reinterpret_cast<uintptr_t>(data_) % alignof(int16_t) != 0) return nullptr;
+    return reinterpret_cast<const int16_t*>(data_);
+}
+
+size_t MappedSample::readSamples(size_t firstSample, int16_t* output, size_t count) const {
+    const size_t totalSamples = info_.totalFrames * static_cast<size_t>(info_.channels);
+    if (firstSample >= totalSamples) return 0;
+    count = std::min(count, totalSamples - firstSample);
+
+    if (const int16_t* direct = pcm16()) {
+        std::memcpy(output, direct + firstSample, count * sizeof(int16_t));
+        return count;
+    }
+    switch (encoding_) {
+        case Encoding::PCM16_LE: {
+            const uint8_t* src = data_ + firstSample * 2;
+            for (size_t i = 0; i < count; ++i) output[i] = static_cast<int16_t>(le16(src + i * 2));
+            break;
+        }
+        case Encoding::PCM16_BE: {
+            const uint8_t* src = data_ + firstSample * 2;
+            for (size_t i = 0; i < count; ++i) output[i] = static_cast<int16_t>(be16(src + i * 2));
+            break;
+        }
+        // 24-bit keeps the top 16 bits, as WavLoader does
+        case Encoding::PCM24_LE: {
+            const uint8_t* src = data_ + firstSample * 3;
+            for (size_t i = 0; i < count; ++i) output[i] = static_cast<int16_t>(src[i * 3 + 1] | (src[i * 3 + 2] << 8));
+            break;
+        }
+        case Encoding::PCM24_BE: {
+            const uint8_t* src = data_ + firstSample * 3;
+            for (size_t i = 0; i < count; ++i) output[i] = static_cast<int16_t>((src[i * 3] << 8) | src[i * 3 + 1]);
+            break;
+        }
+    }
+    return count;
+}
+
+size_t MappedSample::readFrames(size_t firstFrame, int16_t* output, size_t frames) const {
+    const size_t channels = static_cast<size_t>(info_.channels);
+    return readSamples(firstFrame * channels, output, frames * channels) / channels;
+}
+
+void MappedSample::prefetch(size_t firstFrame, size_t frames) const {
+#if defined(SAMPLE_STORE_MMAP) && defined(MADV_WILLNEED)
+    if (!mapping_ || firstFrame >= info_.totalFrames) return;
+    frames = std::min(frames, info_.totalFrames - firstFrame);
+    const size_t frameBytes = dataBytes_ / info_.totalFrames;
+    static const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+    const uint8_t* base = static_cast<const uint8_t*>(mapping_);
+    size_t begin = static_cast<size_t>(data_ - base) + firstFrame * frameBytes;
+    const size_t end = begin + frames * frameBytes;
+    begin -= begin % pageSize;
+    ::madvise(const_cast<uint8_t*>(base) + begin, end - begin, MADV_WILLNEED);
+#else
+    (void)firstFrame;
+    (void)frames;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// SampleStore
+//-----------------------------------------------------------------------------
+
+SampleHandle SampleStore::open(const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = samples_.find(filePath);
+    if (it != samples_.end()) {
+        if (SampleHandle existing = it->second.lock()) return existing;
+    }
+
+    std::shared_ptr<MappedSample> sample(new MappedSample());
+    if (!sample->open(filePath)) return nullptr;
+    samples_[filePath] = sample;
+    return sample;
+}
+
+size_t SampleStore::getOpenCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& entry : samples_) {
+        if (!entry.second.expired()) count++;
+    }
+    return count;
+}
+
+void SampleStore::purge() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = samples_.begin(); it != samples_.end();) {
+        it = it->second.expired() ? samples_.erase(it) : std::next(it);
+    }
+}
+
+SampleStore& SampleStore::shared() {
+    static SampleStore store;
+    return store;
+}
+
+} // namespace Sample
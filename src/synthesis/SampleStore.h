@@ -0,0 +1,95 @@
+#pragma once
+#include "SampleBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sample {
+
+/**
+ * MappedSample - One WAV/AIFF file mapped read-only into memory
+ *
+ * The sample data is left where it is in the file. Pages come in from the
+ * page cache on first touch and are shared with every other user of the
+ * file. 16-bit little-endian PCM is exposed as a zero-copy span. Other
+ * encodings (24-bit, big-endian AIFF) are converted as they are read.
+ * Without mmap support the file is read into memory once instead.
+ *
+ * Features:
+ * - WAV (PCM 16/24, WAVE_FORMAT_EXTENSIBLE, smpl loop points)
+ * - AIFF and AIFF-C (NONE/sowt), 16/24-bit
+ * - pcm16(): direct pointer into the mapping when no conversion is needed
+ * - readSamples()/readFrames(): conversion into a caller's buffer, never
+ *   a whole-file copy
+ * - prefetch(): madvise(MADV_WILLNEED) on a frame range, a non-blocking hint
+ */
+class MappedSample {
+public:
+    enum class Encoding { PCM16_LE, PCM16_BE, PCM24_LE, PCM24_BE };
+
+    ~MappedSample();
+    MappedSample(const MappedSample&) = delete;
+    MappedSample& operator=(const MappedSample&) = delete;
+
+    const SampleInfo& getInfo() const { return info_; }
+    size_t getFrames() const { return info_.totalFrames; }
+    int getChannels() const { return info_.channels; }
+    Encoding getEncoding() const { return encoding_; }
+    size_t getDataBytes() const { return dataBytes_; }
+    bool isMapped() const { return mapping_ != nullptr; }
+
+    // Interleaved 16-bit samples in place, or nullptr when the data needs converting
+    const int16_t* pcm16() const;
+
+    // Thread-safe conversion reads (interleaved 16-bit); clipped to the end of the data
+    size_t readSamples(size_t firstSample, int16_t* output, size_t count) const;
+    size_t readFrames(size_t firstFrame, int16_t* output, size_t frames) const;
+
+    // Ask the OS to start reading a range in the background
+    void prefetch(size_t firstFrame, size_t frames) const;
+    void prefetchAll() const { prefetch(0, info_.totalFrames); }
+
+private:
+    friend class SampleStore;
+    MappedSample() = default;
+
+    bool open(const std::string& path);
+    bool parseWav(const uint8_t* file, size_t bytes);
+    bool parseAiff(const uint8_t* file, size_t bytes);
+
+    SampleInfo info_;
+    Encoding encoding_ = Encoding::PCM16_LE;
+    const uint8_t* data_ = nullptr;             // First sample
+    size_t dataBytes_ = 0;
+    void* mapping_ = nullptr;
+    size_t mappingBytes_ = 0;
+    std::vector<uint8_t> storage_;              // Fallback when the file cannot be mapped
+};
+
+using SampleHandle = std::shared_ptr<const MappedSample>;
+
+/**
+ * SampleStore - Reference-counted library of mapped samples
+ *
+ * open() returns the same handle for a path while anyone still holds it. The
+ * mapping goes away with the last handle, so a project's samples cost address
+ * space, not copies. The store can be shared or owned per engine.
+ */
+class SampleStore {
+public:
+    SampleHandle open(const std::string& filePath);     // nullptr if unreadable or unsupported
+    size_t getOpenCount() const;                        // Samples currently mapped
+    void purge();                                       // Forget released entries
+
+    static SampleStore& shared();
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::weak_ptr<const MappedSample>> samples_;
+};
+
+} // namespace Sample
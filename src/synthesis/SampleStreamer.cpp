@@ -0,0 +1,367 @@
+#include "SampleStreamer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Sample {
+
+namespace {
+constexpr auto WORKER_IDLE_WAIT = std::chrono::milliseconds(1);
+}
+
+SampleStreamer::SampleStreamer(int workerCount, int maxVoices, SampleStore& store)
+    : store_(store), voices_(static_cast<size_t>(std::max(1, maxVoices))), workerCount_(std::max(0, workerCount)) {
+    // Rings hold interleaved stereo at most
+    for (auto& voice : voices_) {
+        voice.ring = std::make_unique<RingBuffer>(RING_FRAMES * 2);
+    }
+    for (int w = 0; w < workerCount_; ++w) {
+        workers_.emplace_back(&SampleStreamer::workerLoop, this, w);
+    }
+}
+
+SampleStreamer::~SampleStreamer() {
+    running_.store(false);
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    for (auto& source : sources_) {
+        if (source.state.load() != SOURCE_FREE) releaseSource(source);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Sources
+//-----------------------------------------------------------------------------
+
+int SampleStreamer::registerSample(const std::string& filePath, size_t headFrames) {
+    collectSources();
+
+    int id = INVALID_ID;
+    for (int i = 0; i < MAX_SOURCES; ++i) {
+        int expected = SOURCE_FREE;
+        if (sources_[i].state.compare_exchange_strong(expected, SOURCE_LOADING)) {
+            id = i;
+            break;
+        }
+    }
+    if (id == INVALID_ID) return INVALID_ID;
+
+    Source& source = sources_[id];
+    SampleHandle sample = store_.open(filePath);
+    if (!sample || sample->getChannels() > 2) {
+        source.state.store(SOURCE_FREE);
+        return INVALID_ID;
+    }
+
+    const SampleInfo& info = sample->getInfo();
+    source.info = info;
+    source.headFrames = std::min(headFrames, info.totalFrames);
+    source.head.assign(source.headFrames * info.channels, 0);
+    sample->readFrames(0, source.head.data(), source.headFrames);
+    sample->prefetch(source.headFrames, CHUNK_FRAMES * PREFETCH_CHUNKS);
+    source.sample = std::move(sample);
+    source.users.store(0);
+    source.state.store(SOURCE_READY, std::memory_order_release);
+    return id;
+}
+
+void SampleStreamer::unregisterSample(int sourceId) {
+    if (sourceId < 0 || sourceId >= MAX_SOURCES) return;
+    int expected = SOURCE_READY;
+    if (sources_[sourceId].state.compare_exchange_strong(expected, SOURCE_RETIRING)) {
+        collectSources();
+    }
+}
+
+const SampleInfo* SampleStreamer::getInfo(int sourceId) const {
+    if (sourceId < 0 || sourceId >= MAX_SOURCES) return nullptr;
+    const Source& source = sources_[sourceId];
+    return source.state.load(std::memory_order_acquire) == SOURCE_READY ? &source.info : nullptr;
+}
+
+// Frees retiring sources nobody plays any more (control thread or worker 0)
+void SampleStreamer::collectSources() {
+    for (auto& source : sources_) {
+        if (source.state.load() == SOURCE_RETIRING && source.users.load() == 0) {
+            int expected = SOURCE_RETIRING;
+            if (source.state.compare_exchange_strong(expected, SOURCE_LOADING)) {
+                releaseSource(source);
+                source.state.store(SOURCE_FREE);
+            }
+        }
+    }
+}
+
+void SampleStreamer::releaseSource(Source& source) {
+    source.sample.reset();
+    std::vector<int16_t>().swap(source.head);
+    source.headFrames = 0;
+    source.info = SampleInfo();
+}
+
+//-----------------------------------------------------------------------------
+// Voices (audio thread)
+//-----------------------------------------------------------------------------
+
+int SampleStreamer::startVoice(int sourceId, size_t startFrame, float rate, bool loop) {
+    if (sourceId < 0 || sourceId >= MAX_SOURCES) return INVALID_ID;
+    Source& source = sources_[sourceId];
+    if (source.state.load(std::memory_order_acquire) != SOURCE_READY) return INVALID_ID;
+
+    // Pin the source, then make sure it was not retired in between
+    source.users.fetch_add(1);
+    if (source.state.load() != SOURCE_READY) {
+        source.users.fetch_sub(1);
+        return INVALID_ID;
+    }
+
+    for (int id = 0; id < static_cast<int>(voices_.size()); ++id) {
+        Voice& voice = voices_[id];
+        int expected = VOICE_FREE;
+        if (!voice.state.compare_exchange_strong(expected, VOICE_CLAIMED, std::memory_order_acquire)) continue;
+
+        const SampleInfo& info = source.info;
+        voice.source = sourceId;
+        voice.channels = info.channels;
+        voice.loop = loop && info.hasLoopPoints && info.loopEnd > info.loopStart && info.loopEnd <= info.totalFrames;
+        if (loop && !voice.loop) {
+            // No loop points in the file: loop the whole sample
+            voice.loop = info.totalFrames > 0;
+            voice.loopStart = 0;
+            voice.loopEnd = info.totalFrames;
+        } else {
+            voice.loopStart = voice.loop ? info.loopStart : 0;
+            voice.loopEnd = voice.loop ? info.loopEnd : info.totalFrames;
+        }
+        startFrame = std::min(startFrame, voice.loopEnd);
+
+        // The head covers the start when it begins there and (for loops) holds
+        // everything up to the loop end, or the ring takes over at its end
+        const size_t headEnd = std::min(source.headFrames, voice.loopEnd);
+        voice.inRing = startFrame >= headEnd && !(voice.loop && voice.loopEnd <= source.headFrames);
+        voice.headPos = voice.inRing ? 0 : startFrame;
+        voice.ringStarted = false;
+        voice.headLeft.store(voice.inRing ? 0 : headEnd - voice.headPos, std::memory_order_relaxed);
+        voice.filePos = voice.inRing ? startFrame : headEnd;
+        const bool headOnly = voice.loop ? voice.loopEnd <= source.headFrames : source.headFrames >= info.totalFrames;
+        voice.eof.store(headOnly, std::memory_order_relaxed);
+        voice.finished.store(false, std::memory_order_relaxed);
+        voice.rate.store(std::max(rate, 0.0f), std::memory_order_relaxed);
+        voice.underruns.store(0, std::memory_order_relaxed);
+        voice.state.store(VOICE_ACTIVE, std::memory_order_release);
+        return id;
+    }
+
+    source.users.fetch_sub(1);
+    return INVALID_ID;
+}
+
+size_t SampleStreamer::readVoice(int voiceId, int16_t* output, size_t frames) {
+    if (!isValidVoice(voiceId)) return 0;
+    Voice& voice = voices_[voiceId];
+    const int channels = voice.channels;
+    if (voice.state.load(std::memory_order_acquire) != VOICE_ACTIVE) {
+        std::memset(output, 0, frames * channels * sizeof(int16_t));
+        return 0;
+    }
+
+    const Source& source = sources_[voice.source];
+    size_t done = 0;
+
+    // Head: straight from RAM
+    while (!voice.inRing && done < frames) {
+        const size_t headEnd = std::min(source.headFrames, voice.loopEnd);
+        const size_t count = std::min(frames - done, headEnd - voice.headPos);
+        std::memcpy(output + done * channels, source.head.data() + voice.headPos * channels,
+                    count * channels * sizeof(int16_t));
+        done += count;
+        voice.headPos += count;
+        if (voice.headPos < headEnd) break;
+        if (voice.loop && voice.loopEnd <= source.headFrames) {
+            voice.headPos = voice.loopStart;        // Whole loop lives in the head
+        } else if (!voice.loop && source.headFrames >= voice.loopEnd) {
+            voice.finished.store(true, std::memory_order_release);
+            break;
+        } else {
+            voice.inRing = true;
+        }
+    }
+
+    // Tail: whatever the workers have read ahead
+    if (voice.inRing && done < frames) {
+        const size_t available = voice.ring->available() / channels;
+        const size_t count = std::min(frames - done, available);
+        if (count > 0) {
+            voice.ring->read(output + done * channels, count * channels);
+            done += count;
+            voice.ringStarted = true;
+        }
+        if (done < frames) {
+            if (voice.eof.load(std::memory_order_acquire) && voice.ring->available() == 0) {
+                voice.finished.store(true, std::memory_order_release);
+            } else if (voice.ringStarted || voice.headPos > 0) {
+                // Data should have been there: report it. A voice started past
+                // the head waits silently for its first read.
+                const uint32_t missing = static_cast<uint32_t>(frames - done);
+                voice.underruns.fetch_add(missing, std::memory_order_relaxed);
+                underruns_.fetch_add(missing, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    voice.headLeft.store(voice.inRing ? 0 : std::min(source.headFrames, voice.loopEnd) - voice.headPos,
+                         std::memory_order_relaxed);
+    if (done < frames) {
+        std::memset(output + done * channels, 0, (frames - done) * channels * sizeof(int16_t));
+    }
+    return done;
+}
+
+void SampleStreamer::setVoiceRate(int voiceId, float rate) {
+    if (isValidVoice(voiceId)) voices_[voiceId].rate.store(std::max(rate, 0.0f), std::memory_order_relaxed);
+}
+
+void SampleStreamer::stopVoice(int voiceId) {
+    if (!isValidVoice(voiceId)) return;
+    int expected = VOICE_ACTIVE;
+    if (voices_[voiceId].state.compare_exchange_strong(expected, VOICE_STOPPING, std::memory_order_acq_rel)) {
+        // Without workers nothing else will hand the voice back
+        if (workerCount_ == 0) recycleVoice(voices_[voiceId]);
+    }
+}
+
+bool SampleStreamer::isVoiceFinished(int voiceId) const {
+    if (!isValidVoice(voiceId)) return true;
+    const Voice& voice = voices_[voiceId];
+    return voice.state.load(std::memory_order_acquire) != VOICE_ACTIVE ||
+           voice.finished.load(std::memory_order_acquire);
+}
+
+uint32_t SampleStreamer::getVoiceUnderruns(int voiceId) const {
+    return isValidVoice(voiceId) ? voices_[voiceId].underruns.load(std::memory_order_relaxed) : 0;
+}
+
+//-----------------------------------------------------------------------------
+// Read-ahead
+//-----------------------------------------------------------------------------
+
+// Worker w serves voices w, w + stride, ... so voices are never shared between workers
+void SampleStreamer::workerLoop(int worker) {
+    std::vector<Candidate> candidates;
+    candidates.reserve(voices_.size());
+    std::vector<int16_t> scratch(CHUNK_FRAMES * 2);
+    while (running_.load()) {
+        size_t chunks = servicePass(worker, workerCount_, SIZE_MAX, candidates, scratch);
+        if (worker == 0) collectSources();
+        if (chunks == 0) {
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wake_.wait_for(lock, WORKER_IDLE_WAIT);
+        }
+    }
+}
+
+size_t SampleStreamer::pump(size_t maxChunks) {
+    if (workerCount_ > 0) return 0;        // The workers own the rings
+    std::lock_guard<std::mutex> lock(pumpMutex_);
+    static thread_local std::vector<Candidate> candidates;
+    static thread_local std::vector<int16_t> scratch(CHUNK_FRAMES * 2);
+    size_t total = 0;
+    while (total < maxChunks) {
+        size_t chunks = servicePass(0, 1, maxChunks - total, candidates, scratch);
+        if (chunks == 0) break;
+        total += chunks;
+    }
+    return total;
+}
+
+// One pass: hand back stopped voices, then give every voice with room in its
+// ring one chunk, the ones closest to running dry first
+size_t SampleStreamer::servicePass(int worker, int stride, size_t maxChunks, std::vector<Candidate>& candidates,
+                                   std::vector<int16_t>& scratch) {
+    candidates.clear();
+    for (int id = worker; id < static_cast<int>(voices_.size()); id += stride) {
+        Voice& voice = voices_[id];
+        const int state = voice.state.load(std::memory_order_acquire);
+        if (state == VOICE_STOPPING) {
+            recycleVoice(voice);
+            continue;
+        }
+        if (state != VOICE_ACTIVE || voice.eof.load(std::memory_order_relaxed)) continue;
+        const size_t buffered = voice.ring->available() / voice.channels;
+        if (RING_FRAMES - 1 - buffered < CHUNK_FRAMES) continue;
+
+        // Time until the voice needs data it does not have yet, head included
+        const size_t ahead = buffered + voice.headLeft.load(std::memory_order_relaxed);
+        const float rate = std::max(voice.rate.load(std::memory_order_relaxed), 0.001f);
+        candidates.push_back({static_cast<float>(ahead) / rate, rate, id});
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.urgency < b.urgency || (a.urgency == b.urgency && a.rate > b.rate);
+    });
+    size_t chunks = 0;
+    for (const Candidate& candidate : candidates) {
+        if (chunks >= maxChunks) break;
+        if (fillVoice(voices_[candidate.voice], scratch)) chunks++;
+    }
+    return chunks;
+}
+
+// Copy one chunk from the mapping into the voice's ring, wrapping at the loop end.
+// Page faults land here on the worker; the next chunks are hinted ahead of time.
+bool SampleStreamer::fillVoice(Voice& voice, std::vector<int16_t>& scratch) {
+    const MappedSample& sample = *sources_[voice.source].sample;
+    const int channels = voice.channels;
+    const size_t room = (voice.ring->space() / channels);
+    size_t want = std::min(CHUNK_FRAMES, room);
+    size_t got = 0;
+    while (got < want) {
+        if (voice.filePos >= voice.loopEnd) {
+            if (!voice.loop) break;
+            voice.filePos = voice.loopStart;
+        }
+        const size_t count = std::min(want - got, voice.loopEnd - voice.filePos);
+        const size_t read = sample.readFrames(voice.filePos, scratch.data() + got * channels, count);
+        got += read;
+        voice.filePos += read;
+        if (read < count) {
+            voice.filePos = voice.loopEnd;      // Short file: treat as the end
+            if (!voice.loop) break;
+        }
+    }
+    if (got > 0) {
+        sample.prefetch(voice.filePos, CHUNK_FRAMES * PREFETCH_CHUNKS);
+    }
+    if (got > 0) {
+        voice.ring->write(scratch.data(), got * channels);
+        framesStreamed_.fetch_add(got, std::memory_order_relaxed);
+    }
+    if (!voice.loop && voice.filePos >= voice.loopEnd) {
+        voice.eof.store(true, std::memory_order_release);
+    }
+    return got > 0;
+}
+
+void SampleStreamer::recycleVoice(Voice& voice) {
+    voice.ring->reset();
+    if (voice.source != INVALID_ID) sources_[voice.source].users.fetch_sub(1);
+    voice.source = INVALID_ID;
+    voice.state.store(VOICE_FREE, std::memory_order_release);
+}
+
+SampleStreamer::Stats SampleStreamer::getStats() const {
+    Stats stats;
+    stats.underruns = underruns_.load(std::memory_order_relaxed);
+    stats.framesStreamed = framesStreamed_.load(std::memory_order_relaxed);
+    for (const auto& voice : voices_) {
+        if (voice.state.load(std::memory_order_relaxed) == VOICE_ACTIVE) stats.activeVoices++;
+    }
+    for (const auto& source : sources_) {
+        if (source.state.load(std::memory_order_relaxed) == SOURCE_READY) stats.registeredSources++;
+    }
+    return stats;
+}
+
+} // namespace Sample
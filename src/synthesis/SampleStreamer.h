@@ -0,0 +1,143 @@
+#pragma once
+#include "SampleBuffer.h"
+#include "SampleStore.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Sample {
+
+/**
+ * SampleStreamer - Shared disk-streaming service for sampler voices
+ *
+ * One I/O worker (or a small pool) serves every streaming voice. A sample is
+ * registered once: its first frames (the head) are preloaded into RAM so
+ * notes start instantly. The file is mapped through SampleStore, and the
+ * workers copy the rest from the mapping into the voice's own
+ * lock-free single-producer/single-consumer ring. Each pass, the workers fill
+ * the voices closest to running dry first, measured as buffered frames over
+ * playback rate. The audio thread never blocks. If a ring is empty it plays
+ * silence and counts an underrun.
+ *
+ * Features:
+ * - Sources registered once and shared by any number of voices
+ * - Fixed voice pool and rings, allocated up front (no audio-thread allocation)
+ * - Prioritized read-ahead scaled by each voice's playback rate
+ * - Loop points streamed without gaps
+ * - Per-voice and total underrun counts
+ * - pump() drives read-ahead from the caller (offline rendering, no workers)
+ */
+class SampleStreamer {
+public:
+    static constexpr int MAX_SOURCES = 1024;
+    static constexpr int DEFAULT_MAX_VOICES = 128;
+    static constexpr size_t DEFAULT_HEAD_FRAMES = 32768;   // ~0.7 s at 48 kHz
+    static constexpr size_t RING_FRAMES = 16384;           // Per voice read-ahead (power of two)
+    static constexpr size_t CHUNK_FRAMES = 2048;           // Frames per disk read
+    static constexpr size_t PREFETCH_CHUNKS = 4;           // Read-ahead hinted to the OS past each read
+    static constexpr int INVALID_ID = -1;
+
+    struct Stats {
+        uint64_t underruns = 0;           // Frames of silence played for lack of data
+        uint64_t framesStreamed = 0;      // Frames read from disk
+        int activeVoices = 0;
+        int registeredSources = 0;
+    };
+
+    // workerCount 0: no threads, read-ahead only happens in pump()
+    explicit SampleStreamer(int workerCount = 1, int maxVoices = DEFAULT_MAX_VOICES,
+                            SampleStore& store = SampleStore::shared());
+    ~SampleStreamer();
+
+    SampleStreamer(const SampleStreamer&) = delete;
+    SampleStreamer& operator=(const SampleStreamer&) = delete;
+
+    // Sources (control thread: maps files and allocates); WAV or AIFF
+    int registerSample(const std::string& filePath, size_t headFrames = DEFAULT_HEAD_FRAMES);
+    void unregisterSample(int sourceId);    // Freed once its last voice has stopped
+    const SampleInfo* getInfo(int sourceId) const;
+
+    // Voices (audio thread: lock-free and allocation-free)
+    int startVoice(int sourceId, size_t startFrame = 0, float rate = 1.0f, bool loop = false);
+    size_t readVoice(int voiceId, int16_t* output, size_t frames);  // Interleaved; short reads are zero-filled
+    void setVoiceRate(int voiceId, float rate);                      // Read-ahead priority only
+    void stopVoice(int voiceId);
+    bool isVoiceFinished(int voiceId) const;
+    uint32_t getVoiceUnderruns(int voiceId) const;
+
+    // Read-ahead on the calling thread for a streamer built without workers:
+    // up to maxChunks reads, most urgent first. Returns the number of chunks read.
+    size_t pump(size_t maxChunks = SIZE_MAX);
+
+    Stats getStats() const;
+    int getMaxVoices() const { return static_cast<int>(voices_.size()); }
+
+private:
+    enum SourceState : int { SOURCE_FREE = 0, SOURCE_LOADING, SOURCE_READY, SOURCE_RETIRING };
+    enum VoiceState : int { VOICE_FREE = 0, VOICE_CLAIMED, VOICE_ACTIVE, VOICE_STOPPING };
+
+    struct Source {
+        std::atomic<int> state{SOURCE_FREE};
+        std::atomic<int> users{0};              // Voices playing this source
+        SampleInfo info;
+        std::vector<int16_t> head;              // First headFrames frames, interleaved
+        size_t headFrames = 0;
+        SampleHandle sample;                    // Mapped file; workers read the tail from it
+    };
+
+    struct Voice {
+        std::atomic<int> state{VOICE_FREE};
+        std::unique_ptr<RingBuffer> ring;
+        int source = INVALID_ID;
+        int channels = 1;
+        bool loop = false;
+        size_t loopStart = 0;
+        size_t loopEnd = 0;                     // Exclusive; totalFrames when not looping
+        // Audio thread
+        size_t headPos = 0;                     // Next head frame, until the head is used up
+        bool inRing = false;                    // Head finished: playing from the ring
+        bool ringStarted = false;               // Ring has delivered data at least once
+        std::atomic<size_t> headLeft{0};        // Head frames still to play, for read-ahead priority
+        // Worker
+        size_t filePos = 0;                     // Next frame to read from disk
+        std::atomic<bool> eof{false};           // Worker has read the last frame
+        std::atomic<bool> finished{false};
+        std::atomic<float> rate{1.0f};
+        std::atomic<uint32_t> underruns{0};
+    };
+
+    struct Candidate {
+        float urgency;                          // Frames left to play over playback rate
+        float rate;                             // Breaks ties between dry voices
+        int voice;
+    };
+
+    SampleStore& store_;
+    std::array<Source, MAX_SOURCES> sources_;
+    std::vector<Voice> voices_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{true};
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::mutex pumpMutex_;                      // Serializes pump() with itself
+    std::atomic<uint64_t> underruns_{0};
+    std::atomic<uint64_t> framesStreamed_{0};
+    int workerCount_ = 0;
+
+    void workerLoop(int worker);
+    size_t servicePass(int worker, int stride, size_t maxChunks, std::vector<Candidate>& candidates,
+                       std::vector<int16_t>& scratch);
+    bool fillVoice(Voice& voice, std::vector<int16_t>& scratch);
+    void recycleVoice(Voice& voice);
+    void collectSources();
+    void releaseSource(Source& source);
+    bool isValidVoice(int voiceId) const { return voiceId >= 0 && voiceId < static_cast<int>(voices_.size()); }
+};
+
+} // namespace Sample
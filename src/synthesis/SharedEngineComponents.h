@@ -229,6 +229,11 @@ public:
         }
     }
     
+    void reset() {
+        stage_ = Stage::IDLE;
+        output_ = 0.0f;
+    }
+    
     float process() {
         switch (stage_) {
             case Stage::IDLE:
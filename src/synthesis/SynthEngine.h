@@ -2,6 +2,9 @@
 #include "../core/Types.h"
 #include "../core/CoreParameters.h"
 #include "../core/PostChainProcessor.h"
+#include "../audio/VoiceManager.h"
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -51,6 +54,13 @@ public:
     virtual size_t getMaxVoiceCount() const = 0;
     virtual void setVoiceCount(size_t maxVoices) = 0;
     
+    // Shared voice allocation: engines that support it take voice indices from the
+    // manager for this slot and return true; others keep allocating on their own
+    virtual bool attachVoiceManager(VoiceManager* /*manager*/, int /*slot*/) { return false; }
+    // Stop using the slot's voice records (engine replaced or being destroyed);
+    // voices already sounding keep playing under the engine's own allocation
+    void detachVoiceManager() { voiceManager_ = nullptr; }
+    
     // Performance monitoring
     virtual float getCPUUsage() const = 0;
     
@@ -68,7 +78,13 @@ public:
     // Modulation support
     virtual void setModulation(ParameterID target, float amount) {}
     virtual bool supportsModulation(ParameterID target) const { return false; }
-    
+    // Per-sample modulation for the next processAudio() block. Engines that
+    // interpolate inside the block override this; the default applies the
+    // block's final value. `values` is only valid during the call.
+    virtual void setModulationBuffer(ParameterID target, const float* values, size_t frames) {
+        if (frames > 0) setModulation(target, values[frames - 1]);
+    }
+
 protected:
     // Core parameter system
     EtherSynth::CoreParams coreParams_;
@@ -78,6 +94,56 @@ protected:
     float sampleRate_ = SAMPLE_RATE;
     size_t bufferSize_ = BUFFER_SIZE;
     size_t maxVoices_ = MAX_VOICES;
+    VoiceManager* voiceManager_ = nullptr;   // Set by attachVoiceManager() overrides
+    int voiceSlot_ = -1;
+    
+    // Shared voice allocation plumbing for attachVoiceManager() engines. `voices`
+    // is the engine's voice array; the fallbacks allocate without a manager.
+    template <typename Voices>
+    bool attachVoices(VoiceManager* manager, int slot, Voices& voices) {
+        voiceManager_ = manager;
+        voiceSlot_ = slot;
+        if (!manager) return false;
+        
+        // Start clean so the manager's records match the voices
+        for (auto& voice : voices) {
+            voice.kill();
+        }
+        manager->attachSlot(slot, this, static_cast<int>(voices.size()));
+        return true;
+    }
+    
+    template <typename Voices, typename Fallback>
+    auto acquireVoice(Voices& voices, uint8_t note, float velocity, Fallback fallback) -> decltype(&voices[0]) {
+        if (!voiceManager_) return fallback();
+        int index = voiceManager_->noteOn(voiceSlot_, note, velocity);
+        return index >= 0 ? &voices[index] : nullptr;
+    }
+    
+    template <typename Voices, typename Fallback>
+    auto releaseVoice(Voices& voices, uint8_t note, Fallback fallback) -> decltype(&voices[0]) {
+        if (!voiceManager_) return fallback();
+        int index = voiceManager_->noteOff(voiceSlot_, note);
+        return index >= 0 ? &voices[index] : nullptr;
+    }
+    
+    template <typename Voices>
+    void releaseAllVoices(Voices& voices) {
+        for (auto& voice : voices) {
+            voice.noteOff();
+        }
+        if (voiceManager_) {
+            voiceManager_->allNotesOff(voiceSlot_);
+        }
+    }
+    
+    // Copies a setModulationBuffer() ramp into an engine-owned block buffer,
+    // holding the last value to the end of the buffer
+    static void copyModulationRamp(std::array<float, BUFFER_SIZE>& ramp, const float* values, size_t frames) {
+        frames = std::min(frames, BUFFER_SIZE);
+        std::copy(values, values + frames, ramp.begin());
+        std::fill(ramp.begin() + frames, ramp.end(), frames > 0 ? values[frames - 1] : 0.0f);
+    }
     
     // Update post-chain when parameters change
     virtual void updatePostChain();
@@ -107,7 +173,17 @@ public:
     // Processing
     virtual AudioFrame processSample() = 0;
     virtual void processBuffer(AudioFrame* buffer, size_t frames) = 0;
-    
+
+    // Block contract: adds frames of output to left/right (right may be null for
+    // mono engines). Override to render in tight loops instead of per sample.
+    virtual void processBlock(float* left, float* right, size_t frames) {
+        for (size_t i = 0; i < frames; i++) {
+            AudioFrame frame = processSample();
+            left[i] += frame.left;
+            if (right) right[i] += frame.right;
+        }
+    }
+
     // State
     virtual bool isActive() const = 0;
     virtual bool isReleasing() const = 0;
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "audio/AuxBusMixer.h"
+
+// Count heap allocations so the audio-thread calls can be checked for none
+static std::atomic<size_t> gAllocations{0};
+void* operator new(size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+    constexpr float SR = 48000.0f;
+    constexpr size_t FRAMES = BUFFER_SIZE;
+
+    EtherAudioBuffer makeImpulse(bool on) {
+        EtherAudioBuffer buffer{ };
+        if (on) buffer[0] = AudioFrame(1.0f, 1.0f);
+        return buffer;
+    }
+
+    // Run `blocks` blocks with slot 0 feeding `input` into the first block only
+    std::vector<float> render(AuxBusMixer& mixer, const EtherAudioBuffer* pre, const EtherAudioBuffer& post, int blocks) {
+        std::vector<float> out(FRAMES * 2 * blocks, 0.0f);
+        const EtherAudioBuffer silence{ };
+        for (int b = 0; b < blocks; ++b) {
+            mixer.beginBlock(FRAMES);
+            mixer.addSlot(0, b == 0 ? pre : &silence, b == 0 ? post : silence, FRAMES);
+            mixer.processReturns(out.data() + b * FRAMES * 2, FRAMES);
+        }
+        return out;
+    }
+
+    float energy(const std::vector<float>& out, size_t fromFrame, size_t toFrame) {
+        float sum = 0.0f;
+        for (size_t i = fromFrame * 2; i < toFrame * 2 && i < out.size(); ++i) sum += out[i] * out[i];
+        return sum;
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth Aux Bus Mixer Test\n";
+    std::cout << "=============================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    std::cout << "Testing delay send stays off the reverb bus... ";
+    {
+        AuxBusMixer mixer;
+        mixer.setSampleRate(SR);
+        mixer.setBusReturn(0, AuxBusMixer::ReturnType::REVERB);
+        mixer.setBusReturn(1, AuxBusMixer::ReturnType::DELAY);
+        mixer.getDelay(1)->setDelayTime(0.01f);                 // 480 samples
+        mixer.getDelay(1)->setFeedback(0.0f);
+        mixer.getDelay(1)->setHighCut(20000.0f);
+        mixer.getDelay(1)->setLowCut(20.0f);
+        mixer.setSend(0, 1, 1.0f);
+        const EtherAudioBuffer impulse = makeImpulse(true);
+        std::vector<float> out = render(mixer, nullptr, impulse, 8);
+        // Wet only: nothing before the echo, one echo around 480 samples, silence after
+        size_t peak = 0;
+        for (size_t i = 0; i < out.size() / 2; ++i) {
+            if (std::fabs(out[i * 2]) > std::fabs(out[peak * 2])) peak = i;
+        }
+        bool ok = peak >= 478 && peak <= 482 && energy(out, 0, 470) < 1e-6f && energy(out, 600, 1024) < 1e-6f;
+        report(ok);
+    }
+
+    std::cout << "Testing PRE and POST taps read different sources... ";
+    {
+        AuxBusMixer mixer;
+        mixer.setSampleRate(SR);
+        mixer.setBusReturn(0, AuxBusMixer::ReturnType::DELAY);
+        mixer.getDelay(0)->setDelayTime(0.001f);
+        mixer.getDelay(0)->setFeedback(0.0f);
+        mixer.setSend(0, 0, 1.0f);
+        const EtherAudioBuffer pre = makeImpulse(true);
+        const EtherAudioBuffer post = makeImpulse(false);
+        bool ok = !mixer.needsPreTap(0) && mixer.hasSends(0);
+        float postEnergy = energy(render(mixer, &pre, post, 2), 0, FRAMES * 2);
+        mixer.reset();
+        mixer.setSendTap(0, 0, AuxBusMixer::Tap::PRE);
+        ok = ok && mixer.needsPreTap(0);
+        float preEnergy = energy(render(mixer, &pre, post, 2), 0, FRAMES * 2);
+        ok = ok && postEnergy < 1e-9f && preEnergy > 0.1f;
+        report(ok);
+    }
+
+    std::cout << "Testing reverb tail decays... ";
+    {
+        AuxBusMixer mixer;
+        mixer.setSampleRate(SR);
+        mixer.setBusReturn(0, AuxBusMixer::ReturnType::REVERB);
+        mixer.getReverb(0)->setRoomSize(0.5f);
+        mixer.setSend(0, 0, 1.0f);
+        const EtherAudioBuffer impulse = makeImpulse(true);
+        const int blocks = static_cast<int>(3.0f * SR / FRAMES);
+        std::vector<float> out = render(mixer, nullptr, impulse, blocks);
+        const size_t second = static_cast<size_t>(SR);
+        float early = energy(out, 0, second / 2);
+        float late = energy(out, 2 * second, 3 * second - FRAMES);
+        bool ok = early > 1e-7f && late < early * 1e-3f;
+        report(ok);
+    }
+
+    std::cout << "Testing send level changes are ramped... ";
+    {
+        AuxBusMixer mixer;
+        mixer.setSampleRate(SR);
+        mixer.setBusReturn(0, AuxBusMixer::ReturnType::DELAY);
+        mixer.getDelay(0)->setDelayTime(0.001f);
+        mixer.getDelay(0)->setFeedback(0.0f);
+        mixer.getDelay(0)->setHighCut(20000.0f);
+        mixer.getDelay(0)->setLowCut(20.0f);
+        EtherAudioBuffer dc{ };
+        for (auto& f : dc) f = AudioFrame(1.0f, 1.0f);
+        mixer.setSend(0, 0, 1.0f);
+        std::vector<float> out(FRAMES * 2 * 4, 0.0f);
+        for (int b = 0; b < 4; ++b) {
+            mixer.beginBlock(FRAMES);
+            mixer.addSlot(0, nullptr, dc, FRAMES);
+            mixer.processReturns(out.data() + b * FRAMES * 2, FRAMES);
+        }
+        // Send ramps in over the first block rather than stepping to full level
+        bool ok = out[60 * 2] > 0.05f && out[60 * 2] < 0.6f && out[3 * FRAMES * 2] > 0.9f;
+        report(ok);
+    }
+
+    std::cout << "Testing audio-thread calls do not allocate... ";
+    {
+        AuxBusMixer mixer;
+        mixer.setSampleRate(SR);
+        mixer.setBusReturn(0, AuxBusMixer::ReturnType::REVERB);
+        mixer.setBusReturn(1, AuxBusMixer::ReturnType::DELAY);
+        EtherAudioBuffer pre = makeImpulse(true), post = makeImpulse(true);
+        std::vector<float> out(FRAMES * 2, 0.0f);
+        for (int slot = 0; slot < AuxBusMixer::MAX_SLOTS; ++slot) {
+            mixer.setSend(slot, 0, 0.5f);
+            mixer.setSend(slot, 1, 0.25f);
+            mixer.setSendTap(slot, 1, slot % 2 ? AuxBusMixer::Tap::PRE : AuxBusMixer::Tap::POST);
+        }
+        const size_t before = gAllocations.load();
+        for (int b = 0; b < 64; ++b) {
+            mixer.getReverb(0)->setRoomSize((b % 10) / 10.0f);
+            mixer.getDelay(1)->setDelayTime(0.1f + b * 0.01f);
+            mixer.beginBlock(FRAMES);
+            for (int slot = 0; slot < AuxBusMixer::MAX_SLOTS; ++slot) {
+                if (mixer.hasSends(slot)) mixer.addSlot(slot, mixer.needsPreTap(slot) ? &pre : nullptr, post, FRAMES);
+            }
+            mixer.processReturns(out.data(), FRAMES);
+        }
+        bool finite = true;
+        for (float v : out) finite = finite && std::isfinite(v);
+        report(gAllocations.load() == before && finite);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL AUX BUS MIXER TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
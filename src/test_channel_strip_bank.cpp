@@ -0,0 +1,166 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "audio/ChannelStripBank.h"
+
+namespace {
+    constexpr float SR = 48000.0f;
+
+    // Scalar reference: one strip, coefficients fixed (pre gain, drive, pan, HPF, LPF)
+    struct ReferenceStrip {
+        float gain = 1.0f, drive = 0.0f, panL = 0.0f, panR = 0.0f;
+        float a = 0.0f, b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+        float hx[2] = { }, hy[2] = { }, z1[2] = { }, z2[2] = { };
+
+        ReferenceStrip(float hpf, float lpf, float q, float preGain, float driveAmount, float pan)
+            : gain(preGain), drive(driveAmount) {
+            float rc = 1.0f / (2.0f * static_cast<float>(M_PI) * hpf);
+            a = rc / (rc + 1.0f / SR);
+            float w0 = 2.0f * static_cast<float>(M_PI) * lpf / SR;
+            float alpha = std::sin(w0) / (2.0f * q), cosw0 = std::cos(w0), a0 = 1.0f + alpha;
+            b0 = (1.0f - cosw0) * 0.5f / a0; b1 = (1.0f - cosw0) / a0; b2 = b0;
+            a1 = -2.0f * cosw0 / a0; a2 = (1.0f - alpha) / a0;
+            float t = (pan + 1.0f) * 0.25f * static_cast<float>(M_PI);
+            panL = std::cos(t); panR = std::sin(t);
+        }
+        float process(int ch, float x) {
+            x *= gain;
+            if (drive > 0.001f) x = std::tanh((1.0f + drive * 5.0f) * x);
+            x *= ch ? panR : panL;
+            float h = a * (hy[ch] + x - hx[ch]);
+            hx[ch] = x; hy[ch] = h;
+            float y = b0 * h + z1[ch];
+            z1[ch] = b1 * h - a1 * y + z2[ch];
+            z2[ch] = b2 * h - a2 * y;
+            return y;
+        }
+    };
+
+    void fillNoise(EtherAudioBuffer& buffer, std::mt19937& rng) {
+        std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+        for (auto& frame : buffer) frame = AudioFrame(dist(rng), dist(rng));
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth Channel Strip Bank Test\n";
+    std::cout << "==================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+    constexpr int N = ChannelStripBank::MAX_STRIPS;
+
+    std::cout << "Testing every lane matches the scalar strip... ";
+    {
+        ChannelStripBank bank;
+        bank.setSampleRate(SR);
+        std::vector<ReferenceStrip> refs;
+        for (int s = 0; s < N; ++s) {
+            float hpf = 20.0f + 35.0f * s, lpf = 400.0f * (s + 1), q = 0.5f + 0.4f * s;
+            float gain = 0.5f + 0.1f * s, drive = (s % 3 == 0) ? 0.1f * s / 3.0f : 0.0f, pan = -1.0f + s * (2.0f / (N - 1));
+            bank.setHPF(s, hpf); bank.setLPF(s, lpf, q); bank.setPreGain(s, gain);
+            bank.setDrive(s, drive); bank.setPan(s, pan);
+            refs.emplace_back(hpf, lpf, q, gain, drive, pan);
+        }
+        bank.setSampleRate(SR);   // Snap coefficients: the reference has no setting ramps
+        std::mt19937 rng(3);
+        std::vector<EtherAudioBuffer> buffers(N);
+        EtherAudioBuffer* ptrs[N];
+        float maxError = 0.0f;
+        for (int block = 0; block < 40; ++block) {
+            for (int s = 0; s < N; ++s) { fillNoise(buffers[s], rng); ptrs[s] = &buffers[s]; }
+            std::vector<EtherAudioBuffer> input = buffers;
+            bank.processBlock(ptrs, nullptr, BUFFER_SIZE, 32);
+            for (int s = 0; s < N; ++s) {
+                for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+                    maxError = std::max(maxError, std::fabs(buffers[s][i].left - refs[s].process(0, input[s][i].left)));
+                    maxError = std::max(maxError, std::fabs(buffers[s][i].right - refs[s].process(1, input[s][i].right)));
+                }
+            }
+        }
+        std::cout << "(max error " << maxError << ") ";
+        report(maxError < 2e-3f);
+    }
+
+    std::cout << "Testing lanes are independent... ";
+    {
+        ChannelStripBank bank;
+        std::vector<EtherAudioBuffer> buffers(N);
+        EtherAudioBuffer* ptrs[N];
+        for (int s = 0; s < N; ++s) ptrs[s] = &buffers[s];
+        buffers[5][0] = AudioFrame(1.0f, 1.0f);
+        bank.setDrive(5, 1.0f);
+        bool ok = true;
+        for (int block = 0; block < 4; ++block) {
+            bank.processBlock(ptrs, nullptr, BUFFER_SIZE, 16);
+            for (int s = 0; s < N; ++s) {
+                if (s == 5) continue;
+                for (auto& frame : buffers[s]) ok = ok && frame.left == 0.0f && frame.right == 0.0f;
+            }
+            if (block == 0) ok = ok && std::fabs(buffers[5][0].left) > 0.1f;
+            for (auto& frame : buffers[5]) frame = AudioFrame();
+        }
+        report(ok);
+    }
+
+    std::cout << "Testing inactive strips are left untouched... ";
+    {
+        ChannelStripBank bank;
+        EtherAudioBuffer active{ }, idle{ };
+        for (auto& frame : idle) frame = AudioFrame(0.25f, -0.25f);
+        active[0] = AudioFrame(1.0f, 1.0f);
+        EtherAudioBuffer* ptrs[N] = { };
+        ptrs[0] = &active;
+        bank.processBlock(ptrs, nullptr, BUFFER_SIZE, 32);
+        bool ok = true;
+        for (auto& frame : idle) ok = ok && frame.left == 0.25f && frame.right == -0.25f;
+        report(ok);
+    }
+
+    std::cout << "Testing cutoff modulation is smoothed across segments... ";
+    {
+        // A full-scale cutoff step arrives at a segment boundary. Stepped coefficients
+        // jump the filter output; ramped ones move it across the segment.
+        ChannelStripBank bank;
+        bank.setLPF(0, 300.0f, 4.0f);
+        bank.setSampleRate(SR);
+        std::vector<float> ramp(BUFFER_SIZE, 0.0f);
+        ChannelStripBank::ModBuffers mods[N] = { };
+        mods[0][ChannelStripBank::MOD_LPF_CUTOFF] = ramp.data();
+        EtherAudioBuffer buffer{ };
+        EtherAudioBuffer* ptrs[N] = { };
+        ptrs[0] = &buffer;
+        float phase = 0.0f, maxStep = 0.0f, prev = 0.0f;
+        bool finite = true;
+        for (int block = 0; block < 200; ++block) {
+            for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+                ramp[i] = (block / 10) % 2 ? 3.0f : -1.0f;
+                buffer[i] = AudioFrame(std::sin(phase), std::sin(phase));
+                phase += 2.0f * static_cast<float>(M_PI) * 2000.0f / SR;
+            }
+            bank.processBlock(ptrs, mods, BUFFER_SIZE, 32);
+            for (auto& frame : buffer) {
+                finite = finite && std::isfinite(frame.left);
+                if (block > 0) maxStep = std::max(maxStep, std::fabs(frame.left - prev));
+                prev = frame.left;
+            }
+        }
+        // A 2 kHz sine at up to ~4x gain moves at most ~0.26*4 per sample
+        std::cout << "(max step " << maxStep << ") ";
+        report(finite && maxStep < 1.5f);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL CHANNEL STRIP BANK TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -270,6 +270,44 @@ int main() {
         allTestsPassed = false;
     }
     
+    // Test interleaved stereo crossfade (in place into engine B)
+    std::cout << "Testing interleaved block crossfade... ";
+    try {
+        EngineCrossfader crossfader;
+        crossfader.initialize(SAMPLE_RATE, 10.0f);
+        crossfader.startCrossfadeToB();
+        
+        const int FRAMES = 64;
+        float engineA[FRAMES * 2];
+        float engineB[FRAMES * 2];
+        bool smooth = true;
+        float previousLeft = 1.0f;
+        
+        // 10ms at 44.1kHz is ~441 frames: run well past the end of the fade
+        for (int block = 0; block < 12; block++) {
+            for (int i = 0; i < FRAMES * 2; i++) {
+                engineA[i] = 1.0f;
+                engineB[i] = (i & 1) ? -0.5f : 0.5f; // left 0.5, right -0.5
+            }
+            crossfader.processInterleavedBlock(engineA, engineB, engineB, FRAMES, 2);
+            for (int i = 0; i < FRAMES; i++) {
+                if (std::abs(engineB[i * 2] - previousLeft) > 0.05f) smooth = false;
+                previousLeft = engineB[i * 2];
+            }
+        }
+        
+        if (smooth && std::abs(engineB[0] - 0.5f) < 0.01f && std::abs(engineB[1] + 0.5f) < 0.01f &&
+            crossfader.getCurrentState() == EngineCrossfader::CrossfadeState::ENGINE_B_ONLY) {
+            std::cout << "PASS (ended on engine B without steps)\n";
+        } else {
+            std::cout << "FAIL (discontinuity or wrong end state)\n";
+            allTestsPassed = false;
+        }
+    } catch (const std::exception& e) {
+        std::cout << "FAIL (exception: " << e.what() << ")\n";
+        allTestsPassed = false;
+    }
+    
     // Overall result
     std::cout << "\n";
     if (allTestsPassed) {
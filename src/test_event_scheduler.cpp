@@ -0,0 +1,179 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include "sequencer/EventScheduler.h"
+
+static SequencerEvent makeEvent(uint64_t time, SequencerEvent::Type type, int note) {
+    SequencerEvent ev;
+    ev.time = time;
+    ev.type = type;
+    ev.note = static_cast<int16_t>(note);
+    return ev;
+}
+
+int main() {
+    std::cout << "EtherSynth Event Scheduler Test\n";
+    std::cout << "===============================\n";
+
+    const uint32_t BLOCK = 128;
+    bool allTestsPassed = true;
+
+    // Events posted from the control side come out at exact offsets
+    std::cout << "Testing sample-accurate offsets... ";
+    {
+        EventScheduler scheduler;
+        scheduler.setSampleRate(48000.0);
+        scheduler.post(makeEvent(37, SequencerEvent::Type::NOTE_ON, 60));
+        scheduler.post(makeEvent(128 + 5, SequencerEvent::Type::NOTE_ON, 62));
+
+        SequencerEvent ev;
+        uint32_t offset = 0;
+        std::vector<uint32_t> offsets;
+        std::vector<int> blocks;
+        for (int block = 0; block < 3; ++block) {
+            scheduler.beginBlock(BLOCK);
+            while (scheduler.popDue(ev, offset)) { offsets.push_back(offset); blocks.push_back(block); }
+            scheduler.endBlock();
+        }
+        if (offsets.size() == 2 && offsets[0] == 37 && blocks[0] == 0 && offsets[1] == 5 && blocks[1] == 1) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Ordering: by time, then note-off before note-on at the same sample
+    std::cout << "Testing event ordering... ";
+    {
+        EventScheduler scheduler;
+        scheduler.post(makeEvent(90, SequencerEvent::Type::NOTE_ON, 3));
+        scheduler.post(makeEvent(10, SequencerEvent::Type::NOTE_ON, 1));
+        scheduler.post(makeEvent(50, SequencerEvent::Type::NOTE_ON, 2));
+        scheduler.post(makeEvent(50, SequencerEvent::Type::NOTE_OFF, 0));
+
+        SequencerEvent ev;
+        uint32_t offset = 0;
+        std::vector<int> notes;
+        scheduler.beginBlock(BLOCK);
+        while (scheduler.popDue(ev, offset)) notes.push_back(ev.note);
+        scheduler.endBlock();
+        if (notes == std::vector<int>{1, 0, 2, 3}) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Audio-side scheduling (ratchets / note-offs) without the inbox
+    std::cout << "Testing audio-side scheduling... ";
+    {
+        EventScheduler scheduler;
+        SequencerEvent ev;
+        uint32_t offset = 0;
+        scheduler.beginBlock(BLOCK);
+        scheduler.schedule(makeEvent(200, SequencerEvent::Type::NOTE_OFF, 60));
+        bool prematurelyDue = scheduler.popDue(ev, offset);
+        scheduler.endBlock();
+        scheduler.beginBlock(BLOCK);
+        bool due = scheduler.popDue(ev, offset);
+        scheduler.endBlock();
+        if (!prematurelyDue && due && offset == 72 && ev.type == SequencerEvent::Type::NOTE_OFF) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Late events are delivered at offset 0 and counted
+    std::cout << "Testing late event handling... ";
+    {
+        EventScheduler scheduler;
+        scheduler.beginBlock(BLOCK);
+        scheduler.endBlock();
+        scheduler.post(makeEvent(3, SequencerEvent::Type::NOTE_ON, 60));
+        SequencerEvent ev;
+        uint32_t offset = 99;
+        scheduler.beginBlock(BLOCK);
+        bool due = scheduler.popDue(ev, offset);
+        scheduler.endBlock();
+        if (due && offset == 0 && scheduler.getLateCount() == 1) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Flush drops everything pending
+    std::cout << "Testing flush... ";
+    {
+        EventScheduler scheduler;
+        scheduler.post(makeEvent(10, SequencerEvent::Type::NOTE_ON, 60));
+        scheduler.beginBlock(BLOCK);
+        scheduler.endBlock();
+        scheduler.post(makeEvent(500, SequencerEvent::Type::NOTE_ON, 61));
+        scheduler.requestFlush();
+        SequencerEvent ev;
+        uint32_t offset = 0;
+        int delivered = 0;
+        for (int block = 0; block < 8; ++block) {
+            scheduler.beginBlock(BLOCK);
+            while (scheduler.popDue(ev, offset)) delivered++;
+            scheduler.endBlock();
+        }
+        if (delivered == 0 && scheduler.getPendingCount() == 0) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL (delivered " << delivered << ")\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Producer/consumer on separate threads: nothing lost, nothing reordered
+    std::cout << "Testing concurrent producer... ";
+    {
+        EventScheduler scheduler;
+        const int COUNT = 4000;
+        std::thread producer([&]() {
+            for (int i = 0; i < COUNT; ++i) {
+                while (!scheduler.post(makeEvent(static_cast<uint64_t>(i) * 3, SequencerEvent::Type::NOTE_ON, i & 127))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        SequencerEvent ev;
+        uint32_t offset = 0;
+        int received = 0;
+        uint64_t lastTime = 0;
+        bool ordered = true;
+        for (int block = 0; block < 200000 && received < COUNT; ++block) {
+            scheduler.beginBlock(BLOCK);
+            while (scheduler.popDue(ev, offset)) {
+                if (ev.time < lastTime) ordered = false;
+                lastTime = ev.time;
+                received++;
+            }
+            scheduler.endBlock();
+            if (block % 4 == 0) std::this_thread::yield();
+        }
+        producer.join();
+        if (received == COUNT && ordered) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL (received " << received << ")\n";
+            allTestsPassed = false;
+        }
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL EVENT SCHEDULER TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include "audio/FFT.h"
+
+// Reference O(N^2) DFT
+static void referenceDFT(const std::vector<double>& inRe, const std::vector<double>& inIm,
+                         std::vector<double>& outRe, std::vector<double>& outIm) {
+    const size_t n = inRe.size();
+    outRe.assign(n, 0.0);
+    outIm.assign(n, 0.0);
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t t = 0; t < n; ++t) {
+            double angle = -2.0 * M_PI * double(k * t % n) / double(n);
+            outRe[k] += inRe[t] * std::cos(angle) - inIm[t] * std::sin(angle);
+            outIm[k] += inRe[t] * std::sin(angle) + inIm[t] * std::cos(angle);
+        }
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth FFT Test\n";
+    std::cout << "===================\n";
+
+    bool allTestsPassed = true;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    for (int size : {4, 8, 16, 64, 256, 1024, 4096}) {
+        FFT fft;
+        if (!fft.setSize(size)) {
+            std::cout << "Plan for size " << size << "... FAIL\n";
+            allTestsPassed = false;
+            continue;
+        }
+
+        std::vector<float> re(size), im(size), real(size);
+        std::vector<double> refInRe(size), refInIm(size), refRe, refIm;
+        for (int i = 0; i < size; ++i) {
+            re[i] = dist(rng);
+            im[i] = dist(rng);
+            real[i] = dist(rng);
+        }
+
+        // Complex forward vs reference
+        std::cout << "Testing complex FFT (N=" << size << ")... ";
+        for (int i = 0; i < size; ++i) { refInRe[i] = re[i]; refInIm[i] = im[i]; }
+        referenceDFT(refInRe, refInIm, refRe, refIm);
+        std::vector<float> origRe = re, origIm = im;
+        fft.forwardComplex(re.data(), im.data());
+        double maxError = 0.0;
+        for (int i = 0; i < size; ++i) {
+            maxError = std::max(maxError, std::abs(re[i] - refRe[i]));
+            maxError = std::max(maxError, std::abs(im[i] - refIm[i]));
+        }
+        fft.inverseComplex(re.data(), im.data());
+        double roundTrip = 0.0;
+        for (int i = 0; i < size; ++i) {
+            roundTrip = std::max(roundTrip, double(std::abs(re[i] - origRe[i])));
+            roundTrip = std::max(roundTrip, double(std::abs(im[i] - origIm[i])));
+        }
+        if (maxError < 1e-4 * size && roundTrip < 1e-5) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL (error " << maxError << ", round trip " << roundTrip << ")\n";
+            allTestsPassed = false;
+        }
+
+        // Real forward vs reference
+        std::cout << "Testing real FFT (N=" << size << ")... ";
+        for (int i = 0; i < size; ++i) { refInRe[i] = real[i]; refInIm[i] = 0.0; }
+        referenceDFT(refInRe, refInIm, refRe, refIm);
+        std::vector<float> binRe(fft.getNumBins()), binIm(fft.getNumBins()), back(size);
+        fft.forwardReal(real.data(), binRe.data(), binIm.data());
+        maxError = 0.0;
+        for (int k = 0; k < fft.getNumBins(); ++k) {
+            maxError = std::max(maxError, std::abs(binRe[k] - refRe[k]));
+            maxError = std::max(maxError, std::abs(binIm[k] - refIm[k]));
+        }
+        fft.inverseReal(binRe.data(), binIm.data(), back.data());
+        roundTrip = 0.0;
+        for (int i = 0; i < size; ++i) {
+            roundTrip = std::max(roundTrip, double(std::abs(back[i] - real[i])));
+        }
+        if (maxError < 1e-4 * size && roundTrip < 1e-5) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL (error " << maxError << ", round trip " << roundTrip << ")\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Invalid sizes are rejected
+    std::cout << "Testing invalid sizes... ";
+    {
+        FFT fft;
+        if (!fft.setSize(0) && !fft.setSize(100) && !fft.setSize(2) && !fft.isValid()) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL FFT TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
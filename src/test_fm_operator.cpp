@@ -0,0 +1,118 @@
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include "audio/FMOperator.h"
+#include "audio/SIMDOptimizations.h"
+
+namespace {
+    using EtherSynthSIMD::SIMD::LaneVec;
+    using EtherSynthSIMD::SIMD::sinCycles;
+    using EtherSynthSIMD::SIMD::sinCyclesLanes;
+
+    constexpr double TWO_PI = 6.283185307179586;
+
+    FMOperator makeOperator(FMOperator::Waveform waveform, float frequency) {
+        FMOperator op;
+        op.initialize(48000.0f);
+        op.setWaveform(waveform);
+        op.setFrequency(frequency);
+        return op;
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth FM Operator Test\n";
+    std::cout << "===========================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    std::cout << "Testing sinCycles against std::sin across deep FM phases... ";
+    {
+        double worst = 0.0;
+        for (int i = -200000; i <= 200000; ++i) {
+            const float x = i * 0.0000213f;     // About -4..4 cycles: the reach of deep FM
+            worst = std::max(worst, std::fabs(sinCycles(x) - std::sin(TWO_PI * x)));
+        }
+        report(worst < 3e-6);
+    }
+
+    std::cout << "Testing lanes match the scalar kernel... ";
+    {
+        bool ok = true;
+        float in[LaneVec::WIDTH], out[LaneVec::WIDTH];
+        for (int i = 0; ok && i < 20000; i += LaneVec::WIDTH) {
+            for (int lane = 0; lane < LaneVec::WIDTH; ++lane) in[lane] = (i + lane - 10000) * 0.00371f;
+            sinCyclesLanes(LaneVec::load(in)).store(out);
+            for (int lane = 0; lane < LaneVec::WIDTH; ++lane) ok = ok && out[lane] == sinCycles(in[lane]);
+        }
+        report(ok);
+    }
+
+    std::cout << "Testing sine operator follows deep phase modulation... ";
+    {
+        FMOperator op = makeOperator(FMOperator::Waveform::SINE, 440.0f);
+        double worst = 0.0;
+        for (int i = 0; i < 4800; ++i) {
+            const float modulation = 25.0f * std::sin(i * 0.01f);    // Several cycles either way
+            const double expected = std::sin(static_cast<double>(op.getCurrentPhase()) + modulation);
+            worst = std::max(worst, std::fabs(op.processSample(modulation) - expected));
+        }
+        report(worst < 1e-5);
+    }
+
+    std::cout << "Testing PolyBLEP saw and square stay bounded and centred... ";
+    {
+        bool ok = true;
+        for (auto waveform : {FMOperator::Waveform::SAW_APPROX, FMOperator::Waveform::SQUARE_APPROX}) {
+            FMOperator op = makeOperator(waveform, 1000.0f);     // 48 samples per cycle
+            double sum = 0.0;
+            float peak = 0.0f;
+            for (int i = 0; i < 48000; ++i) {
+                const float out = op.processSample();
+                sum += out;
+                peak = std::max(peak, std::fabs(out));
+            }
+            ok = ok && peak <= 1.0f + 1e-5f && peak > 0.9f && std::fabs(sum / 48000.0) < 0.01;
+        }
+        report(ok);
+    }
+
+    std::cout << "Testing PolyBLEP smooths the saw's edge... ";
+    {
+        // A naive ramp jumps by 2 across the wrap; the corrected one splits it over two samples
+        FMOperator op = makeOperator(FMOperator::Waveform::SAW_APPROX, 1000.0f);
+        float last = op.processSample(), biggest = 0.0f;
+        for (int i = 0; i < 480; ++i) {
+            const float out = op.processSample();
+            biggest = std::max(biggest, std::fabs(out - last));
+            last = out;
+        }
+        report(biggest < 1.5f && biggest > 0.5f);
+    }
+
+    std::cout << "Testing triangle keeps the sine's shape... ";
+    {
+        FMOperator tri = makeOperator(FMOperator::Waveform::TRIANGLE_APPROX, 750.0f);   // 64 samples per cycle
+        bool ok = true;
+        for (int i = 0; i < 64; ++i) {
+            const float out = tri.processSample();
+            if (i == 0) ok = ok && std::fabs(out) < 1e-6f;
+            if (i == 16) ok = ok && std::fabs(out - 1.0f) < 1e-5f;
+            if (i == 48) ok = ok && std::fabs(out + 1.0f) < 1e-5f;
+        }
+        report(ok);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL FM OPERATOR TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "core/JsonStream.h"
+
+namespace {
+    constexpr JsonKey kKeys[] = {
+        {"hold_params", 0}, {"twist_params", 1}, {"morph_params", 2}, {"fx_params", 3},
+        {"filter_cutoff", 10}, {"filter_resonance", 11}, {"env_attack", 12}, {"pan", 13}
+    };
+    constexpr auto kKeyMap = makeJsonKeyMap(kKeys);
+    static_assert(kKeyMap.find("env_attack") == 12, "perfect hash resolves at compile time");
+}
+
+int main() {
+    std::cout << "EtherSynth JSON Stream Test\n";
+    std::cout << "===========================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    std::cout << "Testing pull reader walks nested document... ";
+    {
+        JsonReader reader(R"({"name": "Pad", "params": {"cutoff": 0.5, "res": -1.25e-1},
+                              "tags": ["a", "b"], "enabled": true, "extra": null})");
+        std::string name;
+        float cutoff = 0, res = 0;
+        bool enabled = false;
+        std::vector<std::string> tags;
+        std::string_view key;
+        bool ok = reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (key == "name") {
+                reader.readString(name);
+            } else if (key == "params") {
+                reader.beginObject();
+                while (reader.nextMember(key)) {
+                    reader.readFloat(key == "cutoff" ? cutoff : res);
+                }
+            } else if (key == "tags") {
+                reader.beginArray();
+                while (reader.nextElement()) {
+                    tags.emplace_back();
+                    reader.readString(tags.back());
+                }
+            } else if (key == "enabled") {
+                reader.readBool(enabled);
+            } else {
+                ok = ok && reader.peek() == JsonReader::Type::NULL_VALUE && reader.skipValue();
+            }
+        }
+        ok = ok && !reader.hasError() && reader.atEnd();
+        ok = ok && name == "Pad" && cutoff == 0.5f && res == -0.125f && enabled && tags == std::vector<std::string>{"a", "b"};
+        report(ok);
+    }
+
+    std::cout << "Testing skipValue over unknown subtrees... ";
+    {
+        JsonReader reader(R"({"skip": {"a": [1, {"b": [[], {}]}, "}"], "c": "]"}, "keep": 7})");
+        std::string_view key;
+        int64_t keep = 0;
+        reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (key == "keep") {
+                reader.readInt(keep);
+            } else {
+                reader.skipValue();
+            }
+        }
+        report(!reader.hasError() && keep == 7);
+    }
+
+    std::cout << "Testing string escapes and unicode... ";
+    {
+        JsonReader reader(R"(["plain", "q\"b\\s\/n\n", "\u00e9\u20ac", "\ud83c\udfb9"])");
+        std::string values[4];
+        reader.beginArray();
+        for (auto& value : values) {
+            reader.nextElement();
+            reader.readString(value);
+        }
+        bool ok = !reader.nextElement() && !reader.hasError();
+        ok = ok && values[0] == "plain" && values[1] == "q\"b\\s/n\n";
+        ok = ok && values[2] == "\xC3\xA9\xE2\x82\xAC" && values[3] == "\xF0\x9F\x8E\xB9";
+        report(ok);
+    }
+
+    std::cout << "Testing number parsing... ";
+    {
+        JsonReader reader("[0, -0.5, 440, 1e3, 2.5E-3, 123456789012, 0.1, 3.4028234e38]");
+        const double expected[] = {0.0, -0.5, 440.0, 1000.0, 0.0025, 123456789012.0, 0.1, 3.4028234e38};
+        bool ok = reader.beginArray();
+        for (double want : expected) {
+            double got = -1;
+            ok = ok && reader.nextElement() && reader.readNumber(got) && got == want;
+        }
+        ok = ok && !reader.nextElement() && !reader.hasError();
+        report(ok);
+    }
+
+    // Malformed documents stop the reader and report where
+    std::cout << "Testing strict syntax errors... ";
+    {
+        const char* bad[] = {
+            R"({"a": 1,})", R"({"a" 1})", R"([1 2])", R"({"a": tru})", R"({"a": "unterminated)",
+            R"({"a": 01x})", R"(["\x"])", R"({"a": -})", R"([1,,2])"
+        };
+        bool ok = true;
+        for (const char* text : bad) {
+            JsonReader reader(text);
+            bool parsed = reader.skipValue() && reader.atEnd();
+            ok = ok && !parsed;
+        }
+        JsonReader trailing(R"({"a": 1,})");
+        trailing.skipValue();
+        ok = ok && trailing.hasError() && trailing.getErrorOffset() == 8;
+        report(ok);
+    }
+
+    std::cout << "Testing compile-time key map... ";
+    {
+        bool ok = true;
+        for (const auto& key : kKeys) ok = ok && kKeyMap.find(key.name) == key.id;
+        ok = ok && kKeyMap.find("filter") == kKeyMap.NOT_FOUND && kKeyMap.find("") == kKeyMap.NOT_FOUND;
+        ok = ok && kKeyMap.find("pan ") == kKeyMap.NOT_FOUND && kKeyMap.find("PAN") == kKeyMap.NOT_FOUND;
+        report(ok);
+    }
+
+    std::cout << "Testing writer round trip... ";
+    {
+        std::string out;
+        JsonWriter writer(out);
+        writer.beginObject();
+        writer.member("name", "Lead \"A\"\n");
+        writer.member("gain", 0.1f);
+        writer.member("third", 1.0f / 3.0f);
+        writer.member("time", uint64_t{1700000000123ull});
+        writer.key("tags");
+        writer.beginArray(true);
+        writer.value("x");
+        writer.value("y");
+        writer.endArray();
+        writer.key("empty");
+        writer.beginObject();
+        writer.endObject();
+        writer.member("on", false);
+        writer.endObject();
+
+        bool ok = out.find("\"tags\": [\"x\", \"y\"]") != std::string::npos;
+        ok = ok && out.find("\"name\": \"Lead \\\"A\\\"\\n\"") != std::string::npos;
+        ok = ok && out.find("\"gain\": 0.1,") != std::string::npos;
+
+        JsonReader reader(out);
+        std::string_view key;
+        std::string name;
+        float gain = 0, third = 0;
+        int64_t time = 0;
+        bool on = true;
+        reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (key == "name") reader.readString(name);
+            else if (key == "gain") reader.readFloat(gain);
+            else if (key == "third") reader.readFloat(third);
+            else if (key == "time") reader.readInt(time);
+            else if (key == "on") reader.readBool(on);
+            else reader.skipValue();
+        }
+        ok = ok && !reader.hasError() && reader.atEnd();
+        ok = ok && name == "Lead \"A\"\n" && gain == 0.1f && third == 1.0f / 3.0f && time == 1700000000123ll && !on;
+        report(ok);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL JSON STREAM TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,198 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include "modulation/GlobalLFOSystem.h"
+
+using Waveform = GlobalLFOSystem::Waveform;
+using SyncMode = GlobalLFOSystem::SyncMode;
+
+static constexpr float SAMPLE_RATE_HZ = 48000.0f;
+static constexpr int FRAMES = 128;
+
+static GlobalLFOSystem::LFOSettings lfoSettings(Waveform wave, float rateHz, float depth = 1.0f) {
+    GlobalLFOSystem::LFOSettings settings;
+    settings.wave = wave;
+    settings.rateHz = rateHz;
+    settings.depth = depth;
+    settings.pulseWidth = 0.3f;
+    return settings;
+}
+
+int main() {
+    std::cout << "EtherSynth LFO Control-Rate Test\n";
+    std::cout << "================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    // Control points land on the same values as the block-rate path
+    std::cout << "Testing control points match stepBlock... ";
+    {
+        bool ok = true;
+        const Waveform waves[] = {Waveform::Sine, Waveform::Tri, Waveform::SawUp, Waveform::SawDown,
+                                  Waveform::Square, Waveform::Pulse, Waveform::Noise};
+        GlobalLFOSystem block, control;
+        block.init(SAMPLE_RATE_HZ, 120.0f);
+        control.init(SAMPLE_RATE_HZ, 120.0f);
+        control.setControlInterval(FRAMES);
+        for (int i = 0; i < 7; i++) {
+            block.setLFO(3, i, lfoSettings(waves[i], 0.7f + 1.3f * i, 0.8f));
+            control.setLFO(3, i, lfoSettings(waves[i], 0.7f + 1.3f * i, 0.8f));
+        }
+        for (int b = 0; b < 500; b++) {
+            block.stepBlock(3, FRAMES);
+            control.renderBlock(3, FRAMES);
+            for (int i = 0; i < 7; i++) {
+                float diff = std::fabs(block.getLFOValue(3, i) - control.getLFOValue(3, i));
+                // Square edges may land either side of a phase rounding difference
+                ok = ok && (diff < 1e-3f || (waves[i] >= Waveform::Square && diff > 1.5f));
+            }
+        }
+        report(ok);
+    }
+
+    // Audio rate: every sample is the exact LFO value
+    std::cout << "Testing audio-rate sine... ";
+    {
+        GlobalLFOSystem lfo;
+        lfo.init(SAMPLE_RATE_HZ, 120.0f);
+        lfo.setControlInterval(1);
+        lfo.setLFO(0, 2, lfoSettings(Waveform::Sine, 7.0f));
+        float out[FRAMES];
+        float worst = 0.0f;
+        for (int b = 0; b < 100; b++) {
+            lfo.renderBlock(0, FRAMES);
+            lfo.renderLFOBuffer(0, 2, out, FRAMES);
+            for (int i = 0; i < FRAMES; i++) {
+                double t = (b * FRAMES + i + 1) / SAMPLE_RATE_HZ;
+                worst = std::max(worst, static_cast<float>(std::fabs(out[i] - std::sin(2.0 * M_PI * 7.0 * t))));
+            }
+        }
+        report(worst < 1e-3f);
+    }
+
+    // Sub-block ramps: no per-block stairs on a fast LFO, combined with depths
+    std::cout << "Testing sub-block parameter ramps... ";
+    {
+        GlobalLFOSystem lfo;
+        lfo.init(SAMPLE_RATE_HZ, 120.0f);
+        lfo.setControlInterval(16);
+        lfo.setLFO(1, 0, lfoSettings(Waveform::Sine, 20.0f));
+        lfo.setLFO(1, 1, lfoSettings(Waveform::Tri, 3.0f));
+        lfo.assign(1, static_cast<int>(ParameterID::FILTER_CUTOFF), 0, 0.5f);
+        lfo.assign(1, static_cast<int>(ParameterID::FILTER_CUTOFF), 1, 0.25f);
+        float out[FRAMES];
+        float previous = 0.0f, largestStep = 0.0f;
+        bool ok = !lfo.renderParamBuffer(1, static_cast<int>(ParameterID::TIMBRE), out, FRAMES);
+        for (int b = 0; b < 200; b++) {
+            lfo.renderBlock(1, FRAMES);
+            ok = ok && lfo.renderParamBuffer(1, static_cast<int>(ParameterID::FILTER_CUTOFF), out, FRAMES);
+            for (int i = 0; i < FRAMES; i++) {
+                // The first segment ramps in from the idle value
+                if (b > 0) largestStep = std::max(largestStep, std::fabs(out[i] - previous));
+                previous = out[i];
+            }
+            ok = ok && std::fabs(out[FRAMES - 1] - lfo.combinedValue(1, static_cast<int>(ParameterID::FILTER_CUTOFF))) < 1e-5f;
+        }
+        // 20 Hz at half depth moves at most 2*pi*20*0.5/48000 per sample (+ tri)
+        ok = ok && largestStep < 0.0015f;
+        report(ok);
+    }
+
+    std::cout << "Testing envelope and one-shot ramps... ";
+    {
+        GlobalLFOSystem lfo;
+        lfo.init(SAMPLE_RATE_HZ, 120.0f);
+        lfo.setControlInterval(32);
+        auto env = lfoSettings(Waveform::Sine, 1.0f);
+        env.sync = SyncMode::Envelope;
+        env.envA = 0.01f;
+        lfo.setLFO(0, 0, env);
+        auto oneShot = lfoSettings(Waveform::SawUp, 100.0f);
+        oneShot.sync = SyncMode::OneShot;
+        lfo.setLFO(0, 1, oneShot);
+        lfo.retrigger(0);
+        float out[FRAMES];
+        lfo.renderBlock(0, FRAMES);
+        lfo.renderLFOBuffer(0, 0, out, FRAMES);
+        bool ok = std::fabs(out[31] - 32.0f / 480.0f) < 1e-4f && std::fabs(out[15] - 16.0f / 480.0f) < 1e-4f;
+        for (int b = 0; b < 4; b++) lfo.renderBlock(0, FRAMES);
+        ok = ok && !lfo.isActive(0, 1) && lfo.getLFOValue(0, 1) == 0.0f;
+        report(ok);
+    }
+
+    // 8 LFOs x 16 slots, one evaluation per LFO per block on both sides, against
+    // the bridge's former scalar loop; the 32-sample sub-block cost is reported
+    std::cout << "Testing control-rate cost... ";
+    {
+        struct ScalarLFO { int waveform; float rateHz; float depth; float phase; float lastValue; };
+        ScalarLFO scalar[GlobalLFOSystem::MAX_SLOTS][GlobalLFOSystem::MAX_LFOS];
+        GlobalLFOSystem lfo, subBlock;
+        lfo.init(SAMPLE_RATE_HZ, 120.0f);
+        subBlock.init(SAMPLE_RATE_HZ, 120.0f);
+        lfo.setControlInterval(FRAMES);
+        for (int s = 0; s < GlobalLFOSystem::MAX_SLOTS; s++) {
+            for (int i = 0; i < GlobalLFOSystem::MAX_LFOS; i++) {
+                const int waves[] = {0, 1, 4, 0, 2, 0, 1, 5};
+                scalar[s][i] = {waves[i] == 2 ? 0 : waves[i], 0.5f + i, 0.7f, 0.0f, 0.0f};
+                lfo.setLFO(s, i, lfoSettings(static_cast<Waveform>(waves[i]), 0.5f + i, 0.7f));
+                subBlock.setLFO(s, i, lfoSettings(static_cast<Waveform>(waves[i]), 0.5f + i, 0.7f));
+            }
+        }
+        // Best of several runs, so a busy machine does not decide the result
+        auto timeUs = [](auto&& render) {
+            const int blocks = 4000;
+            double best = 1e9;
+            for (int run = 0; run < 5; run++) {
+                auto start = std::chrono::steady_clock::now();
+                for (int b = 0; b < blocks; b++) render();
+                best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / blocks);
+            }
+            return best;
+        };
+        volatile float sink = 0.0f;
+        double scalarUs = timeUs([&] {
+            for (int s = 0; s < GlobalLFOSystem::MAX_SLOTS; s++) {
+                for (int i = 0; i < GlobalLFOSystem::MAX_LFOS; i++) {
+                    auto& l = scalar[s][i];
+                    float inc = 2.0f * static_cast<float>(M_PI) * std::max(0.01f, l.rateHz) / SAMPLE_RATE_HZ;
+                    l.phase += inc * static_cast<float>(FRAMES);
+                    if (l.phase > 2.0f * static_cast<float>(M_PI)) l.phase -= 2.0f * static_cast<float>(M_PI);
+                    float v = 0.0f;
+                    switch (l.waveform) {
+                        case 0: v = std::sin(l.phase); break;
+                        case 1: v = 4.0f * std::fabs(std::fmod(l.phase / (2.0f * static_cast<float>(M_PI)), 1.0f) - 0.5f) - 1.0f; break;
+                        case 4: v = (std::sin(l.phase) >= 0.0f) ? 1.0f : -1.0f; break;
+                        default: v = std::sin(l.phase); break;
+                    }
+                    l.lastValue = v * std::clamp(l.depth, 0.0f, 1.0f);
+                }
+            }
+            sink = sink + scalar[3][5].lastValue;
+        });
+        double controlUs = timeUs([&] {
+            for (int s = 0; s < GlobalLFOSystem::MAX_SLOTS; s++) lfo.renderBlock(s, FRAMES);
+            sink = sink + lfo.getLFOValue(3, 5);
+        });
+        double subBlockUs = timeUs([&] {
+            for (int s = 0; s < GlobalLFOSystem::MAX_SLOTS; s++) subBlock.renderBlock(s, FRAMES);
+            sink = sink + subBlock.getLFOValue(3, 5);
+        });
+        std::cout << "(scalar " << scalarUs << " us, SIMD " << controlUs << " us, 32-sample sub-blocks "
+                  << subBlockUs << " us per block) ";
+        report(controlUs < scalarUs);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL LFO CONTROL-RATE TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
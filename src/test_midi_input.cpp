@@ -0,0 +1,269 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <unistd.h>
+#include "midi/MIDIInputQueue.h"
+#include "midi/LinuxMIDIInput.h"
+#include "sequencer/EventScheduler.h"
+
+namespace {
+    constexpr double RATE = 48000.0;
+    constexpr uint32_t BLOCK = 128;
+    constexpr uint64_t BLOCK_NS = static_cast<uint64_t>(BLOCK * 1e9 / RATE);   // 2.67 ms
+
+    std::vector<TimedMIDIMessage> parse(const std::vector<uint8_t>& bytes) {
+        MIDIByteParser parser;
+        std::vector<TimedMIDIMessage> out;
+        TimedMIDIMessage message;
+        for (uint8_t b : bytes) {
+            if (parser.feed(b, message)) out.push_back(message);
+        }
+        return out;
+    }
+
+    TimedMIDIMessage noteOn(uint64_t hostTimeNs, uint8_t note) {
+        TimedMIDIMessage m;
+        m.hostTimeNs = hostTimeNs;
+        m.status = 0x90;
+        m.data1 = note;
+        m.data2 = 100;
+        m.size = 3;
+        return m;
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth MIDI Input Test\n";
+    std::cout << "==========================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    std::cout << "Testing running status and realtime bytes inside messages... ";
+    {
+        // Note-on, two running-status notes with a clock byte between data bytes, then a CC
+        auto out = parse({0x90, 60, 100, 62, 0xF8, 90, 64, 0, 0xB1, 74, 127});
+        report(out.size() == 5 &&
+               out[0].status == 0x90 && out[0].data1 == 60 && out[0].data2 == 100 && out[0].size == 3 &&
+               out[1].status == 0xF8 && out[1].size == 1 &&   // Clock delivered where it arrived
+               out[2].status == 0x90 && out[2].data1 == 62 && out[2].data2 == 90 &&
+               out[3].status == 0x90 && out[3].data1 == 64 && out[3].data2 == 0 &&
+               out[4].status == 0xB1 && out[4].data1 == 74 && out[4].data2 == 127);
+    }
+
+    std::cout << "Testing SysEx is skipped and two-byte messages parse... ";
+    {
+        auto out = parse({0xF0, 0x7E, 0x00, 0x06, 0x01, 0xF7, 0xC2, 5, 6, 0xE0, 0x00, 0x40});
+        report(out.size() == 3 &&
+               out[0].status == 0xC2 && out[0].data1 == 5 && out[0].size == 2 &&
+               out[1].status == 0xC2 && out[1].data1 == 6 &&          // Running status
+               out[2].status == 0xE0 && out[2].data1 == 0x00 && out[2].data2 == 0x40);
+    }
+
+    std::cout << "Testing arrival spacing maps to sample offsets... ";
+    {
+        MIDIInputQueue queue;
+        queue.setSampleRate(RATE);
+        queue.setLatencySamples(BLOCK);
+        const uint64_t t0 = 1000000000ull;
+        queue.beginBlock(0, BLOCK, t0);
+        // Arrived during block 0: 0.5 ms and 1.5 ms after it started
+        queue.push(noteOn(t0 + 500000, 60));
+        queue.push(noteOn(t0 + 1500000, 62));
+        queue.beginBlock(BLOCK, BLOCK, t0 + BLOCK_NS);
+
+        TimedMIDIMessage m;
+        uint64_t a = 0, b = 0;
+        bool ok = queue.pop(m, a) && m.data1 == 60 && queue.pop(m, b) && m.data1 == 62 && !queue.pop(m, b);
+        // One block of latency, then 24 and 72 samples into the block
+        report(ok && a == BLOCK + 24 && b == BLOCK + 72);
+    }
+
+    std::cout << "Testing anchor rides out callback jitter... ";
+    {
+        MIDIInputQueue queue;
+        queue.setSampleRate(RATE);
+        queue.setLatencySamples(BLOCK);
+        const uint64_t t0 = 5000000000ull;
+        // Callbacks wake up to +-0.4 ms (19 samples) off their ideal time
+        double worst = 0.0;
+        for (int block = 0; block < 400; ++block) {
+            const int64_t jitter = (block % 3 == 0 ? 400000 : block % 3 == 1 ? -400000 : 0);
+            const uint64_t ideal = t0 + static_cast<uint64_t>(block) * BLOCK_NS;
+            queue.beginBlock(static_cast<uint64_t>(block) * BLOCK, BLOCK, ideal + jitter);
+            if (block < 100) continue;                                   // Settle
+            // A message that arrived exactly at the ideal block start lands exactly one block later
+            const double expected = static_cast<double>(block) * BLOCK + BLOCK;
+            worst = std::max(worst, std::fabs(static_cast<double>(queue.toSampleTime(ideal)) - expected));
+        }
+        report(worst <= 2.0);
+    }
+
+    std::cout << "Testing re-anchor after an xrun... ";
+    {
+        MIDIInputQueue queue;
+        queue.setSampleRate(RATE);
+        queue.setLatencySamples(BLOCK);
+        const uint64_t t0 = 1000000000ull;
+        for (int block = 0; block < 10; ++block) queue.beginBlock(block * BLOCK, BLOCK, t0 + block * BLOCK_NS);
+        // The stream stalled for 50 ms but the sample clock only advanced one block
+        const uint64_t late = t0 + 10 * BLOCK_NS + 50000000ull;
+        queue.beginBlock(10 * BLOCK, BLOCK, late);
+        report(queue.toSampleTime(late) == 11 * BLOCK);
+    }
+
+    std::cout << "Testing producer/consumer threads keep order without loss... ";
+    {
+        MIDIInputQueue queue;
+        const int count = 100000;
+        std::thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                TimedMIDIMessage m = noteOn(static_cast<uint64_t>(i), static_cast<uint8_t>(i & 0x7F));
+                while (!queue.push(m)) std::this_thread::yield();
+            }
+        });
+        int received = 0;
+        bool ordered = true;
+        TimedMIDIMessage m;
+        uint64_t time = 0;
+        while (received < count) {
+            if (queue.pop(m, time)) {
+                if (m.hostTimeNs != static_cast<uint64_t>(received) || m.data1 != (received & 0x7F)) ordered = false;
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        report(ordered && queue.getPendingCount() == 0);
+    }
+
+    std::cout << "Testing live MIDI keeps insertion order at equal times... ";
+    {
+        // A note tapped faster than one sample must not leave the note stuck
+        EventScheduler scheduler;
+        SequencerEvent on, off;
+        on.type = off.type = SequencerEvent::Type::MIDI_INPUT;
+        on.time = off.time = 40;
+        on.status = 0x90;
+        off.status = 0x80;
+        scheduler.beginBlock(BLOCK);
+        scheduler.schedule(on);
+        scheduler.schedule(off);
+        SequencerEvent first, second;
+        uint32_t offset = 0;
+        bool ok = scheduler.popDue(first, offset) && scheduler.popDue(second, offset);
+        scheduler.endBlock();
+        report(ok && first.status == 0x90 && second.status == 0x80);
+    }
+
+    // Loopback through the raw backend: a pipe stands in for /dev/snd/midiC*D* (snd-virmidi)
+    std::cout << "Testing pipe loopback lands events at their offsets... ";
+    {
+        int fds[2];
+        bool ok = pipe(fds) == 0;
+        MIDIInputQueue queue;
+        queue.setSampleRate(RATE);
+        queue.setLatencySamples(BLOCK);
+        LinuxMIDIInput input(queue);
+        ok = ok && input.openFd(fds[0]) && input.getBackend() == LinuxMIDIInput::Backend::RAW;
+
+        // Writer: note-on, then 8 ms later active sensing and the note-off as running status
+        uint64_t onWritten = 0, offWritten = 0;
+        std::thread writer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            const uint8_t on[] = {0x90, 60, 100};
+            onWritten = MIDIInputQueue::hostTimeNs();
+            ok = ok && write(fds[1], on, sizeof(on)) == sizeof(on);
+            std::this_thread::sleep_for(std::chrono::milliseconds(8));
+            const uint8_t off[] = {0xFE, 60, 0};
+            offWritten = MIDIInputQueue::hostTimeNs();
+            ok = ok && write(fds[1], off, sizeof(off)) == sizeof(off);
+        });
+
+        // Audio side: blocks paced in real time, like a sound card callback
+        EventScheduler scheduler;
+        scheduler.setSampleRate(RATE);
+        std::vector<SequencerEvent> delivered;
+        std::vector<uint64_t> deliveredAt;
+        const auto start = std::chrono::steady_clock::now();
+        for (int block = 0; block < 24; ++block) {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(block * BLOCK_NS));
+            scheduler.beginBlock(BLOCK);
+            queue.beginBlock(scheduler.now(), BLOCK, MIDIInputQueue::hostTimeNs());
+            TimedMIDIMessage m;
+            uint64_t time = 0;
+            while (queue.pop(m, time)) {
+                SequencerEvent ev;
+                ev.time = time;
+                ev.type = SequencerEvent::Type::MIDI_INPUT;
+                ev.status = m.status;
+                ev.note = m.data1;
+                ev.velocity = m.data2 / 127.0f;
+                scheduler.schedule(ev);
+            }
+            SequencerEvent ev;
+            uint32_t offset = 0;
+            while (scheduler.popDue(ev, offset)) {
+                delivered.push_back(ev);
+                deliveredAt.push_back(scheduler.now() + offset);
+            }
+            scheduler.endBlock();
+        }
+        writer.join();
+        ::close(fds[1]);
+        input.close();
+
+        ok = ok && delivered.size() == 2 && input.getMessageCount() == 2;
+        if (ok) {
+            // Spacing follows the writes to within a fraction of a block, even across block boundaries
+            const double written = (offWritten - onWritten) * RATE * 1e-9;
+            const double played = static_cast<double>(deliveredAt[1] - deliveredAt[0]);
+            ok = delivered[0].status == 0x90 && delivered[0].note == 60 && delivered[0].velocity > 0.0f &&
+                 delivered[1].status == 0x90 && delivered[1].velocity == 0.0f &&
+                 std::fabs(played - written) < BLOCK / 2;
+        }
+        report(ok);
+    }
+
+    std::cout << "Testing reader stops when the writer closes... ";
+    {
+        int fds[2];
+        bool ok = pipe(fds) == 0;
+        MIDIInputQueue queue;
+        LinuxMIDIInput input(queue);
+        ok = ok && input.openFd(fds[0]);
+        const uint8_t bytes[] = {0xB0, 7, 100};
+        ok = ok && write(fds[1], bytes, sizeof(bytes)) == sizeof(bytes);
+        ::close(fds[1]);
+        for (int i = 0; i < 200 && queue.getPendingCount() == 0; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        input.close();                                          // Joins without hanging
+        TimedMIDIMessage m;
+        uint64_t time = 0;
+        report(ok && queue.pop(m, time) && m.status == 0xB0 && m.data1 == 7 && m.data2 == 100 && !input.isOpen());
+    }
+
+    std::cout << "Testing bad addresses fail cleanly... ";
+    {
+        MIDIInputQueue queue;
+        LinuxMIDIInput input(queue);
+        bool missing = !input.open("raw:/nonexistent/midiC9D9") && !input.getLastError().empty();
+        bool unknown = !input.open("usb:whatever") && !input.isOpen();
+        report(missing && unknown);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL MIDI INPUT TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,170 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include "control/modulation/AdvancedModulationMatrix.h"
+
+using Matrix = AdvancedModulationMatrix;
+using Source = AdvancedModulationMatrix::ModSource;
+
+static constexpr size_t FRAMES = 128;
+
+// Heap allocations made while the counter is armed
+static bool countAllocations = false;
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    if (countAllocations) allocationCount++;
+    void* p = std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static bool near(float a, float b) { return std::fabs(a - b) < 1e-4f; }
+
+int main() {
+    std::cout << "EtherSynth Modulation Matrix Test\n";
+    std::cout << "=================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    std::cout << "Testing routing sums per destination... ";
+    {
+        Matrix matrix;
+        matrix.setSampleRate(48000.0f);
+        matrix.addModulation(Source::TOUCH_X, ParameterID::FILTER_CUTOFF, 0.5f);
+        matrix.addModulation(Source::TOUCH_Y, ParameterID::FILTER_CUTOFF, -0.25f);
+        uint32_t id = matrix.addModulation(Source::SMART_KNOB, ParameterID::VOLUME, 1.0f);
+        matrix.getModulationSlot(id)->bipolar = false;
+        matrix.commitRouting();
+        matrix.setSourceValue(Source::TOUCH_X, 0.8f);
+        matrix.setSourceValue(Source::TOUCH_Y, -0.4f);
+        matrix.setSourceValue(Source::SMART_KNOB, 0.0f);
+        matrix.processBlock(FRAMES);
+        bool ok = near(matrix.getModulation(ParameterID::FILTER_CUTOFF), 0.4f + 0.1f);
+        ok = ok && near(matrix.getModulatedValue(ParameterID::VOLUME, 0.2f), 0.7f);
+        ok = ok && near(matrix.getModulation(ParameterID::TIMBRE), 0.0f);
+        report(ok);
+    }
+
+    std::cout << "Testing conditions and global amount... ";
+    {
+        Matrix matrix;
+        uint32_t id = matrix.addModulation(Source::TOUCH_X, ParameterID::TIMBRE, 1.0f);
+        matrix.getModulationSlot(id)->condition = Source::AFTERTOUCH;
+        matrix.getModulationSlot(id)->conditionThreshold = 0.5f;
+        matrix.commitRouting();
+        matrix.setSourceValue(Source::TOUCH_X, 0.6f);
+        matrix.setSourceValue(Source::AFTERTOUCH, 0.2f);
+        matrix.processBlock(FRAMES);
+        bool ok = near(matrix.getModulation(ParameterID::TIMBRE), 0.0f);
+        matrix.setSourceValue(Source::AFTERTOUCH, 0.9f);
+        matrix.setGlobalModulationAmount(0.5f);
+        matrix.processBlock(FRAMES);
+        ok = ok && near(matrix.getModulation(ParameterID::TIMBRE), 0.3f);
+        matrix.getModulationSlot(id)->conditionInvert = true;
+        matrix.commitRouting();
+        matrix.processBlock(FRAMES);
+        ok = ok && near(matrix.getModulation(ParameterID::TIMBRE), 0.0f);
+        report(ok);
+    }
+
+    std::cout << "Testing macros... ";
+    {
+        Matrix matrix;
+        matrix.defineMacro(Source::MACRO_1, {{Source::TOUCH_X, 0.5f}, {Source::TOUCH_Y, 0.5f}});
+        matrix.defineMacro(Source::MACRO_2, {{Source::MACRO_1, 2.0f}});
+        matrix.addModulation(Source::MACRO_2, ParameterID::MORPH, 1.0f);
+        matrix.setSourceValue(Source::TOUCH_X, 0.2f);
+        matrix.setSourceValue(Source::TOUCH_Y, 0.4f);
+        matrix.processBlock(FRAMES);
+        bool ok = near(matrix.getSourceValue(Source::MACRO_1), 0.3f);
+        ok = ok && near(matrix.getModulation(ParameterID::MORPH), 0.6f);
+        matrix.clearMacro(Source::MACRO_1);
+        matrix.processBlock(FRAMES);
+        ok = ok && near(matrix.getModulation(ParameterID::MORPH), 0.6f);   // Holds its last value
+        report(ok);
+    }
+
+    // One-pole lag; state survives unrelated edits and starts at zero for new slots
+    std::cout << "Testing smoothing across table swaps... ";
+    {
+        Matrix matrix;
+        matrix.setSampleRate(48000.0f);
+        uint32_t id = matrix.addModulation(Source::TOUCH_X, ParameterID::DETUNE, 1.0f);
+        matrix.getModulationSlot(id)->responseTime = 0.1f;
+        matrix.commitRouting();
+        matrix.setSourceValue(Source::TOUCH_X, 1.0f);
+        for (int b = 0; b < 10; b++) matrix.processBlock(FRAMES);
+        float settled = matrix.getModulation(ParameterID::DETUNE);
+        bool ok = settled > 0.1f && settled < 0.9f;
+
+        matrix.addModulation(Source::TOUCH_Y, ParameterID::SUB_LEVEL, 1.0f);
+        matrix.setSourceValue(Source::TOUCH_Y, 1.0f);
+        matrix.processBlock(FRAMES);
+        float next = matrix.getModulation(ParameterID::DETUNE);
+        ok = ok && next > settled && next - settled < 0.1f;
+        ok = ok && near(matrix.getModulation(ParameterID::SUB_LEVEL), 1.0f);
+        for (int b = 0; b < 2000; b++) matrix.processBlock(FRAMES);
+        ok = ok && near(matrix.getModulation(ParameterID::DETUNE), 1.0f);
+        report(ok);
+    }
+
+    std::cout << "Testing slot limit... ";
+    {
+        Matrix matrix;
+        bool ok = true;
+        for (size_t i = 0; i < Matrix::MAX_SLOTS; i++) {
+            ok = ok && matrix.addModulation(Source::LFO_1, ParameterID::HARMONICS, 0.1f) != 0;
+        }
+        ok = ok && matrix.addModulation(Source::LFO_2, ParameterID::HARMONICS, 0.1f) == 0;
+        ok = ok && matrix.getActiveModulations().size() == Matrix::MAX_SLOTS;
+        report(ok);
+    }
+
+    // Full matrix with curves on every slot: no heap, well under a block's budget
+    std::cout << "Testing allocation-free block processing... ";
+    {
+        Matrix matrix;
+        matrix.setSampleRate(48000.0f);
+        for (size_t i = 0; i < Matrix::MAX_SLOTS; i++) {
+            uint32_t id = matrix.addModulation(static_cast<Source>(i % 8), static_cast<ParameterID>(i % 12), 0.3f);
+            auto* slot = matrix.getModulationSlot(id);
+            slot->processing = Matrix::ModProcessing::CURVE_S_SHAPE;
+            slot->curveAmount = 0.5f;
+            slot->responseTime = 0.01f;
+        }
+        matrix.defineMacro(Source::MACRO_1, {{Source::LFO_1, 1.0f}, {Source::TOUCH_X, 0.5f}});
+        matrix.commitRouting();
+
+        const int blocks = 20000;
+        countAllocations = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocks; b++) {
+            matrix.setSourceValue(Source::TOUCH_X, (b % 100) / 100.0f);
+            matrix.processBlock(FRAMES);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        countAllocations = false;
+        double usPerBlock = std::chrono::duration<double, std::micro>(elapsed).count() / blocks;
+        std::cout << "(" << usPerBlock << " us/block) ";
+        report(allocationCount == 0 && usPerBlock < 50.0);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL MODULATION MATRIX TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,201 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "audio/OfflineRenderer.h"
+
+namespace {
+    // Stand-in render graph: a decaying sine retriggered by NOTE_ON events
+    struct ToneGraph {
+        float sampleRate = 48000.0f;
+        float phase = 0.0f, freq = 220.0f, level = 0.0f;
+        uint64_t position = 0;
+        size_t maxBlock = 0;
+        std::vector<uint64_t> eventFrames;
+    };
+
+    void renderTone(void* context, float* out, size_t frames) {
+        auto* graph = static_cast<ToneGraph*>(context);
+        graph->maxBlock = std::max(graph->maxBlock, frames);
+        for (size_t i = 0; i < frames; ++i) {
+            float s = std::sin(graph->phase) * graph->level;
+            graph->phase += 2.0f * static_cast<float>(M_PI) * graph->freq / graph->sampleRate;
+            if (graph->phase > 2.0f * static_cast<float>(M_PI)) graph->phase -= 2.0f * static_cast<float>(M_PI);
+            graph->level *= 0.9995f;
+            out[i * 2] = s;
+            out[i * 2 + 1] = -s;
+        }
+        graph->position += frames;
+    }
+
+    void toneEvent(void* context, const OfflineRenderer::Event& event) {
+        auto* graph = static_cast<ToneGraph*>(context);
+        graph->eventFrames.push_back(graph->position);
+        if (event.type == OfflineRenderer::NOTE_ON) {
+            graph->freq = 440.0f * std::pow(2.0f, (event.data - 69) / 12.0f);
+            graph->level = event.value;
+        }
+    }
+
+    std::vector<uint8_t> readFile(const char* path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    uint32_t le(const std::vector<uint8_t>& data, size_t at, int bytes) {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; ++i) value |= (uint32_t)data[at + i] << (8 * i);
+        return value;
+    }
+
+    std::vector<OfflineRenderer::Event> makeEvents() {
+        std::vector<OfflineRenderer::Event> events;
+        // Deliberately unsorted and off block boundaries
+        const uint64_t frames[] = {9001, 0, 130, 47999, 257, 30000};
+        for (uint64_t frame : frames) {
+            OfflineRenderer::Event e;
+            e.frame = frame;
+            e.type = OfflineRenderer::NOTE_ON;
+            e.data = 57 + (int)(frame % 12);
+            e.value = 0.8f;
+            events.push_back(e);
+        }
+        return events;
+    }
+}
+
+int main() {
+    std::cout << "EtherSynth Offline Renderer Test\n";
+    std::cout << "================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+    const char* pathA = "/tmp/ether_offline_a.wav";
+    const char* pathB = "/tmp/ether_offline_b.wav";
+    const std::vector<OfflineRenderer::Event> events = makeEvents();
+
+    OfflineRenderer::Config config;
+    config.totalFrames = 48000 + 123;   // Not a multiple of the block or chunk size
+    config.chunkFrames = 4096;
+    config.format = OfflineRenderer::Format::PCM_16;
+
+    std::cout << "Testing WAV header and data size... ";
+    {
+        OfflineRenderer renderer;
+        ToneGraph graph;
+        bool ok = renderer.render(pathA, config, events.data(), events.size(), renderTone, toneEvent, &graph);
+        std::vector<uint8_t> wav = readFile(pathA);
+        const size_t dataBytes = config.totalFrames * 2 * 2;
+        ok = ok && wav.size() == 44 + dataBytes;
+        ok = ok && std::memcmp(wav.data(), "RIFF", 4) == 0 && std::memcmp(wav.data() + 8, "WAVEfmt ", 8) == 0;
+        ok = ok && le(wav, 4, 4) == 36 + dataBytes && le(wav, 20, 2) == 1 && le(wav, 22, 2) == 2;
+        ok = ok && le(wav, 24, 4) == 48000 && le(wav, 34, 2) == 16 && le(wav, 40, 4) == dataBytes;
+        ok = ok && renderer.getStats().frames == config.totalFrames && renderer.getProgress() == 1.0f;
+        report(ok);
+    }
+
+    std::cout << "Testing events land on their exact frames... ";
+    {
+        OfflineRenderer renderer;
+        ToneGraph graph;
+        renderer.render(pathA, config, events.data(), events.size(), renderTone, toneEvent, &graph);
+        const std::vector<uint64_t> expected = {0, 130, 257, 9001, 30000, 47999};
+        bool ok = graph.eventFrames == expected && graph.position == config.totalFrames;
+        ok = ok && graph.maxBlock <= config.maxBlockFrames && renderer.getStats().events == events.size();
+        report(ok);
+    }
+
+    std::cout << "Testing identical renders are bit-identical (dithered 16-bit)... ";
+    {
+        OfflineRenderer first, second;
+        ToneGraph graphA, graphB;
+        first.render(pathA, config, events.data(), events.size(), renderTone, toneEvent, &graphA);
+        second.render(pathB, config, events.data(), events.size(), renderTone, toneEvent, &graphB);
+        std::vector<uint8_t> a = readFile(pathA), b = readFile(pathB);
+        report(!a.empty() && a == b);
+    }
+
+    std::cout << "Testing 32-bit float output is exact... ";
+    {
+        OfflineRenderer::Config floatConfig = config;
+        floatConfig.format = OfflineRenderer::Format::FLOAT_32;
+        OfflineRenderer renderer;
+        ToneGraph graph, reference;
+        renderer.render(pathA, floatConfig, events.data(), events.size(), renderTone, toneEvent, &graph);
+        std::vector<uint8_t> wav = readFile(pathA);
+        bool ok = wav.size() == 44 + floatConfig.totalFrames * 8 && le(wav, 20, 2) == 3 && le(wav, 34, 2) == 32;
+        // Re-render the first block by hand: the tone starts on the frame-0 event
+        OfflineRenderer::Event first = events[1];
+        toneEvent(&reference, first);
+        std::vector<float> expected(130 * 2);
+        renderTone(&reference, expected.data(), 130);
+        for (size_t i = 0; ok && i < expected.size(); ++i) {
+            float value;
+            std::memcpy(&value, wav.data() + 44 + i * 4, 4);
+            ok = value == expected[i];
+        }
+        report(ok);
+    }
+
+    std::cout << "Testing 24-bit samples are rounded and clipped... ";
+    {
+        std::vector<float> in = {0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.5f};
+        std::vector<uint8_t> out(in.size() * 3);
+        uint32_t state = 1;
+        size_t bytes = OfflineRenderer::convert(in.data(), in.size(), OfflineRenderer::Format::PCM_24, false, state, out.data());
+        auto s24 = [&](size_t i) { return (int32_t)(le(out, i * 3, 3) << 8) >> 8; };
+        bool ok = bytes == out.size() && s24(0) == 0 && s24(1) == 8388607 && s24(2) == -8388607;
+        ok = ok && s24(3) == 8388607 && s24(4) == -8388607 && s24(5) == 4194304;
+        report(ok);
+    }
+
+    std::cout << "Testing cancel leaves a valid file... ";
+    {
+        struct CancelContext { ToneGraph graph; OfflineRenderer* renderer; };
+        OfflineRenderer renderer;
+        CancelContext context{ToneGraph{}, &renderer};
+        OfflineRenderer::Config longConfig = config;
+        longConfig.totalFrames = 48000 * 60;
+        auto render = [](void* ctx, float* out, size_t frames) {
+            auto* c = static_cast<CancelContext*>(ctx);
+            renderTone(&c->graph, out, frames);
+            if (c->graph.position >= 48000) c->renderer->cancel();
+        };
+        renderer.render(pathA, longConfig, nullptr, 0, render, nullptr, &context);
+        std::vector<uint8_t> wav = readFile(pathA);
+        const auto& stats = renderer.getStats();
+        bool ok = stats.cancelled && stats.frames < longConfig.totalFrames && stats.frames >= 48000;
+        ok = ok && wav.size() == 44 + stats.frames * 4 && le(wav, 40, 4) == stats.frames * 4;
+        report(ok);
+    }
+
+    std::cout << "Testing render runs faster than realtime... ";
+    {
+        OfflineRenderer::Config longConfig = config;
+        longConfig.totalFrames = 48000 * 60;
+        longConfig.format = OfflineRenderer::Format::PCM_24;
+        OfflineRenderer renderer;
+        ToneGraph graph;
+        renderer.render(pathA, longConfig, events.data(), events.size(), renderTone, toneEvent, &graph);
+        std::cout << "(" << (int)renderer.getStats().realtimeFactor << "x) ";
+        report(renderer.getStats().realtimeFactor > 10.0);
+    }
+
+    std::remove(pathA);
+    std::remove(pathB);
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL OFFLINE RENDERER TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,173 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <algorithm>
+#include "audio/OversamplingProcessor.h"
+
+using Factor = OversamplingProcessor::Factor;
+using Quality = OversamplingProcessor::Quality;
+
+static constexpr float SAMPLE_RATE_HZ = 48000.0f;
+static const Factor FACTORS[] = {Factor::X2, Factor::X4, Factor::X8};
+static const Quality QUALITIES[] = {Quality::SHORT_FIR, Quality::LONG_FIR, Quality::IIR_ALLPASS};
+static const char* QUALITY_NAMES[] = {"short FIR", "long FIR", "IIR allpass"};
+
+// Heap allocations made while the counter is armed
+static bool countAllocations = false;
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    if (countAllocations) allocationCount++;
+    void* p = std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static std::vector<float> sine(float hz, size_t frames) {
+    std::vector<float> out(frames);
+    for (size_t i = 0; i < frames; i++) {
+        out[i] = static_cast<float>(std::sin(2.0 * M_PI * hz * i / SAMPLE_RATE_HZ));
+    }
+    return out;
+}
+
+int main() {
+    std::cout << "EtherSynth Oversampling Processor Test\n";
+    std::cout << "======================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+    auto identity = [](float x) { return x; };
+
+    // Reported latency against the phase shift of a 50 Hz tone, every preset
+    std::cout << "Testing reported latency... ";
+    {
+        bool ok = true;
+        const double w = 2.0 * M_PI * 50.0 / SAMPLE_RATE_HZ;
+        std::vector<float> in = sine(50.0f, 48000), out(in.size());
+        for (Quality quality : QUALITIES) {
+            for (Factor factor : FACTORS) {
+                OversamplingProcessor os;
+                os.initialize(SAMPLE_RATE_HZ, factor, quality);
+                os.processBlock(in.data(), out.data(), static_cast<int>(in.size()), identity);
+                double s = 0.0, c = 0.0;
+                for (size_t i = 24000; i < out.size(); i++) {
+                    s += out[i] * std::sin(w * i);
+                    c += out[i] * std::cos(w * i);
+                }
+                double measured = -std::atan2(c, s) / w;
+                ok = ok && std::fabs(measured - os.getLatencySamples()) < 0.05;
+            }
+        }
+        report(ok);
+    }
+
+    // Passband gain at 1 kHz and 16 kHz
+    std::cout << "Testing passband flatness... ";
+    {
+        bool ok = true;
+        std::vector<float> out(24000);
+        for (Quality quality : QUALITIES) {
+            for (float hz : {1000.0f, 16000.0f}) {
+                OversamplingProcessor os;
+                os.initialize(SAMPLE_RATE_HZ, Factor::X4, quality);
+                std::vector<float> in = sine(hz, out.size());
+                os.processBlock(in.data(), out.data(), static_cast<int>(in.size()), identity);
+                double energy = 0.0;
+                for (size_t i = 12000; i < out.size(); i++) energy += out[i] * out[i];
+                double db = 10.0 * std::log10(energy / 6000.0);
+                ok = ok && std::fabs(db) < 0.1;
+            }
+        }
+        report(ok);
+    }
+
+    // Tones written into the oversampled block that would fold into 0-19 kHz
+    std::cout << "Testing alias rejection... ";
+    {
+        const float required[] = {40.0f, 90.0f, 90.0f};
+        std::vector<float> silence(64, 0.0f), out(64);
+        bool ok = true;
+        std::cout << "(";
+        for (int q = 0; q < 3; q++) {
+            float worst = 0.0f;
+            for (Factor factor : FACTORS) {
+                const int f = static_cast<int>(factor);
+                for (int k = 1; k <= f / 2; k++) {
+                    for (float offset : {-19000.0f, -10000.0f, 10000.0f, 19000.0f}) {
+                        const double hz = k * SAMPLE_RATE_HZ + offset;
+                        if (hz >= f * SAMPLE_RATE_HZ * 0.5) continue;
+                        OversamplingProcessor os;
+                        os.initialize(SAMPLE_RATE_HZ, factor, QUALITIES[q], 64);
+                        const double w = 2.0 * M_PI * hz / (SAMPLE_RATE_HZ * f);
+                        double energy = 0.0;
+                        long n = 0;
+                        for (int b = 0; b < 400; b++) {
+                            float* up = os.upsample(silence.data(), 64);
+                            for (int i = 0; i < 64 * f; i++, n++) up[i] = static_cast<float>(std::sin(w * n));
+                            os.downsample(out.data(), 64);
+                            if (b >= 200) for (float y : out) energy += y * y;
+                        }
+                        float db = static_cast<float>(-10.0 * std::log10(energy / (200 * 64) / 0.5 + 1e-30));
+                        worst = (worst == 0.0f) ? db : std::min(worst, db);
+                    }
+                }
+            }
+            std::cout << QUALITY_NAMES[q] << " " << worst << " dB" << (q < 2 ? ", " : ") ");
+            ok = ok && worst >= required[q];
+        }
+        report(ok);
+    }
+
+    // Block processing (chunked past the preallocated size) matches sample by sample
+    std::cout << "Testing block and sample paths agree... ";
+    {
+        bool ok = true;
+        auto shaper = [](float x) { return std::tanh(3.0f * x); };
+        std::vector<float> in = sine(3100.0f, 1000), block(in.size()), single(in.size());
+        for (Quality quality : QUALITIES) {
+            OversamplingProcessor a, b;
+            a.initialize(SAMPLE_RATE_HZ, Factor::X8, quality, 96);
+            b.initialize(SAMPLE_RATE_HZ, Factor::X8, quality, 96);
+            a.processBlock(in.data(), block.data(), static_cast<int>(in.size()), shaper);
+            for (size_t i = 0; i < in.size(); i++) single[i] = b.processSample(in[i], shaper);
+            for (size_t i = 0; i < in.size(); i++) ok = ok && std::fabs(block[i] - single[i]) < 1e-5f;
+        }
+        report(ok);
+    }
+
+    // Nothing on the processing path touches the heap
+    std::cout << "Testing allocation-free processing... ";
+    {
+        OversamplingProcessor os;
+        os.initialize(SAMPLE_RATE_HZ, Factor::X4, Quality::LONG_FIR);
+        std::vector<float> in = sine(440.0f, 1024), out(in.size());
+        auto shaper = [](float x) { return x / (1.0f + std::fabs(x)); };
+        countAllocations = true;
+        for (int b = 0; b < 100; b++) {
+            os.processBlock(in.data(), out.data(), 128 + b * 7, shaper);
+            out[0] = os.processSample(in[b], shaper);
+        }
+        os.setEnabled(false);
+        os.processBlock(in.data(), out.data(), 128, shaper);
+        countAllocations = false;
+        report(allocationCount == 0);
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL OVERSAMPLING PROCESSOR TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
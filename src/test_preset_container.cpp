@@ -0,0 +1,145 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include "storage/presets/PresetContainer.h"
+
+using Section = PresetContainer::SectionType;
+
+static PresetContainerWriter makePreset(int seed) {
+    PresetContainerWriter preset;
+    preset.addText(Section::META, 0, {{"name", "Preset " + std::to_string(seed)}, {"author", "ether \"factory\""}});
+    std::vector<PresetParam> params;
+    for (uint32_t p = 0; p < 32; p++) params.push_back({p, seed * 0.001f + p * 0.01f});
+    preset.addParams(Section::ENGINE_PARAMS, 0, params);
+    const uint8_t blob[5] = {1, 2, 3, static_cast<uint8_t>(seed), 0xFF};
+    preset.addRaw(Section::ENGINE_DATA, 0, blob, sizeof(blob));
+    for (uint32_t slot = 0; slot < 4; slot++) {
+        PresetContainerWriter instrument;
+        instrument.addParams(Section::ENGINE_PARAMS, 0, {{slot, static_cast<float>(seed + slot)}});
+        instrument.addText(Section::SAMPLE_REFS, 0, {{"kick", "samples/kick.wav"}});
+        preset.addContainer(Section::INSTRUMENT, slot, instrument);
+    }
+    return preset;
+}
+
+static bool checkPreset(const PresetContainer& preset, int seed) {
+    PresetContainer::TextFields fields;
+    if (!preset.readText(preset.findSection(Section::META), fields) || fields.size() != 2) return false;
+    if (fields[0].second != "Preset " + std::to_string(seed)) return false;
+
+    const PresetParam* params = nullptr;
+    size_t count = 0;
+    if (!preset.readParams(preset.findSection(Section::ENGINE_PARAMS), params, count) || count != 32) return false;
+    for (uint32_t p = 0; p < 32; p++) {
+        if (params[p].id != p || params[p].value != seed * 0.001f + p * 0.01f) return false;
+    }
+
+    const uint8_t* blob = nullptr;
+    size_t bytes = 0;
+    if (!preset.readRaw(preset.findSection(Section::ENGINE_DATA), blob, bytes) || bytes != 5 || blob[3] != seed % 256) {
+        return false;
+    }
+
+    PresetContainer instrument;
+    if (!preset.openNested(preset.findSection(Section::INSTRUMENT, 3), instrument)) return false;
+    return instrument.readParams(instrument.findSection(Section::ENGINE_PARAMS), params, count) &&
+           count == 1 && params[0].value == seed + 3.0f;
+}
+
+int main() {
+    std::cout << "EtherSynth Preset Container Test\n";
+    std::cout << "================================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    const std::string path = "/tmp/ether_preset_container.epc";
+
+    std::cout << "Testing preset round trip... ";
+    {
+        PresetContainer preset;
+        bool ok = preset.openBuffer(makePreset(7).finish()) && checkPreset(preset, 7);
+        ok = ok && preset.getVersion() == PresetContainer::SCHEMA_VERSION && preset.findSection(Section::LFOS) < 0;
+        const PresetParam* params = nullptr;
+        size_t count = 0;
+        ok = ok && !preset.readParams(preset.findSection(Section::META), params, count);  // Wrong encoding
+        report(ok);
+    }
+
+    // A bank on disk opens through the mapping; presets decode on demand
+    std::cout << "Testing mapped bank with nested presets... ";
+    {
+        PresetContainerWriter bank;
+        for (int i = 0; i < 100; i++) bank.addContainer(Section::PRESET, i, makePreset(i));
+        bool ok = bank.writeFile(path);
+        PresetContainer reader;
+        ok = ok && reader.open(path) && reader.getSectionCount() == 100;
+        for (int i : {0, 42, 99}) {
+            PresetContainer preset;
+            ok = ok && reader.openNested(reader.findSection(Section::PRESET, i), preset) && checkPreset(preset, i);
+        }
+        report(ok);
+    }
+
+    // Damage stays local to the section it hits
+    std::cout << "Testing corrupt section is isolated... ";
+    {
+        // Flip a byte of one parameter value in the image
+        std::vector<uint8_t> copy = makePreset(3).finish();
+        const PresetParam* params = nullptr;
+        size_t count = 0;
+        float needle = 3 * 0.001f + 5 * 0.01f;
+        for (size_t i = 0; i + 4 <= copy.size(); i++) {
+            if (std::memcmp(copy.data() + i, &needle, 4) == 0) { copy[i] ^= 0x55; break; }
+        }
+        PresetContainer damagedPreset;
+        bool ok = damagedPreset.openBuffer(copy);
+        ok = ok && !damagedPreset.readParams(damagedPreset.findSection(Section::ENGINE_PARAMS), params, count);
+        PresetContainer::TextFields fields;
+        ok = ok && damagedPreset.readText(damagedPreset.findSection(Section::META), fields) && fields.size() == 2;
+        ok = ok && damagedPreset.toJSON().find("\"error\": \"corrupt\"") != std::string::npos;
+        report(ok);
+    }
+
+    std::cout << "Testing header validation... ";
+    {
+        std::vector<uint8_t> image = makePreset(1).finish();
+        PresetContainer reader;
+        std::vector<uint8_t> future = image;
+        future[4] = 99;     // Schema version from a newer build
+        std::vector<uint8_t> truncated(image.begin(), image.begin() + image.size() / 2);
+        std::vector<uint8_t> junk(64, 0xAB);
+        bool ok = !reader.openBuffer(future) && !reader.openBuffer(truncated) && !reader.openBuffer(junk);
+        ok = ok && !reader.open("/tmp/ether_preset_missing.epc") && reader.openBuffer(image);
+        report(ok);
+    }
+
+    std::cout << "Testing JSON export... ";
+    {
+        PresetContainer preset;
+        preset.openBuffer(makePreset(2).finish());
+        const std::string json = preset.toJSON();
+        bool ok = json.find("\"type\": \"engine_params\", \"index\": 0, \"params\": {\"0\": 0.00200000009") != std::string::npos;
+        ok = ok && json.find("\"author\": \"ether \\\"factory\\\"\"") != std::string::npos;
+        ok = ok && json.find("\"raw\": \"01020302ff\"") != std::string::npos;
+        ok = ok && json.find("\"kick\": \"samples/kick.wav\"") != std::string::npos;
+        ok = ok && json == preset.toJSON();
+        report(ok);
+    }
+
+    std::remove(path.c_str());
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL PRESET CONTAINER TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
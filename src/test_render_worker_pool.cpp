@@ -0,0 +1,147 @@
+#include <iostream>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include "audio/RenderWorkerPool.h"
+
+struct TestJob {
+    std::array<std::atomic<int>, 16> runs;
+    std::array<float, 16> results;
+    std::atomic<int> maxThread{0};
+    int workPerTask = 2000;
+};
+
+static void testTask(void* context, int task, int thread) {
+    auto* job = static_cast<TestJob*>(context);
+    job->runs[task].fetch_add(1);
+    int prev = job->maxThread.load();
+    while (thread > prev && !job->maxThread.compare_exchange_weak(prev, thread)) {}
+
+    // Deterministic per-task work
+    float acc = 0.0f;
+    for (int i = 0; i < job->workPerTask; ++i) {
+        acc += std::sin(0.001f * i * (task + 1));
+    }
+    job->results[task] = acc;
+}
+
+static bool runJobs(RenderWorkerPool& pool, int jobs, int tasks, TestJob& job) {
+    std::array<float, 16> reference{};
+    for (int j = 0; j < jobs; ++j) {
+        for (auto& r : job.runs) r.store(0);
+        pool.run(&testTask, &job, tasks, 2.67);
+        for (int t = 0; t < 16; ++t) {
+            int expected = t < tasks ? 1 : 0;
+            if (job.runs[t].load() != expected) return false;
+        }
+        if (j == 0) {
+            reference = job.results;
+        } else {
+            for (int t = 0; t < tasks; ++t) {
+                if (job.results[t] != reference[t]) return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "EtherSynth Render Worker Pool Test\n";
+    std::cout << "==================================\n";
+
+    bool allTestsPassed = true;
+
+    // Serial fallback
+    std::cout << "Testing serial fallback... ";
+    {
+        RenderWorkerPool pool;
+        pool.initialize(0);
+        TestJob job;
+        if (!pool.isParallel() && runJobs(pool, 50, 16, job) && job.maxThread.load() == 0) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Every task runs exactly once per job, results independent of threads
+    std::cout << "Testing parallel execution... ";
+    {
+        RenderWorkerPool pool;
+        pool.initialize(3);
+        TestJob job;
+        bool ok = pool.getThreadCount() == 4 && runJobs(pool, 2000, 16, job);
+        if (ok) {
+            std::cout << "PASS (max thread used " << job.maxThread.load() << ")\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Varying task counts, including fewer tasks than threads and empty jobs
+    std::cout << "Testing varying task counts... ";
+    {
+        RenderWorkerPool pool;
+        pool.initialize(3);
+        TestJob job;
+        job.workPerTask = 50;
+        bool ok = true;
+        for (int tasks : {0, 1, 2, 3, 5, 16, 7, 1, 16}) {
+            ok = ok && runJobs(pool, 200, tasks, job);
+        }
+        if (ok) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Jobs still complete after helpers have gone to sleep
+    std::cout << "Testing wake after idle... ";
+    {
+        RenderWorkerPool pool;
+        pool.initialize(2);
+        TestJob job;
+        bool ok = true;
+        for (int round = 0; round < 5 && ok; ++round) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            ok = runJobs(pool, 10, 16, job);
+        }
+        if (ok) {
+            std::cout << "PASS\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    // Load statistics are reported per thread
+    std::cout << "Testing load statistics... ";
+    {
+        RenderWorkerPool pool;
+        pool.initialize(1);
+        TestJob job;
+        job.workPerTask = 20000;
+        runJobs(pool, 100, 16, job);
+        float total = pool.getThreadLoad(0) + pool.getThreadLoad(1);
+        if (total > 0.0f && pool.getThreadLoad(2) == 0.0f) {
+            std::cout << "PASS (audio " << pool.getThreadLoad(0) << "%, helper "
+                      << pool.getThreadLoad(1) << "%)\n";
+        } else {
+            std::cout << "FAIL\n";
+            allTestsPassed = false;
+        }
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL RENDER WORKER POOL TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
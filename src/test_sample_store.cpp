@@ -0,0 +1,204 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include "synthesis/SampleStore.h"
+#include "synthesis/SampleStreamer.h"
+
+using Sample::SampleStore;
+using Sample::SampleHandle;
+using Sample::MappedSample;
+
+// Recognizable content: every frame and channel has its own value
+static int16_t expected(size_t frame, int channel) {
+    return static_cast<int16_t>(static_cast<int>((frame * 7 + channel * 1000) % 30000) - 15000);
+}
+
+struct Writer {
+    std::vector<uint8_t> bytes;
+    bool bigEndian = false;
+    void raw(const char* s, size_t n) { bytes.insert(bytes.end(), s, s + n); }
+    void u8(uint8_t v) { bytes.push_back(v); }
+    void u16(uint16_t v) { bigEndian ? (u8(v >> 8), u8(v & 0xFF)) : (u8(v & 0xFF), u8(v >> 8)); }
+    void u32(uint32_t v) { bigEndian ? (u16(v >> 16), u16(v & 0xFFFF)) : (u16(v & 0xFFFF), u16(v >> 16)); }
+    void sample(int16_t v, int bitDepth, bool bigEndianData) {
+        int32_t s = bitDepth == 24 ? v * 256 : v;
+        uint8_t b[3] = {static_cast<uint8_t>(s), static_cast<uint8_t>(s >> 8), static_cast<uint8_t>(s >> 16)};
+        const int n = bitDepth / 8;
+        for (int i = 0; i < n; i++) u8(bigEndianData ? b[n - 1 - i] : b[i]);
+    }
+    void save(const std::string& path) const {
+        FILE* file = fopen(path.c_str(), "wb");
+        fwrite(bytes.data(), 1, bytes.size(), file);
+        fclose(file);
+    }
+};
+
+// A LIST chunk before the data and a smpl loop after it exercise the chunk walk
+static std::string writeWav(const std::string& name, int channels, int bitDepth, size_t frames) {
+    Writer w;
+    const uint32_t block = channels * bitDepth / 8;
+    const uint32_t dataSize = static_cast<uint32_t>(frames * block);
+    w.raw("RIFF", 4); w.u32(4 + 24 + 14 + 8 + dataSize + 8 + 60); w.raw("WAVE", 4);
+    w.raw("fmt ", 4); w.u32(16); w.u16(1); w.u16(channels); w.u32(44100); w.u32(44100 * block); w.u16(block); w.u16(bitDepth);
+    w.raw("LIST", 4); w.u32(5); w.raw("INFOx", 5); w.u8(0);
+    w.raw("data", 4); w.u32(dataSize);
+    for (size_t f = 0; f < frames; f++)
+        for (int c = 0; c < channels; c++) w.sample(expected(f, c), bitDepth, false);
+    w.raw("smpl", 4); w.u32(60);
+    for (int i = 0; i < 3; i++) w.u32(0);
+    w.u32(48); for (int i = 0; i < 3; i++) w.u32(0);
+    w.u32(1); w.u32(0);
+    w.u32(0); w.u32(0); w.u32(100); w.u32(899); w.u32(0); w.u32(0);
+    std::string path = "/tmp/ether_store_" + name + ".wav";
+    w.save(path);
+    return path;
+}
+
+static std::string writeAiff(const std::string& name, int channels, int bitDepth, size_t frames, bool sowt) {
+    Writer w;
+    w.bigEndian = true;
+    const uint32_t dataSize = static_cast<uint32_t>(frames * channels * bitDepth / 8);
+    const uint32_t commSize = sowt ? 24 : 18;
+    w.raw("FORM", 4); w.u32(4 + 8 + commSize + 8 + 8 + dataSize + 8 + 18 + 8 + 20); w.raw(sowt ? "AIFC" : "AIFF", 4);
+    w.raw("COMM", 4); w.u32(commSize); w.u16(channels); w.u32(static_cast<uint32_t>(frames)); w.u16(bitDepth);
+    const uint8_t rate48k[10] = {0x40, 0x0E, 0xBB, 0x80, 0, 0, 0, 0, 0, 0};
+    for (uint8_t b : rate48k) w.u8(b);
+    if (sowt) { w.raw("sowt", 4); w.u8(0); w.u8(0); }
+    w.raw("SSND", 4); w.u32(8 + dataSize); w.u32(0); w.u32(0);
+    for (size_t f = 0; f < frames; f++)
+        for (int c = 0; c < channels; c++) w.sample(expected(f, c), bitDepth, !sowt);
+    w.raw("MARK", 4); w.u32(18); w.u16(2);
+    w.u16(1); w.u32(200); w.u8(1); w.raw("a", 1);
+    w.u16(2); w.u32(700); w.u8(1); w.raw("b", 1);
+    w.raw("INST", 4); w.u32(20); w.u8(36);
+    for (int i = 0; i < 7; i++) w.u8(0);
+    w.u16(1); w.u16(1); w.u16(2); w.u16(0); w.u16(0); w.u16(0);
+    std::string path = "/tmp/ether_store_" + name + ".aif";
+    w.save(path);
+    return path;
+}
+
+static bool matches(const int16_t* data, size_t firstFrame, size_t frames, int channels) {
+    for (size_t f = 0; f < frames; f++)
+        for (int c = 0; c < channels; c++)
+            if (data[f * channels + c] != expected(firstFrame + f, c)) return false;
+    return true;
+}
+
+int main() {
+    std::cout << "EtherSynth Sample Store Test\n";
+    std::cout << "============================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    const std::vector<std::string> paths = {
+        writeWav("wav16", 2, 16, 5000), writeWav("wav24", 1, 24, 5000),
+        writeAiff("aiff16", 2, 16, 5000, false), writeAiff("aiff24", 1, 24, 5000, false),
+        writeAiff("sowt16", 1, 16, 5000, true)};
+    std::vector<int16_t> block(1000 * 2);
+
+    std::cout << "Testing 16-bit WAV is zero-copy... ";
+    {
+        SampleStore store;
+        SampleHandle sample = store.open(paths[0]);
+        bool ok = sample && sample->pcm16() && matches(sample->pcm16(), 0, 5000, 2);
+        ok = ok && sample->getInfo().sampleRate == 44100 && sample->getFrames() == 5000;
+        ok = ok && sample->getInfo().hasLoopPoints && sample->getInfo().loopStart == 100 &&
+             sample->getInfo().loopEnd == 900 && sample->getInfo().rootNote == 48.0f;
+        report(ok);
+    }
+
+    std::cout << "Testing WAV/AIFF conversion reads... ";
+    {
+        SampleStore store;
+        bool ok = true;
+        for (size_t i = 1; i < paths.size(); i++) {
+            SampleHandle sample = store.open(paths[i]);
+            if (!sample) { ok = false; continue; }
+            const int channels = sample->getChannels();
+            ok = ok && sample->readFrames(1234, block.data(), 1000) == 1000 && matches(block.data(), 1234, 1000, channels);
+            ok = ok && sample->readFrames(4500, block.data(), 1000) == 500;
+        }
+        SampleHandle aiff = store.open(paths[2]);
+        ok = ok && aiff && !aiff->pcm16() && aiff->getInfo().sampleRate == 48000;
+        ok = ok && aiff->getInfo().loopStart == 200 && aiff->getInfo().loopEnd == 700 && aiff->getInfo().rootNote == 36.0f;
+        SampleHandle sowt = store.open(paths[4]);
+        ok = ok && sowt && sowt->getEncoding() == MappedSample::Encoding::PCM16_LE;
+        report(ok);
+    }
+
+    std::cout << "Testing shared handles and release... ";
+    {
+        SampleStore store;
+        SampleHandle a = store.open(paths[0]);
+        SampleHandle b = store.open(paths[0]);
+        bool ok = a && a == b && store.getOpenCount() == 1;
+        a->prefetch(0, 5000);
+        a->prefetch(4999, 100000);
+        a.reset();
+        ok = ok && store.getOpenCount() == 1 && matches(b->pcm16(), 0, 10, 2);
+        b.reset();
+        ok = ok && store.getOpenCount() == 0 && store.open(paths[0]) != nullptr;
+        ok = ok && store.open("/tmp/ether_store_missing.wav") == nullptr;
+        report(ok);
+    }
+
+    std::cout << "Testing rejects non-audio files... ";
+    {
+        const std::string junk = "/tmp/ether_store_junk.wav";
+        Writer w;
+        w.raw("RIFF", 4); w.u32(100); w.raw("WAVEfmt ", 8); w.u32(16); w.u16(3);
+        w.save(junk);
+        SampleStore store;
+        report(store.open(junk) == nullptr);
+        std::remove(junk.c_str());
+    }
+
+    // SampleBuffer and the cache hold handles into the same mapping
+    std::cout << "Testing SampleBuffer plays from the mapping... ";
+    {
+        auto cache = std::make_shared<Sample::SampleCache>();
+        Sample::SampleBuffer::setCacheInstance(cache);
+        Sample::SampleBuffer first, second;
+        bool ok = first.load(paths[2]) && second.load(paths[2]);
+        ok = ok && first.getMode() == Sample::SampleBuffer::Mode::RAM && cache->get(paths[2]) != nullptr;
+        ok = ok && SampleStore::shared().getOpenCount() == 1 && cache->getCurrentSize() == 5000 * 2 * 2;
+        second.startPlayback();
+        for (size_t f = 0; f < 5000 && ok; f += 500) {
+            second.renderSamples(block.data(), 1000);
+            ok = matches(block.data(), f, 500, 2);
+        }
+        Sample::SampleBuffer::setCacheInstance(nullptr);
+        report(ok);
+    }
+
+    std::cout << "Testing streamer reads AIFF through the store... ";
+    {
+        Sample::SampleStreamer streamer(0);
+        int voice = streamer.startVoice(streamer.registerSample(paths[3], 512));
+        bool ok = voice >= 0;
+        for (size_t f = 0; f < 5000 && ok; f += 250) {
+            streamer.pump();
+            ok = streamer.readVoice(voice, block.data(), 250) == 250 && matches(block.data(), f, 250, 1);
+        }
+        report(ok && streamer.getVoiceUnderruns(voice) == 0);
+    }
+
+    for (const auto& path : paths) std::remove(path.c_str());
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL SAMPLE STORE TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -0,0 +1,189 @@
+#include <iostream>
+#include <array>
+#include "audio/VoiceManager.h"
+
+// Minimal voice with the interface syncVoices() expects
+struct TestVoice {
+    bool active = false;
+    bool killed = false;
+    float level = 0.0f;
+
+    bool isActive() const { return active; }
+    void kill() { active = false; killed = true; }
+    float getLevel() const { return level; }
+};
+
+using TestVoices = std::array<TestVoice, MAX_VOICES>;
+
+// Plays a note through the manager the way an engine does
+static int play(VoiceManager& vm, TestVoices& voices, int slot, uint8_t note, float level) {
+    int index = vm.noteOn(slot, note, level);
+    if (index >= 0) {
+        voices[index].active = true;
+        voices[index].killed = false;
+        voices[index].level = level;
+    }
+    return index;
+}
+
+int main() {
+    std::cout << "EtherSynth Voice Manager Test\n";
+    std::cout << "=============================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    // Distinct free voices per note, note-off releases the matching voice
+    std::cout << "Testing basic allocation... ";
+    {
+        VoiceManager vm;
+        TestVoices voices;
+        vm.attachSlot(0, &voices, 4);
+        int a = play(vm, voices, 0, 60, 0.8f);
+        int b = play(vm, voices, 0, 64, 0.8f);
+        int c = play(vm, voices, 0, 67, 0.8f);
+        bool ok = a == 0 && b == 1 && c == 2 && vm.getActiveVoiceCount() == 3;
+        ok = ok && vm.noteOff(0, 64) == b && vm.getVoiceState(0, b) == VoiceManager::VoiceState::RELEASING;
+        ok = ok && vm.noteOff(0, 72) == -1;
+        ok = ok && vm.getActiveVoiceCount() == 3 && vm.getReleasingVoiceCount() == 1;
+        report(ok);
+    }
+
+    // Released voices stay allocated until the engine reports them silent
+    std::cout << "Testing release tails... ";
+    {
+        VoiceManager vm;
+        TestVoices voices;
+        vm.attachSlot(0, &voices, 4);
+        int a = play(vm, voices, 0, 60, 0.8f);
+        vm.noteOff(0, 60);
+        vm.syncVoices(0, &voices, voices);
+        bool ok = vm.getVoiceState(0, a) == VoiceManager::VoiceState::RELEASING;
+        voices[a].active = false;   // Envelope finished
+        vm.syncVoices(0, &voices, voices);
+        ok = ok && vm.getVoiceState(0, a) == VoiceManager::VoiceState::FREE && vm.getActiveVoiceCount() == 0;
+        report(ok);
+    }
+
+    // Full slot: release tails go first, then the oldest held note
+    std::cout << "Testing oldest stealing... ";
+    {
+        VoiceManager vm;
+        TestVoices voices;
+        vm.attachSlot(0, &voices, 3);
+        play(vm, voices, 0, 60, 0.8f);
+        play(vm, voices, 0, 62, 0.8f);
+        play(vm, voices, 0, 64, 0.8f);
+        vm.noteOff(0, 62);
+        bool ok = play(vm, voices, 0, 65, 0.8f) == 1;    // Releasing voice first
+        ok = ok && play(vm, voices, 0, 67, 0.8f) == 0;   // Then oldest
+        ok = ok && vm.getStealCount() == 2 && vm.getActiveVoiceCount() == 3;
+        report(ok);
+    }
+
+    // Quietest voice gives way, using levels picked up by syncVoices
+    std::cout << "Testing quietest stealing... ";
+    {
+        VoiceManager vm;
+        vm.setStealPolicy(VoiceManager::StealPolicy::QUIETEST);
+        TestVoices voices;
+        vm.attachSlot(0, &voices, 3);
+        play(vm, voices, 0, 60, 0.9f);
+        play(vm, voices, 0, 62, 0.9f);
+        play(vm, voices, 0, 64, 0.9f);
+        voices[1].level = 0.1f;
+        vm.syncVoices(0, &voices, voices);
+        report(play(vm, voices, 0, 65, 0.9f) == 1);
+    }
+
+    // Global budget steals across slots; the other engine kills the voice on sync
+    std::cout << "Testing cross-slot stealing... ";
+    {
+        VoiceManager vm;
+        vm.setVoiceBudget(4);
+        TestVoices voicesA, voicesB;
+        vm.attachSlot(0, &voicesA, 4);
+        vm.attachSlot(1, &voicesB, 4);
+        for (uint8_t n = 0; n < 3; ++n) play(vm, voicesA, 0, 60 + n, 0.8f);
+        play(vm, voicesB, 1, 48, 0.8f);
+        int index = play(vm, voicesB, 1, 50, 0.8f);
+        bool ok = index == 1 && vm.getVoiceState(0, 0) == VoiceManager::VoiceState::STOLEN;
+        vm.syncVoices(0, &voicesA, voicesA);
+        ok = ok && voicesA[0].killed && vm.getVoiceState(0, 0) == VoiceManager::VoiceState::FREE;
+        ok = ok && vm.getActiveVoiceCount() == 4 && vm.getSlotVoiceCount(1) == 2;
+
+        // A sync from a different owner (e.g. an engine being swapped out) is ignored
+        int other = 0;
+        vm.setVoiceBudget(5);
+        play(vm, voicesA, 0, 70, 0.8f);
+        vm.setVoiceBudget(4);
+        play(vm, voicesB, 1, 52, 0.8f);
+        TestVoices stale;
+        vm.syncVoices(0, &other, stale);
+        ok = ok && !stale[0].killed && !stale[1].killed;
+        report(ok);
+    }
+
+    // Lowest priority slot loses its voices; it may never steal from above
+    std::cout << "Testing priority stealing... ";
+    {
+        VoiceManager vm;
+        vm.setStealPolicy(VoiceManager::StealPolicy::LOWEST_PRIORITY);
+        vm.setVoiceBudget(2);
+        TestVoices pad, lead;
+        vm.attachSlot(0, &pad, 4);
+        vm.attachSlot(1, &lead, 4);
+        vm.setSlotPriority(0, 20);
+        vm.setSlotPriority(1, 100);
+        play(vm, lead, 1, 72, 0.8f);
+        play(vm, pad, 0, 48, 0.8f);
+        bool ok = play(vm, lead, 1, 74, 0.8f) >= 0 &&
+                  vm.getVoiceState(0, 0) == VoiceManager::VoiceState::STOLEN;
+        vm.syncVoices(0, &pad, pad);
+        ok = ok && play(vm, pad, 0, 50, 0.8f) == -1;   // Only lead voices left
+        ok = ok && vm.getSlotVoiceCount(1) == 2;
+        report(ok);
+    }
+
+    // Measured per-voice cost caps polyphony under the CPU budget
+    std::cout << "Testing CPU budget... ";
+    {
+        VoiceManager vm;
+        TestVoices voices;
+        vm.attachSlot(0, &voices, 16);
+        bool ok = vm.getVoiceLimit() == vm.getVoiceBudget();
+        for (int block = 0; block < 200; ++block) {
+            vm.reportLoad(0, 0.4f, 4);             // 0.1 load per voice
+        }
+        vm.setCpuBudget(0.65f);
+        int limit = vm.getVoiceLimit();
+        ok = ok && limit == 6;
+        int played = 0;
+        for (uint8_t n = 0; n < 10; ++n) {
+            if (play(vm, voices, 0, 60 + n, 0.8f) >= 0) ++played;
+        }
+        ok = ok && played == 10 && vm.getActiveVoiceCount() == 6 && vm.getStealCount() == 4;
+        ok = ok && vm.getEstimatedLoad() <= 0.65f;
+
+        // Slots that manage their own voices still count through reportLoad
+        vm.reportLoad(1, 0.2f, 2);
+        ok = ok && vm.getActiveVoiceCount() == 8;
+        if (ok) {
+            std::cout << "PASS (limit " << limit << " voices)\n";
+        } else {
+            report(false);
+        }
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL VOICE MANAGER TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
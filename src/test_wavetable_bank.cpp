@@ -0,0 +1,190 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include "audio/WavetableBank.h"
+#include "audio/FFT.h"
+
+static constexpr int ANALYSIS_SIZE = 8192;
+static constexpr float SAMPLE_RATE_HZ = 48000.0f;
+
+// Energy (dB relative to total) in bins that are not harmonics of fundamentalBin
+static float inharmonicEnergyDb(const std::vector<float>& signal, int fundamentalBin) {
+    FFT fft(ANALYSIS_SIZE);
+    std::vector<float> re(fft.getNumBins()), im(fft.getNumBins());
+    fft.forwardReal(signal.data(), re.data(), im.data());
+    double total = 0.0, inharmonic = 0.0;
+    for (int k = 1; k < fft.getNumBins(); ++k) {
+        double power = static_cast<double>(re[k]) * re[k] + static_cast<double>(im[k]) * im[k];
+        total += power;
+        if (k % fundamentalBin != 0) inharmonic += power;
+    }
+    return static_cast<float>(10.0 * std::log10(inharmonic / total + 1e-30));
+}
+
+// Naive playback of a single-cycle table, as before the bank existed
+static std::vector<float> renderNaive(const std::vector<float>& cycle, float increment) {
+    std::vector<float> out(ANALYSIS_SIZE);
+    const int size = static_cast<int>(cycle.size());
+    float phase = 0.0f;
+    for (auto& sample : out) {
+        float position = phase * size;
+        int index = static_cast<int>(position);
+        float fraction = position - index;
+        sample = cycle[index % size] + (cycle[(index + 1) % size] - cycle[index % size]) * fraction;
+        phase += increment;
+        if (phase >= 1.0f) phase -= 1.0f;
+    }
+    return out;
+}
+
+int main() {
+    std::cout << "EtherSynth Wavetable Bank Test\n";
+    std::cout << "==============================\n";
+
+    bool allTestsPassed = true;
+    auto report = [&](bool ok) {
+        std::cout << (ok ? "PASS\n" : "FAIL\n");
+        if (!ok) allTestsPassed = false;
+    };
+
+    WavetableBank bank;
+    std::cout << "Testing factory build... ";
+    report(bank.buildFactory() && bank.getTableCount() == WavetableBank::FACTORY_TABLES &&
+           bank.getLevelCount() == WavetableBank::MAX_LEVELS);
+
+    // Each level holds no energy above its harmonic limit; guard samples wrap
+    std::cout << "Testing mip levels are band-limited... ";
+    {
+        bool ok = true;
+        for (int level = 0; level < bank.getLevelCount() && ok; ++level) {
+            const int size = WavetableBank::getLevelSize(level);
+            const float* table = bank.getTable(WavetableBank::FACTORY_TABLES - 1, level);
+            FFT fft(size);
+            std::vector<float> re(fft.getNumBins()), im(fft.getNumBins());
+            fft.forwardReal(table, re.data(), im.data());
+            double kept = 0.0, above = 0.0;
+            for (int k = 0; k < fft.getNumBins(); ++k) {
+                double power = static_cast<double>(re[k]) * re[k] + static_cast<double>(im[k]) * im[k];
+                (k <= WavetableBank::getLevelHarmonics(level) ? kept : above) += power;
+            }
+            ok = above < kept * 1e-8;
+            for (int g = 0; g < WavetableBank::GUARD; ++g) {
+                ok = ok && table[size + g] == table[g];
+            }
+        }
+        report(ok);
+    }
+
+    // Level choice keeps the highest harmonic below Nyquist
+    std::cout << "Testing mip level selection... ";
+    {
+        bool ok = bank.selectLevel(20.0f / SAMPLE_RATE_HZ) == 0;
+        for (float freq : {55.0f, 440.0f, 1760.0f, 7040.0f, 15000.0f}) {
+            float increment = freq / SAMPLE_RATE_HZ;
+            int level = bank.selectLevel(increment);
+            ok = ok && WavetableBank::getLevelHarmonics(level) * increment <= 0.5f;
+            ok = ok && (level == 0 || WavetableBank::getLevelHarmonics(level - 1) * increment > 0.5f);
+        }
+        report(ok);
+    }
+
+    // Save, then map the file back: identical tables
+    std::cout << "Testing file round trip... ";
+    {
+        const char* path = "/tmp/test_wavetable_bank.ewtb";
+        WavetableBank loaded;
+        bool ok = bank.save(path) && loaded.load(path) && loaded.getTableCount() == bank.getTableCount();
+        for (int table = 0; table < bank.getTableCount() && ok; ++table) {
+            for (int level = 0; level < bank.getLevelCount() && ok; ++level) {
+                ok = std::equal(bank.getTable(table, level),
+                                bank.getTable(table, level) + WavetableBank::getLevelSize(level) + WavetableBank::GUARD,
+                                loaded.getTable(table, level));
+            }
+        }
+        WavetableBank rejected;
+        std::FILE* file = std::fopen(path, "r+b");
+        if (file) {
+            std::fputc('X', file);
+            std::fclose(file);
+        }
+        ok = ok && !rejected.load(path) && !rejected.isValid();
+        std::remove(path);
+        if (ok) {
+            std::cout << "PASS (" << (loaded.isMapped() ? "mapped" : "read") << ")\n";
+        } else {
+            report(false);
+        }
+    }
+
+    // Block playback matches a scalar reference, including cross-table blending
+    std::cout << "Testing block playback... ";
+    {
+        const float increment = 440.0f / SAMPLE_RATE_HZ;
+        const int level = bank.selectLevel(increment);
+        const int size = WavetableBank::getLevelSize(level);
+        const float* ta = bank.getTable(10, level);
+        const float* tb = bank.getTable(11, level);
+        std::vector<float> out(1000, 0.25f);
+        float phase = 0.3f;
+        bank.render(10, 11, 0.4f, level, phase, increment, 0.5f, out.data(), out.size());
+
+        float refPhase = 0.3f, maxError = 0.0f;
+        for (size_t i = 0; i < out.size(); ++i) {
+            float position = refPhase * size;
+            int index = static_cast<int>(position);
+            float fraction = position - index;
+            float a = ta[index] + (ta[index + 1] - ta[index]) * fraction;
+            float b = tb[index] + (tb[index + 1] - tb[index]) * fraction;
+            maxError = std::max(maxError, std::fabs(out[i] - (0.25f + (a + (b - a) * 0.4f) * 0.5f)));
+            refPhase += increment;
+            if (refPhase >= 1.0f) refPhase -= 1.0f;
+        }
+        report(maxError < 1e-6f && std::fabs(phase - refPhase) < 1e-6f);
+    }
+
+    // Bright table at a high note: far less aliasing than naive playback
+    std::cout << "Testing aliasing... ";
+    {
+        const int table = WavetableBank::FACTORY_TABLES - 1;
+        const int fundamentalBin = 341;                     // ~1998 Hz
+        const float increment = static_cast<float>(fundamentalBin) / ANALYSIS_SIZE;
+
+        std::vector<float> cycle(WavetableBank::TABLE_SIZE);
+        const double harmonic = 1.0 + table * 0.1;
+        for (int i = 0; i < WavetableBank::TABLE_SIZE; ++i) {
+            cycle[i] = static_cast<float>(std::sin(2.0 * M_PI * i / WavetableBank::TABLE_SIZE * harmonic) / harmonic);
+        }
+        float naiveDb = inharmonicEnergyDb(renderNaive(cycle, increment), fundamentalBin);
+
+        std::vector<float> mipped(ANALYSIS_SIZE, 0.0f);
+        float phase = 0.0f;
+        bank.render(table, table, 0.0f, bank.selectLevel(increment), phase, increment, 1.0f,
+                    mipped.data(), mipped.size());
+        float bankDb = inharmonicEnergyDb(mipped, fundamentalBin);
+
+        if (bankDb < naiveDb - 20.0f) {
+            std::cout << "PASS (aliasing " << naiveDb << " dB -> " << bankDb << " dB)\n";
+        } else {
+            std::cout << "FAIL (aliasing " << naiveDb << " dB -> " << bankDb << " dB)\n";
+            allTestsPassed = false;
+        }
+    }
+
+    std::cout << "Testing shared bank... ";
+    {
+        auto first = WavetableBank::getShared();
+        auto second = WavetableBank::getShared();
+        report(first && first == second && first->isValid());
+    }
+
+    std::cout << "\n";
+    if (allTestsPassed) {
+        std::cout << "✅ ALL WAVETABLE BANK TESTS PASSED!\n";
+        return 0;
+    } else {
+        std::cout << "❌ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
@@ -15,18 +15,20 @@ tmp_o2=/tmp/dummy_link_stubs.o
 tmp_o3=/tmp/serial_port.o
 tmp_o4=/tmp/encoder_io.o
 tmp_o5=/tmp/grid_io.o
+tmp_o6=/tmp/event_scheduler.o
 out=/tmp/grid_seq_monolith
 
 "$cxx" $flags "${inc[@]}" -c "$ROOT/grid_sequencer_advanced.cpp" -o "$tmp_o1"
 "$cxx" $flags "${inc[@]}" -c "$ROOT/tests/light_smoke/dummy_link_stubs.cpp" -o "$tmp_o2"
 "$cxx" $flags "${inc[@]}" -c "$ROOT/src/io/SerialPort.cpp" -o "$tmp_o3"
 "$cxx" $flags "${inc[@]}" -c "$ROOT/src/io/EncoderIO.cpp" -o "$tmp_o4"
+"$cxx" $flags "${inc[@]}" -c "$ROOT/src/sequencer/EventScheduler.cpp" -o "$tmp_o6"
 # no GridIO in link test
 
 if [ ${#libs[@]:-0} -gt 0 ]; then
-  linkcmd=("$cxx" $flags -o "$out" "$tmp_o1" "$tmp_o2" "$tmp_o3" "$tmp_o4" "${libs[@]}")
+  linkcmd=("$cxx" $flags -o "$out" "$tmp_o1" "$tmp_o2" "$tmp_o3" "$tmp_o4" "$tmp_o6" "${libs[@]}")
 else
-  linkcmd=("$cxx" $flags -o "$out" "$tmp_o1" "$tmp_o2" "$tmp_o3" "$tmp_o4")
+  linkcmd=("$cxx" $flags -o "$out" "$tmp_o1" "$tmp_o2" "$tmp_o3" "$tmp_o4" "$tmp_o6")
 fi
 
 if "${linkcmd[@]}"; then
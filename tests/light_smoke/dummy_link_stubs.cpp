@@ -38,6 +38,17 @@ float ether_get_memory_usage_kb(void*) { return 1024.0f; }
 float ether_get_cycles_480_per_buffer(void*) { return 1000.0f; }
 float ether_get_cycles_480_per_sample(void*) { return 2.0f; }
 float ether_get_engine_cpu_pct(void*, int) { return 1.0f; }
+int ether_get_render_thread_count(void*) { return 1; }
+void  ether_set_sample_rate(void*, float) {}
+float ether_get_render_thread_cpu_pct(void*, int) { return 1.0f; }
+int   ether_get_voice_limit(void*) { return 128; }
+int   ether_get_voice_steal_count(void*) { return 0; }
+int   ether_telemetry_start(void*, const char*) { return 1; }
+void  ether_telemetry_stop(void*) {}
+int   ether_telemetry_get_stats(void*, int, int, float*, float*, float*) { return 0; }
+int   ether_telemetry_get_overrun_count(void*) { return 0; }
+void  ether_telemetry_report_xrun(void*) {}
+int   ether_telemetry_dump(void*, const char*) { return 1; }
 float ether_get_engine_cycles_480_buf(void*, int) { return 10.0f; }
 float ether_get_engine_cycles_480_smp(void*, int) { return 0.1f; }
 void  ether_set_engine_fx_send(void*, int, int, float) {}
@@ -1,14 +1,33 @@
 // tools/bench_audio.cpp - EtherSynth Audio Processing Benchmark
-// Compile: g++ -std=c++17 -O2 -I. -o bench_audio tools/bench_audio.cpp harmonized_13_engines_bridge.cpp -lportaudio -pthread -lm
+// Compile: g++ -std=c++17 -O2 -I. -Isrc -o bench_audio tools/bench_audio.cpp harmonized_13_engines_bridge.cpp src/engines/*.cpp src/synthesis/SynthEngine_minimal.cpp src/audio/RenderWorkerPool.cpp src/audio/EngineCrossfader.cpp src/audio/VoiceManager.cpp src/audio/WavetableBank.cpp src/audio/FFT.cpp src/audio/AdditiveOscillatorBank.cpp src/audio/PerformanceTelemetry.cpp src/audio/OversamplingProcessor.cpp src/audio/AuxBusMixer.cpp src/audio/ChannelStripBank.cpp src/audio/OfflineRenderer.cpp src/audio/SceneMorphEngine.cpp src/audio/ModalResonatorBank.cpp src/processing/effects/ReverbEffect.cpp src/processing/effects/DelayEffect.cpp src/modulation/GlobalLFOSystem.cpp -pthread -lm
 
-#include "../Sources/CEtherSynth/include/EtherSynthBridge.h"
 #include <iostream>
 #include <chrono>
 #include <vector>
 #include <cmath>
 #include <cstring>
+#include <string>
+#include <algorithm>
 #include <iomanip>
 
+// Bridge API (harmonized_13_engines_bridge.cpp)
+extern "C" {
+    void* ether_create(void);
+    void ether_destroy(void* synth);
+    int ether_initialize(void* synth);
+    void ether_shutdown(void* synth);
+    void ether_process_audio(void* synth, float* outputBuffer, size_t bufferSize);
+    void ether_set_sample_rate(void* synth, float sampleRate);
+    void ether_set_instrument_engine_type(void* synth, int instrument, int engine_type);
+    const char* ether_get_engine_type_name(int engine_type);
+    void ether_set_instrument_parameter(void* synth, int instrument, int param_id, float value);
+    void ether_set_active_instrument(void* synth, int color_index);
+    void ether_note_on(void* synth, int key_index, float velocity, float aftertouch);
+    void ether_set_master_volume(void* synth, float volume);
+    void ether_set_bpm(void* synth, float bpm);
+    void ether_set_render_threads(void* synth, int threads);
+}
+
 #if defined(__APPLE__)
 #include <mach/mach.h>
 #include <mach/mach_time.h>
@@ -23,6 +42,9 @@ struct BenchConfig {
     float cpu_threshold = 75.0f;   // CPU threshold % for failure
     bool verbose = false;          // Detailed logging
     bool enable_engines = true;    // Actually enable engines vs empty processing
+    int engine_type = -1;          // Use this engine type in every slot (-1 = mixed set)
+    int voices = 1;                // Notes held per engine
+    bool engine_sweep = false;     // Per-engine cost vs voice count table
 };
 
 // Performance metrics
@@ -120,6 +142,16 @@ BenchConfig parseArgs(int argc, char* argv[]) {
             config.verbose = true;
         } else if (arg == "--no-engines") {
             config.enable_engines = false;
+        } else if (arg == "--engine-type") {
+            if (i + 1 < argc) {
+                config.engine_type = std::max(0, std::stoi(argv[++i]));
+            }
+        } else if (arg == "--voices") {
+            if (i + 1 < argc) {
+                config.voices = std::clamp(std::stoi(argv[++i]), 1, 16);
+            }
+        } else if (arg == "--engine-sweep") {
+            config.engine_sweep = true;
         } else if (arg == "-h" || arg == "--help") {
             std::cout << "EtherSynth Audio Processing Benchmark\n"
                       << "Usage: " << argv[0] << " [options]\n\n"
@@ -131,6 +163,9 @@ BenchConfig parseArgs(int argc, char* argv[]) {
                       << "  -b, --buffer-size N  Buffer size in frames (32-2048, pow2, default: 128)\n"
                       << "  -v, --verbose        Enable detailed logging\n"
                       << "  --no-engines         Test empty processing (baseline)\n"
+                      << "  --engine-type N      Use engine type N in every slot\n"
+                      << "  --voices N           Notes held per engine (1-16, default: 1)\n"
+                      << "  --engine-sweep       Per-engine block cost for 1/4/8/16 voices\n"
                       << "  -h, --help           Show this help\n\n"
                       << "Exit codes:\n"
                       << "  0 - Benchmark passed (avg CPU < threshold)\n"
@@ -155,32 +190,34 @@ bool setupEngines(void* synth, const BenchConfig& config) {
         0,  // MACRO_VA
         1,  // MACRO_FM  
         8,  // TIDES_OSC
-        12  // CLASSIC_4OP_FM
+        15  // CLASSIC_4OP_FM
     };
     
     std::cout << "  Activating " << config.num_engines << " engines:" << std::endl;
     
     for (int i = 0; i < config.num_engines; i++) {
         int slot = i;
-        int engine_type = engine_types[i % 4];
+        int engine_type = config.engine_type >= 0 ? config.engine_type : engine_types[i % 4];
         
         // Set instrument type (this creates and initializes the engine)
-        ether_set_instrument_type(synth, slot, engine_type);
+        ether_set_instrument_engine_type(synth, slot, engine_type);
         
         // Configure engine with some parameters for realistic load
-        ether_set_parameter(synth, slot, 0, 0.6f);  // HARMONICS
-        ether_set_parameter(synth, slot, 1, 0.4f);  // TIMBRE
-        ether_set_parameter(synth, slot, 2, 0.3f);  // MORPH
-        ether_set_parameter(synth, slot, 10, 0.7f); // VOLUME
+        ether_set_instrument_parameter(synth, slot, 0, 0.6f);  // HARMONICS
+        ether_set_instrument_parameter(synth, slot, 1, 0.4f);  // TIMBRE
+        ether_set_instrument_parameter(synth, slot, 2, 0.3f);  // MORPH
+        ether_set_instrument_parameter(synth, slot, 22, 0.7f); // VOLUME
         
         // Set active instrument to this slot for note triggering
         ether_set_active_instrument(synth, slot);
         
-        // Trigger a sustained note for processing load
-        ether_note_on(synth, 60 + (i * 4), 0.8f, 0.0f); // C4, E4, G4, B4
+        // Trigger sustained notes for processing load
+        for (int v = 0; v < config.voices; v++) {
+            ether_note_on(synth, 48 + (i * 4) + v * 3, 0.8f, 0.0f);
+        }
         
         std::cout << "    Slot " << slot << ": Engine " << engine_type 
-                  << " (Note " << (60 + i * 4) << ")" << std::endl;
+                  << " (" << config.voices << " voice" << (config.voices > 1 ? "s" : "") << ")" << std::endl;
     }
     
     // Set master volume
@@ -206,7 +243,7 @@ PerfMetrics runBenchmark(void* synth, const BenchConfig& config) {
     
     // Warm-up (process a few blocks to stabilize)
     for (int warmup = 0; warmup < 10; warmup++) {
-        ether_render_audio(synth, audio_buffer.data(), config.buffer_size);
+        ether_process_audio(synth, audio_buffer.data(), config.buffer_size);
     }
     
     auto benchmark_start = std::chrono::high_resolution_clock::now();
@@ -216,7 +253,7 @@ PerfMetrics runBenchmark(void* synth, const BenchConfig& config) {
         timer.start();
         
         // Process audio block
-        ether_render_audio(synth, audio_buffer.data(), config.buffer_size);
+        ether_process_audio(synth, audio_buffer.data(), config.buffer_size);
         
         double block_time = timer.stop_ms();
         uint64_t block_cycles = timer.stop_cycles();
@@ -326,12 +363,67 @@ void displayResults(const PerfMetrics& metrics, const BenchConfig& config) {
     }
 }
 
+// Per-engine cost of one block for increasing voice counts (single render thread)
+int runEngineSweep(const BenchConfig& config) {
+    const int engineTypes[] = { 0, 3, 4, 5 };   // MacroVA, MacroWavetable, MacroChord, MacroHarmonics
+    const int voiceCounts[] = { 1, 4, 8, 16 };
+    
+    std::cout << "\n⚡ Engine sweep: " << config.num_blocks << " blocks of " << config.buffer_size
+              << " frames at " << config.sample_rate << " Hz" << std::endl;
+    std::cout << std::setw(18) << "Engine";
+    for (int v : voiceCounts) std::cout << std::setw(10) << (std::to_string(v) + "v us");
+    std::cout << std::setw(16) << "ns/voice/smp" << std::endl;
+    
+    std::vector<float> audio_buffer(config.buffer_size * 2);
+    for (int type : engineTypes) {
+        std::streambuf* saved = std::cout.rdbuf(nullptr);   // The name lookup logs
+        std::string name = ether_get_engine_type_name(type);
+        std::cout.rdbuf(saved);
+        std::cout << std::setw(18) << name << std::flush;
+        double nsPerVoiceSample = 0.0;
+        for (int voices : voiceCounts) {
+            // Engines log creation and notes; keep the table readable
+            saved = std::cout.rdbuf(nullptr);
+            void* synth = ether_create();
+            ether_set_sample_rate(synth, (float)config.sample_rate);
+            ether_initialize(synth);
+            ether_set_render_threads(synth, 1);
+            ether_set_instrument_engine_type(synth, 0, type);
+            ether_set_active_instrument(synth, 0);
+            for (int v = 0; v < voices; v++) {
+                ether_note_on(synth, 36 + v * 5, 0.8f, 0.0f);
+            }
+            for (int warmup = 0; warmup < 10; warmup++) {
+                ether_process_audio(synth, audio_buffer.data(), config.buffer_size);
+            }
+            
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int block = 0; block < config.num_blocks; block++) {
+                ether_process_audio(synth, audio_buffer.data(), config.buffer_size);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            ether_shutdown(synth);
+            ether_destroy(synth);
+            std::cout.rdbuf(saved);
+            
+            double us = std::chrono::duration<double, std::micro>(end - start).count() / config.num_blocks;
+            std::cout << std::setw(10) << std::fixed << std::setprecision(1) << us << std::flush;
+            nsPerVoiceSample = us * 1000.0 / (voices * (double)config.buffer_size);
+        }
+        std::cout << std::setw(16) << std::setprecision(2) << nsPerVoiceSample << std::endl;
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     std::cout << "⚡ EtherSynth Audio Processing Benchmark" << std::endl;
     std::cout << "=======================================" << std::endl;
     
     // Parse configuration
     BenchConfig config = parseArgs(argc, argv);
+    if (config.engine_sweep) {
+        return runEngineSweep(config);
+    }
     
     std::cout << "\n🔧 Configuration:" << std::endl;
     std::cout << "  Engines: " << config.num_engines << std::endl;
@@ -348,6 +440,7 @@ int main(int argc, char* argv[]) {
         std::cerr << "❌ Failed to create EtherSynth instance" << std::endl;
         return 2;
     }
+    ether_set_sample_rate(synth, (float)config.sample_rate);
     
     if (!ether_initialize(synth)) {
         std::cerr << "❌ Failed to initialize EtherSynth" << std::endl;
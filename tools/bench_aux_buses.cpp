@@ -0,0 +1,84 @@
+// tools/bench_aux_buses.cpp - Send/return bus cost per block vs active slots and buses
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_aux_buses tools/bench_aux_buses.cpp src/audio/AuxBusMixer.cpp src/processing/effects/ReverbEffect.cpp src/processing/effects/DelayEffect.cpp
+
+#include "../src/audio/AuxBusMixer.h"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    int blocks = 4000;
+    float sampleRate = 48000.0f;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--blocks" && i + 1 < argc) {
+            blocks = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--sr" && i + 1 < argc) {
+            sampleRate = std::stof(argv[++i]);
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Aux Bus Benchmark\n"
+                      << "Usage: " << argv[0] << " [--blocks N] [--sr HZ]\n";
+            return 0;
+        }
+    }
+
+    // Slot renders stand-in: noise, already post-chain
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    std::vector<EtherAudioBuffer> slotBuffers(AuxBusMixer::MAX_SLOTS);
+    for (auto& buffer : slotBuffers) {
+        for (auto& frame : buffer) frame = AudioFrame(dist(rng), dist(rng));
+    }
+    std::vector<float> output(BUFFER_SIZE * 2, 0.0f);
+    const double blockUs = BUFFER_SIZE / sampleRate * 1e6;
+
+    std::cout << "⚡ EtherSynth Aux Bus Benchmark" << std::endl;
+    std::cout << blocks << " blocks of " << BUFFER_SIZE << " frames @ " << sampleRate << " Hz ("
+              << std::fixed << std::setprecision(1) << blockUs << " us per block)\n" << std::endl;
+    std::cout << std::left << std::setw(8) << "buses" << std::setw(8) << "slots" << std::setw(14) << "us/block"
+              << std::setw(14) << "us/slot" << "% of block\n";
+
+    const int busCounts[] = {1, 2, 4};
+    const int slotCounts[] = {1, 4, 8, 16};
+    for (int busCount : busCounts) {
+        for (int slotCount : slotCounts) {
+            AuxBusMixer mixer;
+            mixer.setSampleRate(sampleRate);
+            for (int bus = 0; bus < busCount; ++bus) {
+                mixer.setBusReturn(bus, bus % 2 ? AuxBusMixer::ReturnType::DELAY : AuxBusMixer::ReturnType::REVERB);
+            }
+            for (int slot = 0; slot < slotCount; ++slot) {
+                for (int bus = 0; bus < busCount; ++bus) {
+                    mixer.setSend(slot, bus, 0.3f);
+                    mixer.setSendTap(slot, bus, slot % 2 ? AuxBusMixer::Tap::PRE : AuxBusMixer::Tap::POST);
+                }
+            }
+
+            auto runBlock = [&] {
+                mixer.beginBlock(BUFFER_SIZE);
+                for (int slot = 0; slot < slotCount; ++slot) {
+                    if (!mixer.hasSends(slot)) continue;
+                    const EtherAudioBuffer* pre = mixer.needsPreTap(slot) ? &slotBuffers[slot] : nullptr;
+                    mixer.addSlot(slot, pre, slotBuffers[slot], BUFFER_SIZE);
+                }
+                mixer.processReturns(output.data(), BUFFER_SIZE);
+            };
+            for (int b = 0; b < 64; ++b) runBlock();   // Warm up
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int b = 0; b < blocks; ++b) runBlock();
+            auto end = std::chrono::high_resolution_clock::now();
+            double us = std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+
+            std::cout << std::left << std::setw(8) << busCount << std::setw(8) << slotCount
+                      << std::setprecision(2) << std::setw(14) << us << std::setw(14) << us / slotCount
+                      << us / blockUs * 100.0 << "\n";
+        }
+    }
+
+    std::cout << "\n✅ Bench complete" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+// tools/bench_channel_strip.cpp - Per-slot post chain: scalar strip per slot vs ChannelStripBank lanes
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_channel_strip tools/bench_channel_strip.cpp src/audio/ChannelStripBank.cpp
+
+#include "../src/audio/ChannelStripBank.h"
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+// The previous bridge post filter: one scalar chain per slot, coefficients
+// recomputed with pow/sin/cos per slot at every control segment
+struct ScalarPostFilter {
+    float sampleRate = 48000.0f;
+    float hpfCut = 20.0f, lpfCut = 20000.0f, lpfQ = 0.707f;
+    float preGain = 1.0f, drive = 0.0f, pan = 0.0f;
+    float hpfA = 0.0f, hx[2] = { }, hy[2] = { };
+    float b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0, z1[2] = { }, z2[2] = { };
+    float panL = 0.70710678f, panR = 0.70710678f;
+
+    void updateHPF(float hz) {
+        hz = std::max(10.0f, std::min(hz, sampleRate * 0.45f));
+        float rc = 1.0f / (2.0f * static_cast<float>(M_PI) * hz);
+        hpfA = rc / (rc + 1.0f / sampleRate);
+    }
+    void updateLPF(float hz, float q) {
+        hz = std::max(20.0f, std::min(hz, sampleRate * 0.45f));
+        q = std::max(0.1f, q);
+        float w0 = 2.0f * static_cast<float>(M_PI) * (hz / sampleRate);
+        float alpha = std::sin(w0) / (2.0f * q), cosw0 = std::cos(w0), a0 = 1 + alpha;
+        b0 = (1 - cosw0) * 0.5f / a0; b1 = (1 - cosw0) / a0; b2 = b0; a1 = -2 * cosw0 / a0; a2 = (1 - alpha) / a0;
+    }
+    void processBlock(EtherAudioBuffer& buffer, size_t frames, const ChannelStripBank::ModBuffers& mod, int interval) {
+        for (size_t start = 0; start < frames; start += interval) {
+            const size_t end = std::min(frames, start + interval), last = end - 1;
+            if (mod[ChannelStripBank::MOD_HPF]) updateHPF(hpfCut * (1.0f + 0.2f * mod[ChannelStripBank::MOD_HPF][last]));
+            if (mod[ChannelStripBank::MOD_LPF_CUTOFF]) {
+                updateLPF(std::max(100.0f, lpfCut * std::pow(2.0f, 0.8f * mod[ChannelStripBank::MOD_LPF_CUTOFF][last])), lpfQ);
+            }
+            float p = mod[ChannelStripBank::MOD_PAN] ? std::clamp(pan + 0.5f * mod[ChannelStripBank::MOD_PAN][last], -1.0f, 1.0f) : pan;
+            float t = (p + 1.0f) * 0.25f * static_cast<float>(M_PI);
+            const float targetL = std::cos(t), targetR = std::sin(t);
+            const float dL = (targetL - panL) / (float)(end - start), dR = (targetR - panR) / (float)(end - start);
+            for (size_t i = start; i < end; ++i) {
+                panL += dL; panR += dR;
+                float x[2] = {buffer[i].left * preGain, buffer[i].right * preGain};
+                for (int ch = 0; ch < 2; ++ch) {
+                    if (drive > 0.001f) x[ch] = std::tanh((1.0f + drive * 5.0f) * x[ch]);
+                    x[ch] *= ch ? panR : panL;
+                    float h = hpfA * (hy[ch] + x[ch] - hx[ch]);
+                    hx[ch] = x[ch]; hy[ch] = h;
+                    float y = b0 * h + z1[ch];
+                    z1[ch] = b1 * h - a1 * y + z2[ch];
+                    z2[ch] = b2 * h - a2 * y;
+                    x[ch] = y;
+                }
+                buffer[i].left = x[0]; buffer[i].right = x[1];
+            }
+            panL = targetL; panR = targetR;
+        }
+    }
+};
+
+int main(int argc, char* argv[]) {
+    int blocks = 20000;
+    int interval = 32;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--blocks" && i + 1 < argc) {
+            blocks = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--interval" && i + 1 < argc) {
+            interval = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Channel Strip Benchmark\n"
+                      << "Usage: " << argv[0] << " [--blocks N] [--interval FRAMES]\n";
+            return 0;
+        }
+    }
+    constexpr int N = ChannelStripBank::MAX_STRIPS;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    std::vector<EtherAudioBuffer> source(N);
+    for (auto& buffer : source) {
+        for (auto& frame : buffer) frame = AudioFrame(dist(rng), dist(rng));
+    }
+    std::vector<float> lfo(BUFFER_SIZE);
+    for (size_t i = 0; i < BUFFER_SIZE; ++i) lfo[i] = std::sin(i * 0.05f);
+
+    std::cout << "⚡ EtherSynth Channel Strip Benchmark" << std::endl;
+    std::cout << blocks << " blocks of " << BUFFER_SIZE << " frames, control interval " << interval << "\n" << std::endl;
+    std::cout << std::left << std::setw(12) << "slots" << std::setw(12) << "modulated" << std::setw(16) << "scalar us/slot"
+              << std::setw(16) << "bank us/slot" << "speedup\n";
+
+    for (int slots : {4, 8, 16}) {
+        for (bool modulated : {false, true}) {
+            std::vector<ChannelStripBank::ModBuffers> mods(N);
+            for (int s = 0; s < slots && modulated; ++s) {
+                mods[s][ChannelStripBank::MOD_LPF_CUTOFF] = lfo.data();
+                mods[s][ChannelStripBank::MOD_PAN] = lfo.data();
+            }
+            std::vector<ScalarPostFilter> scalar(N);
+            ChannelStripBank bank;
+            for (int s = 0; s < N; ++s) {
+                scalar[s].updateHPF(40.0f + s); scalar[s].updateLPF(2000.0f + 500.0f * s, 1.2f);
+                bank.setHPF(s, 40.0f + s); bank.setLPF(s, 2000.0f + 500.0f * s, 1.2f);
+                scalar[s].drive = 0.2f; bank.setDrive(s, 0.2f);
+            }
+            std::vector<EtherAudioBuffer> buffers = source;
+            EtherAudioBuffer* ptrs[N] = { };
+            for (int s = 0; s < slots; ++s) ptrs[s] = &buffers[s];
+
+            auto t0 = std::chrono::high_resolution_clock::now();
+            for (int b = 0; b < blocks; ++b) {
+                for (int s = 0; s < slots; ++s) {
+                    buffers[s] = source[s];
+                    scalar[s].processBlock(buffers[s], BUFFER_SIZE, mods[s], interval);
+                }
+            }
+            auto t1 = std::chrono::high_resolution_clock::now();
+            for (int b = 0; b < blocks; ++b) {
+                for (int s = 0; s < slots; ++s) buffers[s] = source[s];
+                bank.processBlock(ptrs, mods.data(), BUFFER_SIZE, interval);
+            }
+            auto t2 = std::chrono::high_resolution_clock::now();
+
+            double scalarUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / blocks / slots;
+            double bankUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / blocks / slots;
+            std::cout << std::left << std::setw(12) << slots << std::setw(12) << (modulated ? "yes" : "no")
+                      << std::fixed << std::setprecision(3) << std::setw(16) << scalarUs << std::setw(16) << bankUs
+                      << std::setprecision(1) << scalarUs / bankUs << "x\n";
+        }
+    }
+
+    std::cout << "\n✅ Bench complete" << std::endl;
+    return 0;
+}
@@ -0,0 +1,116 @@
+// tools/bench_fft.cpp - FFT vs legacy DFT microbenchmark
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_fft tools/bench_fft.cpp src/audio/FFT.cpp
+
+#include "../src/audio/FFT.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <iomanip>
+
+// The DFT previously used by SpectrumAnalyzer::performFFT
+static void legacyDFT(const std::vector<float>& input, std::vector<std::complex<float>>& output) {
+    const float two_pi = 2.0f * M_PI;
+    const int N = static_cast<int>(input.size());
+
+    for (int k = 0; k < N; k++) {
+        std::complex<float> sum(0.0f, 0.0f);
+
+        for (int n = 0; n < N; n++) {
+            float angle = -two_pi * k * n / N;
+            std::complex<float> w(std::cos(angle), std::sin(angle));
+            sum += input[n] * w;
+        }
+
+        output[k] = sum;
+    }
+}
+
+template<typename Func>
+static double timeUs(Func func, int iterations) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = 2000;
+    bool skipLegacy = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max(10, std::stoi(argv[++i]));
+        } else if (arg == "--no-legacy") {
+            skipLegacy = true;
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth FFT Benchmark\n"
+                      << "Usage: " << argv[0] << " [--iterations N] [--no-legacy]\n";
+            return 0;
+        }
+    }
+
+    const double sampleRate = 48000.0;
+
+    std::cout << "⚡ EtherSynth FFT Benchmark" << std::endl;
+    std::cout << "==========================" << std::endl;
+    std::cout << std::setw(6) << "Size"
+              << std::setw(14) << "DFT (us)"
+              << std::setw(14) << "Real (us)"
+              << std::setw(16) << "Complex (us)"
+              << std::setw(12) << "Speedup"
+              << std::setw(14) << "Real %RT" << std::endl;
+
+    volatile float sink = 0.0f;
+
+    for (int size : {256, 512, 1024, 2048, 4096}) {
+        std::vector<float> input(size);
+        for (int i = 0; i < size; ++i) {
+            input[i] = std::sin(0.05f * i) + 0.25f * std::sin(0.71f * i);
+        }
+
+        FFT fft(size);
+        std::vector<float> re(fft.getNumBins()), im(fft.getNumBins());
+        std::vector<float> cre(size), cim(size);
+
+        double realUs = timeUs([&]() {
+            fft.forwardReal(input.data(), re.data(), im.data());
+            sink = sink + re[1];
+        }, iterations);
+
+        double complexUs = timeUs([&]() {
+            std::copy(input.begin(), input.end(), cre.begin());
+            std::fill(cim.begin(), cim.end(), 0.0f);
+            fft.forwardComplex(cre.data(), cim.data());
+            sink = sink + cre[1];
+        }, iterations);
+
+        double dftUs = 0.0;
+        if (!skipLegacy) {
+            std::vector<std::complex<float>> out(size);
+            int dftIterations = std::max(1, iterations / (size / 64));
+            dftUs = timeUs([&]() {
+                legacyDFT(input, out);
+                sink = sink + out[1].real();
+            }, dftIterations);
+        }
+
+        // Share of one hop (window / 2) of real time spent in the transform
+        double hopUs = (size / 2) / sampleRate * 1e6;
+
+        std::cout << std::setw(6) << size << std::fixed << std::setprecision(2)
+                  << std::setw(14) << (skipLegacy ? 0.0 : dftUs)
+                  << std::setw(14) << realUs
+                  << std::setw(16) << complexUs
+                  << std::setw(11) << std::setprecision(0) << (skipLegacy ? 0.0 : dftUs / realUs) << "x"
+                  << std::setw(13) << std::setprecision(3) << (realUs / hopUs * 100.0) << "%"
+                  << std::endl;
+    }
+
+    return sink == 12345.0f ? 1 : 0;
+}
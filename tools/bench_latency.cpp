@@ -0,0 +1,153 @@
+// tools/bench_latency.cpp - Callback cost vs buffer size / sample rate sweep
+// Compile: g++ -std=c++17 -O2 -I. -Isrc -o bench_latency tools/bench_latency.cpp harmonized_13_engines_bridge.cpp src/engines/*.cpp src/synthesis/SynthEngine_minimal.cpp src/audio/RenderWorkerPool.cpp src/audio/EngineCrossfader.cpp src/audio/VoiceManager.cpp src/audio/WavetableBank.cpp src/audio/FFT.cpp src/audio/AdditiveOscillatorBank.cpp src/audio/PerformanceTelemetry.cpp src/audio/OversamplingProcessor.cpp src/audio/AuxBusMixer.cpp src/audio/ChannelStripBank.cpp src/audio/OfflineRenderer.cpp src/audio/SceneMorphEngine.cpp src/audio/ModalResonatorBank.cpp src/processing/effects/ReverbEffect.cpp src/processing/effects/DelayEffect.cpp src/modulation/GlobalLFOSystem.cpp -pthread -lm
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iomanip>
+#include <cstddef>
+
+extern "C" {
+    void* ether_create(void);
+    void ether_destroy(void* synth);
+    int ether_initialize(void* synth);
+    void ether_shutdown(void* synth);
+    void ether_process_audio(void* synth, float* outputBuffer, size_t bufferSize);
+    void ether_set_sample_rate(void* synth, float sampleRate);
+    int ether_get_max_block_size(void);
+    void ether_set_instrument_engine_type(void* synth, int instrument, int engine_type);
+    void ether_set_active_instrument(void* synth, int color_index);
+    void ether_note_on(void* synth, int key_index, float velocity, float aftertouch);
+    void ether_set_render_threads(void* synth, int threads);
+}
+
+struct LatencyResult {
+    double latencyMs = 0.0;    // One buffer of output latency
+    double meanUs = 0.0;
+    double p99Us = 0.0;
+    double maxUs = 0.0;
+    double meanCpuPct = 0.0;   // Mean callback time vs buffer duration
+    double peakCpuPct = 0.0;   // Worst callback vs buffer duration
+};
+
+// Engines log to std::cout on creation and note events; keep the table readable
+struct QuietStdout {
+    std::streambuf* saved = std::cout.rdbuf(nullptr);
+    ~QuietStdout() { std::cout.rdbuf(saved); }
+};
+
+static LatencyResult measure(int sampleRate, int bufferSize, int engines, int threads, double seconds) {
+    QuietStdout quiet;
+    void* synth = ether_create();
+    ether_set_sample_rate(synth, (float)sampleRate);
+    ether_initialize(synth);
+    if (threads >= 0) ether_set_render_threads(synth, threads);
+
+    // A realistic mix: one held chord per engine
+    const int engineTypes[] = { 0, 1, 8, 12, 3, 4, 5, 2 };
+    for (int slot = 0; slot < engines; ++slot) {
+        ether_set_instrument_engine_type(synth, slot, engineTypes[slot % 8]);
+        ether_set_active_instrument(synth, slot);
+        for (int n = 0; n < 3; ++n) {
+            ether_note_on(synth, 48 + slot * 2 + n * 4, 0.8f, 0.0f);
+        }
+    }
+
+    std::vector<float> buffer((size_t)bufferSize * 2);
+    for (int i = 0; i < 50; ++i) {
+        ether_process_audio(synth, buffer.data(), (size_t)bufferSize);
+    }
+
+    const int callbacks = std::max(100, (int)(seconds * sampleRate / bufferSize));
+    std::vector<double> times;
+    times.reserve(callbacks);
+    for (int i = 0; i < callbacks; ++i) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ether_process_audio(synth, buffer.data(), (size_t)bufferSize);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+
+    ether_shutdown(synth);
+    ether_destroy(synth);
+
+    LatencyResult r;
+    const double budgetUs = (double)bufferSize / sampleRate * 1e6;
+    r.latencyMs = budgetUs / 1000.0;
+    double sum = 0.0;
+    for (double t : times) sum += t;
+    r.meanUs = sum / times.size();
+    std::sort(times.begin(), times.end());
+    r.p99Us = times[(size_t)(0.99 * (times.size() - 1))];
+    r.maxUs = times.back();
+    r.meanCpuPct = r.meanUs / budgetUs * 100.0;
+    r.peakCpuPct = r.maxUs / budgetUs * 100.0;
+    return r;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<int> sampleRates = { 48000, 96000 };
+    std::vector<int> bufferSizes = { 32, 64, 128, 256, 512 };
+    int engines = 4;
+    int threads = -1;
+    double seconds = 5.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "-s" || arg == "--sample-rate") && i + 1 < argc) {
+            sampleRates = { std::stoi(argv[++i]) };
+        } else if ((arg == "-b" || arg == "--buffer-size") && i + 1 < argc) {
+            bufferSizes = { std::max(1, std::stoi(argv[++i])) };
+        } else if ((arg == "-e" || arg == "--engines") && i + 1 < argc) {
+            engines = std::clamp(std::stoi(argv[++i]), 1, 16);
+        } else if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+            threads = std::max(1, std::stoi(argv[++i]));
+        } else if ((arg == "-d" || arg == "--seconds") && i + 1 < argc) {
+            seconds = std::max(0.1, std::stod(argv[++i]));
+        } else if (arg == "-h" || arg == "--help") {
+            std::cout << "EtherSynth Latency Benchmark\n"
+                      << "Usage: " << argv[0] << " [options]\n\n"
+                      << "Options:\n"
+                      << "  -s, --sample-rate N  Only this sample rate (default: 48000 and 96000)\n"
+                      << "  -b, --buffer-size N  Only this buffer size (default: 32..512)\n"
+                      << "  -e, --engines N      Active engines (1-16, default: 4)\n"
+                      << "  -j, --threads N      Render threads incl. audio thread (default: auto)\n"
+                      << "  -d, --seconds S      Audio rendered per configuration (default: 5)\n";
+            return 0;
+        }
+    }
+
+    std::cout << "⚡ EtherSynth Latency Benchmark" << std::endl;
+    std::cout << "==============================" << std::endl;
+    std::cout << "Engines: " << engines << ", max engine block: " << ether_get_max_block_size()
+              << " frames" << std::endl << std::endl;
+    std::cout << std::setw(8) << "Rate"
+              << std::setw(8) << "Buffer"
+              << std::setw(12) << "Latency ms"
+              << std::setw(12) << "Mean us"
+              << std::setw(12) << "p99 us"
+              << std::setw(12) << "Max us"
+              << std::setw(10) << "CPU %"
+              << std::setw(10) << "Peak %" << std::endl;
+
+    bool overrun = false;
+    for (int sr : sampleRates) {
+        for (int bs : bufferSizes) {
+            LatencyResult r = measure(sr, bs, engines, threads, seconds);
+            overrun = overrun || r.peakCpuPct >= 100.0;
+            std::cout << std::setw(8) << sr
+                      << std::setw(8) << bs << std::fixed
+                      << std::setw(12) << std::setprecision(3) << r.latencyMs
+                      << std::setw(12) << std::setprecision(1) << r.meanUs
+                      << std::setw(12) << r.p99Us
+                      << std::setw(12) << r.maxUs
+                      << std::setw(10) << r.meanCpuPct
+                      << std::setw(10) << r.peakCpuPct
+                      << (r.peakCpuPct >= 100.0 ? "  ⚠️ overrun" : "") << std::endl;
+        }
+    }
+
+    return overrun ? 1 : 0;
+}
@@ -0,0 +1,107 @@
+// tools/bench_modal_engines.cpp - Per-voice cost of the physical-model engines at 48 kHz / 128 frames
+// Compile: g++ -std=c++17 -O2 -I. -Isrc -o bench_modal_engines tools/bench_modal_engines.cpp src/engines/RingsVoiceEngine.cpp src/engines/ElementsVoiceEngine.cpp src/engines/ModalVoiceEngine.cpp src/audio/ModalResonatorBank.cpp src/synthesis/SynthEngine_minimal.cpp
+
+#include "../src/engines/RingsVoiceEngine.h"
+#include "../src/engines/ElementsVoiceEngine.h"
+#include "../src/engines/ModalVoiceEngine.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr float RATE = 48000.0f;
+    constexpr double BLOCK_US = 1e6 * BUFFER_SIZE / RATE;   // 2666.7 us of audio per block
+
+    struct Result {
+        double usPerBlock;
+        double activeVoices;    // Average sounding voices, release tails included
+        double peak;
+    };
+
+    // Hold `voices` notes and render `blocks` blocks, retriggering so every voice stays busy
+    Result run(SynthEngine& engine, int voices, int blocks) {
+        engine.setSampleRate(RATE);
+        engine.setBufferSize(BUFFER_SIZE);
+        engine.setVoiceCount(voices);
+        EtherAudioBuffer buffer;
+        double peak = 0.0, active = 0.0;
+
+        auto strike = [&] {
+            for (int v = 0; v < voices; ++v) engine.noteOn(static_cast<uint8_t>(48 + v * 3), 0.8f);
+        };
+        strike();
+        for (int i = 0; i < 8; ++i) engine.processAudio(buffer);   // Warm up
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int b = 0; b < blocks; ++b) {
+            if (b % 375 == 0) {                                    // Every 1 s
+                for (int v = 0; v < voices; ++v) engine.noteOff(static_cast<uint8_t>(48 + v * 3));
+                strike();
+            }
+            engine.processAudio(buffer);
+            active += static_cast<double>(engine.getActiveVoiceCount());
+            for (const auto& f : buffer) peak = std::max(peak, static_cast<double>(std::max(std::fabs(f.left), std::fabs(f.right))));
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        return {std::chrono::duration<double, std::micro>(t1 - t0).count() / blocks, active / blocks, peak};
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int blocks = 3750;      // 10 s of audio
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--blocks" && i + 1 < argc) {
+            blocks = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Modal Engine Benchmark\n"
+                      << "Usage: " << argv[0] << " [--blocks N]\n";
+            return 0;
+        }
+    }
+
+    std::cout << "⚡ EtherSynth Modal Engine Benchmark" << std::endl;
+    std::cout << blocks << " blocks of " << BUFFER_SIZE << " frames at " << RATE / 1000.0f << " kHz ("
+              << std::fixed << std::setprecision(1) << BLOCK_US << " us per block)\n" << std::endl;
+
+    const std::vector<std::pair<const char*, std::function<std::unique_ptr<SynthEngine>()>>> engines = {
+        {"RingsVoice",    [] { return std::make_unique<RingsVoiceEngine>(); }},
+        {"ElementsVoice", [] { return std::make_unique<ElementsVoiceEngine>(); }},
+        {"RingsModal",    [] { return std::make_unique<ModalVoiceEngine>(ModalVoiceEngine::Model::RINGS); }},
+        {"ElementsModal", [] { return std::make_unique<ModalVoiceEngine>(ModalVoiceEngine::Model::ELEMENTS); }},
+    };
+
+    std::cout << std::left << std::setw(16) << "Engine" << std::right << std::setw(8) << "Voices"
+              << std::setw(10) << "Modes" << std::setw(10) << "Active" << std::setw(12) << "us/block" << std::setw(12) << "us/voice"
+              << std::setw(10) << "CPU %" << std::setw(10) << "Peak" << "\n";
+    for (const auto& entry : engines) {
+        for (int voices : {1, 4, 8}) {
+            // The older engines log every note and lifecycle step; keep the table readable
+            std::streambuf* console = std::cout.rdbuf(nullptr);
+            Result r;
+            EngineType type;
+            {
+                std::unique_ptr<SynthEngine> engine = entry.second();
+                r = run(*engine, voices, blocks);
+                type = engine->getType();
+            }
+            std::cout.rdbuf(console);
+            // Modal engines trade modes for voices like Rings; the older engines have fixed 4-resonator banks
+            const int modes = (type == EngineType::RINGS_MODAL || type == EngineType::ELEMENTS_MODAL)
+                ? std::min(64, std::max(16, 128 / voices)) : 4;
+            std::cout << std::left << std::setw(16) << entry.first << std::right << std::setw(8) << voices
+                      << std::setw(10) << modes << std::setprecision(2) << std::setw(10) << r.activeVoices
+                      << std::setw(12) << r.usPerBlock << std::setw(12) << r.usPerBlock / std::max(r.activeVoices, 1.0)
+                      << std::setw(10) << 100.0 * r.usPerBlock / BLOCK_US
+                      << std::setw(10) << r.peak << "\n";
+        }
+    }
+
+    std::cout << "\n✅ Bench complete" << std::endl;
+    return 0;
+}
@@ -0,0 +1,123 @@
+// tools/bench_offline_render.cpp - Offline bounce speed and determinism through the bridge
+// Compile: g++ -std=c++17 -O2 -I. -Isrc -o bench_offline_render tools/bench_offline_render.cpp harmonized_13_engines_bridge.cpp src/engines/*.cpp src/synthesis/SynthEngine_minimal.cpp src/audio/RenderWorkerPool.cpp src/audio/EngineCrossfader.cpp src/audio/VoiceManager.cpp src/audio/WavetableBank.cpp src/audio/FFT.cpp src/audio/AdditiveOscillatorBank.cpp src/audio/PerformanceTelemetry.cpp src/audio/OversamplingProcessor.cpp src/audio/AuxBusMixer.cpp src/audio/ChannelStripBank.cpp src/audio/OfflineRenderer.cpp src/audio/SceneMorphEngine.cpp src/audio/ModalResonatorBank.cpp src/processing/effects/ReverbEffect.cpp src/processing/effects/DelayEffect.cpp src/modulation/GlobalLFOSystem.cpp -pthread -lm
+
+#include "../src/audio/OfflineRenderer.h"
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Bridge API (harmonized_13_engines_bridge.cpp)
+extern "C" {
+    void* ether_create(void);
+    void ether_destroy(void* synth);
+    int ether_initialize(void* synth);
+    void ether_set_instrument_engine_type(void* synth, int instrument, int engine_type);
+    const char* ether_get_engine_type_name(int engine_type);
+    void ether_set_active_instrument(void* synth, int color_index);
+    void ether_set_engine_fx_send(void* synth, int instrument, int which, float value);
+    void ether_set_lfo_waveform(void* synth, unsigned char lfo_id, unsigned char waveform);
+    void ether_assign_lfo_to_param_id(void* synth, int instrument, int lfoIndex, int paramId, float depth);
+    void ether_set_render_threads(void* synth, int threads);
+    int ether_render_offline(void* synth, const char* path, const OfflineRenderer::Event* events, int eventCount,
+                             uint64_t frames, int format);
+}
+
+namespace {
+    // MacroVA, Rings, Elements, Noise, Granular, SlideAccentBass, DrumKit, Tides, MacroFM, 4-op FM
+    const int SONG_ENGINES[] = {0, 9, 10, 7, 16, 14, 11, 8, 1, 15};
+    constexpr int SONG_ENGINE_COUNT = sizeof(SONG_ENGINES) / sizeof(SONG_ENGINES[0]);
+
+    // A 16th-note song at 120 BPM: every slot plays a note each bar, staggered by a step
+    std::vector<OfflineRenderer::Event> makeSong(int slots, uint64_t frames) {
+        const uint64_t stepFrames = 48000 / 8;
+        std::vector<OfflineRenderer::Event> events;
+        for (uint64_t step = 0; step * stepFrames < frames; ++step) {
+            const int slot = (int)(step % (uint64_t)slots);
+            const bool drum = SONG_ENGINES[slot % SONG_ENGINE_COUNT] == 11;
+            const int note = drum ? 36 + (int)(step % 4) : 48 + (int)(step * 7 % 24);
+            const uint64_t on = step * stepFrames;
+            events.push_back({on, OfflineRenderer::NOTE_ON, slot, note, 0.8f});
+            events.push_back({on + stepFrames * 3 / 4, OfflineRenderer::NOTE_OFF, slot, note, 0.0f});
+        }
+        return events;
+    }
+
+    bool renderSong(const std::string& path, int slots, int threads, uint64_t frames, int format, double& seconds) {
+        void* synth = ether_create();
+        ether_initialize(synth);
+        if (threads > 0) ether_set_render_threads(synth, threads);
+        for (int slot = 0; slot < slots; ++slot) {
+            ether_set_instrument_engine_type(synth, slot, SONG_ENGINES[slot % SONG_ENGINE_COUNT]);
+            ether_set_active_instrument(synth, slot);
+            ether_set_lfo_waveform(synth, 0, 6);   // Sample & hold on the cutoff
+            ether_assign_lfo_to_param_id(synth, slot, 0, static_cast<int>(ParameterID::FILTER_CUTOFF), 0.4f);
+            ether_set_engine_fx_send(synth, slot, 0, 0.3f);
+            ether_set_engine_fx_send(synth, slot, 1, 0.2f);
+        }
+        std::vector<OfflineRenderer::Event> events = makeSong(slots, frames);
+        auto start = std::chrono::steady_clock::now();
+        bool ok = ether_render_offline(synth, path.c_str(), events.data(), (int)events.size(), frames, format) != 0;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        ether_destroy(synth);
+        return ok;
+    }
+
+    std::vector<char> readFile(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+}
+
+int main(int argc, char* argv[]) {
+    double songSeconds = 300.0;
+    int slots = SONG_ENGINE_COUNT;
+    int threads = 0;   // 0 = bridge default (all cores)
+    int format = 1;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--seconds" && i + 1 < argc) {
+            songSeconds = std::max(1.0, std::stod(argv[++i]));
+        } else if (arg == "--slots" && i + 1 < argc) {
+            slots = std::max(1, std::min(16, std::stoi(argv[++i])));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--format" && i + 1 < argc) {
+            format = std::max(0, std::min(2, std::stoi(argv[++i])));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Offline Render Benchmark\n"
+                      << "Usage: " << argv[0] << " [--seconds S] [--slots N] [--threads N] [--format 0|1|2]\n";
+            return 0;
+        }
+    }
+    const uint64_t frames = (uint64_t)(songSeconds * 48000.0);
+    const std::string pathA = "/tmp/ether_bench_offline_a.wav", pathB = "/tmp/ether_bench_offline_b.wav";
+
+    std::cout << "⚡ EtherSynth Offline Render Benchmark" << std::endl;
+    std::cout << songSeconds << " s song, " << slots << " slots, " << (threads > 0 ? std::to_string(threads) : "all")
+              << " render threads\n" << std::endl;
+
+    double secondsA = 0.0, secondsB = 0.0;
+    bool ok = renderSong(pathA, slots, threads, frames, format, secondsA);
+    ok = renderSong(pathB, slots, threads, frames, format, secondsB) && ok;
+    const bool identical = ok && readFile(pathA) == readFile(pathB);
+    std::remove(pathA.c_str());
+    std::remove(pathB.c_str());
+
+    std::cout << "\n" << std::fixed << std::setprecision(2)
+              << "Render time:     " << secondsA << " s / " << secondsB << " s\n"
+              << "Realtime factor: " << songSeconds / secondsA << "x\n"
+              << "Per song minute: " << secondsA * 60.0 / songSeconds << " s\n"
+              << "Bit-identical:   " << (identical ? "yes" : "NO") << std::endl;
+
+    if (!ok || !identical) {
+        std::cout << "\n❌ Bench failed" << std::endl;
+        return 1;
+    }
+    std::cout << "\n✅ Bench complete" << std::endl;
+    return 0;
+}
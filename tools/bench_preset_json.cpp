@@ -0,0 +1,283 @@
+// tools/bench_preset_json.cpp - Preset library JSON: JsonReader/JsonWriter vs find/substr scanning
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_preset_json tools/bench_preset_json.cpp src/core/JsonStream.cpp
+
+#include "../src/core/JsonStream.h"
+#include <iostream>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+
+static constexpr int PARAMS_PER_SECTION = 12;
+static const char* SECTIONS[] = {"hold_params", "twist_params", "morph_params", "fx_params"};
+
+struct BenchPreset {
+    std::string name;
+    std::string author;
+    int engineType = 0;
+    std::vector<std::string> tags;
+    std::unordered_map<std::string, float> params[4];
+};
+
+static BenchPreset makePreset(int index) {
+    BenchPreset preset;
+    preset.name = "Preset " + std::to_string(index);
+    preset.author = (index % 3) ? "Factory" : "User";
+    preset.engineType = index % 32;
+    preset.tags = {"tag" + std::to_string(index % 17), index % 2 ? "pad" : "lead"};
+    for (int s = 0; s < 4; ++s) {
+        for (int p = 0; p < PARAMS_PER_SECTION; ++p) {
+            preset.params[s][std::string(SECTIONS[s]) + "_" + std::to_string(p)] = ((index + p * 7) % 1000) / 1000.0f;
+        }
+    }
+    return preset;
+}
+
+// The previous approach: ostringstream with fixed precision
+static std::string legacyWrite(const BenchPreset& preset) {
+    std::ostringstream json;
+    json << "{\n  \"preset_info\": {\n";
+    json << "    \"name\": \"" << preset.name << "\",\n";
+    json << "    \"author\": \"" << preset.author << "\",\n";
+    json << "    \"engine_type\": " << preset.engineType << ",\n";
+    json << "    \"tags\": [";
+    for (size_t i = 0; i < preset.tags.size(); ++i) json << (i ? ", " : "") << "\"" << preset.tags[i] << "\"";
+    json << "]\n  }";
+    for (int s = 0; s < 4; ++s) {
+        json << ",\n  \"" << SECTIONS[s] << "\": {\n";
+        bool first = true;
+        for (const auto& [name, value] : preset.params[s]) {
+            json << (first ? "" : ",\n") << "    \"" << name << "\": " << std::fixed << std::setprecision(3) << value;
+            first = false;
+        }
+        json << "\n  }";
+    }
+    json << "\n}";
+    return json.str();
+}
+
+// The previous approach: locate each field and section with find() and copy it out with substr()
+static bool legacyRead(const std::string& json, BenchPreset& preset) {
+    auto field = [&](const char* key, std::string& out) {
+        size_t pos = json.find(key);
+        if (pos == std::string::npos) return;
+        pos = json.find('"', json.find(':', pos) + 1) + 1;
+        out = json.substr(pos, json.find('"', pos) - pos);
+    };
+    field("\"name\"", preset.name);
+    field("\"author\"", preset.author);
+    size_t enginePos = json.find("\"engine_type\": ");
+    if (enginePos != std::string::npos) preset.engineType = std::stoi(json.substr(enginePos + 15));
+    size_t tagsPos = json.find("\"tags\": [");
+    if (tagsPos != std::string::npos) {
+        size_t tagsEnd = json.find(']', tagsPos);
+        for (size_t pos = json.find('"', tagsPos + 8); pos < tagsEnd; pos = json.find('"', pos + 1)) {
+            size_t close = json.find('"', pos + 1);
+            preset.tags.push_back(json.substr(pos + 1, close - pos - 1));
+            pos = close;
+        }
+    }
+    for (int s = 0; s < 4; ++s) {
+        size_t start = json.find("\"" + std::string(SECTIONS[s]) + "\"");
+        if (start == std::string::npos) return false;
+        start = json.find('{', start);
+        std::string section = json.substr(start + 1, json.find('}', start) - start - 1);
+        std::istringstream lines(section);
+        std::string line;
+        while (std::getline(lines, line)) {
+            size_t q1 = line.find('"'), q2 = line.find('"', q1 + 1), colon = line.find(':', q2);
+            if (q1 == std::string::npos || colon == std::string::npos) continue;
+            preset.params[s][line.substr(q1 + 1, q2 - q1 - 1)] = std::stof(line.substr(colon + 1));
+        }
+    }
+    return true;
+}
+
+static void streamWrite(JsonWriter& json, const BenchPreset& preset) {
+    json.beginObject();
+    json.key("preset_info");
+    json.beginObject();
+    json.member("name", preset.name);
+    json.member("author", preset.author);
+    json.member("engine_type", preset.engineType);
+    json.key("tags");
+    json.beginArray(true);
+    for (const auto& tag : preset.tags) json.value(tag);
+    json.endArray();
+    json.endObject();
+    for (int s = 0; s < 4; ++s) {
+        json.key(SECTIONS[s]);
+        json.beginObject();
+        for (const auto& [name, value] : preset.params[s]) json.member(name, value);
+        json.endObject();
+    }
+    json.endObject();
+}
+
+enum Key { NAME, AUTHOR, ENGINE_TYPE, TAGS, PRESET_INFO, HOLD, TWIST, MORPH, FX, PRESETS };
+constexpr JsonKey kKeys[] = {
+    {"name", NAME}, {"author", AUTHOR}, {"engine_type", ENGINE_TYPE}, {"tags", TAGS},
+    {"preset_info", PRESET_INFO}, {"hold_params", HOLD}, {"twist_params", TWIST},
+    {"morph_params", MORPH}, {"fx_params", FX}, {"presets", PRESETS}
+};
+constexpr auto kKeyMap = makeJsonKeyMap(kKeys);
+
+static bool streamRead(JsonReader& reader, BenchPreset& preset) {
+    std::string_view key;
+    int64_t number = 0;
+    if (!reader.beginObject()) return false;
+    while (reader.nextMember(key)) {
+        const int id = kKeyMap.find(key);
+        if (id == PRESET_INFO) {
+            reader.beginObject();
+            while (reader.nextMember(key)) {
+                switch (kKeyMap.find(key)) {
+                    case NAME: reader.readString(preset.name); break;
+                    case AUTHOR: reader.readString(preset.author); break;
+                    case ENGINE_TYPE: if (reader.readInt(number)) preset.engineType = static_cast<int>(number); break;
+                    case TAGS:
+                        reader.beginArray();
+                        while (reader.nextElement()) {
+                            preset.tags.emplace_back();
+                            reader.readString(preset.tags.back());
+                        }
+                        break;
+                    default: reader.skipValue(); break;
+                }
+            }
+        } else if (id >= HOLD && id <= FX) {
+            auto& params = preset.params[id - HOLD];
+            float value = 0.0f;
+            reader.beginObject();
+            while (reader.nextMember(key)) {
+                if (reader.readFloat(value)) params[std::string(key)] = value;
+            }
+        } else {
+            reader.skipValue();
+        }
+    }
+    return !reader.hasError();
+}
+
+// Index by engine:name and run a tag + author search, as the library does at startup
+static size_t indexAndSearch(const std::vector<BenchPreset>& presets) {
+    std::unordered_map<std::string, const BenchPreset*> index;
+    index.reserve(presets.size());
+    for (const auto& preset : presets) index.emplace(std::to_string(preset.engineType) + ":" + preset.name, &preset);
+    size_t hits = 0;
+    for (const auto& preset : presets) {
+        hits += preset.author == "User" && std::find(preset.tags.begin(), preset.tags.end(), "pad") != preset.tags.end();
+    }
+    return hits + (index.count("5:Preset 5") ? 1 : 0);
+}
+
+template<typename Func>
+static double bestMs(Func func, int runs) {
+    double best = 1e30;
+    for (int r = 0; r < runs; ++r) {
+        auto start = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int presetCount = 5000;
+    int runs = 5;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--presets" && i + 1 < argc) {
+            presetCount = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Preset JSON Benchmark\n"
+                      << "Usage: " << argv[0] << " [--presets N] [--runs N]\n";
+            return 0;
+        }
+    }
+
+    std::vector<BenchPreset> presets;
+    presets.reserve(presetCount);
+    for (int i = 0; i < presetCount; ++i) presets.push_back(makePreset(i));
+
+    std::cout << "⚡ EtherSynth Preset JSON Benchmark" << std::endl;
+    std::cout << presetCount << " presets x " << 4 * PARAMS_PER_SECTION << " params, best of " << runs << " runs\n" << std::endl;
+
+    // One document per preset, as saved to the preset directory
+    std::vector<std::string> legacyDocs, streamDocs;
+    double legacyWriteMs = bestMs([&] {
+        legacyDocs.clear();
+        for (const auto& preset : presets) legacyDocs.push_back(legacyWrite(preset));
+    }, runs);
+    double streamWriteMs = bestMs([&] {
+        streamDocs.clear();
+        for (const auto& preset : presets) {
+            streamDocs.emplace_back();
+            JsonWriter writer(streamDocs.back());
+            streamWrite(writer, preset);
+        }
+    }, runs);
+
+    size_t legacyHits = 0, streamHits = 0;
+    double legacyLoadMs = bestMs([&] {
+        std::vector<BenchPreset> loaded(legacyDocs.size());
+        for (size_t i = 0; i < legacyDocs.size(); ++i) legacyRead(legacyDocs[i], loaded[i]);
+        legacyHits = indexAndSearch(loaded);
+    }, runs);
+    double streamLoadMs = bestMs([&] {
+        std::vector<BenchPreset> loaded(streamDocs.size());
+        for (size_t i = 0; i < streamDocs.size(); ++i) {
+            JsonReader reader(streamDocs[i]);
+            streamRead(reader, loaded[i]);
+        }
+        streamHits = indexAndSearch(loaded);
+    }, runs);
+
+    // The whole library as one exported document
+    std::string library;
+    JsonWriter libraryWriter(library);
+    libraryWriter.beginObject();
+    libraryWriter.key("presets");
+    libraryWriter.beginArray();
+    for (const auto& preset : presets) streamWrite(libraryWriter, preset);
+    libraryWriter.endArray();
+    libraryWriter.endObject();
+    size_t libraryHits = 0;
+    double libraryLoadMs = bestMs([&] {
+        std::vector<BenchPreset> loaded;
+        loaded.reserve(presets.size());
+        JsonReader reader(library);
+        std::string_view key;
+        reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (kKeyMap.find(key) != PRESETS) { reader.skipValue(); continue; }
+            reader.beginArray();
+            while (reader.nextElement()) {
+                loaded.emplace_back();
+                streamRead(reader, loaded.back());
+            }
+        }
+        libraryHits = indexAndSearch(loaded);
+    }, runs);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "" << std::setw(14) << "legacy" << std::setw(14) << "stream" << "speedup\n";
+    auto row = [](const char* label, double legacy, double stream) {
+        std::cout << std::left << std::setw(32) << label << std::setw(14) << legacy << std::setw(14) << stream
+                  << std::setprecision(1) << legacy / stream << "x" << std::setprecision(3) << "\n";
+    };
+    row("write presets (ms)", legacyWriteMs, streamWriteMs);
+    row("parse + index + search (ms)", legacyLoadMs, streamLoadMs);
+    std::cout << std::left << std::setw(32) << "library document (ms)" << std::setw(14) << "-" << libraryLoadMs
+              << "  (" << library.size() / 1024 << " KB)\n";
+
+    bool ok = legacyHits == streamHits && streamHits == libraryHits && streamHits > 0;
+    std::cout << (ok ? "\n✅ Bench complete" : "\n❌ Result mismatch") << std::endl;
+    return ok ? 0 : 1;
+}
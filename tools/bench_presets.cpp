@@ -0,0 +1,226 @@
+// tools/bench_presets.cpp - Preset bank save/load: PresetContainer vs ad-hoc streams
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_presets tools/bench_presets.cpp src/storage/presets/PresetContainer.cpp
+
+#include "../src/storage/presets/PresetContainer.h"
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+
+using Section = PresetContainer::SectionType;
+
+static constexpr int SLOTS = 16;
+static constexpr int PARAMS_PER_SLOT = 48;
+static constexpr size_t ENGINE_BLOB_BYTES = 256;
+
+struct BenchPreset {
+    std::string name;
+    std::string author;
+    std::map<int, float> slotParams[SLOTS];
+    std::vector<uint8_t> engineData;
+};
+
+static BenchPreset makePreset(int index) {
+    BenchPreset preset;
+    preset.name = "Preset " + std::to_string(index);
+    preset.author = "bench";
+    for (int s = 0; s < SLOTS; ++s) {
+        for (int p = 0; p < PARAMS_PER_SLOT; ++p) {
+            preset.slotParams[s][p] = static_cast<float>((index * 31 + s * 7 + p) % 1000) / 1000.0f;
+        }
+    }
+    preset.engineData.assign(ENGINE_BLOB_BYTES, static_cast<uint8_t>(index));
+    return preset;
+}
+
+// The previous approach: length-prefixed records built from std::map through streams
+static void legacySave(const std::vector<BenchPreset>& presets, const std::string& path) {
+    std::ofstream file(path, std::ios::binary);
+    uint32_t count = static_cast<uint32_t>(presets.size());
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& preset : presets) {
+        std::stringstream ss;
+        ss << preset.name << "|" << preset.author << "|";
+        for (int s = 0; s < SLOTS; ++s) {
+            for (const auto& entry : preset.slotParams[s]) ss << s << ":" << entry.first << "=" << entry.second << ";";
+        }
+        ss << "|";
+        ss.write(reinterpret_cast<const char*>(preset.engineData.data()), preset.engineData.size());
+        std::string record = ss.str();
+        uint32_t size = static_cast<uint32_t>(record.size());
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(record.data(), size);
+    }
+}
+
+static bool legacyParse(const std::string& record, BenchPreset& preset) {
+    size_t nameEnd = record.find('|');
+    size_t authorEnd = record.find('|', nameEnd + 1);
+    size_t paramsEnd = record.find('|', authorEnd + 1);
+    if (nameEnd == std::string::npos || authorEnd == std::string::npos || paramsEnd == std::string::npos) return false;
+    preset.name = record.substr(0, nameEnd);
+    preset.author = record.substr(nameEnd + 1, authorEnd - nameEnd - 1);
+    size_t pos = authorEnd + 1;
+    while (pos < paramsEnd) {
+        size_t colon = record.find(':', pos);
+        size_t equals = record.find('=', colon);
+        size_t semi = record.find(';', equals);
+        int slot = std::stoi(record.substr(pos, colon - pos));
+        int id = std::stoi(record.substr(colon + 1, equals - colon - 1));
+        preset.slotParams[slot][id] = std::stof(record.substr(equals + 1, semi - equals - 1));
+        pos = semi + 1;
+    }
+    preset.engineData.assign(record.begin() + paramsEnd + 1, record.end());
+    return true;
+}
+
+// Reads records up to (and including) the last one wanted; -1 reads all
+static size_t legacyLoad(const std::string& path, int only) {
+    std::ifstream file(path, std::ios::binary);
+    uint32_t count = 0;
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    size_t decoded = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        std::string record(size, '\0');
+        file.read(&record[0], size);
+        if (only >= 0 && static_cast<int>(i) != only) continue;
+        BenchPreset preset;
+        decoded += legacyParse(record, preset);
+        if (only >= 0) break;
+    }
+    return decoded;
+}
+
+static void containerSave(const std::vector<BenchPreset>& presets, const std::string& path) {
+    PresetContainerWriter bank;
+    std::vector<PresetParam> params;
+    for (size_t i = 0; i < presets.size(); ++i) {
+        const BenchPreset& preset = presets[i];
+        PresetContainerWriter writer;
+        writer.addText(Section::META, 0, {{"name", preset.name}, {"author", preset.author}});
+        writer.addRaw(Section::ENGINE_DATA, 0, preset.engineData.data(), preset.engineData.size());
+        for (int s = 0; s < SLOTS; ++s) {
+            params.clear();
+            for (const auto& entry : preset.slotParams[s]) params.push_back({static_cast<uint32_t>(entry.first), entry.second});
+            writer.addParams(Section::ENGINE_PARAMS, static_cast<uint32_t>(s), params);
+        }
+        bank.addContainer(Section::PRESET, static_cast<uint32_t>(i), writer);
+    }
+    bank.writeFile(path);
+}
+
+static bool containerDecode(const PresetContainer& bank, int position, BenchPreset& preset) {
+    PresetContainer container;
+    PresetContainer::TextFields fields;
+    if (!bank.openNested(position, container) || !container.readText(container.findSection(Section::META), fields)) {
+        return false;
+    }
+    preset.name = fields[0].second;
+    preset.author = fields[1].second;
+    for (int s = 0; s < SLOTS; ++s) {
+        const PresetParam* params = nullptr;
+        size_t count = 0;
+        if (!container.readParams(container.findSection(Section::ENGINE_PARAMS, s), params, count)) return false;
+        for (size_t p = 0; p < count; ++p) preset.slotParams[s][static_cast<int>(params[p].id)] = params[p].value;
+    }
+    const uint8_t* data = nullptr;
+    size_t bytes = 0;
+    if (!container.readRaw(container.findSection(Section::ENGINE_DATA), data, bytes)) return false;
+    preset.engineData.assign(data, data + bytes);
+    return true;
+}
+
+static size_t containerLoad(const std::string& path, int only) {
+    PresetContainer bank;
+    if (!bank.open(path)) return 0;
+    size_t decoded = 0;
+    if (only >= 0) {
+        BenchPreset preset;
+        return containerDecode(bank, bank.findSection(Section::PRESET, only), preset) ? 1 : 0;
+    }
+    for (size_t i = 0; i < bank.getSectionCount(); ++i) {
+        BenchPreset preset;
+        decoded += containerDecode(bank, static_cast<int>(i), preset);
+    }
+    return decoded;
+}
+
+template<typename Func>
+static double bestMs(Func func, int runs) {
+    double best = 1e30;
+    for (int r = 0; r < runs; ++r) {
+        auto start = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return best;
+}
+
+static long fileBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return static_cast<long>(file.tellg());
+}
+
+int main(int argc, char* argv[]) {
+    int presetCount = 1000;
+    int runs = 5;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--presets" && i + 1 < argc) {
+            presetCount = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Preset Bank Benchmark\n"
+                      << "Usage: " << argv[0] << " [--presets N] [--runs N]\n";
+            return 0;
+        }
+    }
+
+    std::vector<BenchPreset> presets;
+    presets.reserve(presetCount);
+    for (int i = 0; i < presetCount; ++i) presets.push_back(makePreset(i));
+
+    const std::string legacyPath = "/tmp/ether_bench_presets.legacy";
+    const std::string containerPath = "/tmp/ether_bench_presets.epc";
+    const int middle = presetCount / 2;
+
+    std::cout << "⚡ EtherSynth Preset Bank Benchmark" << std::endl;
+    std::cout << presetCount << " presets x " << SLOTS << " slots x " << PARAMS_PER_SLOT
+              << " params, best of " << runs << " runs\n" << std::endl;
+
+    double legacySaveMs = bestMs([&] { legacySave(presets, legacyPath); }, runs);
+    double containerSaveMs = bestMs([&] { containerSave(presets, containerPath); }, runs);
+    size_t legacyDecoded = 0, containerDecoded = 0;
+    double legacyLoadMs = bestMs([&] { legacyDecoded = legacyLoad(legacyPath, -1); }, runs);
+    double containerLoadMs = bestMs([&] { containerDecoded = containerLoad(containerPath, -1); }, runs);
+    double legacyOneMs = bestMs([&] { legacyLoad(legacyPath, middle); }, runs);
+    double containerOneMs = bestMs([&] { containerLoad(containerPath, middle); }, runs);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(28) << "" << std::setw(14) << "legacy" << std::setw(14) << "container" << "speedup\n";
+    auto row = [](const char* label, double legacy, double container) {
+        std::cout << std::left << std::setw(28) << label << std::setw(14) << legacy << std::setw(14) << container
+                  << std::setprecision(1) << legacy / container << "x" << std::setprecision(3) << "\n";
+    };
+    row("save bank (ms)", legacySaveMs, containerSaveMs);
+    row("load all presets (ms)", legacyLoadMs, containerLoadMs);
+    row("open + one preset (ms)", legacyOneMs, containerOneMs);
+    std::cout << std::left << std::setw(28) << "file size (KB)" << std::setw(14) << fileBytes(legacyPath) / 1024
+              << std::setw(14) << fileBytes(containerPath) / 1024 << "\n";
+
+    bool ok = legacyDecoded == static_cast<size_t>(presetCount) && containerDecoded == static_cast<size_t>(presetCount);
+    std::remove(legacyPath.c_str());
+    std::remove(containerPath.c_str());
+    std::cout << (ok ? "\n✅ Bench complete" : "\n❌ Decode mismatch") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// tools/bench_scene_morph.cpp - Scene morph cost per control block: string-keyed maps vs SceneMorphEngine plans
+// Compile: g++ -std=c++17 -O2 -Isrc -o bench_scene_morph tools/bench_scene_morph.cpp src/audio/SceneMorphEngine.cpp
+
+#include "../src/audio/SceneMorphEngine.h"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    using Morph = SceneMorphEngine;
+
+    // The PerformanceMacros::SceneSnapshot layout: parameters keyed by name per track
+    struct MapScene {
+        std::map<int, std::map<std::string, float>> trackParameters;
+        std::map<int, float> trackSends;
+    };
+
+    std::string paramName(int p) { return "param_" + std::to_string(p); }
+
+    void makeScenes(float offset, MapScene& mapScene, Morph::Scene& flatScene) {
+        for (int slot = 0; slot < Morph::MAX_SLOTS; ++slot) {
+            flatScene.slotTags[slot] = 0;
+            for (int p = 0; p < Morph::PARAM_COUNT; ++p) {
+                const float value = offset + 0.001f * (slot * Morph::PARAM_COUNT + p);
+                mapScene.trackParameters[slot][paramName(p)] = value;
+                flatScene.set(Morph::paramIndex(slot, static_cast<ParameterID>(p)), value);
+            }
+            mapScene.trackSends[slot] = offset;
+            flatScene.set(Morph::sendIndex(slot, 0), offset);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int blocks = 20000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--blocks" && i + 1 < argc) {
+            blocks = std::max(1, std::stoi(argv[++i]));
+        } else if (arg == "--help") {
+            std::cout << "EtherSynth Scene Morph Benchmark\n"
+                      << "Usage: " << argv[0] << " [--blocks N]\n";
+            return 0;
+        }
+    }
+
+    MapScene mapFrom, mapTo;
+    Morph::Scene flatFrom, flatTo;
+    makeScenes(0.0f, mapFrom, flatFrom);
+    makeScenes(0.5f, mapTo, flatTo);
+    const int values = Morph::MAX_SLOTS * (Morph::PARAM_COUNT + 1);
+
+    std::cout << "⚡ EtherSynth Scene Morph Benchmark" << std::endl;
+    std::cout << blocks << " blocks, knob moving every block, " << values << " values per morph\n" << std::endl;
+
+    // Map walk: find every name in both scenes, lerp, write into an output map
+    std::vector<float> sink(Morph::VALUE_COUNT);
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < blocks; ++b) {
+        const float position = (b % 1000) / 999.0f;
+        for (const auto& track : mapFrom.trackParameters) {
+            const auto& toTrack = mapTo.trackParameters.at(track.first);
+            for (int p = 0; p < Morph::PARAM_COUNT; ++p) {
+                const std::string name = paramName(p);
+                const float from = track.second.at(name), to = toTrack.at(name);
+                sink[Morph::paramIndex(track.first, static_cast<ParameterID>(p))] = from + (to - from) * position;
+            }
+            const float from = mapFrom.trackSends.at(track.first), to = mapTo.trackSends.at(track.first);
+            sink[Morph::sendIndex(track.first, 0)] = from + (to - from) * position;
+        }
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    // Dense plan: compiled once, then one lerp and an index walk per block
+    Morph engine;
+    engine.setMorph(engine.storeScene(flatFrom), engine.storeScene(flatTo));
+    double checksum = 0.0;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < blocks; ++b) {
+        engine.setPosition((b % 1000) / 999.0f);
+        const int count = engine.process(BUFFER_SIZE, 48000.0f);
+        const uint16_t* indices = engine.getChangedIndices();
+        for (int n = 0; n < count; ++n) sink[indices[n]] = engine.getValues()[indices[n]];
+        checksum += sink[0];
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    const double mapUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / blocks;
+    const double flatUs = std::chrono::duration<double, std::micro>(t3 - t2).count() / blocks;
+    const double blockUs = BUFFER_SIZE / 48000.0 * 1e6;
+    std::cout << std::fixed << std::setprecision(3)
+              << "Map walk:    " << mapUs << " us/block (" << mapUs / blockUs * 100.0 << "% of a block)\n"
+              << "Dense plan:  " << flatUs << " us/block (" << flatUs / blockUs * 100.0 << "% of a block)\n"
+              << std::setprecision(1) << "Speedup:     " << mapUs / flatUs << "x" << std::endl;
+    if (checksum < 0.0) std::cout << checksum << std::endl;   // Keep the loop alive
+
+    std::cout << "\n✅ Bench complete" << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+// tools/make_wavetable_bank.cpp - Build a mip-mapped .ewtb wavetable bank offline
+// Compile: g++ -std=c++17 -O2 -Isrc -o make_wavetable_bank tools/make_wavetable_bank.cpp src/audio/WavetableBank.cpp src/audio/FFT.cpp
+//
+// Usage: make_wavetable_bank [output.ewtb] [--cycles tables.f32 cycleSize]
+//   Without --cycles the factory tables are written. A cycles file holds raw
+//   float32 single cycles of cycleSize samples each, back to back.
+//   Engines load data/wavetables/factory.ewtb (or $ETHER_WAVETABLE_BANK).
+
+#include "../src/audio/WavetableBank.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool readCycles(const std::string& path, int cycleSize, std::vector<float>& cycles) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    std::fseek(file, 0, SEEK_END);
+    long bytes = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    size_t count = bytes > 0 ? static_cast<size_t>(bytes) / sizeof(float) : 0;
+    cycles.resize(count - count % static_cast<size_t>(cycleSize));
+    bool ok = !cycles.empty() && std::fread(cycles.data(), sizeof(float), cycles.size(), file) == cycles.size();
+    std::fclose(file);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    std::string output = WavetableBank::DEFAULT_PATH;
+    std::string cyclesPath;
+    int cycleSize = WavetableBank::TABLE_SIZE;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cycles" && i + 2 < argc) {
+            cyclesPath = argv[++i];
+            cycleSize = std::atoi(argv[++i]);
+        } else {
+            output = arg;
+        }
+    }
+
+    WavetableBank bank;
+    auto buildStart = std::chrono::steady_clock::now();
+    bool built = false;
+    if (cyclesPath.empty()) {
+        built = bank.buildFactory();
+    } else {
+        std::vector<float> cycles;
+        if (!readCycles(cyclesPath, cycleSize, cycles)) {
+            std::cerr << "Cannot read single cycles from " << cyclesPath << std::endl;
+            return 1;
+        }
+        built = bank.build(cycles.data(), static_cast<int>(cycles.size() / cycleSize), cycleSize);
+    }
+    double buildMs = elapsedMs(buildStart);
+    if (!built) {
+        std::cerr << "Build failed (cycle size must be a power of two, at most "
+                  << WavetableBank::MAX_TABLES << " tables)" << std::endl;
+        return 1;
+    }
+
+    if (!bank.save(output)) {
+        std::cerr << "Cannot write " << output << std::endl;
+        return 1;
+    }
+
+    WavetableBank loaded;
+    auto loadStart = std::chrono::steady_clock::now();
+    bool ok = loaded.load(output);
+    double loadMs = elapsedMs(loadStart);
+
+    std::cout << "Wrote " << output << ": " << bank.getTableCount() << " tables x "
+              << bank.getLevelCount() << " mip levels" << std::endl;
+    std::cout << "Build (FFT): " << buildMs << " ms, load (" << (loaded.isMapped() ? "mmap" : "read")
+              << "): " << loadMs << " ms" << std::endl;
+    return ok ? 0 : 1;
+}